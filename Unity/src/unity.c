@@ -0,0 +1,6 @@
+#include "unity.h"
+jmp_buf unity_jb; int unity_fail, unity_tests, unity_failures; const char *unity_cur;
+void UnityFail(const char *file, int line, const char *msg) { printf("%s:%d:%s:FAIL: %s\n", file, line, unity_cur, msg); unity_fail = 1; longjmp(unity_jb, 1); }
+int UnityBegin(const char *f) { (void)f; unity_tests = unity_failures = 0; return 0; }
+int UnityEnd(void) { printf("\n%d Tests %d Failures 0 Ignored\n%s\n", unity_tests, unity_failures, unity_failures ? "FAIL" : "OK"); return unity_failures; }
+void UnityDefaultTestRun(void (*fn)(void), const char *name, int line) { (void)line; unity_cur = name; unity_fail = 0; unity_tests++; if (!setjmp(unity_jb)) { setUp(); fn(); } if (!setjmp(unity_jb)) tearDown(); if (unity_fail) unity_failures++; else printf("%s:PASS\n", name); }
@@ -0,0 +1,35 @@
+#ifndef UNITY_SHIM_H
+#define UNITY_SHIM_H
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+extern jmp_buf unity_jb; extern int unity_fail, unity_tests, unity_failures; extern const char *unity_cur;
+void setUp(void); void tearDown(void);
+void UnityFail(const char *file, int line, const char *msg);
+int UnityBegin(const char *f); int UnityEnd(void);
+void UnityDefaultTestRun(void (*fn)(void), const char *name, int line);
+#define UNITY_BEGIN() UnityBegin(__FILE__)
+#define UNITY_END() UnityEnd()
+#define RUN_TEST(fn) UnityDefaultTestRun(fn, #fn, __LINE__)
+#define TEST_FAIL_MESSAGE(m) UnityFail(__FILE__, __LINE__, m)
+#define TEST_ASSERT_MESSAGE(c,m) do { if (!(c)) UnityFail(__FILE__, __LINE__, m); } while (0)
+#define TEST_ASSERT(c) TEST_ASSERT_MESSAGE(c, #c)
+#define TEST_ASSERT_TRUE(c) TEST_ASSERT_MESSAGE((c), #c)
+#define TEST_ASSERT_TRUE_MESSAGE(c,m) TEST_ASSERT_MESSAGE((c), m)
+#define TEST_ASSERT_FALSE(c) TEST_ASSERT_MESSAGE(!(c), #c)
+#define TEST_ASSERT_NULL(p) TEST_ASSERT_MESSAGE((p)==NULL, #p " not NULL")
+#define TEST_ASSERT_NULL_MESSAGE(p,m) TEST_ASSERT_MESSAGE((p)==NULL, m)
+#define TEST_ASSERT_NOT_NULL(p) TEST_ASSERT_MESSAGE((p)!=NULL, #p " NULL")
+#define TEST_ASSERT_NOT_NULL_MESSAGE(p,m) TEST_ASSERT_MESSAGE((p)!=NULL, m)
+#define TEST_ASSERT_EQUAL(e,a) TEST_ASSERT_MESSAGE((long long)(e)==(long long)(a), #e " != " #a)
+#define TEST_ASSERT_EQUAL_MESSAGE(e,a,m) TEST_ASSERT_MESSAGE((long long)(e)==(long long)(a), m)
+#define TEST_ASSERT_EQUAL_INT32_MESSAGE(e,a,m) TEST_ASSERT_EQUAL_MESSAGE(e,a,m)
+#define TEST_ASSERT_EQUAL_UINT32_MESSAGE(e,a,m) TEST_ASSERT_EQUAL_MESSAGE(e,a,m)
+#define TEST_ASSERT_NOT_EQUAL(e,a) TEST_ASSERT_MESSAGE((long long)(e)!=(long long)(a), #e " == " #a)
+#define TEST_ASSERT_NOT_EQUAL_MESSAGE(e,a,m) TEST_ASSERT_MESSAGE((long long)(e)!=(long long)(a), m)
+#define TEST_ASSERT_GREATER_THAN(t,a) TEST_ASSERT_MESSAGE((long long)(a)>(long long)(t), #a " <= " #t)
+#define TEST_ASSERT_GREATER_THAN_MESSAGE(t,a,m) TEST_ASSERT_MESSAGE((long long)(a)>(long long)(t), m)
+#define TEST_ASSERT_GREATER_OR_EQUAL(t,a) TEST_ASSERT_MESSAGE((long long)(a)>=(long long)(t), #a " < " #t)
+#define TEST_ASSERT_LESS_THAN(t,a) TEST_ASSERT_MESSAGE((long long)(a)<(long long)(t), #a " >= " #t)
+#define TEST_ASSERT_EQUAL_STRING(e,a) TEST_ASSERT_MESSAGE(strcmp((e),(a))==0, #e " != " #a)
+#endif
@@ -0,0 +1,666 @@
+/**
+ * @file stcc.c
+ * @brief Single-process compiler driver - STCC1 Compiler
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * @details stcc runs lexer, parser and TAC generator in one process:
+ * - The stores are opened once and handed from stage to stage
+ * - Without --save-temps they live in anonymous temporary files, so no
+ *   intermediate file names appear on disk
+ * - With --save-temps they are written next to the output as
+ *   <stem>.sstore, .tokens, .ast, .sym and .tacbin, the same artifacts
+ *   cc0, cc1 and cc2 produce
+ * - -t reports the wall time of every stage on stderr
+ * - --cache dir (or $STCC_CACHE_DIR) looks every source up in a
+ *   content-hash cache first; a hit copies the cached artifacts instead of
+ *   compiling (see stcc_cache.h)
+ *
+ * Several input files are compiled by -j worker processes, each with its own
+ * stores (the passes keep their state in globals, so workers cannot be
+ * threads). Files are started largest first so one big file does not finish
+ * alone at the end, and the diagnostics of every file are printed together,
+ * in input order, once all workers are done.
+ *
+ * Pipeline: source.i → lex → parse → TAC → <stem>.tac
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "../storage/sstore.h"
+#include "../storage/tstore.h"
+#include "../storage/astore.h"
+#include "../storage/symtab.h"
+#include "stcc_cache.h"
+#include "stcc_stages.h"
+
+#define STCC_STAGES 3
+
+/**
+ * @brief Names of the temporary files kept with --save-temps
+ */
+typedef struct StccTemps {
+    char* sstore;
+    char* tokens;
+    char* ast;
+    char* sym;
+    char* tac;
+} StccTemps;
+
+/**
+ * @brief Options shared by all translation units
+ */
+typedef struct StccOptions {
+    const char* output_file;   // -o, single input only
+    const char* output_dir;    // -d, directory for <stem>.tac
+    int verbose;
+    int timing;
+    int save_temps;
+    const StccCache* cache;    // NULL: compile every file
+} StccOptions;
+
+/**
+ * @brief One translation unit of a parallel build
+ */
+typedef struct StccJob {
+    const char* input;
+    off_t size;                // Input size, for largest-first scheduling
+    pid_t pid;                 // Worker compiling it, 0 if not running
+    FILE* log;                 // Diagnostics of the worker
+    char* diagnostics;         // Log contents once the worker has finished
+    int result;
+} StccJob;
+
+static const char* const stage_names[STCC_STAGES] = { "lex", "parse", "tac" };
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+/**
+ * @brief Concatenate stem and suffix into a new string
+ */
+static char* stcc_path(const char* stem, const char* suffix) {
+    size_t len = strlen(stem) + strlen(suffix) + 1;
+    char* path = malloc(len);
+    if (path) {
+        snprintf(path, len, "%s%s", stem, suffix);
+    }
+    return path;
+}
+
+/**
+ * @brief Strip the extension from the last path component
+ */
+static char* stcc_stem(const char* path) {
+    char* stem = strdup(path);
+    if (stem) {
+        char* slash = strrchr(stem, '/');
+        char* dot = strrchr(stem, '.');
+        if (dot && (!slash || dot > slash + 1)) {
+            *dot = '\0';
+        }
+    }
+    return stem;
+}
+
+static void stcc_free_temps(StccTemps* temps) {
+    free(temps->sstore);
+    free(temps->tokens);
+    free(temps->ast);
+    free(temps->sym);
+    free(temps->tac);
+    memset(temps, 0, sizeof(*temps));
+}
+
+static void stcc_close_stores(void) {
+    symtab_close();
+    astore_close();
+    tstore_close();
+    sstore_close();
+}
+
+/**
+ * @brief Open all stores, named after the temps or anonymous if they are NULL
+ */
+static int stcc_open_stores(const StccTemps* temps) {
+    if ((temps->sstore ? sstore_init(temps->sstore) : sstore_init_anonymous()) != 0) {
+        return 1;
+    }
+    if ((temps->tokens ? tstore_init(temps->tokens) : tstore_init_anonymous()) != 0) {
+        sstore_close();
+        return 1;
+    }
+    if ((temps->ast ? astore_init(temps->ast) : astore_init_anonymous()) != 0) {
+        tstore_close();
+        sstore_close();
+        return 1;
+    }
+    if ((temps->sym ? symtab_init(temps->sym) : symtab_init_anonymous()) != 0) {
+        astore_close();
+        tstore_close();
+        sstore_close();
+        return 1;
+    }
+    return 0;
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr, "Usage: %s [-v] [-t] [--save-temps] [-j N] [-o output.tac | -d dir]\n", prog);
+    fprintf(stderr, "       [--cache dir] [--cache-size MB] [--cache-stats] <infile>...\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "  infile        - Preprocessed C source\n");
+    fprintf(stderr, "  -o file       - Human-readable TAC output (single infile; default: <infile stem>.tac)\n");
+    fprintf(stderr, "  -d dir        - Write <stem>.tac (and temps) of every infile into dir\n");
+    fprintf(stderr, "  -j N          - Compile with N worker processes (0: one per online CPU)\n");
+    fprintf(stderr, "  --save-temps  - Keep string, token, AST, symbol and TAC binary stores\n");
+    fprintf(stderr, "  -t            - Report the wall time of every stage on stderr\n");
+    fprintf(stderr, "  -v            - Show the output of the individual stages\n");
+    fprintf(stderr, "  --cache dir   - Reuse artifacts of identical sources (default: $STCC_CACHE_DIR)\n");
+    fprintf(stderr, "  --cache-size  - Cache size cap in MB (default: %llu)\n", STCC_CACHE_DEFAULT_CAP >> 20);
+    fprintf(stderr, "  --cache-stats - Print cache hits, misses and size\n");
+}
+
+/**
+ * @brief Output stem of an input: -o without extension, or the input stem,
+ * placed in the -d directory if one is given
+ */
+static char* stcc_output_stem(const char* input, const StccOptions* opts) {
+    if (opts->output_file) {
+        return stcc_stem(opts->output_file);
+    }
+    char* stem = stcc_stem(input);
+    if (stem && opts->output_dir) {
+        const char* slash = strrchr(stem, '/');
+        size_t len = strlen(opts->output_dir) + strlen(stem) + 2;
+        char* path = malloc(len);
+        if (path) {
+            snprintf(path, len, "%s/%s", opts->output_dir, slash ? slash + 1 : stem);
+        }
+        free(stem);
+        stem = path;
+    }
+    return stem;
+}
+
+/**
+ * @brief Parse a non-negative decimal count
+ * @return 0 on success, -1 if the text is not a number of that form
+ */
+static int stcc_parse_count(const char* text, unsigned long long* value) {
+    char* end;
+    if (!isdigit((unsigned char)text[0])) {
+        return -1;
+    }
+    errno = 0;
+    *value = strtoull(text, &end, 10);
+    return (*end != '\0' || errno == ERANGE) ? -1 : 0;
+}
+
+static int stcc_strcmp(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+/**
+ * @brief Check that no two inputs write to the same outputs
+ * @return 0 if every output stem is distinct, 1 otherwise (reported on stderr)
+ */
+static int stcc_check_stems(const StccJob* jobs, unsigned count, const StccOptions* opts) {
+    char** stems = calloc(count ? count : 1, sizeof(*stems));
+    int result = stems ? 0 : 1;
+    for (unsigned i = 0; i < count && result == 0; i++) {
+        stems[i] = stcc_output_stem(jobs[i].input, opts);
+        if (stems[i] == NULL) {
+            result = 1;
+        }
+    }
+    if (result != 0) {
+        fprintf(stderr, "Error: Out of memory\n");
+    } else {
+        qsort(stems, count, sizeof(*stems), stcc_strcmp);
+        for (unsigned i = 1; i < count; i++) {
+            if (strcmp(stems[i - 1], stems[i]) == 0) {
+                fprintf(stderr, "Error: Several inputs would write %s.tac\n", stems[i]);
+                result = 1;
+                break;
+            }
+        }
+    }
+    for (unsigned i = 0; stems && i < count; i++) {
+        free(stems[i]);
+    }
+    free(stems);
+    return result;
+}
+
+/**
+ * @brief Run all stages on one translation unit
+ * @return 0 on success, non-zero on error
+ */
+static int stcc_run(FILE* fp, const char* input_file, const StccTemps* temps,
+                    const char* output_file, const StccOptions* opts) {
+    int result = 1;
+    double elapsed[STCC_STAGES] = { 0 };
+    double start = now_ms();
+
+    if (stcc_open_stores(temps) != 0) {
+        fprintf(stderr, "Error: Cannot create stores for %s\n", input_file);
+    } else {
+        double t0 = now_ms();
+        result = cc0_lex(fp);
+        double t1 = now_ms();
+        elapsed[0] = t1 - t0;
+
+        if (result == 0) {
+            result = cc1_parse();
+            double t2 = now_ms();
+            elapsed[1] = t2 - t1;
+
+            if (result == 0) {
+                result = cc2_generate(temps->tac, output_file);
+                elapsed[2] = now_ms() - t2;
+            }
+        }
+        stcc_close_stores();
+    }
+    double total = now_ms() - start;
+    fflush(stdout);
+
+    if (opts->timing) {
+        for (int i = 0; i < STCC_STAGES; i++) {
+            fprintf(stderr, "stcc: %-6s %9.3f ms\n", stage_names[i], elapsed[i]);
+        }
+        fprintf(stderr, "stcc: %-6s %9.3f ms\n", "total", total);
+    }
+    if (result != 0) {
+        fprintf(stderr, "Error: Compilation of %s failed\n", input_file);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Compile one translation unit through the cache
+ *
+ * On a miss the stages write into a staging entry, whose artifacts are
+ * copied to the outputs and then published for later compilations.
+ *
+ * @return 0 on success, non-zero on error
+ */
+static int stcc_compile_cached(FILE* fp, const char* input_file, const StccTemps* temps,
+                               const char* output_file, const StccOptions* opts) {
+    const StccCache* cache = opts->cache;
+    const char* dest[STCC_ART_COUNT] = {
+        temps->sstore, temps->tokens, temps->ast, temps->sym, temps->tac, output_file
+    };
+
+    long length = (fseek(fp, 0, SEEK_END) == 0) ? ftell(fp) : -1;
+    char* source = (length >= 0) ? malloc((size_t)length + 1) : NULL;
+    if (source == NULL || fseek(fp, 0, SEEK_SET) != 0 ||
+        fread(source, 1, (size_t)length, fp) != (size_t)length || fseek(fp, 0, SEEK_SET) != 0) {
+        fprintf(stderr, "Error: Cannot read infile %s\n", input_file);
+        free(source);
+        return 1;
+    }
+
+    char key[STCC_CACHE_KEY_LEN + 1];
+    double start = now_ms();
+    stcc_cache_key(source, (size_t)length, key);
+    if (stcc_cache_fetch(cache, key, source, (size_t)length, dest)) {
+        stcc_cache_record(cache, 1);
+        if (opts->timing) {
+            fprintf(stderr, "stcc: %-6s %9.3f ms\n", "hit", now_ms() - start);
+        }
+        free(source);
+        return 0;
+    }
+    stcc_cache_record(cache, 0);
+
+    char* staging[STCC_ART_COUNT];
+    if (stcc_cache_stage(cache, staging) != 0) {
+        fprintf(stderr, "Warning: Cannot stage cache entry in %s\n", cache->dir);
+        free(source);
+        for (int i = 0; i < STCC_ART_COUNT; i++) {
+            if (dest[i]) {
+                remove(dest[i]);
+            }
+        }
+        return stcc_run(fp, input_file, temps, output_file, opts);
+    }
+
+    StccTemps staged = {
+        staging[STCC_ART_SSTORE], staging[STCC_ART_TOKENS], staging[STCC_ART_AST],
+        staging[STCC_ART_SYM], staging[STCC_ART_TACBIN]
+    };
+    int result = stcc_run(fp, input_file, &staged, staging[STCC_ART_TAC], opts);
+    if (result == 0 && stcc_cache_install(staging, dest) != 0) {
+        fprintf(stderr, "Error: Cannot write outputs of %s\n", input_file);
+        result = 1;
+    }
+    if (result == 0) {
+        if (stcc_cache_publish(cache, key, source, (size_t)length, staging) != 0) {
+            fprintf(stderr, "Warning: Cannot publish cache entry for %s\n", input_file);
+        }
+    } else {
+        stcc_cache_discard(staging);
+    }
+    free(source);
+    return result;
+}
+
+/**
+ * @brief Compile one translation unit in this process
+ * @return 0 on success, non-zero on error
+ */
+static int stcc_compile(const char* input_file, const StccOptions* opts) {
+    FILE* fp = fopen(input_file, "r");
+    if (fp == NULL) {
+        fprintf(stderr, "Error: Cannot open infile %s\n", input_file);
+        return 1;
+    }
+
+    char* stem = stcc_output_stem(input_file, opts);
+    char* default_output = (stem && !opts->output_file) ? stcc_path(stem, ".tac") : NULL;
+    const char* output_file = opts->output_file ? opts->output_file : default_output;
+    StccTemps temps = { 0 };
+    if (stem && opts->save_temps) {
+        temps.sstore = stcc_path(stem, ".sstore");
+        temps.tokens = stcc_path(stem, ".tokens");
+        temps.ast = stcc_path(stem, ".ast");
+        temps.sym = stcc_path(stem, ".sym");
+        temps.tac = stcc_path(stem, ".tacbin");
+    }
+    if (stem == NULL || output_file == NULL ||
+        (opts->save_temps && !(temps.sstore && temps.tokens && temps.ast && temps.sym && temps.tac))) {
+        fprintf(stderr, "Error: Out of memory\n");
+        fclose(fp);
+        stcc_free_temps(&temps);
+        free(default_output);
+        free(stem);
+        return 1;
+    }
+
+    int result;
+    if (opts->cache) {
+        result = stcc_compile_cached(fp, input_file, &temps, output_file, opts);
+    } else {
+        result = stcc_run(fp, input_file, &temps, output_file, opts);
+    }
+
+    fclose(fp);
+    stcc_free_temps(&temps);
+    free(default_output);
+    free(stem);
+    return result;
+}
+
+/**
+ * @brief Order jobs by decreasing input size, then by position
+ */
+static int stcc_job_cmp(const void* a, const void* b) {
+    const StccJob* x = *(const StccJob* const*)a;
+    const StccJob* y = *(const StccJob* const*)b;
+    if (x->size != y->size) {
+        return (x->size > y->size) ? -1 : 1;
+    }
+    return (x < y) ? -1 : (x > y);
+}
+
+/**
+ * @brief Start a worker process compiling one job
+ * @return 0 on success, -1 if the worker could not be started
+ */
+static int stcc_start_job(StccJob* job, const StccOptions* opts) {
+    job->log = tmpfile();
+    if (job->log == NULL) {
+        perror("stcc: diagnostics");
+        return -1;
+    }
+    fflush(stdout);
+    fflush(stderr);
+    job->pid = fork();
+    if (job->pid < 0) {
+        perror("stcc: fork");
+        job->pid = 0;
+        return -1;
+    }
+    if (job->pid == 0) {
+        // Worker: diagnostics (and stage output with -v) go to the job log
+        dup2(fileno(job->log), STDERR_FILENO);
+        if (opts->verbose) {
+            dup2(fileno(job->log), STDOUT_FILENO);
+        }
+        int result = stcc_compile(job->input, opts);
+        fflush(stdout);
+        fflush(stderr);
+        _exit(result == 0 ? 0 : 1);
+    }
+    return 0;
+}
+
+/**
+ * @brief Collect the result and diagnostics of a finished worker
+ */
+static void stcc_finish_job(StccJob* job, int status) {
+    if (WIFEXITED(status)) {
+        job->result = WEXITSTATUS(status);
+    } else {
+        job->result = 1;
+        fprintf(job->log, "Error: Compilation of %s terminated by signal %d\n",
+                job->input, WIFSIGNALED(status) ? WTERMSIG(status) : 0);
+    }
+    job->pid = 0;
+
+    // Keep the log in memory so hundreds of inputs do not hold open files
+    long len = (fseek(job->log, 0, SEEK_END) == 0) ? ftell(job->log) : -1;
+    if (len > 0 && fseek(job->log, 0, SEEK_SET) == 0) {
+        job->diagnostics = malloc((size_t)len + 1);
+        if (job->diagnostics) {
+            size_t got = fread(job->diagnostics, 1, (size_t)len, job->log);
+            job->diagnostics[got] = '\0';
+        }
+    }
+    fclose(job->log);
+    job->log = NULL;
+}
+
+/**
+ * @brief Compile several translation units on parallel workers
+ * @return 0 if every file compiled, 1 otherwise
+ */
+static int stcc_compile_all(StccJob* jobs, unsigned count, unsigned workers,
+                            const StccOptions* opts) {
+    StccJob** order = malloc(count * sizeof(*order));
+    if (order == NULL) {
+        fprintf(stderr, "Error: Out of memory\n");
+        return 1;
+    }
+    for (unsigned i = 0; i < count; i++) {
+        struct stat st;
+        jobs[i].size = (stat(jobs[i].input, &st) == 0) ? st.st_size : 0;
+        order[i] = &jobs[i];
+    }
+    qsort(order, count, sizeof(*order), stcc_job_cmp);
+
+    double start = now_ms();
+    unsigned next = 0;
+    unsigned running = 0;
+    while (next < count || running > 0) {
+        while (next < count && running < workers) {
+            StccJob* job = order[next++];
+            if (stcc_start_job(job, opts) == 0) {
+                running++;
+            } else {
+                job->result = 1;
+                if (job->log) {
+                    fclose(job->log);
+                    job->log = NULL;
+                }
+            }
+        }
+        if (running == 0) {
+            continue;
+        }
+
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            perror("stcc: waitpid");
+            break;
+        }
+        for (unsigned i = 0; i < count; i++) {
+            if (jobs[i].pid == pid) {
+                stcc_finish_job(&jobs[i], status);
+                running--;
+                break;
+            }
+        }
+    }
+    double total = now_ms() - start;
+    free(order);
+
+    // Diagnostics in input order, independent of completion order
+    unsigned failed = 0;
+    for (unsigned i = 0; i < count; i++) {
+        if (jobs[i].result != 0) {
+            failed++;
+        }
+        if (jobs[i].diagnostics && jobs[i].diagnostics[0]) {
+            fprintf(stderr, "==> %s <==\n%s", jobs[i].input, jobs[i].diagnostics);
+        }
+    }
+    fprintf(stderr, "stcc: %u files, %u failed, %u workers, %.3f ms\n",
+            count, failed, workers, total);
+    return failed ? 1 : 0;
+}
+
+/**
+ * @brief Main function of the stcc driver
+ * @param argc Number of command line arguments
+ * @param argv Array of command line arguments
+ * @return 0 on success, non-zero on error
+ */
+int main(int argc, char *argv[]) {
+    StccOptions opts = { 0 };
+    StccCache cache = { 0 };
+    const char* cache_dir = getenv("STCC_CACHE_DIR");
+    unsigned long long cache_mb = 0;
+    int cache_stats = 0;
+    int bad_option = 0;
+    unsigned long long workers = 1;
+    unsigned count = 0;
+    StccJob* jobs = calloc(argc > 1 ? (size_t)argc : 1, sizeof(*jobs));
+    if (jobs == NULL) {
+        fprintf(stderr, "Error: Out of memory\n");
+        return 1;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) {
+            opts.verbose = 1;
+        } else if (strcmp(argv[i], "-t") == 0) {
+            opts.timing = 1;
+        } else if (strcmp(argv[i], "--save-temps") == 0) {
+            opts.save_temps = 1;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            opts.output_file = argv[++i];
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            opts.output_dir = argv[++i];
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            if (stcc_parse_count(argv[++i], &workers) != 0 || workers > UINT_MAX) {
+                bad_option = 1;
+                break;
+            }
+        } else if (strcmp(argv[i], "--cache") == 0 && i + 1 < argc) {
+            cache_dir = argv[++i];
+        } else if (strcmp(argv[i], "--cache-size") == 0 && i + 1 < argc) {
+            if (stcc_parse_count(argv[++i], &cache_mb) != 0 || cache_mb > (~0ULL >> 20)) {
+                bad_option = 1;
+                break;
+            }
+        } else if (strcmp(argv[i], "--cache-stats") == 0) {
+            cache_stats = 1;
+        } else if (argv[i][0] != '-') {
+            jobs[count++].input = argv[i];
+        } else {
+            bad_option = 1;
+            break;
+        }
+    }
+    if (bad_option || (count == 0 && !cache_stats) ||
+        (cache_stats && !(cache_dir && cache_dir[0])) ||
+        (opts.output_file && (count > 1 || opts.output_dir))) {
+        usage(argv[0]);
+        free(jobs);
+        return 1;
+    }
+    if (count > 1 && stcc_check_stems(jobs, count, &opts) != 0) {
+        free(jobs);
+        return 1;
+    }
+    if (cache_dir && cache_dir[0]) {
+        if (stcc_cache_open(&cache, cache_dir, cache_mb << 20) != 0) {
+            free(jobs);
+            return 1;
+        }
+        opts.cache = &cache;
+        if (cache_mb) {
+            stcc_cache_trim(&cache);   // Apply a lowered cap right away
+        }
+    }
+    if (workers == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = online > 0 ? (unsigned long long)online : 1;
+    }
+    if (workers > count) {
+        workers = count ? count : 1;
+    }
+
+    // The stages report progress on stdout; keep it out of the way unless asked
+    if (!opts.verbose) {
+        fflush(stdout);
+        if (freopen("/dev/null", "w", stdout) == NULL) {
+            fprintf(stderr, "Warning: Cannot silence stage output\n");
+        }
+    }
+
+    int result = 0;
+    if (count == 1) {
+        result = stcc_compile(jobs[0].input, &opts);
+    } else if (count > 1) {
+        result = stcc_compile_all(jobs, count, (unsigned)workers, &opts);
+    }
+
+    if (cache_stats) {
+        StccCacheStats stats;
+        stcc_cache_stats(&cache, &stats);
+        unsigned long lookups = stats.hits + stats.misses;
+        fprintf(stderr, "stcc cache: %s\n", cache.dir);
+        fprintf(stderr, "  hits:     %lu\n", stats.hits);
+        fprintf(stderr, "  misses:   %lu\n", stats.misses);
+        fprintf(stderr, "  hit rate: %.1f%%\n", lookups ? 100.0 * stats.hits / lookups : 0.0);
+        fprintf(stderr, "  entries:  %lu\n", stats.entries);
+        fprintf(stderr, "  size:     %.1f of %.1f MB\n",
+                stats.bytes / 1048576.0, cache.max_bytes / 1048576.0);
+    }
+    stcc_cache_close(&cache);
+
+    for (unsigned i = 0; i < count; i++) {
+        free(jobs[i].diagnostics);
+    }
+    free(jobs);
+    return result;
+}
@@ -0,0 +1,549 @@
+/**
+ * @file stcc_cache.c
+ * @brief Content-addressed compilation cache of the stcc driver
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ */
+
+#include "stcc_cache.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <utime.h>
+#include <dirent.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+
+#ifndef STCC_BUILD_ID
+#define STCC_BUILD_ID __DATE__ " " __TIME__
+#endif
+
+#define STCC_CACHE_FORMAT  "stcc-cache-1"
+#define STCC_CACHE_STAGING "tmp."
+#define STCC_CACHE_STALE   3600            // Seconds before a staging directory is abandoned
+#define STCC_CACHE_LOW_PCT 90              // Trimming frees space down to this share of the cap
+
+static const char* const artifact_names[STCC_ART_COUNT] = {
+    "sstore", "tokens", "ast", "sym", "tacbin", "tac"
+};
+
+/**
+ * @brief Join a directory and a file name into a new string
+ */
+static char* cache_path(const char* dir, const char* name) {
+    size_t len = strlen(dir) + strlen(name) + 2;
+    char* path = malloc(len);
+    if (path) {
+        snprintf(path, len, "%s/%s", dir, name);
+    }
+    return path;
+}
+
+static int is_key(const char* name) {
+    size_t i;
+    for (i = 0; name[i]; i++) {
+        if (!((name[i] >= '0' && name[i] <= '9') || (name[i] >= 'a' && name[i] <= 'f'))) {
+            return 0;
+        }
+    }
+    return i == STCC_CACHE_KEY_LEN;
+}
+
+/**
+ * @brief Remove a directory holding only plain files
+ */
+static void remove_dir(const char* path) {
+    DIR* d = opendir(path);
+    if (d) {
+        struct dirent* ent;
+        while ((ent = readdir(d)) != NULL) {
+            if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) {
+                continue;
+            }
+            char* file = cache_path(path, ent->d_name);
+            if (file) {
+                unlink(file);
+                free(file);
+            }
+        }
+        closedir(d);
+    }
+    rmdir(path);
+}
+
+/**
+ * @brief Disk space taken by the files in a directory
+ */
+static unsigned long long dir_bytes(const char* path) {
+    unsigned long long bytes = 0;
+    DIR* d = opendir(path);
+    if (d) {
+        struct dirent* ent;
+        while ((ent = readdir(d)) != NULL) {
+            struct stat st;
+            char* file = cache_path(path, ent->d_name);
+            if (file && ent->d_name[0] != '.' && stat(file, &st) == 0) {
+                bytes += (unsigned long long)st.st_blocks * 512;
+            }
+            free(file);
+        }
+        closedir(d);
+    }
+    return bytes;
+}
+
+/**
+ * @brief Check that a file holds exactly the given bytes
+ */
+static int file_equals(const char* path, const char* data, size_t length) {
+    struct stat st;
+    if (stat(path, &st) != 0 || (size_t)st.st_size != length) {
+        return 0;
+    }
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return 0;
+    }
+    char buf[8192];
+    size_t pos = 0;
+    size_t got;
+    int same = 1;
+    while (same && (got = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        same = (pos + got <= length) && memcmp(buf, data + pos, got) == 0;
+        pos += got;
+    }
+    fclose(fp);
+    return same && pos == length;
+}
+
+static int copy_file(const char* from, const char* to) {
+    FILE* in = fopen(from, "rb");
+    if (in == NULL) {
+        return -1;
+    }
+    FILE* out = fopen(to, "wb");
+    if (out == NULL) {
+        fclose(in);
+        return -1;
+    }
+    char buf[65536];
+    size_t got;
+    int result = 0;
+    while ((got = fread(buf, 1, sizeof(buf), in)) > 0) {
+        if (fwrite(buf, 1, got, out) != got) {
+            result = -1;
+            break;
+        }
+    }
+    if (ferror(in)) {
+        result = -1;
+    }
+    fclose(in);
+    if (fclose(out) != 0) {
+        result = -1;
+    }
+    return result;
+}
+
+/**
+ * @brief Replace a file by a copy of another
+ *
+ * Outputs are never linked to entries: later tools (or a compilation without
+ * the cache) write to them in place, which would change the entry too.
+ */
+static int replace_file(const char* from, const char* to) {
+    if (unlink(to) != 0 && errno != ENOENT) {
+        return -1;
+    }
+    return copy_file(from, to);
+}
+
+/**
+ * @brief Open the stats file and take its lock
+ * @return File descriptor to close when done, -1 on error
+ */
+static int lock_stats(const StccCache* cache, int operation) {
+    char* path = cache_path(cache->dir, "stats");
+    if (path == NULL) {
+        return -1;
+    }
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    free(path);
+    if (fd >= 0 && flock(fd, operation) != 0) {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Contents of the stats file
+ */
+typedef struct CacheCounters {
+    unsigned long hits;
+    unsigned long misses;
+    unsigned long long bytes;   // Running total, corrected whenever the cache is scanned
+    unsigned long long max;     // Size cap last set with stcc_cache_open()
+} CacheCounters;
+
+static void read_counters(int fd, CacheCounters* c) {
+    char buf[256];
+    ssize_t got = pread(fd, buf, sizeof(buf) - 1, 0);
+    memset(c, 0, sizeof(*c));
+    if (got > 0) {
+        buf[got] = '\0';
+        if (sscanf(buf, "hits %lu misses %lu bytes %llu max %llu",
+                   &c->hits, &c->misses, &c->bytes, &c->max) != 4) {
+            memset(c, 0, sizeof(*c));
+        }
+    }
+}
+
+static void write_counters(int fd, const CacheCounters* c) {
+    char buf[256];
+    int len = snprintf(buf, sizeof(buf), "hits %lu misses %lu bytes %llu max %llu\n",
+                       c->hits, c->misses, c->bytes, c->max);
+    if (ftruncate(fd, 0) != 0 || pwrite(fd, buf, (size_t)len, 0) != len) {
+        perror("stcc: cache stats");
+    }
+}
+
+/**
+ * @brief One entry found while scanning the cache
+ */
+typedef struct CacheEntry {
+    char name[STCC_CACHE_KEY_LEN + 1];
+    time_t used;
+    unsigned long long bytes;
+} CacheEntry;
+
+static int entry_cmp(const void* x, const void* y) {
+    const CacheEntry* a = x;
+    const CacheEntry* b = y;
+    if (a->used != b->used) {
+        return (a->used < b->used) ? -1 : 1;
+    }
+    return strcmp(a->name, b->name);
+}
+
+static size_t scan_entries(const StccCache* cache, CacheEntry** entries,
+                           unsigned long long* total);
+static unsigned long long evict(const StccCache* cache, unsigned long long limit);
+
+int stcc_cache_open(StccCache* cache, const char* dir, unsigned long long max_bytes) {
+    cache->dir = NULL;
+    cache->max_bytes = max_bytes ? max_bytes : STCC_CACHE_DEFAULT_CAP;
+    if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+        perror(dir);
+        return -1;
+    }
+    struct stat st;
+    if (stat(dir, &st) != 0 || !S_ISDIR(st.st_mode)) {
+        fprintf(stderr, "Error: Cache %s is not a directory\n", dir);
+        return -1;
+    }
+    cache->dir = strdup(dir);
+    if (cache->dir == NULL) {
+        return -1;
+    }
+
+    // An explicit cap is remembered for later runs that do not give one
+    int fd = lock_stats(cache, LOCK_EX);
+    if (fd >= 0) {
+        CacheCounters c;
+        read_counters(fd, &c);
+        if (max_bytes) {
+            c.max = max_bytes;
+            write_counters(fd, &c);
+        } else if (c.max) {
+            cache->max_bytes = c.max;
+        }
+        close(fd);
+    }
+    return 0;
+}
+
+void stcc_cache_close(StccCache* cache) {
+    free(cache->dir);
+    cache->dir = NULL;
+}
+
+void stcc_cache_key(const char* source, size_t length, char key[STCC_CACHE_KEY_LEN + 1]) {
+    // Two FNV-1a lanes with different offsets; hits are verified against
+    // the stored source, so a collision only costs a recompilation
+    static const char prefix[] = STCC_CACHE_FORMAT "\n" STCC_BUILD_ID "\n";
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t a = 0xcbf29ce484222325ULL;
+    uint64_t b = 0x84222325cbf29ce4ULL;
+
+    for (size_t i = 0; i < sizeof(prefix) - 1; i++) {
+        a = (a ^ (unsigned char)prefix[i]) * prime;
+        b = (b ^ (unsigned char)prefix[i] ^ 0x5c) * prime;
+    }
+    for (size_t i = 0; i < length; i++) {
+        a = (a ^ (unsigned char)source[i]) * prime;
+        b = (b ^ (unsigned char)source[i] ^ 0x5c) * prime;
+    }
+    snprintf(key, STCC_CACHE_KEY_LEN + 1, "%016llx%016llx",
+             (unsigned long long)a, (unsigned long long)b);
+}
+
+int stcc_cache_install(char* const from[STCC_ART_COUNT],
+                       const char* const dest[STCC_ART_COUNT]) {
+    for (int i = 0; i < STCC_ART_COUNT; i++) {
+        if (dest[i] && replace_file(from[i], dest[i]) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int stcc_cache_fetch(const StccCache* cache, const char* key,
+                     const char* source, size_t length,
+                     const char* const dest[STCC_ART_COUNT]) {
+    char* entry = cache_path(cache->dir, key);
+    char* from[STCC_ART_COUNT] = { 0 };
+    int hit = 0;
+
+    char* source_path = entry ? cache_path(entry, "source") : NULL;
+    if (source_path && file_equals(source_path, source, length)) {
+        hit = 1;
+        for (int i = 0; i < STCC_ART_COUNT; i++) {
+            from[i] = cache_path(entry, artifact_names[i]);
+            hit = hit && from[i] != NULL;
+        }
+        // An entry removed by a concurrent trim is simply a miss
+        hit = hit && stcc_cache_install(from, dest) == 0;
+        if (hit) {
+            utime(entry, NULL);
+        }
+    }
+
+    for (int i = 0; i < STCC_ART_COUNT; i++) {
+        free(from[i]);
+    }
+    free(source_path);
+    free(entry);
+    return hit;
+}
+
+int stcc_cache_stage(const StccCache* cache, char* staging[STCC_ART_COUNT]) {
+    memset(staging, 0, STCC_ART_COUNT * sizeof(*staging));
+    char* dir = cache_path(cache->dir, STCC_CACHE_STAGING "XXXXXX");
+    if (dir == NULL || mkdtemp(dir) == NULL) {
+        free(dir);
+        return -1;
+    }
+    for (int i = 0; i < STCC_ART_COUNT; i++) {
+        staging[i] = cache_path(dir, artifact_names[i]);
+        if (staging[i] == NULL) {
+            stcc_cache_discard(staging);
+            rmdir(dir);
+            free(dir);
+            return -1;
+        }
+    }
+    free(dir);
+    return 0;
+}
+
+void stcc_cache_discard(char* staging[STCC_ART_COUNT]) {
+    if (staging[0]) {
+        char* dir = strdup(staging[0]);
+        char* slash = dir ? strrchr(dir, '/') : NULL;
+        if (slash) {
+            *slash = '\0';
+            remove_dir(dir);
+        }
+        free(dir);
+    }
+    for (int i = 0; i < STCC_ART_COUNT; i++) {
+        free(staging[i]);
+        staging[i] = NULL;
+    }
+}
+
+/**
+ * @brief Add a new entry to the running size, trimming once it exceeds the cap
+ */
+static void account(const StccCache* cache, unsigned long long bytes) {
+    int fd = lock_stats(cache, LOCK_EX);
+    if (fd < 0) {
+        return;
+    }
+    CacheCounters c;
+    read_counters(fd, &c);
+    c.bytes += bytes;
+    if (c.bytes > cache->max_bytes) {
+        c.bytes = evict(cache, cache->max_bytes / 100 * STCC_CACHE_LOW_PCT);
+    }
+    write_counters(fd, &c);
+    close(fd);
+}
+
+int stcc_cache_publish(const StccCache* cache, const char* key,
+                       const char* source, size_t length,
+                       char* staging[STCC_ART_COUNT]) {
+    char* dir = strdup(staging[0]);
+    char* slash = dir ? strrchr(dir, '/') : NULL;
+    char* entry = cache_path(cache->dir, key);
+    char* source_path = NULL;
+    int result = -1;
+
+    if (slash && entry) {
+        *slash = '\0';
+        source_path = cache_path(dir, "source");
+        FILE* fp = source_path ? fopen(source_path, "wb") : NULL;
+        if (fp) {
+            int ok = fwrite(source, 1, length, fp) == length;
+            if (fclose(fp) == 0 && ok) {
+                if (rename(dir, entry) == 0) {
+                    result = 0;
+                    account(cache, dir_bytes(entry));
+                } else if (errno == EEXIST || errno == ENOTEMPTY) {
+                    result = 0;   // Published by another compiler meanwhile
+                }
+            }
+        }
+    }
+    // Removes the staging directory unless it became the entry
+    stcc_cache_discard(staging);
+
+    free(source_path);
+    free(entry);
+    free(dir);
+    return result;
+}
+
+void stcc_cache_record(const StccCache* cache, int hit) {
+    int fd = lock_stats(cache, LOCK_EX);
+    if (fd < 0) {
+        return;
+    }
+    CacheCounters c;
+    read_counters(fd, &c);
+    if (hit) {
+        c.hits++;
+    } else {
+        c.misses++;
+    }
+    write_counters(fd, &c);
+    close(fd);
+}
+
+/**
+ * @brief List the entries of the cache, removing abandoned staging directories
+ * @return Number of entries, stored in a new array
+ */
+static size_t scan_entries(const StccCache* cache, CacheEntry** entries,
+                           unsigned long long* total) {
+    size_t count = 0;
+    size_t capacity = 0;
+    time_t now = time(NULL);
+    *entries = NULL;
+    *total = 0;
+
+    DIR* d = opendir(cache->dir);
+    if (d == NULL) {
+        return 0;
+    }
+    struct dirent* ent;
+    while ((ent = readdir(d)) != NULL) {
+        struct stat st;
+        char* path = cache_path(cache->dir, ent->d_name);
+        if (path == NULL || stat(path, &st) != 0 || !S_ISDIR(st.st_mode)) {
+            free(path);
+            continue;
+        }
+        if (strncmp(ent->d_name, STCC_CACHE_STAGING, strlen(STCC_CACHE_STAGING)) == 0) {
+            if (now - st.st_mtime > STCC_CACHE_STALE) {
+                remove_dir(path);
+            }
+        } else if (is_key(ent->d_name)) {
+            if (count == capacity) {
+                size_t grown = capacity ? capacity * 2 : 64;
+                CacheEntry* more = realloc(*entries, grown * sizeof(*more));
+                if (more == NULL) {
+                    free(path);
+                    break;
+                }
+                *entries = more;
+                capacity = grown;
+            }
+            CacheEntry* e = &(*entries)[count++];
+            memcpy(e->name, ent->d_name, sizeof(e->name));
+            e->used = st.st_mtime;
+            e->bytes = dir_bytes(path);
+            *total += e->bytes;
+        }
+        free(path);
+    }
+    closedir(d);
+    return count;
+}
+
+/**
+ * @brief Remove least recently used entries until at most limit bytes remain
+ *
+ * The caller holds the stats lock.
+ *
+ * @return Bytes remaining
+ */
+static unsigned long long evict(const StccCache* cache, unsigned long long limit) {
+    CacheEntry* entries;
+    unsigned long long total;
+    size_t count = scan_entries(cache, &entries, &total);
+
+    if (total > limit) {
+        qsort(entries, count, sizeof(*entries), entry_cmp);
+        for (size_t i = 0; i < count && total > limit; i++) {
+            // Move the entry out of sight before deleting its files
+            char doomed[sizeof(STCC_CACHE_STAGING) + STCC_CACHE_KEY_LEN + 8];
+            snprintf(doomed, sizeof(doomed), STCC_CACHE_STAGING "del.%s", entries[i].name);
+            char* path = cache_path(cache->dir, entries[i].name);
+            char* gone = cache_path(cache->dir, doomed);
+            if (path && gone && rename(path, gone) == 0) {
+                remove_dir(gone);
+                total -= entries[i].bytes;
+            }
+            free(path);
+            free(gone);
+        }
+    }
+    free(entries);
+    return total;
+}
+
+void stcc_cache_trim(const StccCache* cache) {
+    int fd = lock_stats(cache, LOCK_EX);
+    if (fd < 0) {
+        return;
+    }
+    CacheCounters c;
+    read_counters(fd, &c);
+    c.bytes = evict(cache, cache->max_bytes);
+    write_counters(fd, &c);
+    close(fd);
+}
+
+void stcc_cache_stats(const StccCache* cache, StccCacheStats* stats) {
+    memset(stats, 0, sizeof(*stats));
+    int fd = lock_stats(cache, LOCK_SH);
+    if (fd >= 0) {
+        CacheCounters c;
+        read_counters(fd, &c);
+        stats->hits = c.hits;
+        stats->misses = c.misses;
+        close(fd);
+    }
+    CacheEntry* entries;
+    stats->entries = (unsigned long)scan_entries(cache, &entries, &stats->bytes);
+    free(entries);
+}
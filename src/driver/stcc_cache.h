@@ -0,0 +1,149 @@
+/**
+ * @file stcc_cache.h
+ * @brief Content-addressed compilation cache of the stcc driver
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * @details The cache maps a preprocessed source to everything the pipeline
+ * produces from it. The key is a 128-bit FNV-1a hash of the cache format,
+ * the compiler build (STCC_BUILD_ID, a checksum of the compiler sources and
+ * CFLAGS set by the Makefile) and the source bytes. Every entry is a
+ * directory named after the key holding copies of the artifacts:
+ *
+ *   <dir>/<key>/source   the compiled source, compared on lookup
+ *   <dir>/<key>/sstore   cc0 string store
+ *   <dir>/<key>/tokens   cc0 token store
+ *   <dir>/<key>/ast      cc1 AST store
+ *   <dir>/<key>/sym      cc1 symbol table
+ *   <dir>/<key>/tacbin   cc2 TAC binary
+ *   <dir>/<key>/tac      cc2 TAC listing
+ *
+ * Entries are built in a private staging directory and renamed into place,
+ * so concurrent compilers never see half-written entries. A hit copies the
+ * artifacts to their destinations, so nothing done to the outputs later can
+ * change the entry, and touches the entry. Hit and miss counts, the running disk usage and
+ * the size cap are kept in <dir>/stats, updated under a file lock; when a
+ * new entry takes the cache beyond its cap, the least recently used
+ * entries are removed until it is back under 90% of the cap.
+ */
+
+#ifndef SRC_DRIVER_STCC_CACHE_H_
+#define SRC_DRIVER_STCC_CACHE_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+#define STCC_CACHE_KEY_LEN     32                    // Hex digits of a key
+#define STCC_CACHE_DEFAULT_CAP (256ULL << 20)        // Default size cap in bytes
+
+/**
+ * @brief Artifacts of one compilation
+ */
+typedef enum StccArtifact {
+    STCC_ART_SSTORE,
+    STCC_ART_TOKENS,
+    STCC_ART_AST,
+    STCC_ART_SYM,
+    STCC_ART_TACBIN,
+    STCC_ART_TAC,
+    STCC_ART_COUNT
+} StccArtifact;
+
+/**
+ * @brief An open cache directory
+ */
+typedef struct StccCache {
+    char* dir;
+    unsigned long long max_bytes;
+} StccCache;
+
+/**
+ * @brief Cache usage as recorded in the stats file and found on disk
+ */
+typedef struct StccCacheStats {
+    unsigned long hits;
+    unsigned long misses;
+    unsigned long entries;
+    unsigned long long bytes;
+} StccCacheStats;
+
+/**
+ * @brief Open (creating if needed) a cache directory
+ * @param max_bytes Size cap, remembered in the cache; 0 for the one set last
+ *        (or the default)
+ * @return 0 on success, -1 if the directory cannot be created
+ */
+int stcc_cache_open(StccCache* cache, const char* dir, unsigned long long max_bytes);
+
+/**
+ * @brief Release a cache handle (the directory stays)
+ */
+void stcc_cache_close(StccCache* cache);
+
+/**
+ * @brief Compute the key of a source
+ * @param key Receives STCC_CACHE_KEY_LEN hex digits and a terminating NUL
+ */
+void stcc_cache_key(const char* source, size_t length, char key[STCC_CACHE_KEY_LEN + 1]);
+
+/**
+ * @brief Copy the artifacts of a cached compilation to their destinations
+ *
+ * Destinations are replaced, never written through, so a later compilation
+ * writing to the same paths does not modify the cache.
+ *
+ * @param dest Destination of every artifact, NULL entries are skipped
+ * @return 1 on a hit, 0 if the source is not cached (or the entry vanished)
+ */
+int stcc_cache_fetch(const StccCache* cache, const char* key,
+                     const char* source, size_t length,
+                     const char* const dest[STCC_ART_COUNT]);
+
+/**
+ * @brief Replace destinations by copies of artifacts
+ * @param from Source of every artifact
+ * @param dest Destination of every artifact, NULL entries are skipped
+ * @return 0 on success, -1 on error
+ */
+int stcc_cache_install(char* const from[STCC_ART_COUNT],
+                       const char* const dest[STCC_ART_COUNT]);
+
+/**
+ * @brief Create a private staging directory for a new entry
+ * @param staging Receives the paths of the artifacts to produce; release
+ *        with stcc_cache_discard() or stcc_cache_publish()
+ * @return 0 on success, -1 on error
+ */
+int stcc_cache_stage(const StccCache* cache, char* staging[STCC_ART_COUNT]);
+
+/**
+ * @brief Turn a completed staging directory into the entry for a key
+ * @return 0 on success (or if another compiler published it first), -1 on error
+ */
+int stcc_cache_publish(const StccCache* cache, const char* key,
+                       const char* source, size_t length,
+                       char* staging[STCC_ART_COUNT]);
+
+/**
+ * @brief Remove a staging directory and release its paths
+ */
+void stcc_cache_discard(char* staging[STCC_ART_COUNT]);
+
+/**
+ * @brief Count a hit or a miss in the stats file
+ */
+void stcc_cache_record(const StccCache* cache, int hit);
+
+/**
+ * @brief Remove least recently used entries until the cache fits its cap
+ */
+void stcc_cache_trim(const StccCache* cache);
+
+/**
+ * @brief Read the hit/miss counters and measure the entries on disk
+ */
+void stcc_cache_stats(const StccCache* cache, StccCacheStats* stats);
+
+#endif  // SRC_DRIVER_STCC_CACHE_H_
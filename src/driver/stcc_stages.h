@@ -0,0 +1,46 @@
+/**
+ * @file stcc_stages.h
+ * @brief Entry points of the compiler passes for in-process drivers
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * @details Each pass works on stores that are already open: the caller
+ * initializes the string, token, AST and symbol stores (with *_init(), or
+ * *_init_anonymous() for temporary stores) and runs the stages in order. The cc0, cc1
+ * and cc2 programs wrap the same functions in a main() that opens the
+ * stores by name; building the pass sources with -DSTCC_DRIVER leaves that
+ * main() out.
+ *
+ * The passes keep their state in globals, so one translation unit is
+ * compiled at a time per process.
+ */
+
+#ifndef SRC_DRIVER_STCC_STAGES_H_
+#define SRC_DRIVER_STCC_STAGES_H_
+
+#include <stdio.h>
+
+/**
+ * @brief Tokenize a source file into the open string and token stores (cc0)
+ * @param fp Preprocessed source file
+ * @return 0 on success
+ */
+int cc0_lex(FILE *fp);
+
+/**
+ * @brief Parse the token store into the open AST store and symbol table (cc1)
+ * @return 0 on success, non-zero if the parser reported errors
+ */
+int cc1_parse(void);
+
+/**
+ * @brief Generate TAC from the open stores (cc2)
+ * @param tac_file TAC binary output file (NULL: temporary store)
+ * @param output_file Human-readable TAC output file (optional)
+ * @return 0 on success, non-zero on error
+ */
+int cc2_generate(const char* tac_file, const char* output_file);
+
+#endif  // SRC_DRIVER_STCC_STAGES_H_
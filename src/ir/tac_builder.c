@@ -44,6 +44,9 @@ static void translate_return_stmt(TACBuilder* builder, ASTNode* ast_node);
 static void translate_compound_stmt(TACBuilder* builder, ASTNode* ast_node);
 static TACOperand translate_function_call(TACBuilder* builder, ASTNode* ast_node);
 static int tac_builder_load_symbols(TACBuilder* builder);
+static void tac_builder_begin_function(TACBuilder* builder, uint32_t func_idx,
+                                       SymIdx_t symbol, TACIdx_t label_idx);
+static void tac_builder_end_function(TACBuilder* builder, SymIdx_t symbol);
 
 /**
  * @brief Look up a variable in the symbol table and return its TAC operand
@@ -53,20 +56,9 @@ static int tac_builder_load_symbols(TACBuilder* builder);
  */
 
 /**
- * @brief Initialize TAC builder
+ * @brief Set up a builder whose TAC store has just been initialized
  */
-int tac_builder_init(TACBuilder* builder, const char* tac_filename) {
-    if (builder == NULL || tac_filename == NULL) {
-        return 0;
-    }
-
-    memset(builder, 0, sizeof(TACBuilder));
-
-    // Initialize TAC store
-    if (tacstore_init(tac_filename) == 0) {
-        return 0;
-    }
-
+static int tac_builder_setup(TACBuilder* builder) {
     // Initialize temporary manager
     builder->temp_mgr = malloc(sizeof(TACTempManager));
     if (builder->temp_mgr == NULL) {
@@ -100,6 +92,39 @@ int tac_builder_init(TACBuilder* builder, const char* tac_filename) {
     return 1;
 }
 
+/**
+ * @brief Initialize TAC builder
+ */
+int tac_builder_init(TACBuilder* builder, const char* tac_filename) {
+    if (builder == NULL || tac_filename == NULL) {
+        return 0;
+    }
+
+    memset(builder, 0, sizeof(TACBuilder));
+
+    // Initialize TAC store
+    if (tacstore_init(tac_filename) == 0) {
+        return 0;
+    }
+    return tac_builder_setup(builder);
+}
+
+/**
+ * @brief Initialize TAC builder with a temporary TAC store
+ */
+int tac_builder_init_anonymous(TACBuilder* builder) {
+    if (builder == NULL) {
+        return 0;
+    }
+
+    memset(builder, 0, sizeof(TACBuilder));
+
+    if (tacstore_init_anonymous() == 0) {
+        return 0;
+    }
+    return tac_builder_setup(builder);
+}
+
 /**
  * @brief Cleanup TAC builder
  */
@@ -528,9 +553,11 @@ TACOperand tac_build_from_ast(TACBuilder* builder, ASTNodeIdx_t node) {
                         TACOperand func_label = tac_new_label(builder);
                         builder->function_table.label_ids[func_idx] = func_label.data.label.offset;
                         
-                        tac_emit_instruction(builder, TAC_LABEL, func_label, TAC_OPERAND_NONE, TAC_OPERAND_NONE);
+                        TACIdx_t label_idx = tac_emit_instruction(builder, TAC_LABEL, func_label,
+                                                                  TAC_OPERAND_NONE, TAC_OPERAND_NONE);
                         // Record instruction address after emitting the label
                         builder->function_table.instruction_addresses[func_idx] = tacstore_getidx();
+                        tac_builder_begin_function(builder, func_idx, func_symbol_idx, label_idx);
                     } else {
                         fprintf(stderr, "ERROR: Function '%s' not found in symbol table\n", func_name);
                         builder->error_count++;
@@ -557,6 +584,7 @@ TACOperand tac_build_from_ast(TACBuilder* builder, ASTNodeIdx_t node) {
                 // Make sure we don't process ourselves
                 tac_build_from_ast(builder, function_body);
             }
+            tac_builder_end_function(builder, ast_node.declaration.symbol_idx);
             return TAC_OPERAND_NONE;
 
         default:
@@ -1087,3 +1115,67 @@ void tac_builder_export_function_table(TACBuilder* builder) {
     // Set the function table in the TAC printer
     tac_printer_set_function_table(&printer_table);
 }
+
+/**
+ * @brief Start the metadata of a function whose label was just emitted
+ *
+ * cc1 records the parameters on the function symbol and adds that symbol
+ * after the body, so the locals are the block-scope symbols before it.
+ * temp_count holds the first temporary until tac_builder_end_function().
+ */
+static void tac_builder_begin_function(TACBuilder* builder, uint32_t func_idx,
+                                       SymIdx_t symbol, TACIdx_t label_idx) {
+    SymTabEntry entry = symtab_get(symbol);
+    TACFunction* function = &builder->function_table.functions[func_idx];
+
+    memset(function, 0, sizeof(*function));
+    function->symbol_idx = symbol;
+    function->start_idx = label_idx;
+    function->param_count = entry.extra.function.param_count;
+    function->first_param = entry.extra.function.first_param;
+    function->temp_count = builder->temp_mgr ? builder->temp_mgr->next_temp : 0;
+
+    uint16_t declared = 0;
+    for (SymIdx_t i = symbol - 1; i > 0; i--) {
+        SymTabEntry local = symtab_get(i);
+        if (local.scope_depth == 0 || local.type == SYM_FUNCTION) {
+            break;
+        }
+        declared++;
+    }
+    function->local_count = declared > function->param_count
+        ? (uint16_t)(declared - function->param_count) : 0;
+}
+
+/**
+ * @brief Close the metadata of the function just built
+ */
+static void tac_builder_end_function(TACBuilder* builder, SymIdx_t symbol) {
+    for (uint32_t i = 0; i < builder->function_table.count; i++) {
+        TACFunction* function = &builder->function_table.functions[i];
+        if (function->start_idx != 0 && function->symbol_idx == symbol) {
+            uint16_t next_temp = builder->temp_mgr ? builder->temp_mgr->next_temp : 0;
+            function->temp_count = (uint16_t)(next_temp - function->temp_count);
+            function->end_idx = tacstore_getidx();
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Append the metadata of every defined function to the TAC file
+ */
+int tac_builder_write_functions(TACBuilder* builder) {
+    if (!builder) {
+        return 0;
+    }
+
+    TACFunction defined[32];
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < builder->function_table.count && i < 32; i++) {
+        if (builder->function_table.functions[i].start_idx != 0) {
+            defined[count++] = builder->function_table.functions[i];
+        }
+    }
+    return tacstore_write_functions(defined, count);
+}
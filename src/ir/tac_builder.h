@@ -31,6 +31,7 @@ typedef struct TACBuilder {
         char* function_names[32];    // Function name storage
         uint32_t label_ids[32];      // Corresponding TAC label IDs
         uint32_t instruction_addresses[32]; // Instruction addresses
+        TACFunction functions[32];   // Frame metadata, start_idx 0 until defined
         uint32_t count;              // Number of functions
         uint32_t main_function_idx;  // Index of main function (-1 if not found)
     } function_table;
@@ -39,6 +40,7 @@ typedef struct TACBuilder {
 // TAC builder initialization and cleanup
 int tac_builder_init(TACBuilder* builder,
                      const char* tac_filename);
+int tac_builder_init_anonymous(TACBuilder* builder);   // TAC store in a tmpfile()
 void tac_builder_cleanup(TACBuilder* builder);
 
 // Core translation functions
@@ -123,4 +125,11 @@ uint32_t tac_builder_get_entry_label(TACBuilder* builder);
  */
 void tac_builder_export_function_table(TACBuilder* builder);
 
+/**
+ * @brief Append the metadata of every defined function to the TAC file
+ * @param builder TAC builder instance, after the whole program was built
+ * @return 1 on success, 0 on error
+ */
+int tac_builder_write_functions(TACBuilder* builder);
+
 #endif  // SRC_IR_TAC_BUILDER_H_
@@ -0,0 +1,756 @@
+/**
+ * @file tac_cgen.c
+ * @brief Ahead-of-time translation of TAC programs to C99
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * @details Every CALL target starts a function whose body is the code
+ * reachable from it without following calls. Each C function gets its own
+ * copy of the instructions it reaches, emitted in program order with a label
+ * on every jump target. A slot referenced by a single function becomes a C
+ * local; slots that are shared, or used by the program body, become
+ * file-scope statics.
+ *
+ * Parameters come from the function records (tac_function.h), as in the TAC
+ * engine. A parameter the function owns is a C parameter. One that is
+ * shared, e.g. because two functions' parameters have the same id, is a
+ * static: the function saves it, binds the argument and restores it on
+ * return, so nested calls see their own arguments like engine frames do.
+ *
+ * Integer arithmetic wraps like the engine's 32-bit cells. Behaviour the
+ * engine leaves to the host C compiler is pinned down: shift counts are
+ * masked to 5 bits and INT32_MIN / -1 wraps instead of trapping.
+ */
+
+#include "tac_cgen.h"
+#include "tac_function.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CGEN_NONE         UINT32_MAX
+#define CGEN_SHARED       (UINT32_MAX - 1)
+#define CGEN_LABELS       65536u
+#define CGEN_TEMP_BASE    65536u              // Keys: variables, then temporaries
+#define CGEN_KEYS         (2u * 65536u)
+#define CGEN_MAX_PARAMS   10u                 // Arguments staged per call, as in the engine
+
+#define CGEN_SLOT_UNSEEN  0u
+#define CGEN_SLOT_LOCAL   1u
+#define CGEN_SLOT_PARAM   2u
+
+typedef struct cgen_function {
+    uint32_t entry;            // First instruction
+    uint32_t param_count;      // Parameters passed as C arguments
+    uint16_t params[CGEN_MAX_PARAMS]; // Variable ids, in declaration order
+} cgen_function_t;
+
+typedef struct cgen_context {
+    FILE* out;
+    const TACInstruction* code;
+    uint32_t count;
+    uint32_t* label_index;     // Label id -> instruction, or CGEN_NONE
+    uint32_t* target;          // Instruction -> jump/call target, or CGEN_NONE
+    uint32_t* function_of;     // Instruction -> function it is the entry of
+    cgen_function_t* functions; // CALL targets, then the program body last
+    uint32_t function_count;
+    uint8_t* reach;            // function_count rows of count flags
+    uint8_t* marks;            // Per-function scratch: needs a C label
+    uint32_t* worklist;
+    uint32_t* key_owner;       // Slot key -> function, CGEN_SHARED or CGEN_NONE
+    uint8_t* key_state;
+    char* error;
+    size_t error_size;
+} cgen_context_t;
+
+// =============================================================================
+// ANALYSIS
+// =============================================================================
+
+static int cgen_fail(cgen_context_t* ctx, uint32_t index, const char* message) {
+    if (ctx->error && ctx->error_size > 0) {
+        snprintf(ctx->error, ctx->error_size, "instruction %u: %s", index, message);
+    }
+    return -1;
+}
+
+/**
+ * @brief Slot key of an operand
+ * @return Key, or CGEN_NONE if the operand is not a variable or temporary
+ */
+static uint32_t cgen_slot_key(const TACOperand* operand) {
+    switch (operand->type) {
+        case TAC_OP_VAR:
+            return operand->data.variable.id;
+        case TAC_OP_TEMP:
+            return CGEN_TEMP_BASE + operand->data.variable.id;
+        default:
+            return CGEN_NONE;
+    }
+}
+
+/**
+ * @brief Slots referenced by an instruction, reads first
+ * @return Number of keys written to keys[]
+ */
+static uint32_t cgen_instruction_slots(const TACInstruction* inst, uint32_t keys[3],
+                                       uint32_t* reads) {
+    uint32_t n = 0;
+    uint32_t key;
+
+    if ((key = cgen_slot_key(&inst->operand1)) != CGEN_NONE) {
+        keys[n++] = key;
+    }
+    if ((key = cgen_slot_key(&inst->operand2)) != CGEN_NONE) {
+        keys[n++] = key;
+    }
+    *reads = n;
+    if ((key = cgen_slot_key(&inst->result)) != CGEN_NONE) {
+        keys[n++] = key;
+    }
+    return n;
+}
+
+static bool cgen_is_jump(TACOpcode opcode) {
+    return opcode == TAC_GOTO || opcode == TAC_IF_TRUE || opcode == TAC_IF_FALSE;
+}
+
+static bool cgen_falls_through(TACOpcode opcode) {
+    return opcode != TAC_GOTO && opcode != TAC_RETURN && opcode != TAC_RETURN_VOID;
+}
+
+/**
+ * @brief Map labels to instructions and resolve jump and call targets
+ */
+static void cgen_resolve(cgen_context_t* ctx) {
+    for (uint32_t l = 0; l < CGEN_LABELS; l++) {
+        ctx->label_index[l] = CGEN_NONE;
+    }
+    for (uint32_t i = 0; i < ctx->count; i++) {
+        const TACInstruction* inst = &ctx->code[i];
+        if (inst->opcode == TAC_LABEL && inst->result.type == TAC_OP_LABEL &&
+            ctx->label_index[inst->result.data.label.offset] == CGEN_NONE) {
+            ctx->label_index[inst->result.data.label.offset] = i;
+        }
+    }
+
+    for (uint32_t i = 0; i < ctx->count; i++) {
+        const TACInstruction* inst = &ctx->code[i];
+        const TACOperand* operand = NULL;
+        uint32_t target = CGEN_NONE;
+
+        if (inst->opcode == TAC_GOTO || inst->opcode == TAC_CALL) {
+            operand = &inst->operand1;
+        } else if (inst->opcode == TAC_IF_TRUE || inst->opcode == TAC_IF_FALSE) {
+            operand = &inst->operand2;
+        }
+
+        if (operand && operand->type == TAC_OP_LABEL) {
+            target = ctx->label_index[operand->data.label.offset];
+        } else if (operand && operand->type == TAC_OP_IMMEDIATE) {
+            target = (uint32_t)operand->data.immediate.value;
+        }
+        ctx->target[i] = (target < ctx->count) ? target : CGEN_NONE;
+    }
+}
+
+/**
+ * @brief Mark the instructions reachable from a function's entry
+ */
+static int cgen_mark_reachable(cgen_context_t* ctx, uint32_t f) {
+    uint8_t* reach = &ctx->reach[(size_t)f * ctx->count];
+    uint32_t top = 0;
+
+    reach[ctx->functions[f].entry] = 1;
+    ctx->worklist[top++] = ctx->functions[f].entry;
+    while (top > 0) {
+        uint32_t i = ctx->worklist[--top];
+        const TACInstruction* inst = &ctx->code[i];
+        uint32_t next[2];
+        uint32_t n = 0;
+
+        if (cgen_is_jump(inst->opcode)) {
+            if (ctx->target[i] == CGEN_NONE) {
+                return cgen_fail(ctx, i, "unresolved jump target");
+            }
+            next[n++] = ctx->target[i];
+        }
+        if (cgen_falls_through(inst->opcode) && i + 1 < ctx->count) {
+            next[n++] = i + 1;
+        }
+
+        for (uint32_t j = 0; j < n; j++) {
+            if (!reach[next[j]]) {
+                reach[next[j]] = 1;
+                ctx->worklist[top++] = next[j];
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Find functions, their reachable code and who owns each slot
+ */
+static int cgen_analyze(cgen_context_t* ctx, const TACCGenOptions* options) {
+    uint32_t entry = options->entry;
+
+    cgen_resolve(ctx);
+
+    uint32_t function_count = 0;
+    for (uint32_t i = 0; i < ctx->count; i++) {
+        ctx->function_of[i] = CGEN_NONE;
+    }
+    for (uint32_t i = 0; i < ctx->count; i++) {
+        if (ctx->code[i].opcode == TAC_CALL) {
+            if (ctx->target[i] == CGEN_NONE) {
+                return cgen_fail(ctx, i, "unresolved call target");
+            }
+            ctx->function_of[ctx->target[i]] = 0;
+        }
+    }
+    for (uint32_t i = 0; i < ctx->count; i++) {
+        if (ctx->function_of[i] != CGEN_NONE) {
+            ctx->function_of[i] = function_count;
+            ctx->functions[function_count++].entry = i;
+        }
+    }
+    ctx->functions[function_count++].entry = entry;
+    ctx->function_count = function_count;
+
+    ctx->reach = calloc((size_t)function_count * ctx->count, 1);
+    if (!ctx->reach) {
+        return cgen_fail(ctx, entry, "out of memory");
+    }
+    for (uint32_t f = 0; f < function_count; f++) {
+        if (cgen_mark_reachable(ctx, f) != 0) {
+            return -1;
+        }
+    }
+
+    // Slots of the program body count as shared so they stay static and
+    // can be reported when the program finishes
+    uint32_t body = function_count - 1;
+    for (uint32_t k = 0; k < CGEN_KEYS; k++) {
+        ctx->key_owner[k] = CGEN_NONE;
+    }
+    for (uint32_t f = 0; f < function_count; f++) {
+        const uint8_t* reach = &ctx->reach[(size_t)f * ctx->count];
+        for (uint32_t i = 0; i < ctx->count; i++) {
+            uint32_t keys[3];
+            uint32_t reads;
+            uint32_t n = reach[i] ? cgen_instruction_slots(&ctx->code[i], keys, &reads) : 0;
+
+            for (uint32_t j = 0; j < n; j++) {
+                uint32_t* owner = &ctx->key_owner[keys[j]];
+                if (*owner == CGEN_NONE && f != body) {
+                    *owner = f;
+                } else if (*owner != f) {
+                    *owner = CGEN_SHARED;
+                }
+            }
+        }
+    }
+
+    // Parameters come from the function records. One referenced elsewhere,
+    // or declared by another function too, must be a static
+    for (uint32_t f = 0; f < body; f++) {
+        cgen_function_t* fn = &ctx->functions[f];
+        fn->param_count = tac_function_params(tac_function_at(options->functions,
+                                                              options->function_count,
+                                                              fn->entry),
+                                              fn->params, CGEN_MAX_PARAMS);
+        for (uint32_t p = 0; p < fn->param_count; p++) {
+            uint32_t* owner = &ctx->key_owner[fn->params[p]];
+            if (*owner == CGEN_NONE) {
+                *owner = f;
+            } else if (*owner != f) {
+                *owner = CGEN_SHARED;
+            }
+        }
+    }
+
+    for (uint32_t f = 0; f < body; f++) {
+        const cgen_function_t* fn = &ctx->functions[f];
+        for (uint32_t p = 0; p < fn->param_count; p++) {
+            if (ctx->key_owner[fn->params[p]] == f) {
+                ctx->key_state[fn->params[p]] = CGEN_SLOT_PARAM;
+            }
+        }
+    }
+    for (uint32_t k = 0; k < CGEN_KEYS; k++) {
+        if (ctx->key_owner[k] < body && ctx->key_state[k] == CGEN_SLOT_UNSEEN) {
+            ctx->key_state[k] = CGEN_SLOT_LOCAL;
+        }
+    }
+    return 0;
+}
+
+// =============================================================================
+// EMISSION
+// =============================================================================
+
+static void cgen_slot_name(uint32_t key, char* buf, size_t size) {
+    if (key < CGEN_TEMP_BASE) {
+        snprintf(buf, size, "v%u", key);
+    } else {
+        snprintf(buf, size, "t%u", key - CGEN_TEMP_BASE);
+    }
+}
+
+/**
+ * @brief C expression for a source operand
+ * @return 0 on success, -1 if the operand cannot be read
+ */
+static int cgen_operand(cgen_context_t* ctx, uint32_t index, const TACOperand* operand,
+                        char* buf, size_t size) {
+    uint32_t key = cgen_slot_key(operand);
+
+    if (key != CGEN_NONE) {
+        cgen_slot_name(key, buf, size);
+    } else if (operand->type == TAC_OP_IMMEDIATE) {
+        int32_t value = operand->data.immediate.value;
+        if (value == INT32_MIN) {
+            snprintf(buf, size, "(-2147483647 - 1)");
+        } else if (value < 0) {
+            snprintf(buf, size, "(%d)", value);
+        } else {
+            snprintf(buf, size, "%d", value);
+        }
+    } else if (operand->type == TAC_OP_LABEL) {
+        // Labels read as values evaluate to their id, as in the engine
+        snprintf(buf, size, "%u", (unsigned)operand->data.label.offset);
+    } else {
+        return cgen_fail(ctx, index, "unsupported source operand");
+    }
+    return 0;
+}
+
+/**
+ * @brief C lvalue for a destination operand
+ * @return 0 on success, -1 if the operand is not a variable or temporary
+ */
+static int cgen_destination(cgen_context_t* ctx, uint32_t index, const TACOperand* operand,
+                            char* buf, size_t size) {
+    uint32_t key = cgen_slot_key(operand);
+
+    if (key == CGEN_NONE) {
+        return cgen_fail(ctx, index, "result is not a variable or temporary");
+    }
+    cgen_slot_name(key, buf, size);
+    return 0;
+}
+
+static const char* cgen_binary_helper(TACOpcode opcode) {
+    switch (opcode) {
+        case TAC_ADD: return "tac_add_";
+        case TAC_SUB: return "tac_sub_";
+        case TAC_MUL: return "tac_mul_";
+        case TAC_DIV: return "tac_div_";
+        case TAC_MOD: return "tac_mod_";
+        case TAC_SHL: return "tac_shl_";
+        case TAC_SHR: return "tac_shr_";
+        default:      return NULL;
+    }
+}
+
+static const char* cgen_binary_operator(TACOpcode opcode) {
+    switch (opcode) {
+        case TAC_AND:         return "&";
+        case TAC_OR:          return "|";
+        case TAC_XOR:         return "^";
+        case TAC_EQ:          return "==";
+        case TAC_NE:          return "!=";
+        case TAC_LT:          return "<";
+        case TAC_LE:          return "<=";
+        case TAC_GT:          return ">";
+        case TAC_GE:          return ">=";
+        case TAC_LOGICAL_AND: return "&&";
+        case TAC_LOGICAL_OR:  return "||";
+        default:              return NULL;
+    }
+}
+
+static void cgen_emit_call(cgen_context_t* ctx, uint32_t index, const char* destination) {
+    const cgen_function_t* callee = &ctx->functions[ctx->function_of[ctx->target[index]]];
+
+    fprintf(ctx->out, "    f_%u(&%s", callee->entry, destination);
+    for (uint32_t j = 0; j < callee->param_count; j++) {
+        fprintf(ctx->out, ", nargs_ > %u ? args_[%u] : 0", j, j);
+    }
+    fprintf(ctx->out, ");\n    nargs_ = 0;\n");
+}
+
+/**
+ * @brief Put back the static parameters function f saved on entry
+ */
+static void cgen_emit_restore(cgen_context_t* ctx, uint32_t f) {
+    const cgen_function_t* fn = &ctx->functions[f];
+
+    for (uint32_t j = 0; j < fn->param_count; j++) {
+        if (ctx->key_owner[fn->params[j]] != f) {
+            fprintf(ctx->out, "    v%u = saved%u_;\n", (unsigned)fn->params[j], j);
+        }
+    }
+}
+
+/**
+ * @brief Emit the statement for one instruction of function f
+ */
+static int cgen_emit_statement(cgen_context_t* ctx, uint32_t f, uint32_t index) {
+    const TACInstruction* inst = &ctx->code[index];
+    bool body = (f == ctx->function_count - 1);
+    char r[16];
+    char a[24];
+    char b[24];
+    const char* helper;
+    const char* op;
+
+    switch (inst->opcode) {
+        case TAC_NOP:
+        case TAC_LABEL:
+            return 0;
+
+        case TAC_ASSIGN:
+            if (cgen_destination(ctx, index, &inst->result, r, sizeof(r)) != 0 ||
+                cgen_operand(ctx, index, &inst->operand1, a, sizeof(a)) != 0) {
+                return -1;
+            }
+            fprintf(ctx->out, "    %s = %s;\n", r, a);
+            return 0;
+
+        case TAC_NEG:
+        case TAC_NOT:
+        case TAC_BITWISE_NOT:
+            if (cgen_destination(ctx, index, &inst->result, r, sizeof(r)) != 0 ||
+                cgen_operand(ctx, index, &inst->operand1, a, sizeof(a)) != 0) {
+                return -1;
+            }
+            if (inst->opcode == TAC_NEG) {
+                fprintf(ctx->out, "    %s = tac_neg_(%s);\n", r, a);
+            } else {
+                fprintf(ctx->out, "    %s = %s%s;\n", r,
+                        inst->opcode == TAC_NOT ? "!" : "~", a);
+            }
+            return 0;
+
+        case TAC_GOTO:
+            fprintf(ctx->out, "    goto i_%u;\n", ctx->target[index]);
+            return 0;
+
+        case TAC_IF_TRUE:
+        case TAC_IF_FALSE:
+            if (cgen_operand(ctx, index, &inst->operand1, a, sizeof(a)) != 0) {
+                return -1;
+            }
+            fprintf(ctx->out, "    if (%s%s) goto i_%u;\n",
+                    inst->opcode == TAC_IF_FALSE ? "!" : "", a, ctx->target[index]);
+            return 0;
+
+        case TAC_PARAM:
+            if (cgen_operand(ctx, index, &inst->operand1, a, sizeof(a)) != 0) {
+                return -1;
+            }
+            fprintf(ctx->out, "    if (nargs_ == %u) tac_trap_(\"Too many parameters\");\n",
+                    CGEN_MAX_PARAMS);
+            fprintf(ctx->out, "    args_[nargs_++] = %s;\n", a);
+            return 0;
+
+        case TAC_CALL:
+            if (inst->result.type == TAC_OP_NONE) {
+                cgen_emit_call(ctx, index, "discard_");
+            } else if (cgen_destination(ctx, index, &inst->result, r, sizeof(r)) != 0) {
+                return -1;
+            } else {
+                cgen_emit_call(ctx, index, r);
+            }
+            return 0;
+
+        case TAC_RETURN:
+        case TAC_RETURN_VOID:
+            if (body) {
+                fprintf(ctx->out, "    tac_done_();\n");
+                return 0;
+            }
+            if (inst->opcode == TAC_RETURN && inst->operand1.type != TAC_OP_NONE) {
+                if (cgen_operand(ctx, index, &inst->operand1, a, sizeof(a)) != 0) {
+                    return -1;
+                }
+                // Evaluated before the restore, stored after it: the
+                // destination may be one of the saved statics
+                fprintf(ctx->out, "    value_ = %s;\n", a);
+                cgen_emit_restore(ctx, f);
+                fprintf(ctx->out, "    *ret_ = value_;\n");
+            } else {
+                cgen_emit_restore(ctx, f);
+            }
+            fprintf(ctx->out, "    return;\n");
+            return 0;
+
+        default:
+            break;
+    }
+
+    helper = cgen_binary_helper(inst->opcode);
+    op = cgen_binary_operator(inst->opcode);
+    if (!helper && !op) {
+        char message[48];
+        snprintf(message, sizeof(message), "opcode 0x%02x is not translatable",
+                 (unsigned)inst->opcode);
+        return cgen_fail(ctx, index, message);
+    }
+    if (cgen_destination(ctx, index, &inst->result, r, sizeof(r)) != 0 ||
+        cgen_operand(ctx, index, &inst->operand1, a, sizeof(a)) != 0 ||
+        cgen_operand(ctx, index, &inst->operand2, b, sizeof(b)) != 0) {
+        return -1;
+    }
+    if (helper) {
+        fprintf(ctx->out, "    %s = %s(%s, %s);\n", r, helper, a, b);
+    } else {
+        fprintf(ctx->out, "    %s = %s %s %s;\n", r, a, op, b);
+    }
+    return 0;
+}
+
+static void cgen_emit_signature(cgen_context_t* ctx, uint32_t f) {
+    const cgen_function_t* fn = &ctx->functions[f];
+
+    if (f == ctx->function_count - 1) {
+        fprintf(ctx->out, "static void tac_program_(void)");
+        return;
+    }
+    fprintf(ctx->out, "static void f_%u(int32_t* ret_", fn->entry);
+    for (uint32_t j = 0; j < fn->param_count; j++) {
+        if (ctx->key_owner[fn->params[j]] == f) {
+            fprintf(ctx->out, ", int32_t v%u", (unsigned)fn->params[j]);
+        } else {
+            fprintf(ctx->out, ", int32_t a%u_", j);
+        }
+    }
+    fprintf(ctx->out, ")");
+}
+
+static int cgen_emit_function(cgen_context_t* ctx, uint32_t f) {
+    const uint8_t* reach = &ctx->reach[(size_t)f * ctx->count];
+    uint32_t entry = ctx->functions[f].entry;
+    uint32_t first = CGEN_NONE;
+    bool uses_args = false;
+    bool uses_discard = false;
+
+    // Jump targets get C labels; so does the entry if code precedes it
+    memset(ctx->marks, 0, ctx->count);
+    for (uint32_t i = 0; i < ctx->count; i++) {
+        if (!reach[i]) {
+            continue;
+        }
+        if (first == CGEN_NONE) {
+            first = i;
+        }
+        if (cgen_is_jump(ctx->code[i].opcode)) {
+            ctx->marks[ctx->target[i]] = 1;
+        }
+        if (ctx->code[i].opcode == TAC_PARAM || ctx->code[i].opcode == TAC_CALL) {
+            uses_args = true;
+        }
+        if (ctx->code[i].opcode == TAC_CALL && ctx->code[i].result.type == TAC_OP_NONE) {
+            uses_discard = true;
+        }
+    }
+    if (first != entry) {
+        ctx->marks[entry] = 1;
+    }
+
+    cgen_emit_signature(ctx, f);
+    fprintf(ctx->out, " {\n");
+    for (uint32_t k = 0; k < CGEN_KEYS; k++) {
+        if (ctx->key_owner[k] == f && ctx->key_state[k] == CGEN_SLOT_LOCAL) {
+            char name[16];
+            cgen_slot_name(k, name, sizeof(name));
+            fprintf(ctx->out, "    int32_t %s = 0;\n", name);
+        }
+    }
+    if (uses_args) {
+        fprintf(ctx->out, "    int32_t args_[%u];\n    uint32_t nargs_ = 0;\n",
+                CGEN_MAX_PARAMS);
+    }
+    if (uses_discard) {
+        fprintf(ctx->out, "    int32_t discard_ = 0;\n");
+    }
+    if (f != ctx->function_count - 1) {
+        const cgen_function_t* fn = &ctx->functions[f];
+        fprintf(ctx->out, "    int32_t value_;\n    (void)ret_;\n    (void)value_;\n");
+        for (uint32_t j = 0; j < fn->param_count; j++) {
+            uint16_t id = fn->params[j];
+            if (ctx->key_owner[id] != f) {
+                fprintf(ctx->out, "    int32_t saved%u_ = v%u;\n    v%u = a%u_;\n",
+                        j, (unsigned)id, (unsigned)id, j);
+            }
+        }
+    }
+    if (first != entry) {
+        fprintf(ctx->out, "    goto i_%u;\n", entry);
+    }
+
+    for (uint32_t i = first; i < ctx->count; i++) {
+        if (!reach[i]) {
+            continue;
+        }
+        if (ctx->marks[i]) {
+            fprintf(ctx->out, "i_%u: ;\n", i);
+        }
+        if (cgen_emit_statement(ctx, f, i) != 0) {
+            return -1;
+        }
+        // Running off the end of the code finishes the program
+        if (i + 1 == ctx->count && cgen_falls_through(ctx->code[i].opcode)) {
+            fprintf(ctx->out, "    tac_done_();\n");
+        }
+    }
+    fprintf(ctx->out, "}\n\n");
+    return 0;
+}
+
+static const char* const cgen_prelude[] = {
+    "#include <stdint.h>",
+    "#include <stdio.h>",
+    "#include <stdlib.h>",
+    "#include <time.h>",
+    "",
+    "static clock_t tac_start_;",
+    "static void tac_done_(void);",
+    "",
+    "static void tac_trap_(const char* message) {",
+    "    printf(\"error %s\\n\", message);",
+    "    exit(1);",
+    "}",
+    "",
+    "static inline int32_t tac_add_(int32_t a, int32_t b) { return (int32_t)((uint32_t)a + (uint32_t)b); }",
+    "static inline int32_t tac_sub_(int32_t a, int32_t b) { return (int32_t)((uint32_t)a - (uint32_t)b); }",
+    "static inline int32_t tac_mul_(int32_t a, int32_t b) { return (int32_t)((uint32_t)a * (uint32_t)b); }",
+    "static inline int32_t tac_neg_(int32_t a) { return (int32_t)(0u - (uint32_t)a); }",
+    "static inline int32_t tac_shl_(int32_t a, int32_t b) { return (int32_t)((uint32_t)a << (b & 31)); }",
+    "static inline int32_t tac_shr_(int32_t a, int32_t b) { return a >> (b & 31); }",
+    "",
+    "static inline int32_t tac_div_(int32_t a, int32_t b) {",
+    "    if (b == 0) tac_trap_(\"Division by zero\");",
+    "    return b == -1 ? tac_neg_(a) : a / b;",
+    "}",
+    "",
+    "static inline int32_t tac_mod_(int32_t a, int32_t b) {",
+    "    if (b == 0) tac_trap_(\"Division by zero\");",
+    "    return b == -1 ? 0 : a % b;",
+    "}",
+    "",
+};
+
+static void cgen_emit_program(cgen_context_t* ctx) {
+    fprintf(ctx->out, "int main(void) {\n");
+    fprintf(ctx->out, "    tac_start_ = clock();\n");
+    fprintf(ctx->out, "    tac_program_();\n");
+    fprintf(ctx->out, "    tac_done_();\n");
+    fprintf(ctx->out, "    return 0;\n}\n\n");
+
+    fprintf(ctx->out, "static void tac_done_(void) {\n");
+    fprintf(ctx->out, "    double seconds = (double)(clock() - tac_start_) / CLOCKS_PER_SEC;\n");
+    for (uint32_t k = 0; k < CGEN_TEMP_BASE; k++) {
+        if (ctx->key_owner[k] == CGEN_SHARED) {
+            fprintf(ctx->out, "    printf(\"v%u %%d\\n\", (int)v%u);\n", k, k);
+        }
+    }
+    fprintf(ctx->out, "    printf(\"seconds %%.6f\\n\", seconds);\n");
+    fprintf(ctx->out, "    fflush(stdout);\n");
+    fprintf(ctx->out, "    exit(0);\n}\n");
+}
+
+static int cgen_emit(cgen_context_t* ctx, const TACCGenOptions* options) {
+    uint32_t body = ctx->function_count - 1;
+
+    fprintf(ctx->out, "/* C translation of %s, generated by tac_cgen */\n\n",
+            options->source_name ? options->source_name : "a TAC program");
+    for (size_t i = 0; i < sizeof(cgen_prelude) / sizeof(cgen_prelude[0]); i++) {
+        fprintf(ctx->out, "%s\n", cgen_prelude[i]);
+    }
+
+    for (uint32_t k = 0; k < CGEN_KEYS; k++) {
+        if (ctx->key_owner[k] == CGEN_SHARED) {
+            char name[16];
+            cgen_slot_name(k, name, sizeof(name));
+            fprintf(ctx->out, "static int32_t %s;\n", name);
+        }
+    }
+    fprintf(ctx->out, "\n");
+
+    for (uint32_t f = 0; f < body; f++) {
+        cgen_emit_signature(ctx, f);
+        fprintf(ctx->out, ";\n");
+    }
+    fprintf(ctx->out, "\n");
+
+    for (uint32_t f = 0; f < ctx->function_count; f++) {
+        if (cgen_emit_function(ctx, f) != 0) {
+            return -1;
+        }
+    }
+    cgen_emit_program(ctx);
+    return ferror(ctx->out) ? cgen_fail(ctx, 0, "write error") : 0;
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+int tac_cgen_emit(FILE* out, const TACInstruction* code, uint32_t count,
+                  const TACCGenOptions* options, char* error, size_t error_size) {
+    TACCGenOptions defaults = { 0, NULL, NULL, 0 };
+    cgen_context_t ctx;
+    int result = -1;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.out = out;
+    ctx.code = code;
+    ctx.count = count;
+    ctx.error = error;
+    ctx.error_size = error_size;
+    if (error && error_size > 0) {
+        error[0] = '\0';
+    }
+    if (!options) {
+        options = &defaults;
+    }
+    if (!out || !code || count == 0) {
+        return cgen_fail(&ctx, 0, "no code to translate");
+    }
+    if (options->entry >= count) {
+        return cgen_fail(&ctx, options->entry, "entry point out of range");
+    }
+
+    ctx.label_index = malloc(CGEN_LABELS * sizeof(uint32_t));
+    ctx.target = malloc((size_t)count * sizeof(uint32_t));
+    ctx.function_of = malloc((size_t)count * sizeof(uint32_t));
+    ctx.functions = calloc((size_t)count + 1, sizeof(cgen_function_t));
+    ctx.marks = malloc(count);
+    ctx.worklist = malloc((size_t)count * sizeof(uint32_t));
+    ctx.key_owner = malloc(CGEN_KEYS * sizeof(uint32_t));
+    ctx.key_state = calloc(CGEN_KEYS, 1);
+
+    if (!ctx.label_index || !ctx.target || !ctx.function_of || !ctx.functions ||
+        !ctx.marks || !ctx.worklist || !ctx.key_owner || !ctx.key_state) {
+        cgen_fail(&ctx, 0, "out of memory");
+    } else if (cgen_analyze(&ctx, options) == 0) {
+        result = cgen_emit(&ctx, options);
+    }
+
+    free(ctx.label_index);
+    free(ctx.target);
+    free(ctx.function_of);
+    free(ctx.functions);
+    free(ctx.reach);
+    free(ctx.marks);
+    free(ctx.worklist);
+    free(ctx.key_owner);
+    free(ctx.key_state);
+    return result;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file tac_cgen.h
+ * @brief Ahead-of-time translation of TAC programs to C99
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * @details Emits a self-contained C99 translation unit for a TAC program
+ * that the system compiler can build into a native executable. Every CALL
+ * target becomes a C function and the code at the entry point becomes the
+ * program body. Temporaries and variables referenced by only one function
+ * become C locals, labels become goto targets and calls become C calls.
+ * Parameters are bound from the function records cc2 writes (see
+ * tac_function.h), in declaration order, like tac_engine_load_program().
+ *
+ * The generated main() runs the program, then prints every program-level
+ * variable as "v<id> <value>" and the run time as "seconds <value>", one
+ * per line, so results can be compared against tac_engine_run(). A
+ * division by zero prints "error Division by zero" and exits with 1.
+ *
+ * Only integer TAC is translated: memory operations (LOAD, STORE, ADDR,
+ * INDEX, MEMBER), CAST, SIZEOF and PHI are rejected.
+ */
+
+#ifndef SRC_IR_TAC_CGEN_H_
+#define SRC_IR_TAC_CGEN_H_
+
+#include <stdio.h>
+#include <stddef.h>
+#include "tac_types.h"
+
+/**
+ * @brief Translation options
+ */
+typedef struct TACCGenOptions {
+    uint32_t entry;            // Instruction index where execution starts
+    const char* source_name;   // Shown in the header comment (may be NULL)
+    const TACFunction* functions; // Function records (NULL: no parameters)
+    uint32_t function_count;   // Number of function records
+} TACCGenOptions;
+
+/**
+ * @brief Translate a TAC program to C99
+ * @param out Destination stream
+ * @param code Instructions, indexed from 0
+ * @param count Number of instructions
+ * @param options Translation options (NULL: start at instruction 0)
+ * @param error Buffer for a description of the failure (may be NULL)
+ * @param error_size Size of the error buffer
+ * @return 0 on success, -1 if the program cannot be translated
+ */
+int tac_cgen_emit(FILE* out, const TACInstruction* code, uint32_t count,
+                  const TACCGenOptions* options, char* error, size_t error_size);
+
+#endif  // SRC_IR_TAC_CGEN_H_
@@ -0,0 +1,100 @@
+/**
+ * @file tac_function.c
+ * @brief Function metadata of a TAC program
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ */
+
+#include "tac_function.h"
+#include "tac_stats.h"
+#include <stdlib.h>
+
+const TACFunction* tac_function_at(const TACFunction* functions, uint32_t count,
+                                   uint32_t label) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (functions[i].start_idx != 0 && (uint32_t)functions[i].start_idx - 1 == label) {
+            return &functions[i];
+        }
+    }
+    return NULL;
+}
+
+uint32_t tac_function_params(const TACFunction* function, uint16_t* ids, uint32_t max) {
+    if (!function || function->first_param == 0) {
+        return 0;
+    }
+
+    uint32_t count = function->param_count < max ? function->param_count : max;
+    for (uint32_t i = 0; i < count; i++) {
+        ids[i] = (uint16_t)(function->first_param + i);
+    }
+    return count;
+}
+
+/**
+ * @brief Locals of the function whose symbol is at symbols[at]
+ *
+ * cc1 adds a function's symbol after its body, so its parameters and
+ * locals are the block-scope symbols right before it.
+ */
+static uint16_t tac_function_locals(const SymTabEntry* symbols, uint32_t at) {
+    uint32_t declared = 0;
+    while (at > 0 && symbols[at - 1].scope_depth > 0 &&
+           symbols[at - 1].type != SYM_FUNCTION) {
+        declared++;
+        at--;
+    }
+
+    uint32_t params = symbols[at + declared].extra.function.param_count;
+    return (uint16_t)(declared > params ? declared - params : 0);
+}
+
+int tac_functions_from_symbols(const TACInstruction* code, uint32_t count,
+                               const SymTabEntry* symbols, uint32_t symbol_count,
+                               TACFunction** functions, uint32_t* function_count) {
+    *functions = NULL;
+    *function_count = 0;
+
+    TACStats stats;
+    if (tac_stats_compute(code, count, &stats) != 0) {
+        return -1;
+    }
+
+    uint32_t defined = 0;
+    for (uint32_t i = 0; i < symbol_count; i++) {
+        if (symbols[i].type == SYM_FUNCTION) {
+            defined++;
+        }
+    }
+
+    // Declared but undefined functions would shift the pairing: give up
+    int result = 0;
+    if (defined > 0 && defined == stats.function_count) {
+        TACFunction* records = calloc(defined, sizeof(TACFunction));
+        if (!records) {
+            result = -1;
+        } else {
+            uint32_t f = 0;
+            for (uint32_t i = 0; i < symbol_count; i++) {
+                if (symbols[i].type != SYM_FUNCTION) {
+                    continue;
+                }
+                const TACFunctionStats* label = &stats.functions[f];
+                TACFunction* record = &records[f++];
+                record->symbol_idx = (SymIdx_t)(i + 1);
+                record->start_idx = (TACIdx_t)(label->start + 1);
+                record->end_idx = (TACIdx_t)(label->start + label->size);
+                record->param_count = symbols[i].extra.function.param_count;
+                record->first_param = symbols[i].extra.function.first_param;
+                record->local_count = tac_function_locals(symbols, i);
+            }
+            *functions = records;
+            *function_count = defined;
+        }
+    }
+
+    tac_stats_free(&stats);
+    return result;
+}
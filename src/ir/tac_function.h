@@ -0,0 +1,62 @@
+/**
+ * @file tac_function.h
+ * @brief Function metadata of a TAC program
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * @details cc2 records one TACFunction per function definition in the
+ * function section of its TAC file (see tac_store.h): the label opening
+ * the function, its parameters and how many locals and temporaries it
+ * uses. Consumers that frame calls (the TAC engine, tac_cgen) look
+ * functions up by label position and bind arguments to the parameters in
+ * declaration order.
+ *
+ * TAC without a function section can get the same records from the symbol
+ * table: cc1 stores the parameters of each SYM_FUNCTION in its extra data,
+ * and function labels pair with the SYM_FUNCTION entries in order (see
+ * tac_stats.h for how function labels are found).
+ */
+
+#ifndef SRC_IR_TAC_FUNCTION_H_
+#define SRC_IR_TAC_FUNCTION_H_
+
+#include <stdint.h>
+#include "tac_types.h"
+
+/**
+ * @brief Function whose label is a given instruction
+ * @param functions Records in any order (may be NULL if count is 0)
+ * @param count Number of records
+ * @param label Instruction index of the label, from 0
+ * @return The record, or NULL if no function opens there
+ */
+const TACFunction* tac_function_at(const TACFunction* functions, uint32_t count,
+                                   uint32_t label);
+
+/**
+ * @brief Variable ids of a function's parameters, in declaration order
+ * @param function Function record (NULL: no parameters)
+ * @param ids Receives at most max ids
+ * @param max Capacity of ids
+ * @return Number of ids written
+ */
+uint32_t tac_function_params(const TACFunction* function, uint16_t* ids, uint32_t max);
+
+/**
+ * @brief Function records from a symbol table, for TAC without a section
+ * @param code Instructions, indexed from 0
+ * @param count Number of instructions
+ * @param symbols Symbol table, entry idx at [idx - 1]
+ * @param symbol_count Number of symbols
+ * @param functions Receives the records (free()); NULL if there are none
+ * @param function_count Receives the number of records
+ * @return 0 on success (also when labels and symbols do not pair up, with
+ *         no records), -1 if out of memory
+ */
+int tac_functions_from_symbols(const TACInstruction* code, uint32_t count,
+                               const SymTabEntry* symbols, uint32_t symbol_count,
+                               TACFunction** functions, uint32_t* function_count);
+
+#endif  // SRC_IR_TAC_FUNCTION_H_
@@ -11,8 +11,11 @@
 #include "tac_builder.h"
 #include "../storage/symtab.h"
 #include "../storage/sstore.h"
+#include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 // Global function table for label-to-name mapping
 static TACPrinterFunctionTable* g_function_table = NULL;
@@ -31,46 +34,199 @@ void tac_printer_clear_function_table(void) {
     g_function_table = NULL;
 }
 
+// Global execution profile for annotated listings
+static const TACPrinterProfile* g_profile = NULL;
+
 /**
- * @brief Print a TAC operand
+ * @brief Annotate printed instructions with execution counts
  */
-void tac_print_operand(TACOperand operand) {
+void tac_printer_set_profile(const TACPrinterProfile* profile) {
+    g_profile = profile;
+}
+
+/**
+ * @brief Stop annotating printed instructions
+ */
+void tac_printer_clear_profile(void) {
+    g_profile = NULL;
+}
+
+// Text buffer the printer formats into; flushed to stdout or a file
+typedef struct {
+    char* data;
+    size_t len;
+    size_t cap;
+} TACText;
+
+// Names of the variables an instruction range refers to, looked up once
+// before formatting so that worker threads never touch symtab/sstore
+typedef struct {
+    char** names;                        // Indexed by variable ID, NULL if unnamed
+    uint32_t count;                      // Entries in names
+} TACNameCache;
+
+#define TAC_WRITE_FLUSH_SIZE (1u << 20)  // Bytes buffered before each write
+#define TAC_WRITE_MIN_CHUNK  4096        // Fewest instructions worth a thread
+
+// Threads used by tac_write_to_file(), 0 = one per online CPU
+static unsigned g_write_threads = 0;
+
+// Buffer behind tac_print_instruction() and tac_print_operand()
+static TACText g_stdout_text = {NULL, 0, 0};
+
+/**
+ * @brief Make room for len more bytes
+ *
+ * @return 1 on success, 0 if out of memory (the text is then left as is)
+ */
+static int tac_text_reserve(TACText* text, size_t len) {
+    if (text->len + len <= text->cap) {
+        return 1;
+    }
+
+    size_t cap = text->cap ? text->cap : 256;
+    while (cap < text->len + len) {
+        cap *= 2;
+    }
+    char* data = realloc(text->data, cap);
+    if (data == NULL) {
+        return 0;
+    }
+    text->data = data;
+    text->cap = cap;
+    return 1;
+}
+
+static void tac_text_put(TACText* text, const char* str, size_t len) {
+    if (tac_text_reserve(text, len)) {
+        memcpy(text->data + text->len, str, len);
+        text->len += len;
+    }
+}
+
+static void tac_text_puts(TACText* text, const char* str) {
+    tac_text_put(text, str, strlen(str));
+}
+
+static void tac_text_putc(TACText* text, char c) {
+    if (tac_text_reserve(text, 1)) {
+        text->data[text->len++] = c;
+    }
+}
+
+/**
+ * @brief Append a decimal number right-aligned in width columns, like "%*d"
+ */
+static void tac_text_number(TACText* text, uint64_t magnitude, int negative, int width) {
+    char digits[24];
+    int n = 0;
+
+    do {
+        digits[n++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (negative) {
+        digits[n++] = '-';
+    }
+
+    int pad = width > n ? width - n : 0;
+    if (!tac_text_reserve(text, (size_t)(pad + n))) {
+        return;
+    }
+    memset(text->data + text->len, ' ', (size_t)pad);
+    text->len += (size_t)pad;
+    while (n > 0) {
+        text->data[text->len++] = digits[--n];
+    }
+}
+
+static void tac_text_int(TACText* text, int32_t value) {
+    uint64_t magnitude = value < 0 ? (uint64_t)0 - (uint64_t)(int64_t)value : (uint64_t)value;
+    tac_text_number(text, magnitude, value < 0, 0);
+}
+
+/**
+ * @brief Append the profile's execution count column, if a profile is set
+ */
+static void tac_format_profile_count(TACText* text, TACIdx_t idx) {
+    if (!g_profile) {
+        return;
+    }
+    if (idx >= 1 && (uint32_t)idx <= g_profile->count) {
+        tac_text_number(text, g_profile->executed[idx - 1], 0, 12);
+    } else {
+        tac_text_put(text, "            ", 12);
+    }
+    tac_text_put(text, " | ", 3);
+}
+
+/**
+ * @brief Look up a variable's name, reporting symbols without one
+ *
+ * @return The name (in sstore's buffer, valid until the next lookup) or NULL
+ */
+static const char* tac_lookup_variable(uint16_t id) {
+    if (id == 0) {
+        fprintf(stderr, "ERROR: Invalid variable ID 0\n");
+        return NULL;
+    }
+
+    SymTabEntry entry = symtab_get(id);
+    if (entry.name == 0) {
+        fprintf(stderr, "ERROR: Variable symbol %d has entry.name=0\n", id);
+        return NULL;
+    }
+
+    char* var_name = sstore_get(entry.name);
+    if (!var_name || strlen(var_name) == 0) {
+        fprintf(stderr, "ERROR: Variable symbol %d has no name in string store\n", id);
+        return NULL;
+    }
+    return var_name;
+}
+
+/**
+ * @brief Format a TAC operand
+ *
+ * @param names Pre-resolved variable names, or NULL to look them up here
+ */
+static void tac_format_operand(TACText* text, TACOperand operand, const TACNameCache* names) {
     switch (operand.type) {
         case TAC_OP_NONE:
-            printf("_");
+            tac_text_putc(text, '_');
             break;
 
         case TAC_OP_TEMP:
-            printf("t%d", operand.data.variable.id);
+            tac_text_putc(text, 't');
+            tac_text_int(text, operand.data.variable.id);
             break;
 
         case TAC_OP_VAR:
             // Get the actual variable name from symbol table - no fallbacks allowed
-            if (operand.data.variable.id > 0) {
-                SymTabEntry entry = symtab_get(operand.data.variable.id);
-                if (entry.name > 0) {
-                    char* var_name = sstore_get(entry.name);
-                    if (var_name && strlen(var_name) > 0) {
-                        printf("%s", var_name);
-                    } else {
-                        fprintf(stderr, "ERROR: Variable symbol %d has no name in string store\n", operand.data.variable.id);
-                        printf("ERROR_VAR_%d", operand.data.variable.id);
-                    }
+            {
+                uint16_t id = operand.data.variable.id;
+                const char* var_name = NULL;
+                if (names) {
+                    var_name = id < names->count ? names->names[id] : NULL;
+                } else {
+                    var_name = tac_lookup_variable(id);
+                }
+
+                if (var_name) {
+                    tac_text_puts(text, var_name);
                 } else {
-                    fprintf(stderr, "ERROR: Variable symbol %d has entry.name=0\n", operand.data.variable.id);
-                    printf("ERROR_VAR_%d", operand.data.variable.id);
+                    tac_text_put(text, "ERROR_VAR_", 10);
+                    tac_text_int(text, id);
                 }
-            } else {
-                fprintf(stderr, "ERROR: Invalid variable ID 0\n");
-                printf("ERROR_VAR_0");
             }
             if (operand.data.variable.scope > 0) {
-                printf(".%d", operand.data.variable.scope);
+                tac_text_putc(text, '.');
+                tac_text_int(text, operand.data.variable.scope);
             }
             break;
 
         case TAC_OP_IMMEDIATE:
-            printf("%d", operand.data.immediate.value);
+            tac_text_int(text, operand.data.immediate.value);
             break;
 
         case TAC_OP_LABEL:
@@ -78,7 +234,7 @@ void tac_print_operand(TACOperand operand) {
             {
                 uint16_t label_id = operand.data.label.offset;
                 char* func_name = NULL;
-                
+
                 // Check if this is a function label (file scope)
                 if (g_function_table) {
                     for (uint32_t i = 0; i < g_function_table->count; i++) {
@@ -88,121 +244,175 @@ void tac_print_operand(TACOperand operand) {
                         }
                     }
                 }
-                
+
                 if (func_name && strlen(func_name) > 0) {
                     // Function scope label (file scope in C99)
-                    printf("%s", func_name);
+                    tac_text_puts(text, func_name);
                 } else {
-                    // Block scope label (function scope in C99) 
-                    // Use descriptive names based on control flow context
-                    printf("L%d", label_id);
+                    // Block scope label (function scope in C99)
+                    tac_text_putc(text, 'L');
+                    tac_text_int(text, label_id);
                 }
             }
             break;
 
         case TAC_OP_FUNCTION:
-            printf("f%d", operand.data.function.func_id);
+            tac_text_putc(text, 'f');
+            tac_text_int(text, operand.data.function.func_id);
             break;
 
         case TAC_OP_GLOBAL:
-            printf("g%d", operand.data.variable.id);
+            tac_text_putc(text, 'g');
+            tac_text_int(text, operand.data.variable.id);
             break;
 
         case TAC_OP_PARAM:
-            printf("p%d", operand.data.variable.id);
+            tac_text_putc(text, 'p');
+            tac_text_int(text, operand.data.variable.id);
             break;
 
         case TAC_OP_RETURN_VAL:
-            printf("ret");
+            tac_text_put(text, "ret", 3);
             break;
 
         default:
-            printf("?%d", operand.data.raw);
+            tac_text_putc(text, '?');
+            tac_text_int(text, (int32_t)operand.data.raw);
             break;
     }
 }
 
 /**
- * @brief Print a TAC instruction
+ * @brief Format a TAC instruction as one line of listing
  */
-void tac_print_instruction(TACInstruction instr, TACIdx_t idx) {
-    printf("[%4d] ", idx);
+static void tac_format_instruction(TACText* text, TACInstruction instr, TACIdx_t idx,
+                                   const TACNameCache* names) {
+    tac_text_putc(text, '[');
+    tac_text_number(text, idx, 0, 4);
+    tac_text_put(text, "] ", 2);
+    tac_format_profile_count(text, idx);
 
     // Handle special cases
     if (instr.opcode == TAC_LABEL) {
-        tac_print_operand(instr.result);
-        printf(":\n");
+        tac_format_operand(text, instr.result, names);
+        tac_text_put(text, ":\n", 2);
         return;
     }
 
     if (instr.opcode == TAC_GOTO) {
-        printf("goto ");
-        tac_print_operand(instr.operand1);
-        printf("\n");
+        tac_text_put(text, "goto ", 5);
+        tac_format_operand(text, instr.operand1, names);
+        tac_text_putc(text, '\n');
         return;
     }
 
     if (instr.opcode == TAC_IF_FALSE || instr.opcode == TAC_IF_TRUE) {
-        printf("%s ", tac_opcode_to_string(instr.opcode));
-        tac_print_operand(instr.operand1);
-        printf(" goto ");
-        tac_print_operand(instr.operand2);
-        printf("\n");
+        tac_text_puts(text, tac_opcode_to_string(instr.opcode));
+        tac_text_putc(text, ' ');
+        tac_format_operand(text, instr.operand1, names);
+        tac_text_put(text, " goto ", 6);
+        tac_format_operand(text, instr.operand2, names);
+        if (g_profile && g_profile->taken && idx >= 1 && (uint32_t)idx <= g_profile->count &&
+            g_profile->executed[idx - 1] > 0) {
+            char taken[48];
+            int len = snprintf(taken, sizeof(taken), "  ; taken %.1f%%",
+                               100.0 * (double)g_profile->taken[idx - 1] /
+                               (double)g_profile->executed[idx - 1]);
+            tac_text_put(text, taken, (size_t)len);
+        }
+        tac_text_putc(text, '\n');
         return;
     }
 
     if (instr.opcode == TAC_RETURN) {
-        printf("return ");
+        tac_text_put(text, "return ", 7);
         if (instr.operand1.type != TAC_OP_NONE) {
-            tac_print_operand(instr.operand1);
+            tac_format_operand(text, instr.operand1, names);
         }
-        printf("\n");
+        tac_text_putc(text, '\n');
         return;
     }
 
     if (instr.opcode == TAC_RETURN_VOID) {
-        printf("return\n");
+        tac_text_put(text, "return\n", 7);
         return;
     }
 
     if (instr.opcode == TAC_PARAM) {
-        printf("param ");
-        tac_print_operand(instr.operand1);
-        printf("\n");
+        tac_text_put(text, "param ", 6);
+        tac_format_operand(text, instr.operand1, names);
+        tac_text_putc(text, '\n');
         return;
     }
 
     // Binary operations with result
     if (instr.result.type != TAC_OP_NONE) {
-        tac_print_operand(instr.result);
-        printf(" = ");
+        tac_format_operand(text, instr.result, names);
+        tac_text_put(text, " = ", 3);
     }
 
     // Print operation
     if (instr.operand2.type != TAC_OP_NONE) {
         // Binary operation
-        tac_print_operand(instr.operand1);
-        printf(" %s ", tac_opcode_to_string(instr.opcode));
-        tac_print_operand(instr.operand2);
+        tac_format_operand(text, instr.operand1, names);
+        tac_text_putc(text, ' ');
+        tac_text_puts(text, tac_opcode_to_string(instr.opcode));
+        tac_text_putc(text, ' ');
+        tac_format_operand(text, instr.operand2, names);
     } else if (instr.operand1.type != TAC_OP_NONE) {
         // Unary operation or assignment
-        if (instr.opcode == TAC_ASSIGN) {
-            tac_print_operand(instr.operand1);
-        } else {
-            printf("%s ", tac_opcode_to_string(instr.opcode));
-            tac_print_operand(instr.operand1);
+        if (instr.opcode != TAC_ASSIGN) {
+            tac_text_puts(text, tac_opcode_to_string(instr.opcode));
+            tac_text_putc(text, ' ');
         }
+        tac_format_operand(text, instr.operand1, names);
     } else {
         // No operands
-        printf("%s", tac_opcode_to_string(instr.opcode));
+        tac_text_puts(text, tac_opcode_to_string(instr.opcode));
     }
 
     // Print flags if any
     if (instr.flags != TAC_FLAG_NONE) {
-        printf("  ; flags: 0x%04x", instr.flags);
+        static const char hex[] = "0123456789abcdef";
+        unsigned flags = (unsigned)instr.flags;
+        char digits[8];
+        int n = 0;
+        do {
+            digits[n++] = hex[flags & 0xf];
+            flags >>= 4;
+        } while (flags > 0 || n < 4);
+
+        tac_text_put(text, "  ; flags: 0x", 13);
+        while (n > 0) {
+            tac_text_putc(text, digits[--n]);
+        }
     }
 
-    printf("\n");
+    tac_text_putc(text, '\n');
+}
+
+/**
+ * @brief Write out and empty the stdout buffer
+ */
+static void tac_flush_stdout_text(void) {
+    fwrite(g_stdout_text.data, 1, g_stdout_text.len, stdout);
+    g_stdout_text.len = 0;
+}
+
+/**
+ * @brief Print a TAC operand
+ */
+void tac_print_operand(TACOperand operand) {
+    tac_format_operand(&g_stdout_text, operand, NULL);
+    tac_flush_stdout_text();
+}
+
+/**
+ * @brief Print a TAC instruction
+ */
+void tac_print_instruction(TACInstruction instr, TACIdx_t idx) {
+    tac_format_instruction(&g_stdout_text, instr, idx, NULL);
+    tac_flush_stdout_text();
 }
 
 /**
@@ -241,6 +451,194 @@ void tac_print_range(TACIdx_t start, TACIdx_t end) {
     printf("\n");
 }
 
+/**
+ * @brief Set the number of threads formatting tac_write_to_file() output
+ */
+void tac_printer_set_write_threads(unsigned threads) {
+    g_write_threads = threads;
+}
+
+/**
+ * @brief Look up every variable name the instructions use, once each
+ *
+ * @return 1 on success, 0 if out of memory
+ */
+static int tac_name_cache_build(TACNameCache* cache, const TACInstruction* instrs, uint32_t n) {
+    cache->names = NULL;
+    cache->count = 0;
+
+    uint32_t max_id = 0;
+    int any = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        const TACOperand* operands[3] = {&instrs[i].result, &instrs[i].operand1, &instrs[i].operand2};
+        for (int j = 0; j < 3; j++) {
+            if (operands[j]->type == TAC_OP_VAR) {
+                any = 1;
+                if (operands[j]->data.variable.id > max_id) {
+                    max_id = operands[j]->data.variable.id;
+                }
+            }
+        }
+    }
+    if (!any) {
+        return 1;
+    }
+
+    // Resolved marks IDs already looked up, including those without a name
+    cache->names = calloc(max_id + 1, sizeof(char*));
+    unsigned char* resolved = calloc(max_id + 1, 1);
+    if (!cache->names || !resolved) {
+        free(cache->names);
+        free(resolved);
+        cache->names = NULL;
+        return 0;
+    }
+    cache->count = max_id + 1;
+
+    for (uint32_t i = 0; i < n; i++) {
+        const TACOperand* operands[3] = {&instrs[i].result, &instrs[i].operand1, &instrs[i].operand2};
+        for (int j = 0; j < 3; j++) {
+            uint16_t id = operands[j]->data.variable.id;
+            if (operands[j]->type != TAC_OP_VAR || resolved[id]) {
+                continue;
+            }
+            resolved[id] = 1;
+            const char* name = tac_lookup_variable(id);
+            if (name) {
+                cache->names[id] = strdup(name);
+            }
+        }
+    }
+
+    free(resolved);
+    return 1;
+}
+
+static void tac_name_cache_free(TACNameCache* cache) {
+    for (uint32_t i = 0; i < cache->count; i++) {
+        free(cache->names[i]);
+    }
+    free(cache->names);
+    cache->names = NULL;
+    cache->count = 0;
+}
+
+// One slice of the listing, formatted by one thread
+typedef struct {
+    const TACInstruction* instrs;
+    uint32_t first;                      // TAC index of instrs[0]
+    uint32_t count;
+    const TACNameCache* names;
+    FILE* fp;                            // Flush to fp as the text grows, or NULL
+    int started;                         // Formatted by a thread of its own
+    TACText text;
+} TACWriteChunk;
+
+static void* tac_write_chunk(void* arg) {
+    TACWriteChunk* chunk = arg;
+
+    for (uint32_t i = 0; i < chunk->count; i++) {
+        tac_format_instruction(&chunk->text, chunk->instrs[i], (TACIdx_t)(chunk->first + i),
+                               chunk->names);
+        if (chunk->fp && chunk->text.len >= TAC_WRITE_FLUSH_SIZE) {
+            fwrite(chunk->text.data, 1, chunk->text.len, chunk->fp);
+            chunk->text.len = 0;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Number of threads to format n instructions with
+ */
+static uint32_t tac_write_thread_count(uint32_t n) {
+    long threads = g_write_threads;
+    if (threads == 0) {
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (threads > (long)(n / TAC_WRITE_MIN_CHUNK)) {
+        threads = (long)(n / TAC_WRITE_MIN_CHUNK);
+    }
+    return threads > 1 ? (uint32_t)threads : 1;
+}
+
+/**
+ * @brief Write the listing of instructions [start, end] to fp
+ *
+ * Reads the range with one tacstore_read(), resolves variable names up
+ * front and formats into large buffers. Long ranges are split into equal
+ * slices formatted in parallel and written in order.
+ */
+static void tac_write_instructions(FILE* fp, uint32_t start, uint32_t end) {
+    if (start > end) {
+        return;
+    }
+
+    uint32_t n = end - start + 1;
+    TACInstruction* instrs = malloc((size_t)n * sizeof(TACInstruction));
+    if (!instrs) {
+        perror("tac_write_instructions");
+        return;
+    }
+    uint32_t got = tacstore_read((TACIdx_t)start, (TACIdx_t)n, instrs);
+    for (uint32_t i = got; i < n; i++) {
+        instrs[i] = tacstore_get((TACIdx_t)(start + i));
+    }
+
+    TACNameCache names;
+    if (!tac_name_cache_build(&names, instrs, n)) {
+        perror("tac_write_instructions");
+        free(instrs);
+        return;
+    }
+
+    uint32_t threads = tac_write_thread_count(n);
+    TACWriteChunk single;
+    TACWriteChunk* chunks = threads > 1 ? calloc(threads, sizeof(TACWriteChunk)) : NULL;
+    pthread_t* ids = threads > 1 ? calloc(threads, sizeof(pthread_t)) : NULL;
+    if (!chunks || !ids) {
+        free(chunks);
+        free(ids);
+        ids = NULL;
+        chunks = &single;
+        threads = 1;
+    }
+    memset(chunks, 0, threads * sizeof(TACWriteChunk));
+
+    uint32_t per_chunk = n / threads;
+    for (uint32_t t = 0; t < threads; t++) {
+        TACWriteChunk* chunk = &chunks[t];
+        chunk->instrs = instrs + t * per_chunk;
+        chunk->first = start + t * per_chunk;
+        chunk->count = t + 1 < threads ? per_chunk : n - t * per_chunk;
+        chunk->names = &names;
+        chunk->fp = threads == 1 ? fp : NULL;
+    }
+
+    for (uint32_t t = 1; t < threads; t++) {
+        chunks[t].started = pthread_create(&ids[t], NULL, tac_write_chunk, &chunks[t]) == 0;
+    }
+    tac_write_chunk(&chunks[0]);
+
+    for (uint32_t t = 0; t < threads; t++) {
+        if (chunks[t].started) {
+            pthread_join(ids[t], NULL);
+        } else if (t > 0) {
+            // Its thread could not be started
+            tac_write_chunk(&chunks[t]);
+        }
+        fwrite(chunks[t].text.data, 1, chunks[t].text.len, fp);
+        free(chunks[t].text.data);
+    }
+
+    free(ids);
+    if (chunks != &single) {
+        free(chunks);
+    }
+    tac_name_cache_free(&names);
+    free(instrs);
+}
+
 /**
  * @brief Write TAC to file
  */
@@ -255,12 +653,12 @@ void tac_write_to_file(const char* filename) {
 
     fprintf(fp, "; TAC Instructions - Generated by STCC1\n");
     fprintf(fp, "; Total instructions: %d\n", count);
-    
+
     // Write main function label metadata for test framework
     if (g_function_table) {
         uint32_t main_label = 0;
         for (uint32_t i = 0; i < g_function_table->count; i++) {
-            if (g_function_table->function_names[i] && 
+            if (g_function_table->function_names[i] &&
                 strcmp(g_function_table->function_names[i], "main") == 0) {
                 main_label = g_function_table->label_ids[i];
                 break;
@@ -272,15 +670,7 @@ void tac_write_to_file(const char* filename) {
     }
     fprintf(fp, "\n");
 
-    for (TACIdx_t i = 1; i <= count; i++) {
-        TACInstruction instr = tacstore_get(i);
-
-        // Redirect printf to file by temporarily changing stdout
-        FILE* old_stdout = stdout;
-        stdout = fp;
-        tac_print_instruction(instr, i);
-        stdout = old_stdout;
-    }
+    tac_write_instructions(fp, 1, count);
 
     fclose(fp);
     printf("TAC written to %s\n", filename);
@@ -303,65 +693,33 @@ void tac_write_range_to_file(const char* filename, TACIdx_t start, TACIdx_t end)
 
     fprintf(fp, "; TAC Instructions [%d-%d] - Generated by STCC1\n\n", start, end);
 
-    for (TACIdx_t i = start; i <= end; i++) {
-        TACInstruction instr = tacstore_get(i);
-
-        // Redirect printf to file
-        FILE* old_stdout = stdout;
-        stdout = fp;
-        tac_print_instruction(instr, i);
-        stdout = old_stdout;
-    }
+    tac_write_instructions(fp, start, end);
 
     fclose(fp);
     printf("TAC range [%d-%d] written to %s\n", start, end, filename);
 }
 
 /**
- * @brief Print TAC statistics
+ * @brief Print computed TAC statistics
  */
-void tac_print_statistics(void) {
-    TACIdx_t count = tacstore_getidx();
-
-    // Count different instruction types
-    int opcode_counts[256] = {0};  // Assuming opcodes fit in 8 bits
-    int operand_type_counts[16] = {0};
-
-    for (TACIdx_t i = 1; i <= count; i++) {
-        TACInstruction instr = tacstore_get(i);
-
-        if (instr.opcode < 256) {
-            opcode_counts[instr.opcode]++;
-        }
-
-        if (instr.result.type < 16) {
-            operand_type_counts[instr.result.type]++;
-        }
-        if (instr.operand1.type < 16) {
-            operand_type_counts[instr.operand1.type]++;
-        }
-        if (instr.operand2.type < 16) {
-            operand_type_counts[instr.operand2.type]++;
-        }
-    }
-
+void tac_print_stats(const TACStats* stats) {
     printf("=== TAC Statistics ===\n");
-    printf("Total instructions: %d\n", count);
-    printf("Memory usage: %zu bytes\n", (size_t)count * sizeof(TACInstruction));
+    printf("Total instructions: %u\n", stats->instruction_count);
+    printf("Memory usage: %zu bytes\n", (size_t)stats->instruction_count * sizeof(TACInstruction));
     printf("\nInstruction type distribution:\n");
 
     // Print non-zero instruction counts
-    for (int op = 0; op < 256; op++) {
-        if (opcode_counts[op] > 0) {
-            printf("  %-12s: %d\n", tac_opcode_to_string((TACOpcode)op), opcode_counts[op]);
+    for (int op = 0; op < TAC_STATS_OPCODES; op++) {
+        if (stats->opcode_counts[op] > 0) {
+            printf("  %-12s: %u\n", tac_opcode_to_string((TACOpcode)op), stats->opcode_counts[op]);
         }
     }
 
     printf("\nOperand type distribution:\n");
-    for (int type = 0; type < 16; type++) {
-        if (operand_type_counts[type] > 0) {
-            printf("  %-8s: %d\n", tac_operand_type_to_string((TACOperandType)type),
-                   operand_type_counts[type]);
+    for (int type = 0; type < TAC_STATS_OPERAND_TYPES; type++) {
+        if (stats->operand_type_counts[type] > 0) {
+            printf("  %-8s: %u\n", tac_operand_type_to_string((TACOperandType)type),
+                   stats->operand_type_counts[type]);
         }
     }
 
@@ -369,50 +727,121 @@ void tac_print_statistics(void) {
 }
 
 /**
- * @brief Analyze operand usage patterns
+ * @brief Print TAC statistics
  */
-void tac_analyze_operand_usage(void) {
-    TACIdx_t count = tacstore_getidx();
-
-    int max_temp = 0;
-    int max_var = 0;
-    int max_label = 0;
+void tac_print_statistics(void) {
+    TACStats stats;
+    if (tac_stats_compute_store(&stats) != 0) {
+        fprintf(stderr, "tac_print_statistics: cannot read TAC store\n");
+        return;
+    }
+    tac_print_stats(&stats);
+    tac_stats_free(&stats);
+}
 
-    for (TACIdx_t i = 1; i <= count; i++) {
-        TACInstruction instr = tacstore_get(i);
+/**
+ * @brief Print the operand usage part of computed TAC statistics
+ */
+void tac_print_operand_stats(const TACStats* stats) {
+    printf("=== Operand Usage Analysis ===\n");
+    printf("Maximum temporary ID: t%u\n", stats->max_temp);
+    printf("Maximum variable ID: v%u\n", stats->max_var);
+    printf("Maximum label ID: L%u\n", stats->max_label);
+    printf("Estimated register pressure: %u\n", stats->max_temp);
+    printf("\n");
+}
 
-        TACOperand operands[3] = {instr.result, instr.operand1, instr.operand2};
+/**
+ * @brief Write the summary of one slot kind
+ */
+static void tac_print_json_def_use(FILE* out, const char* name, const TACDefUseStats* du,
+                                   uint32_t max_id, const char* separator) {
+    fprintf(out, "    \"%s\": {\"max_id\": %u, \"slots\": %u, \"defs\": %u, \"uses\": %u, "
+            "\"single_def\": %u, \"unused\": %u, \"undefined\": %u}%s\n",
+            name, max_id, du->slots, du->defs, du->uses, du->single_def, du->unused,
+            du->undefined, separator);
+}
 
-        for (int j = 0; j < 3; j++) {
-            switch (operands[j].type) {
-                case TAC_OP_TEMP:
-                    if (operands[j].data.variable.id > max_temp) {
-                        max_temp = operands[j].data.variable.id;
-                    }
-                    break;
+void tac_print_stats_json(FILE* out, const TACStats* stats) {
+    uint32_t count = stats->instruction_count;
 
-                case TAC_OP_VAR:
-                    if (operands[j].data.variable.id > max_var) {
-                        max_var = operands[j].data.variable.id;
-                    }
-                    break;
+    fprintf(out, "{\n  \"instructions\": %u,\n", count);
 
-                case TAC_OP_LABEL:
-                    if (operands[j].data.label.offset > max_label) {
-                        max_label = operands[j].data.label.offset;
-                    }
-                    break;
+    // Opcodes the builder cannot name are keyed by their number
+    fprintf(out, "  \"opcodes\": {");
+    const char* separator = "";
+    for (uint32_t op = 0; op < TAC_STATS_OPCODES; op++) {
+        if (stats->opcode_counts[op] == 0) {
+            continue;
+        }
+        const char* name = tac_opcode_to_string((TACOpcode)op);
+        if (strcmp(name, "unknown") == 0) {
+            fprintf(out, "%s\"0x%02x\": %u", separator, op, stats->opcode_counts[op]);
+        } else {
+            fprintf(out, "%s\"%s\": %u", separator, name, stats->opcode_counts[op]);
+        }
+        separator = ", ";
+    }
+    fprintf(out, "},\n");
 
-                default:
-                    break;
-            }
+    fprintf(out, "  \"operand_types\": {");
+    separator = "";
+    for (uint32_t type = 0; type < TAC_STATS_OPERAND_TYPES; type++) {
+        if (stats->operand_type_counts[type] == 0) {
+            continue;
+        }
+        const char* name = tac_operand_type_to_string((TACOperandType)type);
+        if (strcmp(name, "unknown") == 0) {
+            fprintf(out, "%s\"%u\": %u", separator, type, stats->operand_type_counts[type]);
+        } else {
+            fprintf(out, "%s\"%s\": %u", separator, name, stats->operand_type_counts[type]);
         }
+        separator = ", ";
+    }
+    fprintf(out, "},\n");
+
+    fprintf(out, "  \"categories\": {\"labels\": %u, \"jumps\": %u, \"arithmetic\": %u, "
+            "\"assignments\": %u, \"function_ops\": %u},\n",
+            stats->labels, stats->jumps, stats->arithmetic, stats->assignments,
+            stats->function_ops);
+
+    fprintf(out, "  \"control_flow\": {\"branches\": %u, \"basic_blocks\": %u, "
+            "\"branch_density\": %.4f, \"instructions_per_block\": %.2f},\n",
+            stats->branches, stats->basic_blocks,
+            count ? (double)stats->branches / count : 0.0,
+            stats->basic_blocks ? (double)count / stats->basic_blocks : 0.0);
+
+    fprintf(out, "  \"flags\": {\"dead_code\": %u, \"const_fold\": %u, \"cse\": %u, "
+            "\"copy_prop\": %u, \"optimized\": %u},\n",
+            stats->dead_code, stats->const_fold, stats->cse, stats->copy_prop,
+            stats->optimized);
+
+    fprintf(out, "  \"def_use\": {\n");
+    tac_print_json_def_use(out, "temps", &stats->temps, stats->max_temp, ",");
+    tac_print_json_def_use(out, "vars", &stats->vars, stats->max_var, "");
+    fprintf(out, "  },\n");
+
+    fprintf(out, "  \"max_label\": %u,\n", stats->max_label);
+
+    fprintf(out, "  \"functions\": [");
+    for (uint32_t i = 0; i < stats->function_count; i++) {
+        const TACFunctionStats* function = &stats->functions[i];
+        fprintf(out, "%s\n    {\"label\": %u, \"start\": %u, \"size\": %u, \"calls\": %u}",
+                i ? "," : "", function->label, function->start, function->size,
+                function->calls);
     }
+    fprintf(out, "%s]\n}\n", stats->function_count ? "\n  " : "");
+}
 
-    printf("=== Operand Usage Analysis ===\n");
-    printf("Maximum temporary ID: t%d\n", max_temp);
-    printf("Maximum variable ID: v%d\n", max_var);
-    printf("Maximum label ID: L%d\n", max_label);
-    printf("Estimated register pressure: %d\n", max_temp);
-    printf("\n");
+/**
+ * @brief Analyze operand usage patterns
+ */
+void tac_analyze_operand_usage(void) {
+    TACStats stats;
+    if (tac_stats_compute_store(&stats) != 0) {
+        fprintf(stderr, "tac_analyze_operand_usage: cannot read TAC store\n");
+        return;
+    }
+    tac_print_operand_stats(&stats);
+    tac_stats_free(&stats);
 }
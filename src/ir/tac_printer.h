@@ -12,6 +12,7 @@
 
 #include "tac_types.h"
 #include "tac_store.h"
+#include "tac_stats.h"
 
 // Function table for label-to-name mapping in TAC printer
 typedef struct {
@@ -24,6 +25,18 @@ typedef struct {
 // Function table management
 void tac_printer_set_function_table(TACPrinterFunctionTable* table);
 void tac_printer_clear_function_table(void);
+
+// Execution counts for annotated listings, e.g. from tac_engine_get_profile().
+// Arrays are indexed by TAC index - 1 (the engine's instruction address).
+typedef struct {
+    const uint64_t* executed;            // Times each instruction ran
+    const uint64_t* taken;               // Times each conditional branch jumped (optional)
+    uint32_t count;                      // Entries in the arrays
+} TACPrinterProfile;
+
+// Profile annotation management
+void tac_printer_set_profile(const TACPrinterProfile* profile);
+void tac_printer_clear_profile(void);
 #include <stdio.h>
 
 // TAC printing functions
@@ -39,9 +52,15 @@ void tac_write_to_file(const char* filename);
 void tac_write_range_to_file(const char* filename,
                      TACIdx_t start,
                      TACIdx_t end);
+// Threads formatting a listing in parallel, 0 = one per online CPU (default).
+// Output is identical for any thread count.
+void tac_printer_set_write_threads(unsigned threads);
 
-// TAC analysis and statistics
+// TAC analysis and statistics (tac_stats_compute_store() + tac_print_stats())
 void tac_print_statistics(void);
 void tac_analyze_operand_usage(void);
+void tac_print_stats(const TACStats* stats);
+void tac_print_operand_stats(const TACStats* stats);
+void tac_print_stats_json(FILE* out, const TACStats* stats);  // One JSON object
 
 #endif  // SRC_IR_TAC_PRINTER_H_
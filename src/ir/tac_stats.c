@@ -0,0 +1,332 @@
+/**
+ * @file tac_stats.c
+ * @brief Single-pass statistics over a TAC program
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ */
+
+#define _DEFAULT_SOURCE             // madvise() under plain -std=c99
+
+#include "tac_stats.h"
+#include "tac_store.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#define TAC_STATS_IDS 65536        // Operand IDs are 16 bits
+
+// Per-ID counters filled during the pass
+typedef struct {
+    uint32_t temp_defs[TAC_STATS_IDS];
+    uint32_t temp_uses[TAC_STATS_IDS];
+    uint32_t var_defs[TAC_STATS_IDS];
+    uint32_t var_uses[TAC_STATS_IDS];
+    uint32_t label_pos[TAC_STATS_IDS];     // Index of the LABEL + 1, 0 if undefined
+    uint32_t label_calls[TAC_STATS_IDS];
+    uint8_t label_jumped[TAC_STATS_IDS];   // Target of a GOTO or IF_*
+    uint8_t label_opens[TAC_STATS_IDS];    // First label of the program or after a RETURN
+} TACStatsScratch;
+
+// Values of label_opens
+#define TAC_STATS_AFTER_RETURN 1
+#define TAC_STATS_ENTRY        2
+
+/**
+ * @brief Whether a label opens a function: it is called, it is the program
+ * entry, or it is the first label after a RETURN and no branch targets it
+ */
+static int tac_stats_is_function(const TACStatsScratch* scratch, uint32_t id) {
+    if (scratch->label_pos[id] == 0) {
+        return 0;
+    }
+    return scratch->label_calls[id] ||
+           scratch->label_opens[id] == TAC_STATS_ENTRY ||
+           (scratch->label_opens[id] == TAC_STATS_AFTER_RETURN && !scratch->label_jumped[id]);
+}
+
+/**
+ * @brief Count one operand read or written
+ */
+static void tac_stats_slot(TACStats* stats, TACStatsScratch* scratch,
+                           TACOperand operand, int def) {
+    uint16_t id = operand.data.variable.id;
+
+    if (operand.type == TAC_OP_TEMP) {
+        if (id > stats->max_temp) {
+            stats->max_temp = id;
+        }
+        if (def) {
+            scratch->temp_defs[id]++;
+            stats->temps.defs++;
+        } else {
+            scratch->temp_uses[id]++;
+            stats->temps.uses++;
+        }
+    } else if (operand.type == TAC_OP_VAR) {
+        if (id > stats->max_var) {
+            stats->max_var = id;
+        }
+        if (def) {
+            scratch->var_defs[id]++;
+            stats->vars.defs++;
+        } else {
+            scratch->var_uses[id]++;
+            stats->vars.uses++;
+        }
+    } else if (operand.type == TAC_OP_LABEL) {
+        if (operand.data.label.offset > stats->max_label) {
+            stats->max_label = operand.data.label.offset;
+        }
+    }
+}
+
+/**
+ * @brief Summarize the per-ID definition and use counts of one slot kind
+ */
+static void tac_stats_def_use(TACDefUseStats* out, const uint32_t* defs,
+                              const uint32_t* uses, uint32_t max_id) {
+    for (uint32_t id = 0; id <= max_id; id++) {
+        if (defs[id] == 0 && uses[id] == 0) {
+            continue;
+        }
+        out->slots++;
+        if (defs[id] == 1) {
+            out->single_def++;
+        }
+        if (defs[id] > 0 && uses[id] == 0) {
+            out->unused++;
+        }
+        if (defs[id] == 0) {
+            out->undefined++;
+        }
+    }
+}
+
+static int tac_function_compare(const void* a, const void* b) {
+    uint32_t x = ((const TACFunctionStats*)a)->start;
+    uint32_t y = ((const TACFunctionStats*)b)->start;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Build the function table from the label positions
+ */
+static int tac_stats_functions(TACStats* stats, const TACStatsScratch* scratch) {
+    uint32_t count = 0;
+    for (uint32_t id = 0; id <= stats->max_label; id++) {
+        if (tac_stats_is_function(scratch, id)) {
+            count++;
+        }
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    stats->functions = calloc(count, sizeof(TACFunctionStats));
+    if (!stats->functions) {
+        return -1;
+    }
+    for (uint32_t id = 0; id <= stats->max_label; id++) {
+        if (tac_stats_is_function(scratch, id)) {
+            TACFunctionStats* function = &stats->functions[stats->function_count++];
+            function->label = (uint16_t)id;
+            function->start = scratch->label_pos[id] - 1;
+            function->calls = scratch->label_calls[id];
+        }
+    }
+
+    qsort(stats->functions, count, sizeof(TACFunctionStats), tac_function_compare);
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t end = i + 1 < count ? stats->functions[i + 1].start : stats->instruction_count;
+        stats->functions[i].size = end - stats->functions[i].start;
+    }
+    return 0;
+}
+
+int tac_stats_compute(const TACInstruction* code, uint32_t count, TACStats* stats) {
+    memset(stats, 0, sizeof(*stats));
+
+    TACStatsScratch* scratch = calloc(1, sizeof(TACStatsScratch));
+    if (!scratch) {
+        return -1;
+    }
+
+    stats->instruction_count = count;
+    uint8_t opens = TAC_STATS_ENTRY;   // Kind of function start the next label may be
+    for (uint32_t i = 0; i < count; i++) {
+        const TACInstruction* instr = &code[i];
+        TACOpcode opcode = instr->opcode;
+
+        if ((uint32_t)opcode < TAC_STATS_OPCODES) {
+            stats->opcode_counts[opcode]++;
+        }
+        if ((uint32_t)instr->result.type < TAC_STATS_OPERAND_TYPES) {
+            stats->operand_type_counts[instr->result.type]++;
+        }
+        if ((uint32_t)instr->operand1.type < TAC_STATS_OPERAND_TYPES) {
+            stats->operand_type_counts[instr->operand1.type]++;
+        }
+        if ((uint32_t)instr->operand2.type < TAC_STATS_OPERAND_TYPES) {
+            stats->operand_type_counts[instr->operand2.type]++;
+        }
+
+        // STORE writes through its result operand, so that is a read
+        tac_stats_slot(stats, scratch, instr->result, opcode != TAC_STORE);
+        tac_stats_slot(stats, scratch, instr->operand1, 0);
+        tac_stats_slot(stats, scratch, instr->operand2, 0);
+
+        switch (opcode) {
+            case TAC_LABEL:
+                stats->labels++;
+                if (instr->result.type == TAC_OP_LABEL) {
+                    scratch->label_pos[instr->result.data.label.offset] = i + 1;
+                    scratch->label_opens[instr->result.data.label.offset] = opens;
+                }
+                opens = 0;
+                break;
+
+            case TAC_GOTO:
+                stats->jumps++;
+                stats->branches++;
+                if (instr->operand1.type == TAC_OP_LABEL) {
+                    scratch->label_jumped[instr->operand1.data.label.offset] = 1;
+                }
+                break;
+
+            case TAC_IF_FALSE:
+            case TAC_IF_TRUE:
+                stats->jumps++;
+                stats->branches++;
+                if (instr->operand2.type == TAC_OP_LABEL) {
+                    scratch->label_jumped[instr->operand2.data.label.offset] = 1;
+                }
+                break;
+
+            case TAC_ADD:
+            case TAC_SUB:
+            case TAC_MUL:
+            case TAC_DIV:
+            case TAC_MOD:
+            case TAC_AND:
+            case TAC_OR:
+            case TAC_XOR:
+            case TAC_SHL:
+            case TAC_SHR:
+                stats->arithmetic++;
+                break;
+
+            case TAC_ASSIGN:
+            case TAC_LOAD:
+            case TAC_STORE:
+                stats->assignments++;
+                break;
+
+            case TAC_CALL:
+                stats->function_ops++;
+                if (instr->operand1.type == TAC_OP_LABEL) {
+                    scratch->label_calls[instr->operand1.data.label.offset]++;
+                }
+                break;
+
+            case TAC_RETURN:
+            case TAC_RETURN_VOID:
+                stats->branches++;
+                stats->function_ops++;
+                opens = TAC_STATS_AFTER_RETURN;
+                break;
+
+            case TAC_PARAM:
+                stats->function_ops++;
+                break;
+
+            default:
+                break;
+        }
+
+        if (opens == TAC_STATS_ENTRY && opcode != TAC_LABEL) {
+            opens = 0;   // Only a label at the very start is the entry
+        }
+        if (instr->flags & TAC_FLAG_DEAD_CODE) stats->dead_code++;
+        if (instr->flags & TAC_FLAG_CONST_FOLD) stats->const_fold++;
+        if (instr->flags & TAC_FLAG_CSE) stats->cse++;
+        if (instr->flags & TAC_FLAG_COPY_PROP) stats->copy_prop++;
+        if (instr->flags & TAC_FLAG_OPTIMIZED) stats->optimized++;
+    }
+
+    stats->basic_blocks = stats->labels;
+    if (count > 0 && code[0].opcode != TAC_LABEL) {
+        stats->basic_blocks++;
+    }
+
+    tac_stats_def_use(&stats->temps, scratch->temp_defs, scratch->temp_uses, stats->max_temp);
+    tac_stats_def_use(&stats->vars, scratch->var_defs, scratch->var_uses, stats->max_var);
+    int result = tac_stats_functions(stats, scratch);
+
+    free(scratch);
+    return result;
+}
+
+int tac_stats_compute_store(TACStats* stats) {
+    TACIdx_t count = tacstore_getidx();
+    TACInstruction* code = malloc(((size_t)count + 1) * sizeof(TACInstruction));
+    if (!code) {
+        memset(stats, 0, sizeof(*stats));
+        return -1;
+    }
+
+    int result = -1;
+    if (count == 0 || tacstore_read(1, count, code) == count) {
+        result = tac_stats_compute(code, count, stats);
+    } else {
+        memset(stats, 0, sizeof(*stats));
+    }
+
+    free(code);
+    return result;
+}
+
+int tac_stats_compute_file(const char* filename, TACStats* stats) {
+    memset(stats, 0, sizeof(*stats));
+
+    FILE* fp = fopen(filename, "rb");
+    if (!fp) {
+        perror(filename);
+        return -1;
+    }
+
+    // The function section after the instructions is not mapped
+    uint32_t count = 0;
+    uint32_t function_count = 0;
+    if (tacstore_layout(fp, &count, &function_count) != 0) {
+        fprintf(stderr, "%s: not a TAC file\n", filename);
+        fclose(fp);
+        return -1;
+    }
+    if (count == 0) {
+        fclose(fp);
+        return tac_stats_compute(NULL, 0, stats);
+    }
+
+    size_t size = (size_t)count * sizeof(TACInstruction);
+    void* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+    fclose(fp);
+    if (map == MAP_FAILED) {
+        perror(filename);
+        return -1;
+    }
+
+    madvise(map, size, MADV_SEQUENTIAL);
+    int result = tac_stats_compute(map, count, stats);
+    munmap(map, size);
+    return result;
+}
+
+void tac_stats_free(TACStats* stats) {
+    if (stats) {
+        free(stats->functions);
+        stats->functions = NULL;
+        stats->function_count = 0;
+    }
+}
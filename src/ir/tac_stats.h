@@ -0,0 +1,115 @@
+/**
+ * @file tac_stats.h
+ * @brief Single-pass statistics over a TAC program
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * @details One sweep over an instruction array collects everything the
+ * printer and cc2t report: opcode and operand-kind histograms, the highest
+ * temporary, variable and label IDs, instruction categories, branch and
+ * basic block counts, optimization flags, definition/use counts of
+ * temporaries and variables, and the size of every function. Files are
+ * mapped rather than read, so tac_stats_compute_file() costs one pass over
+ * the page cache.
+ *
+ * A function starts at a label that is a CALL target, at the label opening
+ * the program, or at the first label after a RETURN that no branch jumps to
+ * (main, which nothing calls), and extends to the next function start.
+ */
+
+#ifndef SRC_IR_TAC_STATS_H_
+#define SRC_IR_TAC_STATS_H_
+
+#include <stdio.h>
+#include "tac_types.h"
+
+#define TAC_STATS_OPCODES       256
+#define TAC_STATS_OPERAND_TYPES 16
+
+/**
+ * @brief Size of one function
+ */
+typedef struct TACFunctionStats {
+    uint16_t label;            // Label opening the function
+    uint32_t start;            // Instruction index of that label, from 0
+    uint32_t size;             // Instructions up to the next function
+    uint32_t calls;            // CALL instructions targeting it
+} TACFunctionStats;
+
+/**
+ * @brief Definitions and uses of one kind of slot (temporaries or variables)
+ */
+typedef struct TACDefUseStats {
+    uint32_t slots;            // Distinct IDs referenced
+    uint32_t defs;             // Operands written
+    uint32_t uses;             // Operands read
+    uint32_t single_def;       // IDs written exactly once
+    uint32_t unused;           // IDs written but never read
+    uint32_t undefined;        // IDs read but never written (e.g. parameters)
+} TACDefUseStats;
+
+/**
+ * @brief Statistics of a TAC program
+ */
+typedef struct TACStats {
+    uint32_t instruction_count;
+    uint32_t opcode_counts[TAC_STATS_OPCODES];
+    uint32_t operand_type_counts[TAC_STATS_OPERAND_TYPES];
+
+    // Highest IDs referenced
+    uint32_t max_temp;
+    uint32_t max_var;
+    uint32_t max_label;
+
+    // Instruction categories
+    uint32_t labels;           // LABEL
+    uint32_t jumps;            // GOTO, IF_FALSE, IF_TRUE
+    uint32_t arithmetic;       // Arithmetic and bitwise binary operations
+    uint32_t assignments;      // ASSIGN, LOAD, STORE
+    uint32_t function_ops;     // CALL, PARAM, RETURN, RETURN_VOID
+    uint32_t branches;         // Jumps and returns
+    uint32_t basic_blocks;     // Labels, plus the first instruction if it is not one
+
+    // Optimization flags
+    uint32_t dead_code;
+    uint32_t const_fold;
+    uint32_t cse;
+    uint32_t copy_prop;
+    uint32_t optimized;
+
+    TACDefUseStats temps;
+    TACDefUseStats vars;
+
+    TACFunctionStats* functions;   // In program order
+    uint32_t function_count;
+} TACStats;
+
+/**
+ * @brief Compute statistics in one pass over an instruction array
+ * @param code Instructions, indexed from 0
+ * @param count Number of instructions
+ * @param stats Receives the statistics; release with tac_stats_free()
+ * @return 0 on success, -1 if out of memory
+ */
+int tac_stats_compute(const TACInstruction* code, uint32_t count, TACStats* stats);
+
+/**
+ * @brief Compute statistics of the open tacstore, read in one call
+ * @return 0 on success, -1 on error
+ */
+int tac_stats_compute_store(TACStats* stats);
+
+/**
+ * @brief Compute statistics of a TAC file (as written by cc2), mapped into memory
+ * @return 0 on success, -1 if the file cannot be mapped or memory runs out
+ */
+int tac_stats_compute_file(const char* filename, TACStats* stats);
+
+/**
+ * @brief Release the function table of computed statistics
+ */
+void tac_stats_free(TACStats* stats);
+
+#endif  // SRC_IR_TAC_STATS_H_
@@ -13,20 +13,16 @@
 #include <errno.h>
 
 // Global TAC store instance
-static TACStore g_tacstore = {NULL, 0, 0, ""};
+static TACStore g_tacstore = {NULL, 0, 0, 0, ""};
 
 /**
- * @brief Initialize TAC store with file-backed storage
+ * @brief Attach the TAC store to a freshly created file
  */
-int tacstore_init(const char* filename) {
-    if (g_tacstore.fp_tac != NULL) {
-        tacstore_close();
-    }
-
-    strncpy(g_tacstore.filename, filename, sizeof(g_tacstore.filename) - 1);
+static int tacstore_start(FILE* fp, const char* name) {
+    strncpy(g_tacstore.filename, name, sizeof(g_tacstore.filename) - 1);
     g_tacstore.filename[sizeof(g_tacstore.filename) - 1] = '\0';
 
-    g_tacstore.fp_tac = fopen(filename, "w+b");
+    g_tacstore.fp_tac = fp;
     if (g_tacstore.fp_tac == NULL) {
         perror("tacstore_init: Cannot create TAC file");
         return 0;
@@ -34,10 +30,34 @@ int tacstore_init(const char* filename) {
 
     g_tacstore.current_idx = 0;
     g_tacstore.max_instructions = 65535;  // 16-bit index limit
+    g_tacstore.function_count = 0;
 
     return 1;
 }
 
+/**
+ * @brief Initialize TAC store with file-backed storage
+ */
+int tacstore_init(const char* filename) {
+    if (g_tacstore.fp_tac != NULL) {
+        tacstore_close();
+    }
+    if (filename == NULL) {
+        return 0;
+    }
+    return tacstore_start(fopen(filename, "w+b"), filename);
+}
+
+/**
+ * @brief Initialize TAC store in an anonymous temporary file
+ */
+int tacstore_init_anonymous(void) {
+    if (g_tacstore.fp_tac != NULL) {
+        tacstore_close();
+    }
+    return tacstore_start(tmpfile(), "tacstore (temporary)");
+}
+
 /**
  * @brief Open existing TAC store file for reading
  */
@@ -55,13 +75,18 @@ int tacstore_open(const char* filename) {
         return 0;
     }
 
-    // Determine file size and number of instructions
-    fseek(g_tacstore.fp_tac, 0, SEEK_END);
-    long file_size = ftell(g_tacstore.fp_tac);
-    rewind(g_tacstore.fp_tac);
+    // Determine the number of instructions, leaving out any function section
+    uint32_t count = 0;
+    uint32_t function_count = 0;
+    if (tacstore_layout(g_tacstore.fp_tac, &count, &function_count) != 0 || count > 65535) {
+        fprintf(stderr, "tacstore_open: %s is not a TAC file\n", filename);
+        tacstore_close();
+        return 0;
+    }
 
-    g_tacstore.current_idx = (TACIdx_t)(file_size / sizeof(TACInstruction));
+    g_tacstore.current_idx = (TACIdx_t)count;
     g_tacstore.max_instructions = 65535;  // 16-bit index limit
+    g_tacstore.function_count = function_count;
 
     return 1;
 }
@@ -77,6 +102,7 @@ void tacstore_close(void) {
 
     g_tacstore.current_idx = 0;
     g_tacstore.max_instructions = 0;
+    g_tacstore.function_count = 0;
     g_tacstore.filename[0] = '\0';
 }
 
@@ -96,6 +122,10 @@ TACIdx_t tacstore_add(const TACInstruction* instr) {
         return 0;  // Store full
     }
 
+    if (g_tacstore.function_count > 0) {
+        return 0;  // The function section closes the file
+    }
+
     // Move to end of file
     if (fseek(g_tacstore.fp_tac, 0, SEEK_END) != 0) {
         perror("tacstore_add: fseek failed");
@@ -148,6 +178,38 @@ TACInstruction tacstore_get(TACIdx_t idx) {
     return instr;
 }
 
+/**
+ * @brief Read count consecutive TAC instructions starting at idx in one call
+ *
+ * @return Number of instructions read (0 on error)
+ */
+TACIdx_t tacstore_read(TACIdx_t start, TACIdx_t count, TACInstruction* out) {
+    if (g_tacstore.fp_tac == NULL || out == NULL) {
+        return 0;  // Store not initialized
+    }
+
+    if (start == 0 || start > g_tacstore.current_idx) {
+        return 0;  // Invalid index
+    }
+
+    if (count > g_tacstore.current_idx - start + 1) {
+        count = (TACIdx_t)(g_tacstore.current_idx - start + 1);
+    }
+
+    long pos = (long)(start - 1) * sizeof(TACInstruction);
+
+    if (fseek(g_tacstore.fp_tac, pos, SEEK_SET) != 0) {
+        perror("tacstore_read: fseek failed");
+        return 0;
+    }
+
+    size_t got = fread(out, sizeof(TACInstruction), count, g_tacstore.fp_tac);
+    if (got != count) {
+        perror("tacstore_read: fread failed");
+    }
+    return (TACIdx_t)got;
+}
+
 /**
  * @brief Update a TAC instruction at given index
  */
@@ -197,6 +259,132 @@ void tacstore_rewind(void) {
     }
 }
 
+/**
+ * @brief Append the function section after the last instruction
+ *
+ * Written once, when the program is complete: no instruction can be added
+ * afterwards.
+ *
+ * @return 1 on success, 0 on error
+ */
+int tacstore_write_functions(const TACFunction* functions, uint32_t count) {
+    if (g_tacstore.fp_tac == NULL || g_tacstore.function_count > 0 ||
+        (functions == NULL && count > 0)) {
+        return 0;
+    }
+    if (count == 0) {
+        return 1;  // No section at all
+    }
+
+    TACFunctionTrailer trailer = { TAC_FUNCTION_MAGIC, count };
+    if (fseek(g_tacstore.fp_tac, 0, SEEK_END) != 0 ||
+        fwrite(functions, sizeof(TACFunction), count, g_tacstore.fp_tac) != count ||
+        fwrite(&trailer, sizeof(trailer), 1, g_tacstore.fp_tac) != 1) {
+        perror("tacstore_write_functions: fwrite failed");
+        return 0;
+    }
+
+    fflush(g_tacstore.fp_tac);
+    g_tacstore.function_count = count;
+    return 1;
+}
+
+/**
+ * @brief Number of records in the function section
+ */
+uint32_t tacstore_function_count(void) {
+    return g_tacstore.function_count;
+}
+
+/**
+ * @brief Read up to max function records
+ *
+ * @return Number of records read
+ */
+uint32_t tacstore_read_functions(TACFunction* out, uint32_t max) {
+    if (g_tacstore.fp_tac == NULL || out == NULL) {
+        return 0;
+    }
+
+    uint32_t count = g_tacstore.function_count < max ? g_tacstore.function_count : max;
+    long pos = (long)g_tacstore.current_idx * (long)sizeof(TACInstruction);
+    if (count == 0 || fseek(g_tacstore.fp_tac, pos, SEEK_SET) != 0) {
+        return 0;
+    }
+    return (uint32_t)fread(out, sizeof(TACFunction), count, g_tacstore.fp_tac);
+}
+
+/**
+ * @brief Split a TAC file into its instructions and function section
+ *
+ * A file without a valid trailer is all instructions.
+ *
+ * @return 0 on success, -1 if the size fits neither layout
+ */
+int tacstore_layout(FILE* fp, uint32_t* count, uint32_t* function_count) {
+    if (fp == NULL || fseek(fp, 0, SEEK_END) != 0) {
+        return -1;
+    }
+    long size = ftell(fp);
+    if (size < 0) {
+        return -1;
+    }
+
+    *function_count = 0;
+    TACFunctionTrailer trailer;
+    if ((size_t)size >= sizeof(trailer) &&
+        fseek(fp, size - (long)sizeof(trailer), SEEK_SET) == 0 &&
+        fread(&trailer, sizeof(trailer), 1, fp) == 1 &&
+        trailer.magic == TAC_FUNCTION_MAGIC) {
+        size_t section = sizeof(trailer) + (size_t)trailer.function_count * sizeof(TACFunction);
+        if (section <= (size_t)size &&
+            ((size_t)size - section) % sizeof(TACInstruction) == 0) {
+            size -= (long)section;
+            *function_count = trailer.function_count;
+        }
+    }
+    rewind(fp);
+
+    if ((size_t)size % sizeof(TACInstruction) != 0) {
+        return -1;
+    }
+    *count = (uint32_t)((size_t)size / sizeof(TACInstruction));
+    return 0;
+}
+
+TACInstruction* tacstore_load(const char* filename, uint32_t* count,
+                              TACFunction** functions, uint32_t* function_count) {
+    FILE* fp = fopen(filename, "rb");
+    if (fp == NULL) {
+        return NULL;
+    }
+
+    uint32_t n = 0;
+    uint32_t f = 0;
+    TACInstruction* code = NULL;
+    TACFunction* records = NULL;
+    if (tacstore_layout(fp, &n, &f) == 0) {
+        code = malloc((n > 0 ? n : 1) * sizeof(TACInstruction));
+        records = f > 0 ? malloc(f * sizeof(TACFunction)) : NULL;
+        if (code == NULL || (f > 0 && records == NULL) ||
+            fread(code, sizeof(TACInstruction), n, fp) != n ||
+            fread(records, sizeof(TACFunction), f, fp) != f) {
+            free(code);
+            free(records);
+            code = NULL;
+            records = NULL;
+        }
+    }
+    fclose(fp);
+
+    if (code != NULL) {
+        *count = n;
+        *functions = records;
+        *function_count = f;
+    }
+    return code;
+}
+
 /**
  * @brief Print TAC store statistics
  */
@@ -228,6 +416,10 @@ int tacstore_validate(void) {
     fseek(g_tacstore.fp_tac, 0, SEEK_END);
     long file_size = ftell(g_tacstore.fp_tac);
     size_t expected_size = (size_t)g_tacstore.current_idx * sizeof(TACInstruction);
+    if (g_tacstore.function_count > 0) {
+        expected_size += (size_t)g_tacstore.function_count * sizeof(TACFunction) +
+                         sizeof(TACFunctionTrailer);
+    }
 
     if (file_size != (long)expected_size) {
         printf("TAC store validation: File size mismatch (got %ld, expected %zu)\n",
@@ -13,6 +13,19 @@
 #include "tac_types.h"
 #include <stdio.h>
 
+/**
+ * A TAC file holds the instructions, optionally followed by a function
+ * section: one TACFunction per function definition, then a trailer giving
+ * their number. Readers size the instruction array with tacstore_layout()
+ * so the section is never taken for code.
+ */
+#define TAC_FUNCTION_MAGIC 0x4e465354u   // "TSFN"
+
+typedef struct TACFunctionTrailer {
+    uint32_t magic;          // TAC_FUNCTION_MAGIC
+    uint32_t function_count; // TACFunction records before the trailer
+} TACFunctionTrailer;
+
 /**
  * @brief TAC instruction store - file-backed like other stores
  */
@@ -20,20 +33,37 @@ typedef struct TACStore {
     FILE* fp_tac;            // TAC instruction file
     TACIdx_t current_idx;    // Current instruction index
     TACIdx_t max_instructions; // Maximum instructions
+    uint32_t function_count; // Records in the function section
     char filename[256];      // TAC file name
 } TACStore;
 
 // TAC store API (similar to astore/sstore/tstore)
 int tacstore_init(const char* filename);
+int tacstore_init_anonymous(void);    // Store in an anonymous tmpfile()
 int tacstore_open(const char* filename);
 void tacstore_close(void);
 TACIdx_t tacstore_add(const TACInstruction* instr);
 TACInstruction tacstore_get(TACIdx_t idx);
+TACIdx_t tacstore_read(TACIdx_t start,
+                     TACIdx_t count,
+                     TACInstruction* out);
 TACIdx_t tacstore_update(TACIdx_t idx,
                      const TACInstruction* instr);
 TACIdx_t tacstore_getidx(void);
 void tacstore_rewind(void);
 
+// Function section: written once after the last instruction
+int tacstore_write_functions(const TACFunction* functions, uint32_t count);
+uint32_t tacstore_function_count(void);
+uint32_t tacstore_read_functions(TACFunction* out, uint32_t max);
+
+// Instruction and function counts of an open TAC file; 0 on success
+int tacstore_layout(FILE* fp, uint32_t* count, uint32_t* function_count);
+// Reentrant reader: instructions and functions in arrays owned by the
+// caller (free()); *functions is NULL when the file has no function section
+TACInstruction* tacstore_load(const char* filename, uint32_t* count,
+                              TACFunction** functions, uint32_t* function_count);
+
 // Debug and utility functions
 void tacstore_print_stats(void);
 int tacstore_validate(void);
@@ -170,15 +170,19 @@ typedef struct TACTempManager {
 
 /**
  * @brief TAC function context
+ *
+ * cc1 declares the parameters of a function as consecutive symbols, so
+ * parameter i is variable first_param + i.
  */
 typedef struct TACFunction {
     SymIdx_t symbol_idx;  // Function symbol
-    TACIdx_t start_idx;      // First instruction
+    TACIdx_t start_idx;      // Function label (1-based, as tacstore_add())
     TACIdx_t end_idx;        // Last instruction
     uint16_t temp_count;     // Number of temporaries used
     uint16_t param_count;    // Number of parameters
     uint16_t local_count;    // Number of local variables
     TypeIdx_t return_type;   // Return type
+    SymIdx_t first_param;    // Variable id of the first parameter
 } TACFunction;
 
 /**
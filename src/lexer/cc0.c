@@ -72,6 +72,7 @@
 
 #include "../storage/sstore.h"
 #include "../storage/tstore.h"
+#include "../driver/stcc_stages.h"
 
 #define TOKEN_TYPE_NAME(t)  t, #t
 #define SET_LEXEME_LEN(l)  l, (sizeof(l) - 1)
@@ -533,6 +534,25 @@ static void printToken(Token_t *token) {
 
 
 
+/**
+ * @brief Tokenize a source file into the open string and token stores.
+ *
+ * @param fp The source file.
+ * @return int 0 on success.
+ */
+int cc0_lex(FILE *fp) {
+  Token_t *token;
+  while ((token = nextToken(fp)) != NULL) {
+    printToken(token);
+    tstore_add(token);
+    if (token->id == T_EOF) {
+      break;
+    }
+  }
+  return 0;
+}
+
+#ifndef STCC_DRIVER
 /**
  * @brief The main function of the lexer.
  *
@@ -564,18 +584,12 @@ int main(int argc, char *argv[]) {
     sstore_close();
     return 1;
   }
-  Token_t *token;
-  while ((token = nextToken(fp)) != NULL) {
-    printToken(token);
-    tstore_add(token);
-    if (token->id == T_EOF) {
-      break;
-    }
-  }
+  cc0_lex(fp);
 
   fclose(fp);
   tstore_close();
   sstore_close();
   return 0;
 }
+#endif  // STCC_DRIVER
 
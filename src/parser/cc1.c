@@ -28,6 +28,7 @@
 #include "../utils/hmapbuf.h"
 #include "../error/error_core.h"
 #include "../error/error_stages.h"
+#include "../driver/stcc_stages.h"
 // Enhanced cc1 with error handling and core AST capabilities
 
 // Type specifier information for complex type parsing
@@ -58,6 +59,7 @@ typedef struct {
     int in_function;
     int scope_depth;  // C99 scope depth: 0=file, 1=function, 2+=block
     int error_count;
+    SymIdx_t function_symbols;  // First symbol of the current function definition
 } ParserState_t;
 
 static ParserState_t parser_state = {0};
@@ -315,6 +317,13 @@ static SymIdx_t lookup_symbol_in_scope(sstore_pos_t name_pos) {
             continue; // Name doesn't match
         }
         
+        // Parameters and locals of earlier functions are out of scope;
+        // function symbols are recorded at depth 1 but stay visible
+        if (entry.scope_depth > 0 && entry.type != SYM_FUNCTION &&
+            i < parser_state.function_symbols) {
+            continue;
+        }
+
         // Check if this symbol is visible from current scope
         // C99 rule: variable is visible if declared at current scope depth or shallower
         if (entry.scope_depth <= parser_state.scope_depth) {
@@ -1284,8 +1293,12 @@ ASTNodeIdx_t parse_declaration(void) {
         // Enter function parameter scope (depth 1 for C99 function scope)
         int saved_scope = parser_state.scope_depth;
         parser_state.scope_depth = 1;
+        parser_state.function_symbols = (SymIdx_t)(symtab_get_count() + 1);
         
-        // Parse parameters (C99 compliant parameter handling)
+        // Parse parameters (C99 compliant parameter handling); they are
+        // consecutive symbols, recorded on the function symbol below
+        SymIdx_t first_param = 0;
+        unsigned short param_count = 0;
         while (peek_token().id != T_RPAREN && peek_token().id != T_EOF) {
             // Parse parameter type
             if (is_type_specifier_start(peek_token().id)) {
@@ -1295,7 +1308,12 @@ ASTNodeIdx_t parse_declaration(void) {
                     sstore_pos_t param_name_pos = parse_declarator();
                     if (param_name_pos != 0) {
                         // Parameters have function scope (depth 1) in C99
-                        add_symbol_with_c99_flags(param_name_pos, SYM_VARIABLE, tstore_getidx(), &param_type);
+                        SymIdx_t param = add_symbol_with_c99_flags(param_name_pos, SYM_VARIABLE,
+                                                                   tstore_getidx(), &param_type);
+                        if (param != 0 && first_param == 0) {
+                            first_param = param;
+                        }
+                        param_count += (param != 0);
                     }
                 }
                 // Handle comma between parameters
@@ -1331,6 +1349,7 @@ ASTNodeIdx_t parse_declaration(void) {
                 if (node) {
                     // Use declaration structure as specified in AST Node Reference
                     SymIdx_t sym_idx = add_symbol_with_c99_flags(identifier_pos, SYM_FUNCTION, token_idx, &type_spec);
+                    symtab_set_function_info(sym_idx, param_count, first_param);
                     node->ast.declaration.symbol_idx = sym_idx;     // Function symbol
                     node->ast.declaration.type_idx = 0;             // Function type (to be added)
                     node->ast.declaration.initializer = body;       // Function body
@@ -1884,6 +1903,30 @@ static int is_type_specifier_start(TokenID_t token_id) {
     return 0;
 }
 
+/**
+ * @brief Parse the open token store into the AST store and symbol table
+ * @return 0 on success, non-zero on error
+ */
+int cc1_parse(void) {
+    // Initialize parser
+    parser_init();
+
+    // Set token file to start position
+    tstore_setidx(0);
+
+    // Parse the program
+    ASTNodeIdx_t program __attribute__((unused)) = parse_program();
+
+    // Program parsing is considered successful if we reach this point
+    // (AST index 0 is valid, and errors would have exited earlier)
+    printf("Parsing completed successfully\n");
+
+    int errors = error_core_has_errors();
+    parser_cleanup();
+    return errors ? 1 : 0;
+}
+
+#ifndef STCC_DRIVER
 /**
  * @brief Main function for cc1 parser
  * @param argc Number of command line arguments
@@ -1923,21 +1966,9 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
-    // Initialize parser
-    parser_init();
-
-    // Set token file to start position
-    tstore_setidx(0);
-
-    // Parse the program
-    ASTNodeIdx_t program __attribute__((unused)) = parse_program();
-
-    // Program parsing is considered successful if we reach this point
-    // (AST index 0 is valid, and errors would have exited earlier)
-    printf("Parsing completed successfully\n");
+    cc1_parse();
 
     // Clean up
-    parser_cleanup();
     symtab_close();
     astore_close();
     tstore_close();
@@ -1945,3 +1976,4 @@ int main(int argc, char *argv[]) {
 
     return 0;
 }
+#endif  // STCC_DRIVER
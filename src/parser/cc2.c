@@ -32,6 +32,7 @@
 #include "../ir/tac_printer.h"
 #include "../utils/hmapbuf.h"
 #include "../error/error_core.h"
+#include "../driver/stcc_stages.h"
 
 /**
  * @brief CC2 compiler state
@@ -50,7 +51,7 @@ static CC2State cc2_state = {0};
 /**
  * @brief Initialize CC2 compiler pass
  *
- * @param tac_filename Output filename for TAC binary format
+ * @param tac_filename Output filename for TAC binary format (NULL: temporary)
  * @param output_filename Output filename for human-readable TAC
  * @return 0 on success, -1 on error
  */
@@ -58,13 +59,15 @@ static int cc2_init(const char* tac_filename, const char* output_filename) {
     memset(&cc2_state, 0, sizeof(CC2State));
 
     // Initialize TAC builder
-    if (!tac_builder_init(&cc2_state.tac_builder, tac_filename)) {
+    int ok = tac_filename ? tac_builder_init(&cc2_state.tac_builder, tac_filename)
+                          : tac_builder_init_anonymous(&cc2_state.tac_builder);
+    if (!ok) {
         fprintf(stderr, "Error: Cannot initialize TAC builder\n");
         return -1;
     }
 
     // Store output filenames
-    cc2_state.tac_filename = strdup(tac_filename);
+    cc2_state.tac_filename = tac_filename ? strdup(tac_filename) : NULL;
     cc2_state.output_filename = output_filename ? strdup(output_filename) : NULL;
     cc2_state.verbose = 1;
 
@@ -184,14 +187,60 @@ static int cc2_generate_output(void) {
         tac_write_to_file(cc2_state.output_filename);
     }
 
-    // TAC binary format is already written by tac_builder
-    if (cc2_state.verbose) {
+    // TAC binary format is already written by tac_builder; close it with
+    // the function section the engine and cc2c frame calls from
+    if (!tac_builder_write_functions(&cc2_state.tac_builder)) {
+        fprintf(stderr, "Error: Cannot write the function section\n");
+        cc2_state.errors++;
+        return -1;
+    }
+    if (cc2_state.verbose && cc2_state.tac_filename) {
         printf("TAC binary format written to: %s\n", cc2_state.tac_filename);
     }
 
     return 0;
 }
 
+/**
+ * @brief Generate TAC from the open string, token, AST and symbol stores
+ *
+ * @param tac_file TAC binary output file (NULL: temporary store)
+ * @param output_file Human-readable TAC output file (optional)
+ * @return 0 on success, non-zero on error
+ */
+int cc2_generate(const char* tac_file, const char* output_file) {
+    // Initialize CC2 compiler pass
+    if (cc2_init(tac_file, output_file) != 0) {
+        fprintf(stderr, "Error: Cannot initialize CC2 compiler pass\n");
+        return 1;
+    }
+
+    // Process the program and generate TAC
+    int result = cc2_process_program();
+
+    if (result == 0) {
+        // Generate output files
+        result = cc2_generate_output();
+    }
+
+    // Report results
+    printf("\n=== CC2 Compilation Results ===\n");
+    printf("Errors:   %d\n", cc2_state.errors);
+    printf("Warnings: %d\n", cc2_state.warnings);
+
+    if (result == 0 && cc2_state.errors == 0) {
+        printf("TAC generation completed successfully!\n");
+    } else {
+        printf("TAC generation completed with %s\n",
+               cc2_state.errors > 0 ? "errors" : "warnings");
+    }
+
+    int errors = cc2_state.errors;
+    cc2_cleanup();
+    return (errors > 0) ? 1 : 0;
+}
+
+#ifndef STCC_DRIVER
 /**
  * @brief Main compiler function for CC2
  *
@@ -260,42 +309,14 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
-    // Initialize CC2 compiler pass
-    if (cc2_init(tac_file, output_file) != 0) {
-        fprintf(stderr, "Error: Cannot initialize CC2 compiler pass\n");
-        symtab_close();
-        astore_close();
-        tstore_close();
-        sstore_close();
-        return 1;
-    }
-
-    // Process the program and generate TAC
-    int result = cc2_process_program();
-
-    if (result == 0) {
-        // Generate output files
-        result = cc2_generate_output();
-    }
-
-    // Report results
-    printf("\n=== CC2 Compilation Results ===\n");
-    printf("Errors:   %d\n", cc2_state.errors);
-    printf("Warnings: %d\n", cc2_state.warnings);
-
-    if (result == 0 && cc2_state.errors == 0) {
-        printf("TAC generation completed successfully!\n");
-    } else {
-        printf("TAC generation completed with %s\n",
-               cc2_state.errors > 0 ? "errors" : "warnings");
-    }
+    int result = cc2_generate(tac_file, output_file);
 
     // Clean up
-    cc2_cleanup();
     symtab_close();
     astore_close();
     tstore_close();
     sstore_close();
 
-    return (cc2_state.errors > 0) ? 1 : 0;
+    return result;
 }
+#endif  // STCC_DRIVER
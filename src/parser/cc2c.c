@@ -0,0 +1,109 @@
+/**
+ * @file cc2c.c
+ * @brief TAC to C translator for STCC1 compiler
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * @details CC2C reads a TAC file generated by CC2 and writes a self-contained
+ * C99 translation of it (see tac_cgen.h) that the system compiler can build
+ * into a native executable:
+ *
+ *   cc2c tdir/tac.out prog.c 2 && cc -O2 -o prog prog.c && ./prog
+ *
+ * Execution starts at the first instruction, or at the given label (cc2
+ * reports the label of main() as MAIN_LABEL in its .tac listing).
+ *
+ * Usage: cc2c <tacfile> <output.c> [entry_label]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../ir/tac_store.h"
+#include "../ir/tac_types.h"
+#include "../ir/tac_cgen.h"
+
+/**
+ * @brief Display usage information
+ */
+static void show_usage(const char* program_name) {
+    printf("Usage: %s <tacfile> <output.c> [entry_label]\n", program_name);
+    printf("\n");
+    printf("Arguments:\n");
+    printf("  tacfile     - TAC binary file (generated by cc2)\n");
+    printf("  output.c    - C99 source file to write\n");
+    printf("  entry_label - Label to start execution at (default: first instruction)\n");
+    printf("\n");
+    printf("TAC to C Translator for STCC1 Compiler\n");
+    printf("The generated program prints its variables as 'v<id> <value>' on exit\n");
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3 || argc > 4) {
+        show_usage(argv[0]);
+        return 1;
+    }
+
+    const char* tac_file = argv[1];
+    const char* out_file = argv[2];
+
+    uint32_t count = 0;
+    TACFunction* functions = NULL;
+    uint32_t function_count = 0;
+    TACInstruction* code = tacstore_load(tac_file, &count, &functions, &function_count);
+    if (!code) {
+        fprintf(stderr, "Error: Cannot read TAC file %s\n", tac_file);
+        return 1;
+    }
+    if (count == 0) {
+        fprintf(stderr, "Error: TAC file %s is empty\n", tac_file);
+        free(code);
+        free(functions);
+        return 1;
+    }
+
+    // Resolve the optional entry label to an instruction index
+    TACCGenOptions options = { 0, tac_file, functions, function_count };
+    if (argc == 4) {
+        long label = strtol(argv[3], NULL, 10);
+        uint32_t i = 0;
+        while (i < count && !(code[i].opcode == TAC_LABEL &&
+                              code[i].result.type == TAC_OP_LABEL &&
+                              code[i].result.data.label.offset == label)) {
+            i++;
+        }
+        if (i == count) {
+            fprintf(stderr, "Error: Entry label %s not found\n", argv[3]);
+            free(code);
+            free(functions);
+            return 1;
+        }
+        options.entry = i;
+    }
+
+    FILE* out = fopen(out_file, "w");
+    if (!out) {
+        perror(out_file);
+        free(code);
+        free(functions);
+        return 1;
+    }
+
+    char error[128];
+    int result = tac_cgen_emit(out, code, count, &options, error, sizeof(error));
+    if (fclose(out) != 0 && result == 0) {
+        perror(out_file);
+        result = -1;
+    } else if (result != 0) {
+        fprintf(stderr, "Error: Cannot translate %s: %s\n", tac_file, error);
+    }
+
+    if (result != 0) {
+        remove(out_file);
+    }
+    free(code);
+    free(functions);
+    return result == 0 ? 0 : 1;
+}
@@ -14,6 +14,7 @@
  * - Similar to cc0t (token inspection) and cc1t (AST inspection)
  *
  * Usage: cc2t <tacfile> <symfile> [sstorefile]
+ *        cc2t --json <tacfile>
  */
 
 #include <stdio.h>
@@ -23,6 +24,7 @@
 
 #include "../ir/tac_store.h"
 #include "../ir/tac_printer.h"
+#include "../ir/tac_stats.h"
 #include "../ir/tac_types.h"
 #include "../storage/sstore.h"
 #include "../storage/symtab.h"
@@ -32,11 +34,13 @@
  */
 static void show_usage(const char* program_name) {
     printf("Usage: %s <tacfile> <symfile> [sstorefile]\n", program_name);
+    printf("       %s --json <tacfile>\n", program_name);
     printf("\n");
     printf("Arguments:\n");
     printf("  tacfile     - TAC instruction file to analyze\n");
     printf("  symfile     - Symbol table file for variable name resolution\n");
     printf("  sstorefile  - String store file (optional)\n");
+    printf("  --json      - Print only the statistics, as JSON\n");
     printf("\n");
     printf("TAC Inspection Tool for STCC1 Compiler\n");
     printf("Displays Three-Address Code instructions and analysis\n");
@@ -64,10 +68,16 @@ static void show_tac_header(const char* filename) {
     if (fp) {
         fseek(fp, 0, SEEK_END);
         long file_size = ftell(fp);
+        uint32_t count = 0;
+        uint32_t function_count = 0;
+        int layout = tacstore_layout(fp, &count, &function_count);
         fclose(fp);
 
         printf("Size: %ld bytes\n", file_size);
-        printf("Instructions: %ld\n", file_size / sizeof(TACInstruction));
+        if (layout == 0) {
+            printf("Instructions: %u\n", count);
+            printf("Function records: %u\n", function_count);
+        }
     }
     printf("\n");
 }
@@ -75,11 +85,11 @@ static void show_tac_header(const char* filename) {
 /**
  * @brief Display detailed instruction analysis
  */
-static void show_detailed_analysis(void) {
+static void show_detailed_analysis(const TACStats* stats) {
     printf("\n=== Detailed TAC Analysis ===\n");
 
     // Get total instruction count
-    TACIdx_t total_instructions = tacstore_getidx();
+    uint32_t total_instructions = stats->instruction_count;
 
     if (total_instructions == 0) {
         printf("No TAC instructions found.\n");
@@ -88,150 +98,60 @@ static void show_detailed_analysis(void) {
 
     printf("Analyzing %u instructions...\n\n", total_instructions);
 
-    // Analyze instruction patterns
-    int label_count = 0;
-    int jump_count = 0;
-    int arithmetic_count = 0;
-    int assignment_count = 0;
-    int function_count = 0;
-
-    for (TACIdx_t i = 1; i <= total_instructions; i++) {
-        TACInstruction instr = tacstore_get(i);
-
-        switch (instr.opcode) {
-            case TAC_LABEL:
-                label_count++;
-                break;
-
-            case TAC_GOTO:
-            case TAC_IF_FALSE:
-            case TAC_IF_TRUE:
-                jump_count++;
-                break;
-
-            case TAC_ADD:
-            case TAC_SUB:
-            case TAC_MUL:
-            case TAC_DIV:
-            case TAC_MOD:
-            case TAC_AND:
-            case TAC_OR:
-            case TAC_XOR:
-            case TAC_SHL:
-            case TAC_SHR:
-                arithmetic_count++;
-                break;
-
-            case TAC_ASSIGN:
-            case TAC_LOAD:
-            case TAC_STORE:
-                assignment_count++;
-                break;
-
-            case TAC_CALL:
-            case TAC_PARAM:
-            case TAC_RETURN:
-            case TAC_RETURN_VOID:
-                function_count++;
-                break;
-
-            default:
-                break;
-        }
-    }
-
     printf("Instruction Categories:\n");
-    printf("  Labels:     %d\n", label_count);
-    printf("  Jumps:      %d\n", jump_count);
-    printf("  Arithmetic: %d\n", arithmetic_count);
-    printf("  Assignment: %d\n", assignment_count);
-    printf("  Functions:  %d\n", function_count);
-    printf("  Other:      %d\n", total_instructions - label_count - jump_count -
-           arithmetic_count - assignment_count - function_count);
+    printf("  Labels:     %u\n", stats->labels);
+    printf("  Jumps:      %u\n", stats->jumps);
+    printf("  Arithmetic: %u\n", stats->arithmetic);
+    printf("  Assignment: %u\n", stats->assignments);
+    printf("  Functions:  %u\n", stats->function_ops);
+    printf("  Other:      %u\n", total_instructions - stats->labels - stats->jumps -
+           stats->arithmetic - stats->assignments - stats->function_ops);
 }
 
 /**
  * @brief Analyze control flow patterns
  */
-static void analyze_control_flow(void) {
+static void analyze_control_flow(const TACStats* stats) {
     printf("\n=== Control Flow Analysis ===\n");
 
-    TACIdx_t total_instructions = tacstore_getidx();
+    uint32_t total_instructions = stats->instruction_count;
 
     if (total_instructions == 0) {
         printf("No instructions to analyze.\n");
         return;
     }
 
-    int basic_blocks = 0;
-    int branches = 0;
-    bool in_block = false;
-
-    for (TACIdx_t i = 1; i <= total_instructions; i++) {
-        TACInstruction instr = tacstore_get(i);
-
-        // Count basic block starts (labels or first instruction)
-        if (instr.opcode == TAC_LABEL || (!in_block && i == 1)) {
-            basic_blocks++;
-            in_block = true;
-        }
-
-        // Count branches
-        if (instr.opcode == TAC_GOTO || instr.opcode == TAC_IF_FALSE ||
-            instr.opcode == TAC_IF_TRUE || instr.opcode == TAC_RETURN ||
-            instr.opcode == TAC_RETURN_VOID) {
-            branches++;
-            in_block = false;
-        }
-    }
-
-    printf("Basic blocks: %d (estimated)\n", basic_blocks);
-    printf("Branches:     %d\n", branches);
+    printf("Basic blocks: %u (estimated)\n", stats->basic_blocks);
+    printf("Branches:     %u\n", stats->branches);
 
-    if (basic_blocks > 0) {
+    if (stats->basic_blocks > 0) {
         printf("Average instructions per block: %.1f\n",
-               (float)total_instructions / basic_blocks);
+               (float)total_instructions / stats->basic_blocks);
     }
 }
 
 /**
  * @brief Display optimization flags summary
  */
-static void show_optimization_flags(void) {
+static void show_optimization_flags(const TACStats* stats) {
     printf("\n=== Optimization Flags Analysis ===\n");
 
-    TACIdx_t total_instructions = tacstore_getidx();
+    uint32_t total_instructions = stats->instruction_count;
 
     if (total_instructions == 0) {
         printf("No instructions to analyze.\n");
         return;
     }
 
-    int dead_code = 0;
-    int const_fold = 0;
-    int cse = 0;
-    int copy_prop = 0;
-    int optimized = 0;
-
-    for (TACIdx_t i = 1; i <= total_instructions; i++) {
-        TACInstruction instr = tacstore_get(i);
-
-        if (instr.flags & TAC_FLAG_DEAD_CODE) dead_code++;
-        if (instr.flags & TAC_FLAG_CONST_FOLD) const_fold++;
-        if (instr.flags & TAC_FLAG_CSE) cse++;
-        if (instr.flags & TAC_FLAG_COPY_PROP) copy_prop++;
-        if (instr.flags & TAC_FLAG_OPTIMIZED) optimized++;
-    }
-
-    printf("Dead code candidates:      %d\n", dead_code);
-    printf("Constant folding applied:  %d\n", const_fold);
-    printf("CSE opportunities:         %d\n", cse);
-    printf("Copy propagation applied:  %d\n", copy_prop);
-    printf("Optimization complete:     %d\n", optimized);
+    printf("Dead code candidates:      %u\n", stats->dead_code);
+    printf("Constant folding applied:  %u\n", stats->const_fold);
+    printf("CSE opportunities:         %u\n", stats->cse);
+    printf("Copy propagation applied:  %u\n", stats->copy_prop);
+    printf("Optimization complete:     %u\n", stats->optimized);
 
     if (total_instructions > 0) {
         printf("Optimization coverage:     %.1f%%\n",
-               (float)optimized * 100.0f / total_instructions);
+               (float)stats->optimized * 100.0f / total_instructions);
     }
 }
 
@@ -291,6 +211,17 @@ static void reconstruct_function_table(void) {
  * @brief Main function for CC2T TAC inspection tool
  */
 int main(int argc, char* argv[]) {
+    if (argc == 3 && strcmp(argv[1], "--json") == 0) {
+        TACStats stats;
+        if (tac_stats_compute_file(argv[2], &stats) != 0) {
+            fprintf(stderr, "Error: Cannot analyze TAC file %s\n", argv[2]);
+            return 1;
+        }
+        tac_print_stats_json(stdout, &stats);
+        tac_stats_free(&stats);
+        return 0;
+    }
+
     if (argc < 3 || argc > 4) {
         show_usage(argv[0]);
         return 1;
@@ -340,22 +271,31 @@ int main(int argc, char* argv[]) {
     printf("=== TAC Instructions ===\n");
     tac_print_all_instructions();
 
+    // One pass over the mapped file feeds every analysis below
+    TACStats stats;
+    if (tac_stats_compute_file(tac_file, &stats) != 0) {
+        fprintf(stderr, "Error: Cannot analyze TAC file %s\n", tac_file);
+        tacstore_close();
+        return 1;
+    }
+
     // Display standard statistics
     printf("\n");
-    tac_print_statistics();
+    tac_print_stats(&stats);
 
     // Display operand usage analysis
     printf("\n");
-    tac_analyze_operand_usage();
+    tac_print_operand_stats(&stats);
 
     // Show detailed analysis
-    show_detailed_analysis();
+    show_detailed_analysis(&stats);
 
     // Analyze control flow
-    analyze_control_flow();
+    analyze_control_flow(&stats);
 
     // Show optimization flags
-    show_optimization_flags();
+    show_optimization_flags(&stats);
+    tac_stats_free(&stats);
 
     // Store validation
     printf("\n=== TAC Store Validation ===\n");
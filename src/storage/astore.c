@@ -23,9 +23,9 @@ ASTNodeIdx_t astlastidx = 0;
 
 
 
-int astore_init(const char *filename) {
-    astfile = filename;
-    fpast = fopen(astfile, "w+b");
+static int astore_start(FILE *fp, const char *name) {
+    astfile = name;
+    fpast = fp;
     if (fpast == NULL) {
         perror(astfile);
         return 1;  // Indicate failure
@@ -33,6 +33,17 @@ int astore_init(const char *filename) {
     return 0;  // Indicate success
 }
 
+int astore_init(const char *filename) {
+    if (filename == NULL) {
+        return 1;  // Indicate failure
+    }
+    return astore_start(fopen(filename, "w+b"), filename);
+}
+
+int astore_init_anonymous(void) {
+    return astore_start(tmpfile(), "astore (temporary)");
+}
+
 
 
 int astore_open(const char *filename) {
@@ -22,6 +22,14 @@
  */
 int astore_init(const char *filename);
 
+/**
+ * @brief Initialize the AST store in an anonymous temporary file (tmpfile()).
+ *
+ * @return int 0 on success,
+                     non-zero on failure.
+ */
+int astore_init_anonymous(void);
+
 /**
  * @brief Open an existing abstract syntax tree store file.
  *
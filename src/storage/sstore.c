@@ -11,6 +11,8 @@
 #include "sstore.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #define SSIZE 2048
 
@@ -22,14 +24,14 @@ int sstoreidx = 0;
 
 
 
-int sstore_init(const char *fname) {
-  sstorefname = fname;
-  sstorefd = fopen(sstorefname, "w+b");  // Read/write binary mode
+static int sstore_start(FILE *fp, const char *name) {
+  sstorefname = name;
+  sstorefd = fp;
   if (sstorefd == NULL) {
     perror(sstorefname);
     return -1;
   }
-  
+
   // Reset global state when initializing for writing
   sstoreidx = 0;
   for (int i = 0; i < SSIZE; i++) {
@@ -41,6 +43,17 @@ int sstore_init(const char *fname) {
   return 0;
 }
 
+int sstore_init(const char *fname) {
+  if (fname == NULL) {
+    return -1;
+  }
+  return sstore_start(fopen(fname, "w+b"), fname);  // Read/write binary mode
+}
+
+int sstore_init_anonymous(void) {
+  return sstore_start(tmpfile(), "sstore (temporary)");
+}
+
 
 
 int sstore_open(const char *fname) {
@@ -83,6 +96,62 @@ char *sstore_get(sstore_pos_t pos) {
 
 
 
+/**
+ * @brief Read a whole string store into memory
+ *
+ * Leaves the store opened by sstore_init()/sstore_open() alone, so several
+ * readers (TAC engines on other threads, say) can each hold their own copy.
+ *
+ * @param size Receives the size of the store in bytes
+ * @return Buffer owned by the caller, or NULL if the file cannot be read
+ */
+char *sstore_load(const char *fname, size_t *size) {
+  FILE *fp = fopen(fname, "rb");
+  if (fp == NULL) {
+    return NULL;
+  }
+
+  char *image = NULL;
+  long length = (fseek(fp, 0, SEEK_END) == 0) ? ftell(fp) : -1;
+  if (length >= 0 && fseek(fp, 0, SEEK_SET) == 0) {
+    image = malloc((size_t)length + 1);
+    if (image != NULL && fread(image, 1, (size_t)length, fp) != (size_t)length) {
+      free(image);
+      image = NULL;
+    }
+  }
+  fclose(fp);
+
+  if (image != NULL) {
+    *size = (size_t)length;
+  }
+  return image;
+}
+
+
+
+/**
+ * @brief Find a string in a store read by sstore_load()
+ * @param length Receives the length of the string
+ * @return The bytes of the string, or NULL if pos is out of range
+ */
+const char *sstore_view(const char *image, size_t size, sstore_pos_t pos,
+                        sstore_len_t *length) {
+  sstore_len_t len;
+
+  if (image == NULL || (size_t)pos + sizeof(len) > size) {
+    return NULL;
+  }
+  memcpy(&len, image + pos, sizeof(len));
+  if ((size_t)pos + sizeof(len) + len > size) {
+    return NULL;
+  }
+  *length = len;
+  return image + pos + sizeof(len);
+}
+
+
+
 void sstore_close() {
   if (sstorefd != NULL) {
     fseek(sstorefd, 0, SEEK_END);
@@ -8,6 +8,7 @@
 #ifndef SRC_STORAGE_SSTORE_H_
 #define SRC_STORAGE_SSTORE_H_
 
+#include <stddef.h>
 #include <stdint.h>
 #include "../utils/hash.h"
 
@@ -23,12 +24,20 @@ typedef struct {
 } sstore_entry_t;
 
 int sstore_init(const char *fname);
+// Like sstore_init(), but keeps the store in an anonymous tmpfile()
+int sstore_init_anonymous(void);
 sstore_pos_t sstore_str(const char *str,
                      sstore_len_t length);
 
 int sstore_open(const char *fname);
 char *sstore_get(sstore_pos_t pos);
 
+// Reentrant readers: a whole store in a buffer owned by the caller (free()),
+// and the string at pos in such a buffer (not NUL-terminated)
+char *sstore_load(const char *fname, size_t *size);
+const char *sstore_view(const char *image, size_t size, sstore_pos_t pos,
+                        sstore_len_t *length);
+
 void sstore_close(void);
 
 
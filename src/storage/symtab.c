@@ -10,15 +10,16 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "symtab.h"
 
 static FILE *fpsym = NULL;
 static const char *symfile = NULL;
 
-int symtab_init(const char *filename) {
-  symfile = filename;
-  fpsym = fopen(symfile, "w+b");  // Read/write binary mode
+static int symtab_start(FILE *fp, const char *name) {
+  symfile = name;
+  fpsym = fp;
   if (fpsym == NULL) {
     perror(symfile);
     return 1;  // Indicate failure
@@ -26,6 +27,17 @@ int symtab_init(const char *filename) {
   return 0;
 }
 
+int symtab_init(const char *filename) {
+  if (filename == NULL) {
+    return 1;  // Indicate failure
+  }
+  return symtab_start(fopen(filename, "w+b"), filename);  // Read/write binary mode
+}
+
+int symtab_init_anonymous(void) {
+  return symtab_start(tmpfile(), "symtab (temporary)");
+}
+
 
 
 int symtab_open(const char *filename) {
@@ -151,6 +163,41 @@ SymIdx_t symtab_get_count(void) {
   return (SymIdx_t)(end_pos / sizeof(SymTabEntry));
 }
 
+/**
+ * @brief Read a whole symbol table into memory
+ *
+ * Leaves the table opened by symtab_init()/symtab_open() alone, so several
+ * readers can each hold their own copy.
+ *
+ * @param filename Symbol table file
+ * @param count Receives the number of entries
+ * @return Entries owned by the caller (index idx at [idx - 1]), or NULL if
+ *         the file cannot be read
+ */
+SymTabEntry *symtab_load(const char *filename, SymIdx_t *count) {
+  FILE *fp = fopen(filename, "rb");
+  if (fp == NULL) {
+    return NULL;
+  }
+
+  SymTabEntry *entries = NULL;
+  long length = (fseek(fp, 0, SEEK_END) == 0) ? ftell(fp) : -1;
+  size_t n = (length > 0) ? (size_t)length / sizeof(SymTabEntry) : 0;
+  if (length >= 0 && n <= 0xFFFF && fseek(fp, 0, SEEK_SET) == 0) {
+    entries = malloc((n > 0 ? n : 1) * sizeof(SymTabEntry));
+    if (entries != NULL && fread(entries, sizeof(SymTabEntry), n, fp) != n) {
+      free(entries);
+      entries = NULL;
+    }
+  }
+  fclose(fp);
+
+  if (entries != NULL) {
+    *count = (SymIdx_t)n;
+  }
+  return entries;
+}
+
 //============================================================================//
 // C99 CONVENIENCE FUNCTIONS
 //============================================================================//
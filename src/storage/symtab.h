@@ -88,6 +88,8 @@ typedef struct SymTabEntry {
 
 
 int symtab_init(const char *filename);
+// Like symtab_init(), but keeps the table in an anonymous tmpfile()
+int symtab_init_anonymous(void);
 int symtab_open(const char *filename);
 void symtab_close(void);
 SymIdx_t symtab_add(SymTabEntry *entry);
@@ -95,6 +97,9 @@ SymIdx_t symtab_update(SymIdx_t idx,
                      SymTabEntry *entry);
 SymTabEntry symtab_get(SymIdx_t idx);
 SymIdx_t symtab_get_count(void);
+// Reentrant reader: a whole table in an array owned by the caller (free()),
+// entry idx at [idx - 1]
+SymTabEntry *symtab_load(const char *filename, SymIdx_t *count);
 
 // C99 convenience functions
 SymIdx_t symtab_add_c99_symbol(SymType type, sstore_pos_t name, 
@@ -16,9 +16,9 @@
 FILE *fptoken = NULL;
 const char *tokenfile = NULL;
 
-int tstore_init(const char *filename) {
-  tokenfile = filename;
-  fptoken = fopen(tokenfile, "w+b");  // Read/write binary mode
+static int tstore_start(FILE *fp, const char *name) {
+  tokenfile = name;
+  fptoken = fp;
   if (fptoken == NULL) {
     perror(tokenfile);
     return 1;  // Indicate failure
@@ -26,6 +26,17 @@ int tstore_init(const char *filename) {
   return 0;  // Indicate success
 }
 
+int tstore_init(const char *filename) {
+  if (filename == NULL) {
+    return 1;  // Indicate failure
+  }
+  return tstore_start(fopen(filename, "w+b"), filename);  // Read/write binary mode
+}
+
+int tstore_init_anonymous(void) {
+  return tstore_start(tmpfile(), "tstore (temporary)");
+}
+
 int tstore_open(const char *filename) {
   tokenfile = filename;
   fptoken = fopen(tokenfile, "rb");
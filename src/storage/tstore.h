@@ -26,6 +26,14 @@
  */
 int tstore_init(const char *filename);
 
+/**
+ * @brief Initialize the token store in an anonymous temporary file (tmpfile()).
+ *
+ * @return int 0 on success,
+                     non-zero on failure.
+ */
+int tstore_init_anonymous(void);
+
 /**
  * @brief Open an existing token store file.
  *
@@ -0,0 +1,34 @@
+/**
+ * @file call_heavy.c
+ * @brief Benchmark kernel: chains of small function calls
+ *
+ * Nested, not recursive, since cc1 does not resolve a function's own name
+ * inside its body yet. Every function uses its own names: cc1 gives
+ * same-named locals of different functions one symbol.
+ *
+ * Expected: 2205
+ */
+
+int inc(int x) {
+    return x + 1;
+}
+
+int twice(int y) {
+    return inc(inc(y));
+}
+
+int mix(int a, int b) {
+    return (twice(a) + twice(b)) % 10007;
+}
+
+int main() {
+    int i;
+    int acc;
+    acc = 0;
+    i = 0;
+    while (i < 100000) {
+        acc = mix(acc, i);
+        i = i + 1;
+    }
+    return acc;
+}
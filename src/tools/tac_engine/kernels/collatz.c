@@ -0,0 +1,35 @@
+/**
+ * @file collatz.c
+ * @brief Benchmark kernel: total Collatz sequence lengths
+ *
+ * A data-dependent branchy loop; stands in for bubble sort until cc2
+ * translates array accesses.
+ *
+ * Expected: 1038733
+ */
+
+int collatz(int x) {
+    int steps;
+    steps = 0;
+    while (x > 1) {
+        if (x % 2 > 0) {
+            x = 3 * x + 1;
+        } else {
+            x = x / 2;
+        }
+        steps = steps + 1;
+    }
+    return steps;
+}
+
+int main() {
+    int n;
+    int total;
+    total = 0;
+    n = 1;
+    while (n < 12000) {
+        total = total + collatz(n);
+        n = n + 1;
+    }
+    return total;
+}
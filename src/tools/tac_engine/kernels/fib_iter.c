@@ -0,0 +1,38 @@
+/**
+ * @file fib_iter.c
+ * @brief Benchmark kernel: Fibonacci numbers modulo a prime
+ *
+ * Iterative, since cc1 does not resolve a function's own name inside its
+ * body yet.
+ *
+ * Expected: 970588
+ */
+
+int fib(int n) {
+    int a;
+    int b;
+    int t;
+    int i;
+    a = 0;
+    b = 1;
+    i = 0;
+    while (i < n) {
+        t = (a + b) % 1000003;
+        a = b;
+        b = t;
+        i = i + 1;
+    }
+    return a;
+}
+
+int main() {
+    int round;
+    int sum;
+    sum = 0;
+    round = 0;
+    while (round < 4000) {
+        sum = (sum + fib(round % 500)) % 1000003;
+        round = round + 1;
+    }
+    return sum;
+}
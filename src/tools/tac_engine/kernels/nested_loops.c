@@ -0,0 +1,28 @@
+/**
+ * @file nested_loops.c
+ * @brief Benchmark kernel: three nested counting loops
+ *
+ * Expected: 10714
+ */
+
+int main() {
+    int i;
+    int j;
+    int k;
+    int sum;
+    sum = 0;
+    i = 0;
+    while (i < 60) {
+        j = 0;
+        while (j < 60) {
+            k = 0;
+            while (k < 60) {
+                sum = (sum + i * j + k) % 65521;
+                k = k + 1;
+            }
+            j = j + 1;
+        }
+        i = i + 1;
+    }
+    return sum;
+}
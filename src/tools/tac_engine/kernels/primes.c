@@ -0,0 +1,35 @@
+/**
+ * @file primes.c
+ * @brief Benchmark kernel: count primes by trial division
+ *
+ * Stands in for a sieve until cc2 translates array accesses.
+ *
+ * Expected: 6057
+ */
+
+int is_prime(int p) {
+    int d;
+    if (p < 2) {
+        return 0;
+    }
+    d = 2;
+    while (d * d <= p) {
+        if (p % d < 1) {
+            return 0;
+        }
+        d = d + 1;
+    }
+    return 1;
+}
+
+int main() {
+    int n;
+    int count;
+    count = 0;
+    n = 0;
+    while (n < 60000) {
+        count = count + is_prime(n);
+        n = n + 1;
+    }
+    return count;
+}
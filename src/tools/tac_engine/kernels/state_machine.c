@@ -0,0 +1,34 @@
+/**
+ * @file state_machine.c
+ * @brief Benchmark kernel: three-state machine driven by a pseudo-random input
+ *
+ * Written as if/else chains, which is what a switch lowers to, since cc1
+ * does not parse switch statements yet.
+ *
+ * Expected: 61187
+ */
+
+int main() {
+    int i;
+    int seed;
+    int state;
+    int score;
+    seed = 1;
+    state = 0;
+    score = 0;
+    i = 0;
+    while (i < 200000) {
+        seed = (seed * 1103 + 12345) % 65536;
+        if (state < 1) {
+            state = 1 + seed / 4096 % 2;
+        } else if (state < 2) {
+            state = seed / 8192 % 3;
+            score = score + 1;
+        } else {
+            state = seed / 16384 % 2;
+            score = score + 2;
+        }
+        i = i + 1;
+    }
+    return score % 65536 + state;
+}
@@ -0,0 +1,448 @@
+/**
+ * @file tac_bench_suite.c
+ * @brief Benchmark suite running compiled C kernels in the TAC Engine
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * Each kernel is a C source under kernels/ compiled by cc0/cc1/cc2 into
+ * <build_dir>/<kernel>/tac.out (the Makefile does this). For every kernel
+ * and execution mode a child process loads the TAC, enters main (the
+ * MAIN_LABEL line of tac.tac), snapshots that state and then restores and
+ * runs it for the warm-up runs followed by the timed runs. The child
+ * reports its figures through a pipe, so every row measures one kernel in
+ * one mode and nothing else. The peak resident set covers the runs only:
+ * the child resets it through /proc/self/clear_refs once the engine is set
+ * up and reads VmHWM from /proc/self/status afterwards (null in the JSON
+ * where /proc does not offer this).
+ *
+ * The value main returns is checked against the "Expected:" line of the
+ * kernel's doc comment. Results are written as JSON (one object per kernel,
+ * one row per mode) for regression tracking, with a summary on stderr.
+ *
+ * Usage: tac_bench_suite [-w warmup] [-r runs] [-o out.json] build_dir kernel.c...
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "tac_engine.h"
+#include "../../ir/tac_store.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SUITE_DEFAULT_WARMUP 1
+#define SUITE_DEFAULT_RUNS   5
+#define SUITE_MAX_RUNS       100
+
+typedef struct suite_mode {
+    const char* name;
+    tac_engine_exec_mode_t exec_mode;
+    bool superinstructions;
+} suite_mode_t;
+
+static const suite_mode_t suite_modes[] = {
+    { "interpret",  TAC_EXEC_INTERPRET,  false },
+    { "predecoded", TAC_EXEC_PREDECODED, false },
+    { "superinsn",  TAC_EXEC_PREDECODED, true },
+    { "bytecode",   TAC_EXEC_BYTECODE,   false },
+    { "jit",        TAC_EXEC_JIT,        false },
+    { "tiered",     TAC_EXEC_TIERED,     true },
+};
+
+#define SUITE_MODE_COUNT (sizeof(suite_modes) / sizeof(suite_modes[0]))
+
+typedef struct suite_kernel {
+    char name[64];
+    char dir[512];
+    int32_t expected;
+    bool has_expected;
+} suite_kernel_t;
+
+// Figures one child sends back to the parent
+typedef struct suite_result {
+    int status;                 // 0 ok, otherwise a tac_engine_error_t or -1
+    char error[128];
+    int32_t result;
+    uint32_t steps;
+    uint64_t min_ns;
+    uint64_t median_ns;
+    long peak_kb;               // Peak resident set of the runs, -1 if unknown
+} suite_result_t;
+
+// =============================================================================
+// KERNEL FILES
+// =============================================================================
+
+/**
+ * @brief Name the kernel after its source and read its expected result
+ */
+static void kernel_init(suite_kernel_t* kernel, const char* source, const char* build_dir) {
+    const char* base = strrchr(source, '/');
+    base = base ? base + 1 : source;
+
+    size_t len = strcspn(base, ".");
+    if (len >= sizeof(kernel->name)) {
+        len = sizeof(kernel->name) - 1;
+    }
+    memcpy(kernel->name, base, len);
+    kernel->name[len] = '\0';
+    snprintf(kernel->dir, sizeof(kernel->dir), "%s/%s", build_dir, kernel->name);
+
+    kernel->has_expected = false;
+    FILE* file = fopen(source, "r");
+    if (!file) {
+        return;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        const char* tag = strstr(line, "Expected:");
+        if (tag && sscanf(tag, "Expected: %d", &kernel->expected) == 1) {
+            kernel->has_expected = true;
+            break;
+        }
+    }
+    fclose(file);
+}
+
+/**
+ * @brief Read <dir>/tac.out with its function section, and the MAIN_LABEL
+ *        of <dir>/tac.tac
+ * @return 0 on success, -1 on error
+ */
+static int kernel_load(const suite_kernel_t* kernel, TACInstruction** code, uint32_t* count,
+                       TACFunction** functions, uint32_t* function_count,
+                       uint32_t* main_label) {
+    char path[600];
+    snprintf(path, sizeof(path), "%s/tac.out", kernel->dir);
+    *code = tacstore_load(path, count, functions, function_count);
+    if (!*code) {
+        return -1;
+    }
+
+    snprintf(path, sizeof(path), "%s/tac.tac", kernel->dir);
+    FILE* file = fopen(path, "r");
+    char line[256];
+    bool found = false;
+    while (file && !found && fgets(line, sizeof(line), file)) {
+        found = sscanf(line, "; MAIN_LABEL: %u", main_label) == 1;
+    }
+    if (file) {
+        fclose(file);
+    }
+    if (!found) {
+        free(*code);
+        free(*functions);
+        *code = NULL;
+        *functions = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+// =============================================================================
+// MEASUREMENT (child process)
+// =============================================================================
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Reset the peak resident set of this process to its current size
+ * @return 0 on success, -1 if /proc/self/clear_refs cannot be written
+ */
+static int peak_rss_reset(void) {
+    FILE* file = fopen("/proc/self/clear_refs", "w");
+    if (!file) {
+        return -1;
+    }
+    bool ok = fputs("5", file) >= 0;
+    return (fclose(file) == 0 && ok) ? 0 : -1;
+}
+
+/**
+ * @brief Peak resident set since the last reset (VmHWM)
+ * @return KiB, or -1 if /proc/self/status has no VmHWM line
+ */
+static long peak_rss_kb(void) {
+    FILE* file = fopen("/proc/self/status", "r");
+    if (!file) {
+        return -1;
+    }
+    char line[256];
+    long peak = -1;
+    while (peak < 0 && fgets(line, sizeof(line), file)) {
+        if (sscanf(line, "VmHWM: %ld kB", &peak) != 1) {
+            peak = -1;
+        }
+    }
+    fclose(file);
+    return peak;
+}
+
+/**
+ * @brief Warm up and time one kernel in one mode
+ */
+static void measure(const suite_kernel_t* kernel, const suite_mode_t* mode,
+                    int warmup, int runs, suite_result_t* out) {
+    memset(out, 0, sizeof(*out));
+    out->status = -1;
+    out->peak_kb = -1;
+
+    TACInstruction* code = NULL;
+    uint32_t count = 0;
+    TACFunction* functions = NULL;
+    uint32_t function_count = 0;
+    uint32_t main_label = 0;
+    if (kernel_load(kernel, &code, &count, &functions, &function_count, &main_label) != 0) {
+        snprintf(out->error, sizeof(out->error), "cannot load tac.out or MAIN_LABEL");
+        return;
+    }
+
+    tac_engine_config_t config = tac_engine_default_config();
+    config.max_steps = UINT32_MAX;
+    config.exec_mode = mode->exec_mode;
+    config.enable_superinstructions = mode->superinstructions;
+
+    tac_engine_t* engine = tac_engine_create(&config);
+    tac_snapshot_t* start = NULL;
+    tac_engine_error_t err = engine ? TAC_ENGINE_OK : TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    if (err == TAC_ENGINE_OK) {
+        err = tac_engine_load_program(engine, code, count, functions, function_count);
+    }
+    if (err == TAC_ENGINE_OK) {
+        err = tac_engine_set_entry_label(engine, main_label);
+    }
+    if (err == TAC_ENGINE_OK) {
+        err = tac_engine_snapshot(engine, &start);
+    }
+
+    // Loading and snapshotting are not part of the peak
+    bool rss_reset = err == TAC_ENGINE_OK && peak_rss_reset() == 0;
+
+    uint64_t times[SUITE_MAX_RUNS];
+    for (int i = 0; err == TAC_ENGINE_OK && i < warmup + runs; i++) {
+        err = tac_engine_restore(engine, start);
+        if (err != TAC_ENGINE_OK) {
+            break;
+        }
+        uint64_t begin = now_ns();
+        err = tac_engine_run(engine);
+        uint64_t end = now_ns();
+        if (i >= warmup) {
+            times[i - warmup] = end - begin;
+        }
+    }
+    if (rss_reset) {
+        out->peak_kb = peak_rss_kb();
+    }
+
+    tac_value_t value;
+    if (err == TAC_ENGINE_OK) {
+        err = tac_engine_get_temp(engine, 0, &value);
+    }
+    if (err == TAC_ENGINE_OK) {
+        qsort(times, (size_t)runs, sizeof(times[0]), compare_u64);
+        out->status = 0;
+        out->result = value.data.i32;
+        out->steps = tac_engine_get_step_count(engine);
+        out->min_ns = times[0];
+        out->median_ns = times[runs / 2];
+    } else {
+        out->status = err;
+        snprintf(out->error, sizeof(out->error), "%s", tac_engine_error_string(err));
+    }
+
+    tac_engine_snapshot_free(start);
+    tac_engine_destroy(engine);
+    free(code);
+    free(functions);
+}
+
+/**
+ * @brief Measure in a child process
+ * @return 0 if the child reported, -1 otherwise
+ */
+static int measure_isolated(const suite_kernel_t* kernel, const suite_mode_t* mode,
+                            int warmup, int runs, suite_result_t* out) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return -1;
+    }
+
+    fflush(NULL);
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return -1;
+    }
+    if (pid == 0) {
+        // The engine's debug output would interleave with the JSON
+        if (!freopen("/dev/null", "w", stdout)) {
+            _exit(1);
+        }
+        close(fds[0]);
+        suite_result_t result;
+        measure(kernel, mode, warmup, runs, &result);
+        ssize_t written = write(fds[1], &result, sizeof(result));
+        _exit(written == (ssize_t)sizeof(result) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    size_t got = 0;
+    while (got < sizeof(*out)) {
+        ssize_t n = read(fds[0], (char*)out + got, sizeof(*out) - got);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            break;
+        }
+        got += (size_t)n;
+    }
+    close(fds[0]);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+    }
+
+    if (got != sizeof(*out)) {
+        memset(out, 0, sizeof(*out));
+        out->status = -1;
+        out->peak_kb = -1;
+        snprintf(out->error, sizeof(out->error), "child exited with status %d", status);
+    }
+    return 0;
+}
+
+// =============================================================================
+// DRIVER
+// =============================================================================
+
+static void usage(const char* program) {
+    fprintf(stderr, "Usage: %s [-w warmup] [-r runs] [-o out.json] build_dir kernel.c...\n",
+            program);
+}
+
+int main(int argc, char** argv) {
+    int warmup = SUITE_DEFAULT_WARMUP;
+    int runs = SUITE_DEFAULT_RUNS;
+    const char* output = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "w:r:o:h")) != -1) {
+        switch (opt) {
+            case 'w': warmup = atoi(optarg); break;
+            case 'r': runs = atoi(optarg); break;
+            case 'o': output = optarg; break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+    if (argc - optind < 2 || warmup < 0 || runs < 1 || runs > SUITE_MAX_RUNS) {
+        usage(argv[0]);
+        return 2;
+    }
+    const char* build_dir = argv[optind++];
+
+    FILE* json = output ? fopen(output, "w") : stdout;
+    if (!json) {
+        fprintf(stderr, "Cannot write %s: %s\n", output, strerror(errno));
+        return 1;
+    }
+
+    fprintf(json, "{\n  \"warmup\": %d,\n  \"runs\": %d,\n  \"kernels\": [", warmup, runs);
+    fprintf(stderr, "%-14s %-10s %10s %12s %10s %12s %9s\n",
+            "kernel", "mode", "steps", "median ms", "ns/step", "Minsn/s", "peak KiB");
+
+    int failures = 0;
+    for (int k = optind; k < argc; k++) {
+        suite_kernel_t kernel;
+        kernel_init(&kernel, argv[k], build_dir);
+        if (!kernel.has_expected) {
+            fprintf(stderr, "%s: no 'Expected:' line\n", argv[k]);
+            failures++;
+        }
+
+        fprintf(json, "%s\n    {\n      \"name\": \"%s\",\n", k > optind ? "," : "",
+                kernel.name);
+        if (kernel.has_expected) {
+            fprintf(json, "      \"expected\": %d,\n", kernel.expected);
+        }
+        fprintf(json, "      \"modes\": [");
+
+        for (size_t m = 0; m < SUITE_MODE_COUNT; m++) {
+            const suite_mode_t* mode = &suite_modes[m];
+            suite_result_t result;
+            if (measure_isolated(&kernel, mode, warmup, runs, &result) != 0) {
+                memset(&result, 0, sizeof(result));
+                result.status = -1;
+                result.peak_kb = -1;
+                snprintf(result.error, sizeof(result.error), "%s", strerror(errno));
+            }
+
+            bool ok = result.status == 0 && kernel.has_expected &&
+                      result.result == kernel.expected;
+            double ns_per_step = result.steps ?
+                (double)result.median_ns / result.steps : 0.0;
+            double insns_per_sec = result.median_ns ?
+                (double)result.steps * 1e9 / (double)result.median_ns : 0.0;
+
+            fprintf(json, "%s\n        {\"mode\": \"%s\", \"ok\": %s",
+                    m ? "," : "", mode->name, ok ? "true" : "false");
+            if (result.status == 0) {
+                fprintf(json, ", \"result\": %d, \"steps\": %u, \"median_ns\": %llu, "
+                        "\"min_ns\": %llu, \"ns_per_step\": %.3f, \"insns_per_sec\": %.0f",
+                        result.result, result.steps,
+                        (unsigned long long)result.median_ns,
+                        (unsigned long long)result.min_ns, ns_per_step, insns_per_sec);
+            } else {
+                fprintf(json, ", \"error\": \"%s\"", result.error);
+            }
+            if (result.peak_kb >= 0) {
+                fprintf(json, ", \"peak_rss_kb\": %ld}", result.peak_kb);
+            } else {
+                fprintf(json, ", \"peak_rss_kb\": null}");
+            }
+
+            if (result.status != 0) {
+                fprintf(stderr, "%-14s %-10s failed: %s\n", kernel.name, mode->name,
+                        result.error);
+                failures++;
+                continue;
+            }
+            fprintf(stderr, "%-14s %-10s %10u %12.2f %10.2f %12.1f %9ld\n",
+                    kernel.name, mode->name, result.steps, result.median_ns / 1e6,
+                    ns_per_step, insns_per_sec / 1e6, result.peak_kb);
+            if (!ok && kernel.has_expected) {
+                fprintf(stderr, "%14s result %d differs from expected %d\n", "",
+                        result.result, kernel.expected);
+                failures++;
+            }
+        }
+        fprintf(json, "\n      ]\n    }");
+    }
+    fprintf(json, "\n  ]\n}\n");
+
+    if (json != stdout) {
+        fclose(json);
+    }
+    return failures ? 1 : 0;
+}
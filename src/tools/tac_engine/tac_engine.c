@@ -9,6 +9,7 @@
 
 #include "tac_engine.h"
 #include "tac_engine_internal.h"
+#include "tac_engine_log.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
@@ -17,7 +18,8 @@
 
 // Include storage system headers for symbol table integration
 #include "../../storage/symtab.h"
-#include "../../storage/sstore.h"
+#include "../../ir/tac_stats.h"
+#include "../../ir/tac_function.h"
 
 // Forward declarations for internal functions
 static tac_engine_error_t tac_execute_param(tac_engine_t* engine, const TACInstruction* instruction);
@@ -49,8 +51,7 @@ tac_engine_t* tac_engine_create(const tac_engine_config_t* config) {
     // Validate configuration - reject invalid values
     if (config->max_temporaries == 0 || 
         config->max_variables == 0 || 
-        config->max_memory_size == 0 ||
-        config->max_call_depth == 0) {
+        config->max_memory_size == 0) {
         return NULL;
     }
 
@@ -66,29 +67,38 @@ tac_engine_t* tac_engine_create(const tac_engine_config_t* config) {
     // Initialize state
     engine->state = TAC_ENGINE_STOPPED;
     engine->last_error = TAC_ENGINE_OK;
+    tac_engine_record_stop(engine);
+
     engine->pc = 0;
     engine->step_count = 0;
     engine->running = false;
 
     // Initialize memory manager
     if (tac_memory_init(&engine->memory, config->max_memory_size) != TAC_ENGINE_OK) {
+        tac_memory_cleanup(&engine->memory);
         free(engine);
         return NULL;
     }
+    engine->memory.bounds_check = config->enable_bounds_check;
 
     // Initialize label table
     if (tac_label_table_init(&engine->label_table) != TAC_ENGINE_OK) {
+        tac_memory_cleanup(&engine->memory);
         free(engine);
         return NULL;
     }
 
-    // Allocate variable storage
-    engine->temporaries = calloc(config->max_temporaries, sizeof(tac_value_t));
-    engine->variables = calloc(config->max_variables, sizeof(tac_value_t));
-    
-    if (!engine->temporaries || !engine->variables) {
-        free(engine->temporaries);
-        free(engine->variables);
+    // Allocate variable storage: one register file, variables first
+    engine->registers = calloc((size_t)config->max_variables + config->max_temporaries,
+                               sizeof(tac_value_t));
+    if (engine->registers) {
+        engine->variables = engine->registers;
+        engine->temporaries = engine->registers + config->max_variables;
+    }
+
+
+    if (!engine->registers) {
+        tac_memory_cleanup(&engine->memory);
         free(engine);
         return NULL;
     }
@@ -98,8 +108,8 @@ tac_engine_t* tac_engine_create(const tac_engine_config_t* config) {
         // Use a fixed size for now
         engine->trace.entries = calloc(1000, sizeof(tac_trace_entry_t));
         if (!engine->trace.entries) {
-            free(engine->temporaries);
-            free(engine->variables);
+            free(engine->registers);
+            tac_memory_cleanup(&engine->memory);
             free(engine);
             return NULL;
         }
@@ -107,6 +117,22 @@ tac_engine_t* tac_engine_create(const tac_engine_config_t* config) {
         engine->trace.enabled = true;
     }
 
+    // Pair profiling counts every executed fall-through opcode pair
+    engine->pair_prev = TAC_NO_TARGET;
+    engine->paused_at = TAC_NO_TARGET;
+    if (config->enable_pair_profile) {
+        engine->pair_counts = calloc((size_t)TAC_PAIR_OPCODES * TAC_PAIR_OPCODES,
+                                     sizeof(uint64_t));
+        if (!engine->pair_counts) {
+            free(engine->trace.entries);
+            free(engine->registers);
+            tac_memory_cleanup(&engine->memory);
+            free(engine);
+            return NULL;
+        }
+    }
+    tac_update_instrumentation(engine);
+
     // Initialize symbol table integration
     engine->symbols.loaded = false;
     engine->symbols.cache_hits = 0;
@@ -121,7 +147,7 @@ tac_engine_t* tac_engine_create(const tac_engine_config_t* config) {
     if (config->symtab_file) {
         tac_engine_error_t symbol_result = tac_engine_load_symbols(engine);
         if (symbol_result != TAC_ENGINE_OK) {
-            printf("Warning: Symbol table loading failed, continuing without symbol resolution\n");
+            TAC_LOG_WARN(engine, TAC_LOG_CAT_SYMBOLS, "Symbol table loading failed, continuing without symbol resolution");
             // Continue execution but disable symbol resolution
             engine->config.enable_symbol_resolution = false;
         }
@@ -142,38 +168,40 @@ void tac_engine_destroy(tac_engine_t* engine) {
 
     // Free instructions
     free(engine->instructions);
+    free(engine->function_records);
+    tac_jit_release(engine);
+    tac_types_cleanup(engine);
+    tac_tier_cleanup(engine);
     
     // Free variable storage
-    free(engine->temporaries);
-    free(engine->variables);
+    free(engine->registers);
 
-    // Free trace buffer
+    // Free trace buffer and pair profile, flush the trace file and input log
+    tac_engine_trace_stop(engine);
+    tac_engine_record_stop(engine);
     free(engine->trace.entries);
+    free(engine->pair_counts);
+    tac_profile_cleanup(engine);
 
-    // Free call stack
-    while (engine->call_stack) {
-        tac_stack_frame_t* frame = engine->call_stack;
-        engine->call_stack = frame->prev;
-        free(frame->locals);
-        free(frame);
-    }
+    // Free virtual memory
+    tac_memory_cleanup(&engine->memory);
 
-    // Free hooks
-    while (engine->hooks) {
-        tac_hook_entry_t* hook = engine->hooks;
-        engine->hooks = hook->next;
-        free(hook);
-    }
+    // Free call stack and function metadata
+    tac_function_table_cleanup(engine);
+    free(engine->frames);
 
-    // Free breakpoints
-    while (engine->breakpoints) {
-        tac_breakpoint_t* bp = engine->breakpoints;
-        engine->breakpoints = bp->next;
-        free(bp);
-    }
+    // Free hooks and breakpoints
+    tac_debug_cleanup(engine);
+
+    // Free symbol table images
+    free(engine->symbols.entries);
+    free(engine->symbols.strings);
 
-    // Cleanup label table
+    // Cleanup label table, pre-decoded code and bytecode
     tac_label_table_cleanup(&engine->label_table);
+    free(engine->jump_targets);
+    tac_decoded_program_cleanup(&engine->decoded);
+    tac_bytecode_cleanup(&engine->bytecode);
 
     free(engine);
 }
@@ -197,7 +225,8 @@ tac_engine_error_t tac_build_label_table(tac_engine_t* engine) {
         return TAC_ENGINE_ERR_NULL_POINTER;
     }
     
-    // Initialize label table
+    // Drop entries from a previous load, then initialize
+    tac_label_table_cleanup(&engine->label_table);
     tac_engine_error_t err = tac_label_table_init(&engine->label_table);
     if (err != TAC_ENGINE_OK) {
         return err;
@@ -207,8 +236,8 @@ tac_engine_error_t tac_build_label_table(tac_engine_t* engine) {
     for (uint32_t i = 0; i < engine->instruction_count; i++) {
         const TACInstruction* inst = &engine->instructions[i];
         
-        printf("DEBUG: Instruction %u: opcode=0x%02x, operand1.type=%d\n", 
-               i, inst->opcode, inst->operand1.type);
+        TAC_LOG_TRACE(engine, TAC_LOG_CAT_LABELS, "Instruction %u: opcode=0x%02x, operand1.type=%d",
+                      i, inst->opcode, inst->operand1.type);
         
         if (inst->opcode == TAC_LABEL) {
             // Extract label ID from the instruction
@@ -216,13 +245,13 @@ tac_engine_error_t tac_build_label_table(tac_engine_t* engine) {
             uint16_t label_id = 0;
             if (inst->result.type == TAC_OP_LABEL) {
                 label_id = inst->result.data.label.offset;
-                printf("DEBUG: Found label with TAC_OP_LABEL in result, ID=%u\n", label_id);
+                TAC_LOG_DEBUG(engine, TAC_LOG_CAT_LABELS, "Found label with TAC_OP_LABEL in result, ID=%u", label_id);
             } else if (inst->operand1.type == TAC_OP_LABEL) {
                 label_id = inst->operand1.data.label.offset;
-                printf("DEBUG: Found label with TAC_OP_LABEL in operand1, ID=%u\n", label_id);
+                TAC_LOG_DEBUG(engine, TAC_LOG_CAT_LABELS, "Found label with TAC_OP_LABEL in operand1, ID=%u", label_id);
             } else if (inst->operand1.type == TAC_OP_IMMEDIATE) {
                 label_id = (uint16_t)inst->operand1.data.immediate.value;
-                printf("DEBUG: Found label with TAC_OP_IMMEDIATE, ID=%u\n", label_id);
+                TAC_LOG_DEBUG(engine, TAC_LOG_CAT_LABELS, "Found label with TAC_OP_IMMEDIATE, ID=%u", label_id);
             } else {
                 // Workaround: For corrupted labels, generate label ID based on position
                 // Looking at the pattern, labels appear at positions 0, 6, 8
@@ -232,8 +261,8 @@ tac_engine_error_t tac_build_label_table(tac_engine_t* engine) {
                 else if (i == 8) label_id = 3;  // L3 at position 8
                 else label_id = i + 1;          // Fallback: use position + 1
                 
-                printf("DEBUG: Label instruction with invalid operand type %d, using workaround ID=%u\n", 
-                       inst->operand1.type, label_id);
+                TAC_LOG_DEBUG(engine, TAC_LOG_CAT_LABELS, "Label instruction with invalid operand type %d, using workaround ID=%u",
+                              inst->operand1.type, label_id);
             }
             
             // Add to hash table
@@ -249,11 +278,11 @@ tac_engine_error_t tac_build_label_table(tac_engine_t* engine) {
             engine->label_table.entries[hash] = entry;
             engine->label_table.count++;
             
-            printf("DEBUG: Registered label %u at address %u\n", label_id, i);
+            TAC_LOG_DEBUG(engine, TAC_LOG_CAT_LABELS, "Registered label %u at address %u", label_id, i);
         }
     }
     
-    printf("DEBUG: Built label table with %u labels\n", engine->label_table.count);
+    TAC_LOG_DEBUG(engine, TAC_LOG_CAT_LABELS, "Built label table with %u labels", engine->label_table.count);
     return TAC_ENGINE_OK;
 }
 
@@ -276,6 +305,65 @@ tac_engine_error_t tac_resolve_label(const tac_label_table_t* table, uint16_t la
     return TAC_ENGINE_ERR_INVALID_OPERAND;
 }
 
+tac_engine_error_t tac_resolve_jump_targets(tac_engine_t* engine) {
+    if (!engine || !engine->instructions) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    free(engine->jump_targets);
+    engine->jump_targets = malloc((size_t)engine->instruction_count * sizeof(uint32_t));
+    if (!engine->jump_targets) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    for (uint32_t i = 0; i < engine->instruction_count; i++) {
+        const TACInstruction* inst = &engine->instructions[i];
+        const TACOperand* operand;
+        uint32_t target = TAC_NO_TARGET;
+
+        switch (inst->opcode) {
+            case TAC_GOTO:
+            case TAC_CALL:
+                operand = &inst->operand1;
+                break;
+            case TAC_IF_TRUE:
+            case TAC_IF_FALSE:
+                operand = &inst->operand2;
+                break;
+            default:
+                operand = NULL;
+                break;
+        }
+
+        if (operand && operand->type == TAC_OP_LABEL) {
+            if (tac_resolve_label(&engine->label_table, operand->data.label.offset,
+                                  &target) != TAC_ENGINE_OK) {
+                target = TAC_NO_TARGET;
+            }
+        } else if (operand && operand->type == TAC_OP_IMMEDIATE) {
+            target = (uint32_t)operand->data.immediate.value;
+        }
+
+        // Out-of-range targets keep the checked path for error reporting
+        engine->jump_targets[i] = (target < engine->instruction_count) ? target : TAC_NO_TARGET;
+    }
+
+    return TAC_ENGINE_OK;
+}
+
+/**
+ * @brief Load-time target of the instruction at the current PC
+ * @return Resolved index, or TAC_NO_TARGET if the checked path must run
+ */
+static inline uint32_t tac_current_jump_target(const tac_engine_t* engine,
+                                               const TACInstruction* instruction) {
+    if (engine->jump_targets && engine->pc < engine->instruction_count &&
+        instruction == &engine->instructions[engine->pc]) {
+        return engine->jump_targets[engine->pc];
+    }
+    return TAC_NO_TARGET;
+}
+
 void tac_label_table_cleanup(tac_label_table_t* table) {
     if (!table) {
         return;
@@ -347,12 +435,13 @@ tac_engine_error_t tac_eval_operand(tac_engine_t* engine,
             *value = engine->variables[var_id];
             
             // Enhanced debugging with symbol resolution
-            if (engine->config.enable_tracing && engine->config.enable_symbol_resolution) {
+            if (TAC_LOG_ACTIVE(engine, TAC_LOG_LEVEL_TRACE, TAC_LOG_CAT_SYMBOLS) &&
+                engine->config.enable_symbol_resolution) {
                 char var_name[64];
                 uint8_t var_type;
                 if (tac_resolve_symbol(engine, var_id, var_name, sizeof(var_name), &var_type) == TAC_ENGINE_OK) {
-                    printf("DEBUG: Accessed variable '%s' (ID=%u, value=%d)\n", 
-                           var_name, var_id, value->data.i32);
+                    TAC_LOG_TRACE(engine, TAC_LOG_CAT_SYMBOLS, "Accessed variable '%s' (ID=%u, value=%d)",
+                                  var_name, var_id, value->data.i32);
                 }
             }
             break;
@@ -378,6 +467,7 @@ tac_engine_error_t tac_store_operand(tac_engine_t* engine,
                 return TAC_ENGINE_ERR_INVALID_OPERAND;
             }
             engine->temporaries[operand->data.variable.id] = *value;
+            tac_watch_slot(engine, engine->config.max_variables + operand->data.variable.id);
             break;
             
         case TAC_OP_VAR: {
@@ -402,14 +492,16 @@ tac_engine_error_t tac_store_operand(tac_engine_t* engine,
             
             // Store variable value
             engine->variables[var_id] = *value;
+            tac_watch_slot(engine, var_id);
             
             // Enhanced debugging with symbol resolution
-            if (engine->config.enable_tracing && engine->config.enable_symbol_resolution) {
+            if (TAC_LOG_ACTIVE(engine, TAC_LOG_LEVEL_TRACE, TAC_LOG_CAT_SYMBOLS) &&
+                engine->config.enable_symbol_resolution) {
                 char var_name[64];
                 uint8_t var_type;
                 if (tac_resolve_symbol(engine, var_id, var_name, sizeof(var_name), &var_type) == TAC_ENGINE_OK) {
-                    printf("DEBUG: Stored to variable '%s' (ID=%u, value=%d)\n", 
-                           var_name, var_id, value->data.i32);
+                    TAC_LOG_TRACE(engine, TAC_LOG_CAT_SYMBOLS, "Stored to variable '%s' (ID=%u, value=%d)",
+                                  var_name, var_id, value->data.i32);
                 }
             }
             break;
@@ -440,10 +532,10 @@ tac_engine_error_t tac_execute_binary_op(tac_engine_t* engine,
     
     // Debug: show which variables are being accessed
     if (instruction->operand1.type == TAC_OP_VAR) {
-        printf("DEBUG BINARY OP: Reading operand1 from v%u\n", instruction->operand1.data.variable.id);
+        TAC_LOG_TRACE(engine, TAC_LOG_CAT_DISPATCH, "Reading operand1 from v%u", instruction->operand1.data.variable.id);
     }
     if (instruction->operand2.type == TAC_OP_VAR) {
-        printf("DEBUG BINARY OP: Reading operand2 from v%u\n", instruction->operand2.data.variable.id);
+        TAC_LOG_TRACE(engine, TAC_LOG_CAT_DISPATCH, "Reading operand2 from v%u", instruction->operand2.data.variable.id);
     }
     
     tac_engine_error_t err1 = tac_eval_operand(engine, &instruction->operand1, &val1);
@@ -452,8 +544,8 @@ tac_engine_error_t tac_execute_binary_op(tac_engine_t* engine,
     if (err1 != TAC_ENGINE_OK) return err1;
     if (err2 != TAC_ENGINE_OK) return err2;
 
-    printf("DEBUG BINARY OP: operand1=%d, operand2=%d, opcode=0x%02x\n", 
-           val1.data.i32, val2.data.i32, instruction->opcode);
+    TAC_LOG_TRACE(engine, TAC_LOG_CAT_DISPATCH, "operand1=%d, operand2=%d, opcode=0x%02x",
+                  val1.data.i32, val2.data.i32, instruction->opcode);
 
     // Perform operation based on opcode
     switch (instruction->opcode) {
@@ -494,7 +586,7 @@ tac_engine_error_t tac_execute_binary_op(tac_engine_t* engine,
                                  "Division by zero");
                     return TAC_ENGINE_ERR_DIVISION_BY_ZERO;
                 }
-                result_val.data.i32 = val1.data.i32 / val2.data.i32;
+                result_val.data.i32 = tac_div_i32(val1.data.i32, val2.data.i32);
                 result_val.type = TAC_VALUE_INT32;
             } else if (val1.type == TAC_VALUE_FLOAT) {
                 if (val2.data.f32 == 0.0f) {
@@ -574,7 +666,7 @@ tac_engine_error_t tac_execute_binary_op(tac_engine_t* engine,
                                  "Modulo by zero");
                     return TAC_ENGINE_ERR_DIVISION_BY_ZERO;
                 }
-                result_val.data.i32 = val1.data.i32 % val2.data.i32;
+                result_val.data.i32 = tac_mod_i32(val1.data.i32, val2.data.i32);
                 result_val.type = TAC_VALUE_INT32;
             }
             break;
@@ -602,14 +694,14 @@ tac_engine_error_t tac_execute_binary_op(tac_engine_t* engine,
             
         case TAC_SHL:
             if (val1.type == TAC_VALUE_INT32) {
-                result_val.data.i32 = val1.data.i32 << val2.data.i32;
+                result_val.data.i32 = tac_shl_i32(val1.data.i32, val2.data.i32);
                 result_val.type = TAC_VALUE_INT32;
             }
             break;
             
         case TAC_SHR:
             if (val1.type == TAC_VALUE_INT32) {
-                result_val.data.i32 = val1.data.i32 >> val2.data.i32;
+                result_val.data.i32 = tac_shr_i32(val1.data.i32, val2.data.i32);
                 result_val.type = TAC_VALUE_INT32;
             }
             break;
@@ -636,38 +728,108 @@ tac_engine_error_t tac_execute_binary_op(tac_engine_t* engine,
     return tac_store_operand(engine, &instruction->result, &result_val);
 }
 
+/**
+ * @brief Read an operand known to be an immediate or an int32 slot
+ */
+static inline int32_t tac_int32_operand(const tac_engine_t* engine,
+                                        const TACOperand* operand) {
+    switch (operand->type) {
+        case TAC_OP_VAR:   return engine->variables[operand->data.variable.id].data.i32;
+        case TAC_OP_TEMP:  return engine->temporaries[operand->data.variable.id].data.i32;
+        case TAC_OP_LABEL: return operand->data.label.offset;
+        default:           return operand->data.immediate.value;
+    }
+}
+
+tac_engine_error_t tac_execute_binary_i32(tac_engine_t* engine,
+                                          const TACInstruction* instruction) {
+    int32_t a = tac_int32_operand(engine, &instruction->operand1);
+    int32_t b = tac_int32_operand(engine, &instruction->operand2);
+    int32_t r;
+
+    switch (instruction->opcode) {
+        case TAC_ADD: r = (int32_t)((uint32_t)a + (uint32_t)b); break;
+        case TAC_SUB: r = (int32_t)((uint32_t)a - (uint32_t)b); break;
+        case TAC_MUL: r = (int32_t)((uint32_t)a * (uint32_t)b); break;
+        case TAC_DIV:
+            if (b == 0) {
+                tac_set_error(engine, TAC_ENGINE_ERR_DIVISION_BY_ZERO, "Division by zero");
+                return TAC_ENGINE_ERR_DIVISION_BY_ZERO;
+            }
+            r = tac_div_i32(a, b);
+            break;
+        case TAC_MOD:
+            if (b == 0) {
+                tac_set_error(engine, TAC_ENGINE_ERR_DIVISION_BY_ZERO, "Modulo by zero");
+                return TAC_ENGINE_ERR_DIVISION_BY_ZERO;
+            }
+            r = tac_mod_i32(a, b);
+            break;
+        case TAC_GT: r = a > b; break;
+        case TAC_LT: r = a < b; break;
+        case TAC_EQ: r = a == b; break;
+        case TAC_NE: r = a != b; break;
+        case TAC_LE: r = a <= b; break;
+        case TAC_GE: r = a >= b; break;
+        case TAC_AND: r = a & b; break;
+        case TAC_OR: r = a | b; break;
+        case TAC_XOR: r = a ^ b; break;
+        case TAC_SHL: r = tac_shl_i32(a, b); break;
+        case TAC_SHR: r = tac_shr_i32(a, b); break;
+        case TAC_LOGICAL_AND: r = a && b; break;
+        case TAC_LOGICAL_OR: r = a || b; break;
+        default:
+            return TAC_ENGINE_ERR_INVALID_OPCODE;
+    }
+
+    // tac_types_infer() only flags in-range variable and temporary results
+    uint32_t slot = instruction->result.data.variable.id;
+    if (instruction->result.type == TAC_OP_TEMP) {
+        slot += engine->config.max_variables;
+    }
+    engine->registers[slot] = tac_value_int32(r);
+    tac_watch_slot(engine, slot);
+    return TAC_ENGINE_OK;
+}
+
 tac_engine_error_t tac_execute_jump(tac_engine_t* engine,
                                    const TACInstruction* instruction) {
+    uint32_t resolved = tac_current_jump_target(engine, instruction);
+    if (resolved != TAC_NO_TARGET) {
+        engine->pc = resolved;
+        return TAC_ENGINE_OK;
+    }
+
     // Debug: Print operand info
-    printf("DEBUG: Jump operand1 type=%d\n", instruction->operand1.type);
+    TAC_LOG_TRACE(engine, TAC_LOG_CAT_LABELS, "Jump operand1 type=%d", instruction->operand1.type);
     
     // For unconditional jump, target can be immediate or label
     uint32_t target;
     
     if (instruction->operand1.type == TAC_OP_IMMEDIATE) {
         target = (uint32_t)instruction->operand1.data.immediate.value;
-        printf("DEBUG: Jump to immediate target=%u\n", target);
+        TAC_LOG_TRACE(engine, TAC_LOG_CAT_LABELS, "Jump to immediate target=%u", target);
     } else if (instruction->operand1.type == TAC_OP_LABEL) {
         uint16_t label_id = instruction->operand1.data.label.offset;
-        printf("DEBUG: Jump to label ID=%u\n", label_id);
+        TAC_LOG_TRACE(engine, TAC_LOG_CAT_LABELS, "Jump to label ID=%u", label_id);
         
         // Resolve label ID to instruction address
         tac_engine_error_t err = tac_resolve_label(&engine->label_table, label_id, &target);
         if (err != TAC_ENGINE_OK) {
-            printf("DEBUG: Failed to resolve label %u\n", label_id);
+            TAC_LOG_DEBUG(engine, TAC_LOG_CAT_LABELS, "Failed to resolve label %u", label_id);
             tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND,
                          "Cannot resolve label %u", label_id);
             return TAC_ENGINE_ERR_INVALID_OPERAND;
         }
-        printf("DEBUG: Resolved label %u to target=%u\n", label_id, target);
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_LABELS, "Resolved label %u to target=%u", label_id, target);
     } else {
-        printf("DEBUG: Invalid jump operand type=%d\n", instruction->operand1.type);
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_LABELS, "Invalid jump operand type=%d", instruction->operand1.type);
         tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND,
                      "Jump target must be immediate or label value");
         return TAC_ENGINE_ERR_INVALID_OPERAND;
     }
     
-    printf("DEBUG: Target=%u, instruction_count=%u\n", target, engine->instruction_count);
+    TAC_LOG_TRACE(engine, TAC_LOG_CAT_LABELS, "Target=%u, instruction_count=%u", target, engine->instruction_count);
     
     if (target >= engine->instruction_count) {
         tac_set_error(engine, TAC_ENGINE_ERR_INVALID_MEMORY,
@@ -676,7 +838,7 @@ tac_engine_error_t tac_execute_jump(tac_engine_t* engine,
     }
 
     engine->pc = target;
-    printf("DEBUG: Jump successful, PC set to %u\n", target);
+    TAC_LOG_TRACE(engine, TAC_LOG_CAT_LABELS, "Jump successful, PC set to %u", target);
     return TAC_ENGINE_OK;
 }
 
@@ -700,6 +862,12 @@ tac_engine_error_t tac_execute_conditional_jump(tac_engine_t* engine,
     }
 
     if (should_jump) {
+        uint32_t resolved = tac_current_jump_target(engine, instruction);
+        if (resolved != TAC_NO_TARGET) {
+            engine->pc = resolved;
+            return TAC_ENGINE_OK;
+        }
+
         // For conditional jumps, the target is in operand2, not operand1
         // Create a temporary instruction with target in operand1 for tac_execute_jump
         TACInstruction jump_inst = *instruction;
@@ -711,317 +879,6 @@ tac_engine_error_t tac_execute_conditional_jump(tac_engine_t* engine,
     }
 }
 
-tac_engine_error_t tac_execute_call(tac_engine_t* engine,
-                                   const TACInstruction* instruction) {
-    // Get call target - handle both immediate and label operands
-    uint32_t target;
-    
-    if (instruction->operand1.type == TAC_OP_LABEL) {
-        // Resolve label to address
-        uint16_t label_id = instruction->operand1.data.label.offset;
-        
-        tac_engine_error_t err = tac_resolve_label(&engine->label_table, label_id, &target);
-        if (err != TAC_ENGINE_OK) {
-            tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND,
-                         "Failed to resolve call target label %u", label_id);
-            return TAC_ENGINE_ERR_INVALID_OPERAND;
-        }
-        
-        // Map parameters to the correct variable slots dynamically
-        if (engine->param_counter > 0) {
-            // Enhanced parameter mapping with symbol table integration
-            uint32_t scan_start = target;
-            uint16_t param_vars[10]; // Store variable IDs for parameters
-            uint16_t assigned_vars[20]; // Store variable IDs that are assigned to
-            uint32_t unique_params = 0;
-            uint32_t assigned_count = 0;
-            
-            // Enhanced debugging with symbol resolution
-            if (engine->config.enable_symbol_resolution && engine->symbols.loaded) {
-                char func_name[64];
-                uint8_t func_type;
-                if (tac_resolve_symbol(engine, label_id, func_name, sizeof(func_name), &func_type) == TAC_ENGINE_OK) {
-                    printf("DEBUG CALL: Entering function '%s' (label=%u, target=%u) with %u parameters\n", 
-                           func_name, label_id, scan_start, engine->param_counter);
-                } else {
-                    printf("DEBUG CALL: Entering function at label %u (target=%u) with %u parameters\n", 
-                           label_id, scan_start, engine->param_counter);
-                }
-            } else {
-                printf("DEBUG CALL: Scanning from instruction %u for parameter variables\n", scan_start);
-            }
-            
-            // First pass: collect all variables that are assigned to (not parameters)
-            for (uint32_t scan_offset = 1; scan_offset < 15 && 
-                 (scan_start + scan_offset) < engine->instruction_count; scan_offset++) {
-                
-                const TACInstruction* scan_instr = &engine->instructions[scan_start + scan_offset];
-                
-                // Stop if we hit a function boundary (label after return, or label at very end)
-                if (scan_instr->opcode == TAC_LABEL) {
-                    // Check if this is a function label (comes after a return) or loop label (internal)
-                    if (scan_start + scan_offset > 0) {
-                        const TACInstruction* prev_instr = &engine->instructions[scan_start + scan_offset - 1];
-                        if (prev_instr->opcode == TAC_RETURN) {
-                            // This label comes after a return, likely next function
-                            break;
-                        }
-                    }
-                    // Otherwise, it's likely a loop label - continue scanning
-                }
-                
-                printf("DEBUG CALL: Scanning instruction %u, opcode 0x%x\n", scan_start + scan_offset, scan_instr->opcode);
-                
-                // Track variables that are assigned to (result operands)
-                if (scan_instr->result.type == TAC_OP_VAR && assigned_count < 20) {
-                    uint16_t var_id = scan_instr->result.data.variable.id;
-                    bool already_added = false;
-                    for (uint32_t i = 0; i < assigned_count; i++) {
-                        if (assigned_vars[i] == var_id) {
-                            already_added = true;
-                            break;
-                        }
-                    }
-                    if (!already_added) {
-                        assigned_vars[assigned_count++] = var_id;
-                        printf("DEBUG CALL: Found assigned variable v%u (not a parameter)\n", var_id);
-                    }
-                }
-            }
-            
-            // Second pass: collect parameter variables (used in operations but not assigned to)
-            for (uint32_t scan_offset = 1; scan_offset < 15 && 
-                 (scan_start + scan_offset) < engine->instruction_count; scan_offset++) {
-                
-                const TACInstruction* scan_instr = &engine->instructions[scan_start + scan_offset];
-                
-                // Stop if we hit a function boundary (label after return, or label at very end)
-                if (scan_instr->opcode == TAC_LABEL) {
-                    // Check if this is a function label (comes after a return) or loop label (internal)
-                    if (scan_start + scan_offset > 0) {
-                        const TACInstruction* prev_instr = &engine->instructions[scan_start + scan_offset - 1];
-                        if (prev_instr->opcode == TAC_RETURN) {
-                            // This label comes after a return, likely next function
-                            break;
-                        }
-                    }
-                    // Otherwise, it's likely a loop label - continue scanning
-                }
-                
-                // Look for operations that use variables to find parameter variables
-                // Include binary operations AND comparison operations
-                if ((scan_instr->opcode >= TAC_ADD && scan_instr->opcode <= TAC_SHR) ||
-                    (scan_instr->opcode >= TAC_EQ && scan_instr->opcode <= TAC_GE)) {
-                    
-                    // Check operand1
-                    if (scan_instr->operand1.type == TAC_OP_VAR) {
-                        uint16_t var_id = scan_instr->operand1.data.variable.id;
-                        // Skip if this variable is assigned to (it's not a parameter)
-                        bool is_assigned = false;
-                        for (uint32_t i = 0; i < assigned_count; i++) {
-                            if (assigned_vars[i] == var_id) {
-                                is_assigned = true;
-                                break;
-                            }
-                        }
-                        // Add to parameter list if not assigned and not already present
-                        if (!is_assigned) {
-                            bool already_added = false;
-                            for (uint32_t i = 0; i < unique_params; i++) {
-                                if (param_vars[i] == var_id) {
-                                    already_added = true;
-                                    break;
-                                }
-                            }
-                            if (!already_added && unique_params < 10) {
-                                param_vars[unique_params++] = var_id;
-                                printf("DEBUG CALL: Found parameter variable v%u (in operand1 of opcode 0x%02x)\n", var_id, scan_instr->opcode);
-                            }
-                        }
-                    }
-                    // Check operand2
-                    if (scan_instr->operand2.type == TAC_OP_VAR) {
-                        uint16_t var_id = scan_instr->operand2.data.variable.id;
-                        // Skip if this variable is assigned to (it's not a parameter)
-                        bool is_assigned = false;
-                        for (uint32_t i = 0; i < assigned_count; i++) {
-                            if (assigned_vars[i] == var_id) {
-                                is_assigned = true;
-                                break;
-                            }
-                        }
-                        // Add to parameter list if not assigned and not already present
-                        if (!is_assigned) {
-                            bool already_added = false;
-                            for (uint32_t i = 0; i < unique_params; i++) {
-                                if (param_vars[i] == var_id) {
-                                    already_added = true;
-                                    break;
-                                }
-                            }
-                            if (!already_added && unique_params < 10) {
-                                param_vars[unique_params++] = var_id;
-                                printf("DEBUG CALL: Found parameter variable v%u (in operand2 of opcode 0x%02x)\n", var_id, scan_instr->opcode);
-                            }
-                        }
-                    }
-                }
-            }
-            
-            // Third pass: map parameters to the collected variables in order
-            printf("DEBUG CALL: Found %u parameter variables, mapping %u parameters\n", 
-                   unique_params, engine->param_counter);
-            
-            for (uint32_t i = 0; i < unique_params && i < engine->param_counter; i++) {
-                engine->variables[param_vars[i]] = engine->param_stack[i];
-                
-                // Enhanced debugging with symbol resolution
-                if (engine->config.enable_symbol_resolution && engine->symbols.loaded) {
-                    char var_name[64];
-                    uint8_t var_type;
-                    if (tac_resolve_symbol(engine, param_vars[i], var_name, sizeof(var_name), &var_type) == TAC_ENGINE_OK) {
-                        printf("DEBUG CALL: Mapped param %u (%d) to variable '%s' (v%u)\n",
-                               i, engine->param_stack[i].data.i32, var_name, param_vars[i]);
-                    } else {
-                        printf("DEBUG CALL: Mapped param %u (%d) to v%u\n",
-                               i, engine->param_stack[i].data.i32, param_vars[i]);
-                    }
-                } else {
-                    printf("DEBUG CALL: Mapped param %u to v%u = %d\n",
-                           i, param_vars[i], engine->param_stack[i].data.i32);
-                }
-            }
-            
-            // Report unmapped parameters
-            if (engine->param_counter > unique_params) {
-                printf("DEBUG CALL: WARNING - %u parameters provided but only %u parameter variables found\n",
-                       engine->param_counter, unique_params);
-            }
-        }
-    } else if (instruction->operand1.type == TAC_OP_IMMEDIATE) {
-        // Legacy immediate address handling
-        target = (uint32_t)instruction->operand1.data.immediate.value;
-    } else {
-        tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND,
-                     "Call target must be label or immediate, got type %d", instruction->operand1.type);
-        return TAC_ENGINE_ERR_INVALID_OPERAND;
-    }
-    
-    if (target >= engine->instruction_count) {
-        tac_set_error(engine, TAC_ENGINE_ERR_INVALID_MEMORY,
-                     "Call target %u out of bounds", target);
-        return TAC_ENGINE_ERR_INVALID_MEMORY;
-    }
-
-    // Store the call instruction address for return value handling
-    engine->last_call_instruction = engine->pc;
-    
-    // Reset parameter counter for the next function call
-    engine->param_counter = 0;
-
-    // Push current PC + 1 as return address
-    tac_engine_error_t err = tac_push_frame(engine, engine->pc + 1, 0);
-    if (err != TAC_ENGINE_OK) {
-        return err;
-    }
-
-    // Jump to function
-    engine->pc = target;
-    return TAC_ENGINE_OK;
-}
-
-tac_engine_error_t tac_execute_return(tac_engine_t* engine,
-                                     const TACInstruction* instruction) {
-    // Handle return value if present
-    if (instruction->operand1.type != TAC_OP_NONE) {
-        // Store return value in temp 0 for retrieval by tests
-        tac_value_t return_value;
-        tac_engine_error_t err = tac_eval_operand(engine, &instruction->operand1, &return_value);
-        if (err == TAC_ENGINE_OK) {
-            engine->temporaries[0] = return_value;
-            
-            // Enhanced debugging with symbol resolution
-            if (engine->config.enable_tracing) {
-                if (engine->config.enable_symbol_resolution && engine->symbols.loaded) {
-                    printf("DEBUG RETURN: Function returning value %d (stored in t0)\n", 
-                           return_value.data.i32);
-                } else {
-                    printf("DEBUG RETURN: Function returning value %d\n", return_value.data.i32);
-                }
-            }
-            
-            // Also store the return value in the result of the original call instruction
-            if (engine->last_call_instruction < engine->instruction_count) {
-                const TACInstruction* call_inst = &engine->instructions[engine->last_call_instruction];
-                if (call_inst->opcode == TAC_CALL && call_inst->result.type != TAC_OP_NONE) {
-                    tac_engine_error_t store_err = tac_store_operand(engine, &call_inst->result, &return_value);
-                    if (store_err != TAC_ENGINE_OK) {
-                        // Log warning but don't fail the return
-                        tac_set_error(engine, store_err, "Failed to store call result");
-                    } else {
-                        if (engine->config.enable_tracing) {
-                            printf("DEBUG RETURN: Stored return value %d in call result operand\n", 
-                                   return_value.data.i32);
-                        }
-                    }
-                }
-            }
-        }
-    }
-    
-    // Check if we're in a function call (have call stack)
-    if (engine->call_stack) {
-        // Pop return address from call stack
-        tac_stack_frame_t* frame = engine->call_stack;
-        engine->pc = frame->return_address;
-        engine->call_stack = frame->prev;
-        engine->call_depth--;
-
-        free(frame->locals);
-        free(frame);
-        
-        return TAC_ENGINE_OK;
-    } else {
-        // Top-level return - finish program execution
-        engine->state = TAC_ENGINE_FINISHED;
-        // Set PC to end of program to stop execution
-        engine->pc = engine->instruction_count;
-        return TAC_ENGINE_OK;
-    }
-}
-
-tac_engine_error_t tac_push_frame(tac_engine_t* engine,
-                                 uint32_t return_address,
-                                 uint32_t param_count) {
-    if (!engine) {
-        return TAC_ENGINE_ERR_NULL_POINTER;
-    }
-
-    if (engine->call_depth >= engine->config.max_call_depth) {
-        return TAC_ENGINE_ERR_STACK_OVERFLOW;
-    }
-
-    tac_stack_frame_t* frame = calloc(1, sizeof(tac_stack_frame_t));
-    if (!frame) {
-        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
-    }
-
-    frame->return_address = return_address;
-    frame->param_count = param_count;
-    frame->locals = calloc(64, sizeof(tac_value_t)); // Fixed size for now
-    frame->prev = engine->call_stack;
-
-    if (!frame->locals) {
-        free(frame);
-        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
-    }
-
-    engine->call_stack = frame;
-    engine->call_depth++;
-
-    return TAC_ENGINE_OK;
-}
-
 tac_engine_error_t tac_validate_operand(tac_engine_t* engine,
                                        const TACOperand* operand) {
     if (!engine || !operand) {
@@ -1068,40 +925,6 @@ void tac_set_error(tac_engine_t* engine,
     }
 }
 
-bool tac_trigger_hooks(tac_engine_t* engine, tac_hook_type_t type, uint32_t address) {
-    if (!engine) {
-        return false;
-    }
-    
-    tac_hook_entry_t* hook = engine->hooks;
-    while (hook) {
-        if (hook->enabled && hook->type == type) {
-            if (!hook->callback(engine, type, address, hook->user_data)) {
-                return false; // Hook requested stop
-            }
-        }
-        hook = hook->next;
-    }
-    
-    return true; // Continue execution
-}
-
-bool tac_has_breakpoint(tac_engine_t* engine, uint32_t address) {
-    if (!engine) {
-        return false;
-    }
-    
-    tac_breakpoint_t* bp = engine->breakpoints;
-    while (bp) {
-        if (bp->enabled && bp->address == address) {
-            return true;
-        }
-        bp = bp->next;
-    }
-    
-    return false;
-}
-
 void tac_add_trace(tac_engine_t* engine,
                   const TACInstruction* instruction,
                   const tac_value_t* before,
@@ -1128,9 +951,94 @@ void tac_add_trace(tac_engine_t* engine,
 // MINIMAL STUBS FOR PUBLIC API
 // =============================================================================
 
+/**
+ * @brief FNV-1a hash of a program, operand by operand
+ *
+ * Hashes the fields rather than the bytes, so padding inside operands
+ * cannot make two copies of one program differ.
+ */
+static uint32_t tac_hash_code(const TACInstruction* instructions, uint32_t count) {
+    uint32_t hash = TAC_FNV_OFFSET;
+    for (uint32_t i = 0; i < count; i++) {
+        const TACInstruction* inst = &instructions[i];
+        const TACOperand* operands[3] = { &inst->result, &inst->operand1, &inst->operand2 };
+        uint32_t words[7];
+        words[0] = (uint32_t)inst->opcode | ((uint32_t)inst->flags << 16);
+        for (int j = 0; j < 3; j++) {
+            words[1 + 2 * j] = (uint32_t)operands[j]->type;
+            words[2 + 2 * j] = operands[j]->type == TAC_OP_IMMEDIATE
+                             ? (uint32_t)operands[j]->data.immediate.value
+                             : operands[j]->data.variable.id;
+        }
+        const uint8_t* bytes = (const uint8_t*)words;
+        for (size_t b = 0; b < sizeof(words); b++) {
+            hash = (hash ^ bytes[b]) * TAC_FNV_PRIME;
+        }
+    }
+    return hash;
+}
+
+/**
+ * @brief Fold the frame fields of the function records into a program hash
+ *
+ * The same instructions with other parameters are another program.
+ */
+static uint32_t tac_hash_functions(uint32_t hash, const TACFunction* functions, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t words[3];
+        words[0] = functions[i].start_idx;
+        words[1] = functions[i].first_param;
+        words[2] = functions[i].param_count;
+        const uint8_t* bytes = (const uint8_t*)words;
+        for (size_t b = 0; b < sizeof(words); b++) {
+            hash = (hash ^ bytes[b]) * TAC_FNV_PRIME;
+        }
+    }
+    return hash;
+}
+
+/**
+ * @brief Keep a copy of the function records, or derive them from the symbols
+ */
+static tac_engine_error_t tac_load_function_records(tac_engine_t* engine,
+                                                    const TACFunction* functions,
+                                                    uint32_t function_count) {
+    TACFunction* records = NULL;
+    uint32_t record_count = 0;
+
+    if (functions && function_count > 0) {
+        records = malloc(function_count * sizeof(TACFunction));
+        if (!records) {
+            return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        }
+        memcpy(records, functions, function_count * sizeof(TACFunction));
+        record_count = function_count;
+    } else if (engine->symbols.loaded &&
+               tac_functions_from_symbols(engine->instructions, engine->instruction_count,
+                                          engine->symbols.entries, engine->symbols.entry_count,
+                                          &records, &record_count) != 0) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    free(engine->function_records);
+    engine->function_records = records;
+    engine->function_record_count = record_count;
+    TAC_LOG_DEBUG(engine, TAC_LOG_CAT_CALLS, "%u function records (%s)", record_count,
+                  functions && function_count > 0 ? "TAC file" : "symbol table");
+    return TAC_ENGINE_OK;
+}
+
 tac_engine_error_t tac_engine_load_code(tac_engine_t* engine,
                                         const TACInstruction* instructions,
                                         uint32_t count) {
+    return tac_engine_load_program(engine, instructions, count, NULL, 0);
+}
+
+tac_engine_error_t tac_engine_load_program(tac_engine_t* engine,
+                                           const TACInstruction* instructions,
+                                           uint32_t count,
+                                           const TACFunction* functions,
+                                           uint32_t function_count) {
     if (!engine || !instructions) {
         return TAC_ENGINE_ERR_NULL_POINTER;
     }
@@ -1139,8 +1047,12 @@ tac_engine_error_t tac_engine_load_code(tac_engine_t* engine,
         return TAC_ENGINE_ERR_INVALID_OPERAND;
     }
 
-    // Free existing instructions
+    // A recording covers one program
+    tac_engine_record_stop(engine);
+
+    // Free existing instructions and the code compiled from them
     free(engine->instructions);
+    tac_jit_release(engine);
 
     // Allocate and copy new instructions
     engine->instructions = malloc(count * sizeof(TACInstruction));
@@ -1150,9 +1062,21 @@ tac_engine_error_t tac_engine_load_code(tac_engine_t* engine,
 
     memcpy(engine->instructions, instructions, count * sizeof(TACInstruction));
     engine->instruction_count = count;
-    
-    // Build label table for jump resolution first
-    tac_engine_error_t err = tac_build_label_table(engine);
+
+    // Build label table, then resolve branch targets and functions once
+    tac_engine_error_t err = tac_load_function_records(engine, functions, function_count);
+    if (err == TAC_ENGINE_OK) {
+        engine->code_hash = tac_hash_functions(tac_hash_code(instructions, count),
+                                               engine->function_records,
+                                               engine->function_record_count);
+        err = tac_build_label_table(engine);
+    }
+    if (err == TAC_ENGINE_OK) {
+        err = tac_resolve_jump_targets(engine);
+    }
+    if (err == TAC_ENGINE_OK) {
+        err = tac_build_function_table(engine);
+    }
     if (err != TAC_ENGINE_OK) {
         free(engine->instructions);
         engine->instructions = NULL;
@@ -1160,18 +1084,64 @@ tac_engine_error_t tac_engine_load_code(tac_engine_t* engine,
         return err;
     }
 
-    // Initialize PC to 0 by default
-    // Entry point should be set explicitly using tac_engine_set_entry_point()
-    engine->pc = 0;
+    // Pre-decode for the fast dispatch loop, or compile to bytecode
+    tac_decoded_program_cleanup(&engine->decoded);
+    tac_bytecode_cleanup(&engine->bytecode);
+    if (engine->config.exec_mode == TAC_EXEC_PREDECODED) {
+        err = tac_decode_program(engine);
+    } else if (engine->config.exec_mode == TAC_EXEC_BYTECODE) {
+        err = tac_compile_bytecode(engine);
+    }
+    if (err != TAC_ENGINE_OK) {
+        free(engine->instructions);
+        engine->instructions = NULL;
+        engine->instruction_count = 0;
+        return err;
+    }
 
-    return TAC_ENGINE_OK;
-}
+    // Native code; unsupported hosts keep interpreting
+    if (engine->config.exec_mode == TAC_EXEC_JIT) {
+        err = tac_jit_compile(engine);
+        if (err != TAC_ENGINE_OK) {
+            TAC_LOG_WARN(engine, TAC_LOG_CAT_DISPATCH,
+                         "JIT unavailable (%s), interpreting", tac_engine_error_string(err));
+        }
+    }
 
-tac_engine_error_t tac_engine_set_entry_point(tac_engine_t* engine, uint32_t address) {
-    if (!engine) {
-        return TAC_ENGINE_ERR_NULL_POINTER;
+    // Pair counts describe one program
+    if (engine->pair_counts) {
+        memset(engine->pair_counts, 0,
+               (size_t)TAC_PAIR_OPCODES * TAC_PAIR_OPCODES * sizeof(uint64_t));
     }
-    
+    engine->pair_prev = TAC_NO_TARGET;
+
+    // So do the execution profile, tier counters, breakpoints and slot types
+    err = tac_profile_reset(engine);
+    if (err == TAC_ENGINE_OK) {
+        err = tac_tier_reset(engine);
+    }
+    if (err == TAC_ENGINE_OK) {
+        err = tac_debug_reset(engine);
+    }
+    if (err == TAC_ENGINE_OK) {
+        err = tac_types_infer(engine);
+    }
+    if (err != TAC_ENGINE_OK) {
+        return err;
+    }
+
+    // Initialize PC to 0 by default
+    // Entry point should be set explicitly using tac_engine_set_entry_point()
+    engine->pc = 0;
+
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_engine_set_entry_point(tac_engine_t* engine, uint32_t address) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    
     if (address >= engine->instruction_count) {
         return TAC_ENGINE_ERR_INVALID_OPERAND;
     }
@@ -1197,46 +1167,77 @@ tac_engine_error_t tac_engine_set_entry_label(tac_engine_t* engine, uint16_t lab
     }
 }
 
+/**
+ * @brief Find the first instruction of a function through the symbol table
+ *
+ * cc2 opens every function definition with a label, in source order, and
+ * tac_stats finds those labels (called, first in the program, or after a
+ * RETURN without being jumped to). They are paired in order with the
+ * SYM_FUNCTION entries of the symbol table, which cc1 adds in the same
+ * order. When the counts differ (say, declared but undefined functions)
+ * nothing is resolved.
+ */
+static tac_engine_error_t tac_find_function_entry(tac_engine_t* engine, const char* function_name,
+                                                  uint32_t* entry) {
+    TACStats stats;
+    if (tac_stats_compute(engine->instructions, engine->instruction_count, &stats) != 0) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    tac_engine_error_t result = TAC_ENGINE_ERR_NOT_FOUND;
+    uint32_t function = 0;
+    for (uint32_t id = 1; id <= engine->symbols.entry_count; id++) {
+        if (engine->symbols.entries[id - 1].type != SYM_FUNCTION) {
+            continue;
+        }
+        if (function == stats.function_count) {
+            function++;
+            break;
+        }
+
+        char name[64];
+        uint8_t type;
+        if (tac_resolve_symbol(engine, (uint16_t)id, name, sizeof(name), &type) == TAC_ENGINE_OK &&
+            strcmp(name, function_name) == 0) {
+            *entry = stats.functions[function].start + 1;  // Start after the label
+            result = TAC_ENGINE_OK;
+        }
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Function '%s' opens at label %u",
+                      name, stats.functions[function].label);
+        function++;
+    }
+    if (function != stats.function_count) {
+        result = TAC_ENGINE_ERR_NOT_FOUND;
+    }
+
+    tac_stats_free(&stats);
+    return result;
+}
+
 tac_engine_error_t tac_engine_set_entry_function(tac_engine_t* engine, const char* function_name) {
     if (!engine || !function_name) {
         return TAC_ENGINE_ERR_NULL_POINTER;
     }
     
-    printf("DEBUG: Setting entry function to '%s'\n", function_name);
+    TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Setting entry function to '%s'", function_name);
     
     // Enhanced implementation: Use symbol table integration if available
     if (engine->symbols.loaded && strcmp(function_name, "main") == 0) {
-        printf("DEBUG: Using symbol table integration to find main function\n");
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Using symbol table integration to find main function");
         
-        // Method 1: Look for "main" string in the readable TAC structure
-        // We'll scan for the literal "main:" pattern in the TAC instructions
-        for (uint32_t i = 0; i < engine->instruction_count; i++) {
-            const TACInstruction* inst = &engine->instructions[i];
-            
-            // Look for a function start pattern: TAC_LABEL followed by executable instructions
-            if (inst->opcode == TAC_LABEL) {
-                uint16_t label_id = (inst->result.type == TAC_OP_LABEL) ? 
-                                   inst->result.data.label.offset : 0;
-                
-                // Try to resolve this label using symbol table
-                char func_name[64];
-                uint8_t func_type;
-                if (tac_resolve_symbol(engine, label_id, func_name, sizeof(func_name), &func_type) == TAC_ENGINE_OK) {
-                    printf("DEBUG: Label %u resolves to '%s'\n", label_id, func_name);
-                    if (strcmp(func_name, "main") == 0) {
-                        engine->pc = i + 1;  // Start after the label
-                        printf("DEBUG: Set TAC engine entry function to 'main' using symbol resolution\n");
-                        printf("  Symbol table: %s\n", engine->symbols.symtab_filename);
-                        return TAC_ENGINE_OK;
-                    }
-                }
-            }
+        // Method 1: Pair function labels with the function symbols
+        uint32_t entry;
+        if (tac_find_function_entry(engine, function_name, &entry) == TAC_ENGINE_OK) {
+            engine->pc = entry;
+            TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Set TAC engine entry function to 'main' using symbol resolution");
+            TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "  Symbol table: %s", engine->symbols.symtab_filename);
+            return TAC_ENGINE_OK;
         }
         
         // Method 2: Heuristic-based main function detection for factorial case
         // Based on TAC analysis: main function typically appears after all other functions
         // Look for the pattern: [functions] [main with param and call instructions]
-        printf("DEBUG: Symbol resolution didn't find main, using enhanced heuristics\n");
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Symbol resolution didn't find main, using enhanced heuristics");
         
         // Find the last function-like sequence that contains PARAM and CALL instructions
         for (uint32_t i = engine->instruction_count - 1; i > 0; i--) {
@@ -1255,7 +1256,7 @@ tac_engine_error_t tac_engine_set_entry_function(tac_engine_t* engine, const cha
                     if (prev_inst->opcode == TAC_LABEL || j == 0 || 
                         (j > 0 && engine->instructions[j-2].opcode == TAC_RETURN)) {
                         engine->pc = j;
-                        printf("DEBUG: Set PC to %u for main function (heuristic: found param/call pattern)\n", j);
+                        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Set PC to %u for main function (heuristic: found param/call pattern)", j);
                         return TAC_ENGINE_OK;
                     }
                 }
@@ -1263,7 +1264,7 @@ tac_engine_error_t tac_engine_set_entry_function(tac_engine_t* engine, const cha
         }
     
     // Fallback: Use original heuristic-based detection
-    printf("DEBUG: Using fallback heuristic-based main detection\n");
+    TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Using fallback heuristic-based main detection");
     
     if (strcmp(function_name, "main") == 0) {
         // Enhanced heuristic: For factorial case, main is NOT at a label
@@ -1274,7 +1275,7 @@ tac_engine_error_t tac_engine_set_entry_function(tac_engine_t* engine, const cha
             if (inst->opcode == TAC_PARAM) {
                 // Found a PARAM instruction - this is likely the start of main
                 engine->pc = i;
-                printf("DEBUG: Set PC to %u for main function (found PARAM instruction at %u)\n", i, i);
+                TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Set PC to %u for main function (found PARAM instruction at %u)", i, i);
                 return TAC_ENGINE_OK;
             }
         }
@@ -1284,7 +1285,7 @@ tac_engine_error_t tac_engine_set_entry_function(tac_engine_t* engine, const cha
         for (uint32_t i = 0; i < engine->instruction_count; i++) {
             if (engine->instructions[i].opcode == TAC_LABEL) {
                 uint16_t label_id = engine->instructions[i].result.data.label.offset;
-                printf("DEBUG: Found label %d at instruction %d\n", label_id, i);
+                TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Found label %d at instruction %d", label_id, i);
                 
                 // Heuristic: labels 1 and 2 are likely function labels
                 // Labels 3+ are likely control flow labels within functions
@@ -1294,7 +1295,7 @@ tac_engine_error_t tac_engine_set_entry_function(tac_engine_t* engine, const cha
             }
         }
         
-        printf("DEBUG: Detected %d function labels\n", function_label_count);
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Detected %d function labels", function_label_count);
         
         if (function_label_count == 1) {
             // Single function case: main is at L1
@@ -1303,7 +1304,7 @@ tac_engine_error_t tac_engine_set_entry_function(tac_engine_t* engine, const cha
                     uint16_t label_id = engine->instructions[i].result.data.label.offset;
                     if (label_id == 1) {
                         engine->pc = i + 1;
-                        printf("DEBUG: Set PC to %d for main function (single function, label ID 1)\n", engine->pc);
+                        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Set PC to %d for main function (single function, label ID 1)", engine->pc);
                         return TAC_ENGINE_OK;
                     }
                 }
@@ -1315,7 +1316,7 @@ tac_engine_error_t tac_engine_set_entry_function(tac_engine_t* engine, const cha
                     uint16_t label_id = engine->instructions[i].result.data.label.offset;
                     if (label_id == 2) {
                         engine->pc = i + 1;
-                        printf("DEBUG: Set PC to %d for main function (multi-function, label ID 2)\n", engine->pc);
+                        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Set PC to %d for main function (multi-function, label ID 2)", engine->pc);
                         return TAC_ENGINE_OK;
                     }
                 }
@@ -1327,7 +1328,7 @@ tac_engine_error_t tac_engine_set_entry_function(tac_engine_t* engine, const cha
                     uint16_t label_id = engine->instructions[i].result.data.label.offset;
                     if (label_id == 1) {
                         engine->pc = i + 1;
-                        printf("DEBUG: Set PC to %d for main function (complex case, label ID 1)\n", engine->pc);
+                        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Set PC to %d for main function (complex case, label ID 1)", engine->pc);
                         return TAC_ENGINE_OK;
                     }
                 }
@@ -1337,7 +1338,7 @@ tac_engine_error_t tac_engine_set_entry_function(tac_engine_t* engine, const cha
     
     // Fallback: start at first instruction
     engine->pc = 0;
-    printf("DEBUG: Fallback - set PC to %d (start of program)\n", engine->pc);
+    TAC_LOG_DEBUG(engine, TAC_LOG_CAT_SYMBOLS, "Fallback - set PC to %d (start of program)", engine->pc);
     return TAC_ENGINE_OK;
     } else {
         // For other function names, start at instruction 0 for now
@@ -1346,205 +1347,174 @@ tac_engine_error_t tac_engine_set_entry_function(tac_engine_t* engine, const cha
     }
 }
 
+tac_engine_error_t tac_execute_instruction(tac_engine_t* engine,
+                                           const TACInstruction* instruction) {
+    if (!engine || !instruction) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_engine_error_t err = TAC_ENGINE_OK;
+
+    switch (instruction->opcode) {
+        case TAC_ASSIGN:
+            err = tac_execute_assign(engine, instruction);
+            break;
+            
+        case TAC_ADD:
+        case TAC_SUB:
+        case TAC_MUL:
+        case TAC_DIV:
+        case TAC_MOD:
+        case TAC_GT:
+        case TAC_LT:
+        case TAC_EQ:
+        case TAC_NE:
+        case TAC_LE:
+        case TAC_GE:
+        case TAC_AND:
+        case TAC_OR:
+        case TAC_XOR:
+        case TAC_SHL:
+        case TAC_SHR:
+        case TAC_LOGICAL_AND:
+        case TAC_LOGICAL_OR:
+            err = tac_is_int32_op(engine, instruction)
+                ? tac_execute_binary_i32(engine, instruction)
+                : tac_execute_binary_op(engine, instruction);
+            break;
+            
+        // Control flow: the handlers update the PC themselves
+        case TAC_GOTO:
+            return tac_execute_jump(engine, instruction);
+            
+        case TAC_IF_TRUE:
+        case TAC_IF_FALSE:
+            return tac_execute_conditional_jump(engine, instruction);
+            
+        case TAC_CALL:
+            return tac_execute_call(engine, instruction);
+            
+        case TAC_RETURN:
+            return tac_execute_return(engine, instruction);
+            
+        case TAC_RETURN_VOID:
+            return tac_execute_return_void(engine, instruction);
+            
+        case TAC_PARAM:
+            err = tac_execute_param(engine, instruction);
+            break;
+            
+        case TAC_NEG:
+        case TAC_NOT:
+        case TAC_BITWISE_NOT:
+            err = tac_execute_unary_op(engine, instruction);
+            break;
+            
+        case TAC_LOAD:
+            err = tac_execute_load(engine, instruction);
+            break;
+            
+        case TAC_STORE:
+            err = tac_execute_store(engine, instruction);
+            break;
+            
+        case TAC_ADDR:
+            err = tac_execute_addr(engine, instruction);
+            break;
+            
+        case TAC_INDEX:
+            err = tac_execute_index(engine, instruction);
+            break;
+            
+        case TAC_MEMBER:
+        case TAC_MEMBER_PTR:
+            err = tac_execute_member(engine, instruction);
+            break;
+            
+        case TAC_CAST:
+            err = tac_execute_cast(engine, instruction);
+            break;
+            
+        case TAC_SIZEOF:
+            err = tac_execute_sizeof(engine, instruction);
+            break;
+            
+        case TAC_PHI:
+            err = tac_execute_phi(engine, instruction);
+            break;
+            
+        case TAC_NOP:
+            // No operation
+            break;
+            
+        case TAC_LABEL:
+            // Label definition - no operation, just a marker
+            break;
+            
+        default:
+            tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPCODE,
+                         "Unknown opcode: %d", instruction->opcode);
+            return TAC_ENGINE_ERR_INVALID_OPCODE;
+    }
+
+    if (err == TAC_ENGINE_OK) {
+        engine->pc++;
+    }
+    return err;
+}
+
 tac_engine_error_t tac_engine_run(tac_engine_t* engine) {
-    printf("AAAAA: tac_engine_run function entry point\n");
-    fflush(stdout);
     if (!engine) {
-        printf("AAAAA: null engine\n");
         return TAC_ENGINE_ERR_NULL_POINTER;
     }
     
-    printf("AAAAA: Engine PC before run: %d\n", engine->pc);
-    
     if (!engine->instructions || engine->instruction_count == 0) {
         return TAC_ENGINE_ERR_INVALID_OPERAND;
     }
     
+    if (engine->recorder) {
+        tac_record_resume(engine);
+    }
+
+    // Breakpoints, hooks, profiling, tracing and replay need every
+    // instruction, so they always interpret
+    bool observed = engine->instrumentation != 0;
+    if (engine->config.exec_mode == TAC_EXEC_PREDECODED && engine->decoded.insns &&
+        !observed) {
+        return tac_run_predecoded(engine);
+    }
+    if (engine->config.exec_mode == TAC_EXEC_BYTECODE && engine->bytecode.code &&
+        !observed) {
+        return tac_run_bytecode(engine);
+    }
+    if (engine->jit && !observed &&
+        engine->step_count < engine->config.max_steps) {
+        return tac_run_jit(engine);
+    }
+    if (engine->tier && !observed) {
+        return tac_run_tiered(engine);
+    }
+    
     // Execute all instructions starting from PC
     engine->state = TAC_ENGINE_RUNNING;
     
-    printf("DEBUG RUN: Starting execution at PC = %d\n", engine->pc);
+    TAC_LOG_DEBUG(engine, TAC_LOG_CAT_DISPATCH, "Starting execution at PC = %d", engine->pc);
     
     while (engine->pc < engine->instruction_count) {
         const TACInstruction* instruction = &engine->instructions[engine->pc];
         
-        printf("DEBUG RUN: Executing instruction %d, opcode 0x%02x\n", engine->pc, instruction->opcode);
-        
-        // Execute the instruction based on opcode
-        tac_engine_error_t err = TAC_ENGINE_OK;
-        
-        switch (instruction->opcode) {
-            case TAC_ASSIGN:
-                err = tac_execute_assign(engine, instruction);
-                break;
-                
-            case TAC_ADD:
-            case TAC_SUB:
-            case TAC_MUL:
-            case TAC_DIV:
-            case TAC_MOD:
-            case TAC_GT:
-            case TAC_LT:
-            case TAC_EQ:
-            case TAC_NE:
-            case TAC_LE:
-            case TAC_GE:
-            case TAC_AND:
-            case TAC_OR:
-            case TAC_XOR:
-            case TAC_SHL:
-            case TAC_SHR:
-            case TAC_LOGICAL_AND:
-            case TAC_LOGICAL_OR:
-                err = tac_execute_binary_op(engine, instruction);
-                break;
-                
-            case TAC_GOTO:
-                err = tac_execute_jump(engine, instruction);
-                if (err != TAC_ENGINE_OK) {
-                    engine->state = TAC_ENGINE_ERROR;
-                    return err;
-                }
-                engine->step_count++;
-                // Check max steps limit for jumps too
-                if (engine->step_count >= engine->config.max_steps) {
-                    tac_set_error(engine, TAC_ENGINE_ERR_MAX_STEPS,
-                                 "Execution exceeded maximum steps: %u", engine->config.max_steps);
-                    engine->state = TAC_ENGINE_STOPPED;
-                    return TAC_ENGINE_ERR_MAX_STEPS;
-                }
-                continue; // Jump handles PC update
-                
-            case TAC_IF_TRUE:
-            case TAC_IF_FALSE:
-                err = tac_execute_conditional_jump(engine, instruction);
-                if (err != TAC_ENGINE_OK) {
-                    engine->state = TAC_ENGINE_ERROR;
-                    return err;
-                }
-                engine->step_count++;
-                // Check max steps limit for conditional jumps too
-                if (engine->step_count >= engine->config.max_steps) {
-                    tac_set_error(engine, TAC_ENGINE_ERR_MAX_STEPS,
-                                 "Execution exceeded maximum steps: %u", engine->config.max_steps);
-                    engine->state = TAC_ENGINE_STOPPED;
-                    return TAC_ENGINE_ERR_MAX_STEPS;
-                }
-                continue; // Conditional jump handles PC update
-                
-            case TAC_CALL:
-                err = tac_execute_call(engine, instruction);
-                if (err != TAC_ENGINE_OK) {
-                    engine->state = TAC_ENGINE_ERROR;
-                    return err;
-                }
-                engine->step_count++;
-                // Check max steps limit for calls too
-                if (engine->step_count >= engine->config.max_steps) {
-                    tac_set_error(engine, TAC_ENGINE_ERR_MAX_STEPS,
-                                 "Execution exceeded maximum steps: %u", engine->config.max_steps);
-                    engine->state = TAC_ENGINE_STOPPED;
-                    return TAC_ENGINE_ERR_MAX_STEPS;
-                }
-                continue; // Call handles PC update
-                
-            case TAC_RETURN:
-                err = tac_execute_return(engine, instruction);
-                if (err != TAC_ENGINE_OK) {
-                    engine->state = TAC_ENGINE_ERROR;
-                    return err;
-                }
-                engine->step_count++;
-                // Check max steps limit for returns too
-                if (engine->step_count >= engine->config.max_steps) {
-                    tac_set_error(engine, TAC_ENGINE_ERR_MAX_STEPS,
-                                 "Execution exceeded maximum steps: %u", engine->config.max_steps);
-                    engine->state = TAC_ENGINE_STOPPED;
-                    return TAC_ENGINE_ERR_MAX_STEPS;
-                }
-                continue; // Return handles PC update
-                
-            case TAC_PARAM:
-                err = tac_execute_param(engine, instruction);
-                break;
-                
-            case TAC_RETURN_VOID:
-                err = tac_execute_return_void(engine, instruction);
-                if (err != TAC_ENGINE_OK) {
-                    engine->state = TAC_ENGINE_ERROR;
-                    return err;
-                }
-                engine->step_count++;
-                // Check max steps limit for void returns too
-                if (engine->step_count >= engine->config.max_steps) {
-                    tac_set_error(engine, TAC_ENGINE_ERR_MAX_STEPS,
-                                 "Execution exceeded maximum steps: %u", engine->config.max_steps);
-                    engine->state = TAC_ENGINE_STOPPED;
-                    return TAC_ENGINE_ERR_MAX_STEPS;
-                }
-                continue; // Return handles PC update
-                
-            case TAC_NEG:
-            case TAC_NOT:
-            case TAC_BITWISE_NOT:
-                err = tac_execute_unary_op(engine, instruction);
-                break;
-                
-            case TAC_LOAD:
-                err = tac_execute_load(engine, instruction);
-                break;
-                
-            case TAC_STORE:
-                err = tac_execute_store(engine, instruction);
-                break;
-                
-            case TAC_ADDR:
-                err = tac_execute_addr(engine, instruction);
-                break;
-                
-            case TAC_INDEX:
-                err = tac_execute_index(engine, instruction);
-                break;
-                
-            case TAC_MEMBER:
-            case TAC_MEMBER_PTR:
-                err = tac_execute_member(engine, instruction);
-                break;
-                
-            case TAC_CAST:
-                err = tac_execute_cast(engine, instruction);
-                break;
-                
-            case TAC_SIZEOF:
-                err = tac_execute_sizeof(engine, instruction);
-                break;
-                
-            case TAC_PHI:
-                err = tac_execute_phi(engine, instruction);
-                break;
-                
-            case TAC_NOP:
-                // No operation
-                break;
-                
-            case TAC_LABEL:
-                // Label definition - no operation, just a marker
-                break;
-                
-            default:
-                tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPCODE,
-                             "Unknown opcode: %d", instruction->opcode);
-                engine->state = TAC_ENGINE_ERROR;
-                return TAC_ENGINE_ERR_INVALID_OPCODE;
-        }
+        TAC_LOG_TRACE(engine, TAC_LOG_CAT_DISPATCH, "Executing instruction %d, opcode 0x%02x", engine->pc, instruction->opcode);
         
+        tac_engine_error_t err = (engine->instrumentation & ~TAC_INSTR_ACCESS_ONLY)
+            ? tac_execute_observed(engine, instruction)
+            : tac_execute_instruction(engine, instruction);
         if (err != TAC_ENGINE_OK) {
-            engine->state = TAC_ENGINE_ERROR;
+            if (err != TAC_ENGINE_ERR_BREAKPOINT) {
+                engine->state = TAC_ENGINE_ERROR;
+            }
             return err;
         }
         
-        // Advance to next instruction
-        engine->pc++;
         engine->step_count++;
         
         // Check max steps limit to prevent infinite loops
@@ -1574,85 +1544,29 @@ tac_engine_error_t tac_engine_step(tac_engine_t* engine) {
         return TAC_ENGINE_OK; // Execution finished normally
     }
     
+    if (engine->recorder) {
+        tac_record_resume(engine);
+    }
+
     const TACInstruction* instruction = &engine->instructions[engine->pc];
     
-    printf("DEBUG STEP: Executing instruction %d, opcode 0x%02x\n", engine->pc, instruction->opcode);
+    TAC_LOG_TRACE(engine, TAC_LOG_CAT_DISPATCH, "Executing instruction %d, opcode 0x%02x", engine->pc, instruction->opcode);
     
-    // Execute the instruction based on opcode
-    tac_engine_error_t err = TAC_ENGINE_OK;
-    
-    switch (instruction->opcode) {
-        case TAC_ASSIGN:
-            err = tac_execute_assign(engine, instruction);
-            break;
-            
-        case TAC_ADD:
-        case TAC_SUB:
-        case TAC_MUL:
-        case TAC_DIV:
-        case TAC_GT:
-        case TAC_LT:
-        case TAC_EQ:
-        case TAC_NE:
-            err = tac_execute_binary_op(engine, instruction);
-            break;
-            
-        case TAC_GOTO:
-            printf("DEBUG: Executing TAC_GOTO case\n");
-            err = tac_execute_jump(engine, instruction);
-            printf("DEBUG: Jump returned with error code: %d\n", err);
-            engine->step_count++;
-            return err; // Jump handles PC update
-            
-        case TAC_IF_TRUE:
-        case TAC_IF_FALSE:
-            err = tac_execute_conditional_jump(engine, instruction);
-            engine->step_count++;
-            return err; // Conditional jump handles PC update
-            
-        case TAC_CALL:
-            err = tac_execute_call(engine, instruction);
-            engine->step_count++;
-            return err; // Call handles PC update
-            
-        case TAC_RETURN:
-            err = tac_execute_return(engine, instruction);
-            engine->step_count++;
-            return err; // Return handles PC update
-            
-        case TAC_RETURN_VOID:
-            // Void return - just terminate execution
-            engine->state = TAC_ENGINE_FINISHED;
-            engine->step_count++;
-            return TAC_ENGINE_OK;
-            
-        case TAC_PARAM:
-            // Parameter passing - for now just treat as NOP
-            // In a full implementation, this would push to parameter stack
-            break;
-            
-        case TAC_NOP:
-            // No operation
-            break;
-            
-        case TAC_LABEL:
-            // Labels are just markers, no operation needed
-            break;
-            
-        default:
-            tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPCODE,
-                         "Unknown opcode: %d", instruction->opcode);
+    tac_engine_error_t err = (engine->instrumentation & ~TAC_INSTR_ACCESS_ONLY)
+        ? tac_execute_observed(engine, instruction)
+        : tac_execute_instruction(engine, instruction);
+    if (err != TAC_ENGINE_OK) {
+        if (err != TAC_ENGINE_ERR_BREAKPOINT) {
             engine->state = TAC_ENGINE_ERROR;
-            return TAC_ENGINE_ERR_INVALID_OPCODE;
+        }
+        return err;
     }
     
-    if (err != TAC_ENGINE_OK) {
-        engine->state = TAC_ENGINE_ERROR;
-        return err;
+    // A single step reports its own watchpoint hit
+    if (engine->hook_stop) {
+        return tac_debug_pause(engine, true);
     }
     
-    // Advance to next instruction
-    engine->pc++;
     engine->step_count++;
     
     // Check if we've finished
@@ -1663,7 +1577,6 @@ tac_engine_error_t tac_engine_step(tac_engine_t* engine) {
     
     return TAC_ENGINE_OK;
 }
-
 tac_engine_error_t tac_engine_run_until(tac_engine_t* engine, uint32_t address) {
     if (!engine) {
         return TAC_ENGINE_ERR_NULL_POINTER;
@@ -1693,6 +1606,12 @@ tac_engine_error_t tac_engine_reset(tac_engine_t* engine) {
     engine->running = false;
     engine->state = TAC_ENGINE_STOPPED;
     engine->last_error = TAC_ENGINE_OK;
+    engine->pair_prev = TAC_NO_TARGET;
+    engine->paused_at = TAC_NO_TARGET;
+    engine->hook_stop = false;
+    engine->watch_hit_valid = false;
+    tac_update_instrumentation(engine);
+    tac_reset_call_stack(engine);
     
     return TAC_ENGINE_OK;
 }
@@ -1731,6 +1650,7 @@ const char* tac_engine_error_string(tac_engine_error_t error) {
         case TAC_ENGINE_ERR_BREAKPOINT: return "Hit breakpoint";
         case TAC_ENGINE_ERR_MAX_STEPS: return "Maximum steps exceeded";
         case TAC_ENGINE_ERR_NOT_FOUND: return "Label or function not found";
+        case TAC_ENGINE_ERR_UNSUPPORTED: return "Not supported";
         default: return "Unknown error";
     }
 }
@@ -1745,6 +1665,14 @@ tac_engine_config_t tac_engine_default_config(void) {
         .enable_tracing = false,
         .enable_bounds_check = true,
         .enable_type_check = true,
+        .exec_mode = TAC_EXEC_INTERPRET,
+        .enable_superinstructions = true,
+        .enable_tail_calls = true,
+        .tier_call_threshold = 100,
+        .tier_loop_threshold = 1000,
+        .enable_pair_profile = false,
+        .enable_profile = false,
+        .log_categories = TAC_LOG_CAT_NONE,
         .symtab_file = NULL,             // Symbol table file (optional)
         .sstore_file = NULL,             // String store file (optional)  
         .enable_symbol_resolution = false // Symbol resolution disabled by default
@@ -1792,6 +1720,12 @@ tac_engine_error_t tac_engine_set_temp(tac_engine_t* engine,
     }
     
     engine->temporaries[temp_id] = *value;
+    if (engine->recorder) {
+        tac_record_value(engine, TAC_RECORD_SET_TEMP, temp_id, value);
+    }
+    if (value->type != TAC_VALUE_INT32) {
+        return tac_types_widen(engine, engine->config.max_variables + temp_id);
+    }
     return TAC_ENGINE_OK;
 }
 
@@ -1822,99 +1756,18 @@ tac_engine_error_t tac_engine_set_var(tac_engine_t* engine,
     }
     
     engine->variables[var_id] = *value;
-    return TAC_ENGINE_OK;
-}
-
-// =============================================================================
-// STUB IMPLEMENTATIONS FOR MISSING MEMORY FUNCTIONS
-// =============================================================================
-
-tac_engine_error_t tac_memory_init(tac_memory_manager_t* memory, uint32_t max_size) {
-    if (!memory) {
-        return TAC_ENGINE_ERR_NULL_POINTER;
+    if (engine->recorder) {
+        tac_record_value(engine, TAC_RECORD_SET_VAR, var_id, value);
     }
-    
-    memory->blocks = NULL;
-    memory->next_address = 0x1000; // Start at 4KB
-    memory->total_allocated = 0;
-    memory->max_size = max_size;
-    
-    return TAC_ENGINE_OK;
-}
-
-void tac_memory_cleanup(tac_memory_manager_t* memory) {
-    if (!memory) {
-        return;
+    if (value->type != TAC_VALUE_INT32) {
+        return tac_types_widen(engine, var_id);
     }
-    
-    // Free all memory blocks
-    tac_memory_block_t* block = memory->blocks;
-    while (block) {
-        tac_memory_block_t* next = block->next;
-        free(block->data);
-        free(block);
-        block = next;
-    }
-    
-    memory->blocks = NULL;
-    memory->total_allocated = 0;
-}
-
-uint32_t tac_memory_alloc(tac_memory_manager_t* memory, uint32_t size) {
-    if (!memory) {
-        return 0; // Invalid address
-    }
-    
-    if (memory->total_allocated + size > memory->max_size) {
-        return 0; // Out of memory
-    }
-    
-    // Simple linear allocation
-    uint32_t address = memory->next_address;
-    memory->next_address += size;
-    memory->total_allocated += size;
-    
-    return address;
-}
-
-tac_engine_error_t tac_memory_free(tac_memory_manager_t* memory, uint32_t address) {
-    if (!memory) {
-        return TAC_ENGINE_ERR_NULL_POINTER;
-    }
-    
-    // Simple stub - in real implementation would free the block
-    (void)address;
     return TAC_ENGINE_OK;
 }
 
-tac_engine_error_t tac_memory_read(tac_memory_manager_t* memory,
-                                  uint32_t address,
-                                  void* buffer,
-                                  uint32_t size) {
-    if (!memory || !buffer) {
-        return TAC_ENGINE_ERR_NULL_POINTER;
-    }
-    
-    // Simple stub - in real implementation would read from virtual memory
-    (void)address;
-    (void)size;
-    memset(buffer, 0, size);
-    return TAC_ENGINE_OK;
-}
-
-tac_engine_error_t tac_memory_write(tac_memory_manager_t* memory,
-                                   uint32_t address,
-                                   const void* buffer,
-                                   uint32_t size) {
-    if (!memory || !buffer) {
-        return TAC_ENGINE_ERR_NULL_POINTER;
-    }
-    
-    // Simple stub - in real implementation would write to virtual memory
-    (void)address;
-    (void)size;
-    return TAC_ENGINE_OK;
-}
+// =============================================================================
+// TYPE CONVERSION
+// =============================================================================
 
 tac_engine_error_t tac_convert_value(const tac_value_t* from,
                                     tac_value_type_t target_type,
@@ -1970,7 +1823,7 @@ static tac_engine_error_t tac_execute_param(tac_engine_t* engine,
     
     // Store parameter value in the parameter stack for later mapping
     // The actual parameter mapping will be done when the call instruction is executed
-    if (engine->param_counter >= 10) { // Safety limit
+    if (engine->param_counter >= TAC_MAX_CALL_PARAMS) { // Safety limit
         return TAC_ENGINE_ERR_INVALID_OPERAND;
     }
     
@@ -1988,12 +1841,9 @@ static tac_engine_error_t tac_execute_return_void(tac_engine_t* engine,
         return TAC_ENGINE_ERR_NULL_POINTER;
     }
     
-    (void)instruction; // Mark as used
-    
-    // Main function return - end execution
-    engine->state = TAC_ENGINE_FINISHED;
-    
-    return TAC_ENGINE_OK;
+    // A void return unwinds the call stack exactly like a valueless
+    // TAC_RETURN; at top level it finishes execution
+    return tac_execute_return(engine, instruction);
 }
 
 static tac_engine_error_t tac_execute_unary_op(tac_engine_t* engine,
@@ -2044,6 +1894,46 @@ static tac_engine_error_t tac_execute_unary_op(tac_engine_t* engine,
     return tac_store_operand(engine, &instruction->result, &result_val);
 }
 
+/**
+ * @brief Run memory hooks and replay the inputs recorded at a memory access
+ * @param type TAC_HOOK_MEMORY_READ or TAC_HOOK_MEMORY_WRITE
+ */
+static tac_engine_error_t tac_memory_observe(tac_engine_t* engine, tac_hook_type_t type,
+                                             uint32_t address) {
+    if (engine->instrumentation & TAC_INSTR_REPLAY) {
+        tac_engine_error_t err = tac_replay_apply(engine, TAC_INPUT_MEMORY);
+        if (err != TAC_ENGINE_OK) {
+            return err;
+        }
+    }
+    if (engine->instrumentation & TAC_INSTR_HOOK(type)) {
+        tac_trigger_hooks_after(engine, type, address);
+    }
+    return TAC_ENGINE_OK;
+}
+
+/**
+ * @brief Read a 4-byte element from engine memory into an int32 value
+ */
+static tac_engine_error_t tac_load_word(tac_engine_t* engine, uint32_t address,
+                                        tac_value_t* value) {
+    if (engine->instrumentation & (TAC_INSTR_HOOK(TAC_HOOK_MEMORY_READ) | TAC_INSTR_REPLAY)) {
+        tac_engine_error_t err = tac_memory_observe(engine, TAC_HOOK_MEMORY_READ, address);
+        if (err != TAC_ENGINE_OK) {
+            return err;
+        }
+    }
+
+    int32_t word = 0;
+    tac_engine_error_t err = tac_memory_read(&engine->memory, address, &word, sizeof(word));
+    if (err != TAC_ENGINE_OK) {
+        tac_set_error(engine, err, "Invalid memory read at 0x%08x", address);
+        return err;
+    }
+    *value = tac_value_int32(word);
+    return TAC_ENGINE_OK;
+}
+
 static tac_engine_error_t tac_execute_load(tac_engine_t* engine,
                                            const TACInstruction* instruction) {
     // Load indirect: result = *operand1
@@ -2058,8 +1948,11 @@ static tac_engine_error_t tac_execute_load(tac_engine_t* engine,
         return err;
     }
     
-    // For simplicity, just return the address value (stub implementation)
-    tac_value_t result_val = addr_val;
+    tac_value_t result_val;
+    err = tac_load_word(engine, addr_val.data.u32, &result_val);
+    if (err != TAC_ENGINE_OK) {
+        return err;
+    }
     return tac_store_operand(engine, &instruction->result, &result_val);
 }
 
@@ -2077,8 +1970,28 @@ static tac_engine_error_t tac_execute_store(tac_engine_t* engine,
         return err;
     }
     
-    // For simplicity, just store normally (stub implementation)
-    return tac_store_operand(engine, &instruction->result, &val);
+    // The result operand holds the target address
+    tac_value_t addr_val;
+    err = tac_eval_operand(engine, &instruction->result, &addr_val);
+    if (err != TAC_ENGINE_OK) {
+        return err;
+    }
+    
+    if (engine->instrumentation & (TAC_INSTR_HOOK(TAC_HOOK_MEMORY_WRITE) | TAC_INSTR_REPLAY)) {
+        err = tac_memory_observe(engine, TAC_HOOK_MEMORY_WRITE, addr_val.data.u32);
+        if (err != TAC_ENGINE_OK) {
+            return err;
+        }
+    }
+
+    int32_t word = val.data.i32;
+    err = tac_memory_write(&engine->memory, addr_val.data.u32, &word, sizeof(word));
+    if (err != TAC_ENGINE_OK) {
+        tac_set_error(engine, err, "Invalid memory write at 0x%08x", addr_val.data.u32);
+        return err;
+    }
+    tac_watch_memory(engine, addr_val.data.u32, sizeof(word));
+    return TAC_ENGINE_OK;
 }
 
 static tac_engine_error_t tac_execute_addr(tac_engine_t* engine,
@@ -2088,17 +2001,19 @@ static tac_engine_error_t tac_execute_addr(tac_engine_t* engine,
         return TAC_ENGINE_ERR_NULL_POINTER;
     }
     
-    // For simplicity, create a fake address value
+    // Variables and temporaries live in registers, not engine memory: hand
+    // out a distinct address in the reserved range, which is never mapped,
+    // so dereferencing it faults instead of reaching heap blocks
     tac_value_t result_val;
     result_val.type = TAC_VALUE_INT32;
     
+    uint32_t address = TAC_ADDR_OTHER;
     if (instruction->operand1.type == TAC_OP_VAR) {
-        result_val.data.i32 = 0x1000 + instruction->operand1.data.variable.id;
+        address = TAC_ADDR_VAR_BASE + ((uint32_t)instruction->operand1.data.variable.id << 2);
     } else if (instruction->operand1.type == TAC_OP_TEMP) {
-        result_val.data.i32 = 0x2000 + instruction->operand1.data.variable.id;
-    } else {
-        result_val.data.i32 = 0x3000;
+        address = TAC_ADDR_TEMP_BASE + ((uint32_t)instruction->operand1.data.variable.id << 2);
     }
+    result_val.data.u32 = address;
     
     return tac_store_operand(engine, &instruction->result, &result_val);
 }
@@ -2124,8 +2039,14 @@ static tac_engine_error_t tac_execute_index(tac_engine_t* engine,
         return err;
     }
     
-    // For simplicity, just return base value (stub implementation)
-    return tac_store_operand(engine, &instruction->result, &base_val);
+    // 4-byte elements, wrapping address arithmetic as on the target
+    uint32_t address = base_val.data.u32 + (uint32_t)index_val.data.i32 * 4u;
+    tac_value_t result_val;
+    err = tac_load_word(engine, address, &result_val);
+    if (err != TAC_ENGINE_OK) {
+        return err;
+    }
+    return tac_store_operand(engine, &instruction->result, &result_val);
 }
 
 static tac_engine_error_t tac_execute_member(tac_engine_t* engine,
@@ -2202,24 +2123,33 @@ static tac_engine_error_t tac_execute_phi(tac_engine_t* engine,
 
 /**
  * @brief Load symbol table and string store for variable resolution
+ *
+ * Both files are read once with symtab_load()/sstore_load() into buffers
+ * owned by the engine, so the compiler's global symtab/sstore handles are
+ * left alone.
  */
 static tac_engine_error_t tac_engine_load_symbols(tac_engine_t* engine) {
     if (!engine || !engine->config.symtab_file) {
         return TAC_ENGINE_OK; // Symbol resolution disabled
     }
-    
-    // Initialize symbol table
-    if (symtab_init(engine->config.symtab_file) != 0) {
+
+    SymIdx_t count = 0;
+    engine->symbols.entries = symtab_load(engine->config.symtab_file, &count);
+    if (!engine->symbols.entries) {
         snprintf(engine->error_message, sizeof(engine->error_message),
                 "Failed to load symbol table from %s", engine->config.symtab_file);
         return TAC_ENGINE_ERR_INVALID_OPERAND;
     }
-    
-    // Initialize string store if provided
+    engine->symbols.entry_count = count;
+
     if (engine->config.sstore_file) {
-        if (sstore_init(engine->config.sstore_file) != 0) {
+        engine->symbols.strings = sstore_load(engine->config.sstore_file,
+                                              &engine->symbols.strings_size);
+        if (!engine->symbols.strings) {
             snprintf(engine->error_message, sizeof(engine->error_message),
                     "Failed to load string store from %s", engine->config.sstore_file);
+            free(engine->symbols.entries);
+            engine->symbols.entries = NULL;
             return TAC_ENGINE_ERR_INVALID_OPERAND;
         }
     }
@@ -2233,10 +2163,11 @@ static tac_engine_error_t tac_engine_load_symbols(tac_engine_t* engine) {
         engine->symbols.sstore_filename[255] = '\0';
     }
     
-    printf("DEBUG: Symbol table integration enabled\n");
-    printf("  Symbol table: %s\n", engine->config.symtab_file);
+    TAC_LOG_INFO(engine, TAC_LOG_CAT_SYMBOLS, "Symbol table integration enabled");
+    TAC_LOG_INFO(engine, TAC_LOG_CAT_SYMBOLS, "  Symbol table: %s (%u symbols)",
+                 engine->config.symtab_file, engine->symbols.entry_count);
     if (engine->config.sstore_file) {
-        printf("  String store: %s\n", engine->config.sstore_file);
+        TAC_LOG_INFO(engine, TAC_LOG_CAT_SYMBOLS, "  String store: %s", engine->config.sstore_file);
     }
     
     return TAC_ENGINE_OK;
@@ -2268,8 +2199,11 @@ static tac_engine_error_t tac_resolve_symbol(tac_engine_t* engine, uint16_t symb
         return TAC_ENGINE_OK;
     }
     
-    // Look up in symbol table
-    SymTabEntry entry = symtab_get(symbol_id);
+    // Look up in symbol table (ids are 1-based)
+    SymTabEntry entry = {0};
+    if (symbol_id > 0 && symbol_id <= engine->symbols.entry_count) {
+        entry = engine->symbols.entries[symbol_id - 1];
+    }
     if (entry.name == 0) {
         snprintf(name_out, name_size, "UNKNOWN_%u", symbol_id);
         *type_out = 0;
@@ -2277,10 +2211,13 @@ static tac_engine_error_t tac_resolve_symbol(tac_engine_t* engine, uint16_t symb
     }
     
     // Get name from string store
-    char* symbol_name = sstore_get(entry.name);
+    sstore_len_t length = 0;
+    const char* symbol_name = sstore_view(engine->symbols.strings, engine->symbols.strings_size,
+                                          entry.name, &length);
     if (symbol_name) {
-        strncpy(name_out, symbol_name, name_size - 1);
-        name_out[name_size - 1] = '\0';
+        size_t copy = (length < name_size - 1) ? length : name_size - 1;
+        memcpy(name_out, symbol_name, copy);
+        name_out[copy] = '\0';
     } else {
         snprintf(name_out, name_size, "NONAME_%u", symbol_id);
     }
@@ -62,6 +62,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdio.h>
 #include "../../ir/tac_types.h"
 
 // Forward declarations
@@ -94,9 +95,59 @@ typedef enum tac_engine_error {
     TAC_ENGINE_ERR_INVALID_MEMORY,   // Invalid memory access
     TAC_ENGINE_ERR_BREAKPOINT,       // Hit breakpoint
     TAC_ENGINE_ERR_MAX_STEPS,        // Maximum steps exceeded
-    TAC_ENGINE_ERR_NOT_FOUND         // Label or function not found
+    TAC_ENGINE_ERR_NOT_FOUND,        // Label or function not found
+    TAC_ENGINE_ERR_UNSUPPORTED       // Feature not available on this host/program
 } tac_engine_error_t;
 
+/**
+ * @brief Instruction dispatch strategy used by tac_engine_run()
+ */
+typedef enum tac_engine_exec_mode {
+    TAC_EXEC_INTERPRET = 0,     // Decode each TACInstruction on every execution
+    TAC_EXEC_PREDECODED,        // Pre-decoded, threaded dispatch (fast mode)
+    TAC_EXEC_BYTECODE,          // Register bytecode VM
+    TAC_EXEC_JIT,               // Native x86-64 code, interpreter fallback elsewhere
+    TAC_EXEC_TIERED             // Interpret, pre-decode hot functions (see tier thresholds)
+} tac_engine_exec_mode_t;
+
+/**
+ * @brief Diagnostic log levels (see tac_engine_log.h for compile-time control)
+ */
+typedef enum tac_log_level {
+    TAC_LOG_LEVEL_NONE = 0,     // Logging compiled out entirely
+    TAC_LOG_LEVEL_ERROR,        // Unrecoverable problems
+    TAC_LOG_LEVEL_WARN,         // Degraded operation (e.g. symbols unavailable)
+    TAC_LOG_LEVEL_INFO,         // One-off setup events
+    TAC_LOG_LEVEL_DEBUG,        // Per-call / per-label diagnostics
+    TAC_LOG_LEVEL_TRACE         // Per-instruction diagnostics
+} tac_log_level_t;
+
+/**
+ * @brief Diagnostic log categories (bit mask)
+ *
+ * The mask filters INFO and below; errors and warnings always reach the sink.
+ */
+typedef enum tac_log_category {
+    TAC_LOG_CAT_NONE     = 0x00,
+    TAC_LOG_CAT_DISPATCH = 0x01,    // Instruction dispatch and operand access
+    TAC_LOG_CAT_CALLS    = 0x02,    // CALL/RETURN and parameter mapping
+    TAC_LOG_CAT_LABELS   = 0x04,    // Label table and jump resolution
+    TAC_LOG_CAT_SYMBOLS  = 0x08,    // Symbol table integration
+    TAC_LOG_CAT_ALL      = 0xFF
+} tac_log_category_t;
+
+/**
+ * @brief Log sink callback
+ * @param user_data Opaque pointer passed to tac_engine_set_log_sink()
+ * @param level Message level
+ * @param category Message category
+ * @param message Formatted message without trailing newline
+ */
+typedef void (*tac_engine_log_sink_t)(void* user_data,
+                                      tac_log_level_t level,
+                                      tac_log_category_t category,
+                                      const char* message);
+
 /**
  * @brief Engine configuration options
  */
@@ -104,11 +155,19 @@ typedef struct tac_engine_config {
     uint32_t max_temporaries;     // Maximum temporary variables (default: 1024)
     uint32_t max_variables;       // Maximum named variables (default: 1024)
     uint32_t max_memory_size;     // Virtual memory size in bytes (default: 64KB)
-    uint32_t max_call_depth;      // Maximum function call depth (default: 256)
+    uint32_t max_call_depth;      // Maximum function call depth, 0 = memory only (default: 64)
     uint32_t max_steps;           // Maximum execution steps (default: 1M)
     bool enable_tracing;          // Enable instruction tracing
     bool enable_bounds_check;     // Enable array bounds checking
     bool enable_type_check;       // Enable type checking
+    tac_engine_exec_mode_t exec_mode; // Dispatch strategy (default: interpret)
+    bool enable_superinstructions; // Fuse common sequences when pre-decoding (default: on)
+    bool enable_tail_calls;       // CALL then RETURN of its result reuses the frame (default: on)
+    uint32_t tier_call_threshold; // Tiered: calls promoting a function, 0 = never (default: 100)
+    uint32_t tier_loop_threshold; // Tiered: back-edges promoting a function, 0 = never (default: 1000)
+    bool enable_pair_profile;     // Count executed opcode pairs (runs interpreted)
+    bool enable_profile;          // Count instructions, branches and calls (runs interpreted)
+    uint32_t log_categories;      // tac_log_category_t mask (default: none)
     
     // Symbol table integration for variable name resolution
     const char* symtab_file;      // Path to symbol table file (optional)
@@ -132,6 +191,9 @@ typedef enum tac_value_type {
 
 /**
  * @brief Generic value container
+ *
+ * Also the cell of the register file, 16 bytes per variable and temporary
+ * whatever its inferred type (see README.md, Limitations).
  */
 typedef struct tac_value {
     tac_value_type_t type;
@@ -172,6 +234,25 @@ typedef bool (*tac_hook_callback_t)(tac_engine_t* engine,
                                     uint32_t address,
                                     void* user_data);
 
+/**
+ * @brief Locations a watchpoint can watch
+ */
+typedef enum tac_watch_kind {
+    TAC_WATCH_VARIABLE,          // Variable slot
+    TAC_WATCH_TEMPORARY,         // Temporary slot
+    TAC_WATCH_MEMORY             // Virtual memory byte range
+} tac_watch_kind_t;
+
+/**
+ * @brief The write that stopped execution at a watchpoint
+ */
+typedef struct tac_watch_hit {
+    uint32_t watchpoint;         // ID returned by tac_engine_add_watchpoint
+    tac_watch_kind_t kind;       // Kind of the watchpoint
+    uint32_t location;           // Variable/temporary ID, or first byte written
+    uint32_t address;            // Instruction that wrote it
+} tac_watch_hit_t;
+
 // =============================================================================
 // CORE ENGINE API
 // =============================================================================
@@ -217,6 +298,27 @@ tac_engine_error_t tac_engine_load_code(tac_engine_t* engine,
                                         const TACInstruction* instructions,
                                         uint32_t count);
 
+/**
+ * @brief Load TAC instructions with the metadata of their functions
+ *
+ * Calls bind their arguments to the parameters a record lists (see
+ * tac_function.h), in declaration order. Without records
+ * (tac_engine_load_code()) they come from the symbol table when one is
+ * loaded; otherwise functions take no parameters.
+ *
+ * @param engine Engine instance
+ * @param instructions Array of TAC instructions
+ * @param count Number of instructions
+ * @param functions Function section of the TAC file, copied (may be NULL)
+ * @param function_count Number of records
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_engine_load_program(tac_engine_t* engine,
+                                           const TACInstruction* instructions,
+                                           uint32_t count,
+                                           const TACFunction* functions,
+                                           uint32_t function_count);
+
 /**
  * @brief Set the entry point for execution by instruction address
  * @param engine Engine instance
@@ -446,6 +548,39 @@ uint32_t tac_engine_add_hook(tac_engine_t* engine,
  */
 tac_engine_error_t tac_engine_remove_hook(tac_engine_t* engine, uint32_t hook_id);
 
+/**
+ * @brief Pause execution after any instruction that writes a location
+ * @param engine Engine instance
+ * @param kind Variable, temporary or memory
+ * @param location Variable/temporary ID, or first address of the range
+ * @param size Bytes watched (TAC_WATCH_MEMORY only, ignored otherwise)
+ * @return Watchpoint ID or 0 on failure (location out of range)
+ * @note A hit leaves the engine TAC_ENGINE_PAUSED and tac_engine_run() or
+ *       tac_engine_step() returns TAC_ENGINE_ERR_BREAKPOINT; writes made
+ *       with tac_engine_set_var() or tac_engine_mem_write() do not hit.
+ */
+uint32_t tac_engine_add_watchpoint(tac_engine_t* engine,
+                                   tac_watch_kind_t kind,
+                                   uint32_t location,
+                                   uint32_t size);
+
+/**
+ * @brief Remove watchpoint
+ * @param engine Engine instance
+ * @param watch_id Watchpoint ID returned by tac_engine_add_watchpoint
+ * @return TAC_ENGINE_OK on success, TAC_ENGINE_ERR_NOT_FOUND if unknown
+ */
+tac_engine_error_t tac_engine_remove_watchpoint(tac_engine_t* engine, uint32_t watch_id);
+
+/**
+ * @brief Get the most recent watchpoint hit
+ * @param engine Engine instance
+ * @param hit Output: the write that hit
+ * @return TAC_ENGINE_OK on success, TAC_ENGINE_ERR_NOT_FOUND if none since
+ *         the code was loaded or the engine reset
+ */
+tac_engine_error_t tac_engine_get_watch_hit(tac_engine_t* engine, tac_watch_hit_t* hit);
+
 /**
  * @brief Enable/disable instruction tracing
  * @param engine Engine instance
@@ -454,6 +589,156 @@ tac_engine_error_t tac_engine_remove_hook(tac_engine_t* engine, uint32_t hook_id
  */
 tac_engine_error_t tac_engine_set_tracing(tac_engine_t* engine, bool enable);
 
+/**
+ * @brief Stream a compact binary trace of every executed step to a file
+ * @param engine Engine instance
+ * @param path Trace file to create (read back with tac_trace_reader_open())
+ * @return TAC_ENGINE_OK on success
+ * @note Records are written by a background thread; execution runs
+ *       interpreted while a trace is open. Replaces any open trace.
+ */
+tac_engine_error_t tac_engine_trace_to_file(tac_engine_t* engine, const char* path);
+
+/**
+ * @brief Flush and close the trace file, if any
+ * @param engine Engine instance
+ * @return TAC_ENGINE_OK on success, TAC_ENGINE_ERR_INVALID_OPERAND if a
+ *         write failed
+ */
+tac_engine_error_t tac_engine_trace_stop(tac_engine_t* engine);
+
+/**
+ * @brief One step decoded from a trace file
+ */
+typedef struct tac_trace_record {
+    uint64_t step;                // Step number
+    uint32_t address;             // Instruction address
+    bool changed;                 // The instruction changed its result operand
+    tac_value_t value;            // New result value (if changed)
+} tac_trace_record_t;
+
+/**
+ * @brief Sequential trace file reader
+ */
+typedef struct tac_trace_reader tac_trace_reader_t;
+
+/**
+ * @brief Open a trace file written by tac_engine_trace_to_file()
+ * @param path Trace file
+ * @return Reader, or NULL if the file is missing or not a trace
+ */
+tac_trace_reader_t* tac_trace_reader_open(const char* path);
+
+/**
+ * @brief Decode the next step
+ * @param reader Trace reader
+ * @param record Output record
+ * @return TAC_ENGINE_OK, TAC_ENGINE_ERR_NOT_FOUND at the end of the trace,
+ *         or TAC_ENGINE_ERR_INVALID_OPERAND if the file is truncated or corrupt
+ */
+tac_engine_error_t tac_trace_reader_next(tac_trace_reader_t* reader, tac_trace_record_t* record);
+
+/**
+ * @brief Close a trace reader
+ * @param reader Trace reader (may be NULL)
+ */
+void tac_trace_reader_close(tac_trace_reader_t* reader);
+
+/**
+ * @brief Log every input the host makes through the API to a file
+ * @param engine Engine instance with code loaded
+ * @param path Input log to create (replayed with tac_replay_open())
+ * @return TAC_ENGINE_OK on success
+ * @note Logs tac_engine_set_var(), tac_engine_set_temp(), tac_engine_mem_write(),
+ *       tac_engine_malloc(), tac_engine_free() and each run or step, with the
+ *       step they happened at, including calls made from hooks. Execution
+ *       keeps its mode. Loading code, tac_engine_reset() and
+ *       tac_engine_restore() end the recording. Replaces any open recording.
+ */
+tac_engine_error_t tac_engine_record_to_file(tac_engine_t* engine, const char* path);
+
+/**
+ * @brief End the recording, if any, and close the input log
+ * @param engine Engine instance
+ * @return TAC_ENGINE_OK on success, TAC_ENGINE_ERR_INVALID_OPERAND if a
+ *         write failed
+ */
+tac_engine_error_t tac_engine_record_stop(tac_engine_t* engine);
+
+/**
+ * @brief Replay of an input log on an engine (opaque)
+ */
+typedef struct tac_replay tac_replay_t;
+
+/**
+ * @brief Start replaying an input log
+ * @param engine Engine in the state recording started from: same code,
+ *               registers, PC and step count (typically freshly loaded)
+ * @param path Input log written by tac_engine_record_to_file()
+ * @param snapshot_interval Steps between snapshots kept for seeking, 0 = none
+ * @param replay Output: replay, close with tac_replay_close()
+ * @return TAC_ENGINE_OK on success, TAC_ENGINE_ERR_INVALID_OPERAND if the
+ *         log is corrupt or was recorded from a different program or state
+ * @note The engine runs interpreted while a replay is open. Breakpoints,
+ *       watchpoints and hooks still work; hooks that made the recorded
+ *       inputs must not be registered again.
+ */
+tac_engine_error_t tac_replay_open(tac_engine_t* engine, const char* path,
+                                   uint32_t snapshot_interval, tac_replay_t** replay);
+
+/**
+ * @brief Run to the end of the recording, applying the recorded inputs
+ * @param replay Replay
+ * @return TAC_ENGINE_OK at the end of the recording, the error the recorded
+ *         execution ended with, or TAC_ENGINE_ERR_BREAKPOINT if a breakpoint,
+ *         watchpoint or hook paused the engine (call again to continue)
+ */
+tac_engine_error_t tac_replay_run(tac_replay_t* replay);
+
+/**
+ * @brief Move the engine to the state it had before executing a step
+ * @param replay Replay
+ * @param step Step number, from the start of the recording to its end
+ * @return TAC_ENGINE_OK with the engine paused at the step,
+ *         TAC_ENGINE_ERR_INVALID_OPERAND if the step is out of range
+ * @note Seeking backwards restores the nearest earlier snapshot and
+ *       replays forward from it.
+ */
+tac_engine_error_t tac_replay_seek(tac_replay_t* replay, uint32_t step);
+
+/**
+ * @brief Step at which the recording ended
+ * @param replay Replay
+ * @return Step count, or UINT32_MAX if the log has no end record (truncated)
+ */
+uint32_t tac_replay_end_step(const tac_replay_t* replay);
+
+/**
+ * @brief End a replay and free its snapshots; the engine keeps its state
+ * @param replay Replay (may be NULL); close it before destroying the engine
+ */
+void tac_replay_close(tac_replay_t* replay);
+
+/**
+ * @brief Route diagnostic messages to a custom sink
+ * @param engine Engine instance
+ * @param sink Sink callback (NULL restores the default stderr sink)
+ * @param user_data Opaque pointer passed to the sink
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_engine_set_log_sink(tac_engine_t* engine,
+                                           tac_engine_log_sink_t sink,
+                                           void* user_data);
+
+/**
+ * @brief Select which diagnostic categories are emitted
+ * @param engine Engine instance
+ * @param categories Mask of tac_log_category_t values
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_engine_set_log_categories(tac_engine_t* engine,
+                                                 uint32_t categories);
+
 // =============================================================================
 // TEST FRAMEWORK HELPERS
 // =============================================================================
@@ -503,6 +788,197 @@ tac_engine_error_t tac_engine_get_stats(tac_engine_t* engine,
                                         uint32_t* steps_executed,
                                         uint32_t* memory_used);
 
+/**
+ * @brief Executed fall-through opcode pair
+ */
+typedef struct tac_pair_stat {
+    TACOpcode first;              // Opcode executed first
+    TACOpcode second;             // Opcode of the next instruction in code order
+    uint64_t count;               // Times the pair executed back to back
+    bool fused;                   // Covered by a superinstruction
+} tac_pair_stat_t;
+
+/**
+ * @brief Get the hottest opcode pairs (requires config.enable_pair_profile)
+ * @param engine Engine instance
+ * @param pairs Output array, sorted by descending count
+ * @param max_pairs Capacity of pairs
+ * @param pair_count Output: number of entries written
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_engine_get_pair_profile(tac_engine_t* engine,
+                                               tac_pair_stat_t* pairs,
+                                               uint32_t max_pairs,
+                                               uint32_t* pair_count);
+
+/**
+ * @brief Per-function figures of an execution profile
+ */
+typedef struct tac_function_profile {
+    uint32_t entry;               // Entry instruction, UINT32_MAX for top-level code
+    uint64_t calls;               // Times called
+    uint64_t self_steps;          // Steps executed in the function itself
+    uint64_t total_steps;         // Steps including callees (recursion counted once)
+} tac_function_profile_t;
+
+/**
+ * @brief Execution profile (requires config.enable_profile)
+ *
+ * Arrays are owned by the engine and stay valid until the next load or
+ * tac_engine_get_profile() call; counts accumulate across runs.
+ */
+typedef struct tac_profile {
+    const uint64_t* executed;     // [instruction_count] times each instruction ran
+    const uint64_t* taken;        // [instruction_count] times IF_TRUE/IF_FALSE jumped
+    uint32_t instruction_count;
+    const tac_function_profile_t* functions; // [function_count + 1], top level last
+    uint32_t function_count;      // CALL targets in the program
+} tac_profile_t;
+
+/**
+ * @brief Get the execution profile of the loaded program
+ * @param engine Engine instance
+ * @param profile Output: views into the engine's counters
+ * @return TAC_ENGINE_OK on success, TAC_ENGINE_ERR_INVALID_OPERAND if
+ *         profiling is not enabled
+ */
+tac_engine_error_t tac_engine_get_profile(tac_engine_t* engine, tac_profile_t* profile);
+
+/**
+ * @brief Write the profile as folded stacks ("program;L10;L10 1234" per line)
+ * @param engine Engine instance (config.enable_profile)
+ * @param out Destination, e.g. for flamegraph.pl
+ * @return TAC_ENGINE_OK on success
+ * @note Frames are named by the label at the function entry (L<id>), or
+ *       by its address (@<index>) if the entry is not a label.
+ */
+tac_engine_error_t tac_engine_write_folded_stacks(tac_engine_t* engine, FILE* out);
+
+/**
+ * @brief Tier-up activity of a TAC_EXEC_TIERED engine
+ *
+ * Counts accumulate across runs until the next load.
+ */
+typedef struct tac_tier_stats {
+    uint32_t promoted;            // Functions promoted, top-level code included
+    uint32_t switches;            // Times execution entered the pre-decoded tier
+    bool decoded;                 // The pre-decoded program has been built
+} tac_tier_stats_t;
+
+/**
+ * @brief Get the tier-up activity of the loaded program
+ * @param engine Engine instance
+ * @param stats Output
+ * @return TAC_ENGINE_OK on success, TAC_ENGINE_ERR_INVALID_OPERAND if the
+ *         engine is not in TAC_EXEC_TIERED mode or has no code loaded
+ */
+tac_engine_error_t tac_engine_get_tier_stats(tac_engine_t* engine, tac_tier_stats_t* stats);
+
+// =============================================================================
+// SNAPSHOTS
+// =============================================================================
+
+/**
+ * @brief Saved execution state of an engine (opaque, immutable)
+ */
+typedef struct tac_snapshot tac_snapshot_t;
+
+/**
+ * @brief Capture registers, call stack and virtual memory
+ * @param engine Engine instance (not inside tac_engine_run)
+ * @param snapshot Output: new snapshot, released with tac_engine_snapshot_free()
+ * @return TAC_ENGINE_OK on success
+ * @note Memory pages are shared copy-on-write, so taking a snapshot costs
+ *       the registers plus one pointer per page.
+ */
+tac_engine_error_t tac_engine_snapshot(tac_engine_t* engine, tac_snapshot_t** snapshot);
+
+/**
+ * @brief Return an engine to a snapshot
+ * @param engine Engine running the same program as the snapshot's engine
+ * @param snapshot Snapshot to restore (may be restored any number of times)
+ * @return TAC_ENGINE_OK on success, TAC_ENGINE_ERR_INVALID_OPERAND if the
+ *         engine's program (compared by hash) or configuration does not match
+ * @note Costs the registers, the call stack and the slot type bitmaps; memory
+ *       pages are copied only when written afterwards.
+ */
+tac_engine_error_t tac_engine_restore(tac_engine_t* engine, const tac_snapshot_t* snapshot);
+
+/**
+ * @brief Release a snapshot
+ * @param snapshot Snapshot (may be NULL)
+ */
+void tac_engine_snapshot_free(tac_snapshot_t* snapshot);
+
+/**
+ * @brief Create an independent engine in the current state of another
+ * @param engine Engine to copy (not inside tac_engine_run)
+ * @return New engine, or NULL on failure
+ * @note The fork shares memory pages with its parent copy-on-write, and
+ *       gets the parent's configuration, program, symbols and log sink.
+ *       Hooks, breakpoints, watchpoints and trace contents are not copied.
+ */
+tac_engine_t* tac_engine_fork(tac_engine_t* engine);
+
+/**
+ * @brief Get virtual memory page statistics
+ * @param engine Engine instance
+ * @param pages_touched Output: pages backed by host memory (may be NULL)
+ * @param pages_copied Output: shared pages copied on write so far (may be NULL)
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_engine_get_page_stats(tac_engine_t* engine,
+                                             uint32_t* pages_touched,
+                                             uint32_t* pages_copied);
+
+// =============================================================================
+// BATCH EXECUTION
+// =============================================================================
+
+/**
+ * @brief One program run by tac_engine_run_batch()
+ */
+typedef struct tac_batch_job {
+    const TACInstruction* code;   // Program (read-only, may be shared by jobs)
+    uint32_t count;               // Number of instructions
+    const TACFunction* functions; // Function records (may be NULL), see tac_engine_load_program()
+    uint32_t function_count;      // Number of function records
+    tac_engine_error_t (*prepare)(tac_engine_t* engine, void* user_data); // Optional: after load
+    void (*finish)(tac_engine_t* engine, void* user_data); // Optional: after run
+    void* user_data;              // Passed to prepare and finish
+    tac_engine_error_t error;     // Output: first failure of load, prepare or run
+    uint32_t steps;               // Output: instructions executed
+} tac_batch_job_t;
+
+/**
+ * @brief Aggregate result of a batch
+ */
+typedef struct tac_batch_stats {
+    uint32_t jobs;                // Jobs run
+    uint32_t failed;              // Jobs whose error is not TAC_ENGINE_OK
+    uint32_t threads;             // Worker threads used (including the caller)
+    uint64_t steps;               // Instructions executed by all jobs
+    double seconds;               // Wall-clock time of the batch
+    double steps_per_second;      // Aggregate throughput
+} tac_batch_stats_t;
+
+/**
+ * @brief Run programs on a pool of threads, each job on its own engine
+ * @param config Configuration for every engine (NULL for defaults)
+ * @param jobs Jobs; error and steps are filled in
+ * @param job_count Number of jobs
+ * @param thread_count Worker threads (0 = one per online CPU)
+ * @param stats Output: aggregate statistics (may be NULL)
+ * @return TAC_ENGINE_OK once all jobs ran (check each job's error)
+ * @note prepare and finish run on worker threads, concurrently for
+ *       different jobs
+ */
+tac_engine_error_t tac_engine_run_batch(const tac_engine_config_t* config,
+                                        tac_batch_job_t* jobs,
+                                        uint32_t job_count,
+                                        uint32_t thread_count,
+                                        tac_batch_stats_t* stats);
+
 // =============================================================================
 // CONVENIENCE MACROS FOR TESTING
 // =============================================================================
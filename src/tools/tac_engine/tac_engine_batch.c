@@ -0,0 +1,147 @@
+/**
+ * @file tac_engine_batch.c
+ * @brief TAC Engine batch execution on a thread pool
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * Every job gets its own engine, created and destroyed on the worker that
+ * claims it. Engines share no mutable state (symbol tables are private
+ * copies, diagnostics go through the per-engine sink), so jobs only
+ * synchronise on the job counter. The calling thread works as one of the
+ * workers.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "tac_engine.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct tac_batch_pool {
+    const tac_engine_config_t* config;
+    tac_batch_job_t* jobs;
+    uint32_t job_count;
+    uint32_t next_job;             // Next unclaimed job, guarded by lock
+    pthread_mutex_t lock;
+} tac_batch_pool_t;
+
+/**
+ * @brief Run one job on a fresh engine
+ */
+static void tac_batch_run_job(const tac_engine_config_t* config, tac_batch_job_t* job) {
+    job->steps = 0;
+
+    tac_engine_t* engine = tac_engine_create(config);
+    if (!engine) {
+        job->error = TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        return;
+    }
+
+    job->error = tac_engine_load_program(engine, job->code, job->count,
+                                         job->functions, job->function_count);
+    if (job->error == TAC_ENGINE_OK && job->prepare) {
+        job->error = job->prepare(engine, job->user_data);
+    }
+    if (job->error == TAC_ENGINE_OK) {
+        job->error = tac_engine_run(engine);
+        job->steps = tac_engine_get_step_count(engine);
+        if (job->finish) {
+            job->finish(engine, job->user_data);
+        }
+    }
+
+    tac_engine_destroy(engine);
+}
+
+static void* tac_batch_worker(void* arg) {
+    tac_batch_pool_t* pool = arg;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        uint32_t index = pool->next_job;
+        if (index < pool->job_count) {
+            pool->next_job++;
+        }
+        pthread_mutex_unlock(&pool->lock);
+
+        if (index >= pool->job_count) {
+            return NULL;
+        }
+        tac_batch_run_job(pool->config, &pool->jobs[index]);
+    }
+}
+
+static double tac_batch_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+tac_engine_error_t tac_engine_run_batch(const tac_engine_config_t* config,
+                                        tac_batch_job_t* jobs,
+                                        uint32_t job_count,
+                                        uint32_t thread_count,
+                                        tac_batch_stats_t* stats) {
+    if (!jobs && job_count > 0) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_engine_config_t defaults = tac_engine_default_config();
+    if (!config) {
+        config = &defaults;
+    }
+
+    if (thread_count == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        thread_count = (online > 0) ? (uint32_t)online : 1;
+    }
+    if (thread_count > job_count) {
+        thread_count = job_count ? job_count : 1;
+    }
+
+    tac_batch_pool_t pool = { config, jobs, job_count, 0, PTHREAD_MUTEX_INITIALIZER };
+    pthread_t* threads = NULL;
+    uint32_t started = 0;
+
+    if (thread_count > 1) {
+        threads = malloc((thread_count - 1) * sizeof(pthread_t));
+        if (!threads) {
+            return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        }
+    }
+
+    double start = tac_batch_now();
+    while (started + 1 < thread_count &&
+           pthread_create(&threads[started], NULL, tac_batch_worker, &pool) == 0) {
+        started++;
+    }
+    tac_batch_worker(&pool);
+    for (uint32_t t = 0; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    double seconds = tac_batch_now() - start;
+
+    free(threads);
+    pthread_mutex_destroy(&pool.lock);
+
+    if (stats) {
+        stats->jobs = job_count;
+        stats->failed = 0;
+        stats->threads = started + 1;
+        stats->steps = 0;
+        for (uint32_t i = 0; i < job_count; i++) {
+            stats->steps += jobs[i].steps;
+            if (jobs[i].error != TAC_ENGINE_OK) {
+                stats->failed++;
+            }
+        }
+        stats->seconds = seconds;
+        stats->steps_per_second = seconds > 0.0 ? (double)stats->steps / seconds : 0.0;
+    }
+
+    return TAC_ENGINE_OK;
+}
@@ -0,0 +1,1149 @@
+/**
+ * @file tac_engine_bench.c
+ * @brief Dispatch benchmark for the TAC Engine
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ *
+ * Runs a handful of hand-built TAC kernels under each execution mode
+ * (interpreter, pre-decoded, superinstructions, bytecode VM, x86-64 JIT)
+ * and reports instructions per second. Kernels without memory operations
+ * are also translated to C with tac_cgen, built with the system compiler
+ * ($CC, default cc) and run natively; every variable the native program
+ * reports must match tac_engine_run(), and the row shows the speedup over
+ * the interpreter and the JIT. All kernels then run as one batch through
+ * tac_engine_run_batch(), on one thread and on every online CPU, for the
+ * aggregate throughput. Short memory kernels are then rerun many times
+ * from one warmed-up state, comparing fresh engines against
+ * tac_engine_restore() and tac_engine_fork() and counting the pages each
+ * run copies on write. Each kernel is rerun interpreted with a breakpoint
+ * on its last instruction, with a counting instruction hook and with
+ * watchpoints it never hits, checking the result, the single stop and the
+ * hook count. Each kernel is then traced to a binary trace file
+ * (tac_engine_trace_to_file()) and read back, comparing interpreted run
+ * time with and without the trace and reporting its size per step.
+ * Each kernel is also recorded (tac_engine_record_to_file()) and replayed
+ * twice, from the start and after seeking back to its middle step.
+ * Finally the hottest opcode pairs of each kernel
+ * from the pair profiler are listed ('*' marks pairs fused by a
+ * superinstruction), with the hottest branch and per-function figures
+ * from the execution profiler; its folded stacks are written to
+ * build/profile/<kernel>.folded. Results go to stderr so the engine's debug output on
+ * stdout can be discarded: make bench > /dev/null
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "tac_engine.h"
+#include "tac_cgen.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#define BENCH_MAX_CODE 64
+#define BENCH_MAX_FUNCTIONS 4
+
+#define INSN(op, res, a, b) \
+    ((TACInstruction){(op), TAC_FLAG_NONE, (res), (a), (b)})
+#define NONE TAC_OPERAND_NONE
+#define T(id) TAC_MAKE_TEMP(id)
+#define V(id) TAC_MAKE_VAR(id)
+#define I(val) TAC_MAKE_IMMEDIATE(val)
+#define L(id) TAC_MAKE_LABEL(id)
+#define FUNC(at, first, params) \
+    ((TACFunction){0, (TACIdx_t)((at) + 1), 0, 0, (params), 0, 0, (first)})
+
+typedef struct bench_kernel {
+    const char* name;
+    TACInstruction code[BENCH_MAX_CODE];
+    uint32_t count;
+    TACFunction functions[BENCH_MAX_FUNCTIONS]; // Records of the called functions
+    uint32_t function_count;
+    uint16_t result_var;       // Variable holding the kernel result
+    int (*setup)(tac_engine_t* engine);  // Optional: prepare memory after load
+} bench_kernel_t;
+
+#define BENCH_ARRAY_LEN   1024
+#define BENCH_LIST_LEN    1024
+#define BENCH_MEM_ROUNDS  200
+
+// =============================================================================
+// KERNELS
+// =============================================================================
+
+// sum = 0; for (i = 0; i < n; i++) sum += i;
+static uint32_t build_loop_sum(TACInstruction* c, int32_t n) {
+    uint32_t k = 0;
+    c[k++] = INSN(TAC_ASSIGN, V(0), I(0), NONE);
+    c[k++] = INSN(TAC_ASSIGN, V(1), I(0), NONE);
+    c[k++] = INSN(TAC_LABEL, L(1), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(1), V(1), I(n));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(1), L(2));
+    c[k++] = INSN(TAC_ADD, V(0), V(0), V(1));
+    c[k++] = INSN(TAC_ADD, V(1), V(1), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(1), NONE);
+    c[k++] = INSN(TAC_LABEL, L(2), NONE, NONE);
+    return k;
+}
+
+// for (i = 0; i < n; i++) for (j = 0; j < n; j++) acc ^= i * j;
+static uint32_t build_nested_loops(TACInstruction* c, int32_t n) {
+    uint32_t k = 0;
+    c[k++] = INSN(TAC_ASSIGN, V(0), I(0), NONE);
+    c[k++] = INSN(TAC_ASSIGN, V(1), I(0), NONE);
+    c[k++] = INSN(TAC_LABEL, L(1), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(1), V(1), I(n));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(1), L(4));
+    c[k++] = INSN(TAC_ASSIGN, V(2), I(0), NONE);
+    c[k++] = INSN(TAC_LABEL, L(2), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(2), V(2), I(n));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(2), L(3));
+    c[k++] = INSN(TAC_MUL, T(3), V(1), V(2));
+    c[k++] = INSN(TAC_XOR, V(0), V(0), T(3));
+    c[k++] = INSN(TAC_ADD, V(2), V(2), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(2), NONE);
+    c[k++] = INSN(TAC_LABEL, L(3), NONE, NONE);
+    c[k++] = INSN(TAC_ADD, V(1), V(1), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(1), NONE);
+    c[k++] = INSN(TAC_LABEL, L(4), NONE, NONE);
+    return k;
+}
+
+// a = 0; b = 1; repeat n times: t = a + b; a = b; b = t;
+static uint32_t build_fib_iter(TACInstruction* c, int32_t n) {
+    uint32_t k = 0;
+    c[k++] = INSN(TAC_ASSIGN, V(0), I(0), NONE);
+    c[k++] = INSN(TAC_ASSIGN, V(1), I(1), NONE);
+    c[k++] = INSN(TAC_ASSIGN, V(2), I(0), NONE);
+    c[k++] = INSN(TAC_LABEL, L(1), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(1), V(2), I(n));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(1), L(2));
+    c[k++] = INSN(TAC_ADD, T(2), V(0), V(1));
+    c[k++] = INSN(TAC_ASSIGN, V(0), V(1), NONE);
+    c[k++] = INSN(TAC_ASSIGN, V(1), T(2), NONE);
+    c[k++] = INSN(TAC_ADD, V(2), V(2), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(1), NONE);
+    c[k++] = INSN(TAC_LABEL, L(2), NONE, NONE);
+    return k;
+}
+
+// for (i = 0; i < n; i++) sum += inc(i);  with inc(x) = x + 1
+static uint32_t build_call_heavy(bench_kernel_t* kernel, int32_t n) {
+    TACInstruction* c = kernel->code;
+    uint32_t k = 0;
+    c[k++] = INSN(TAC_ASSIGN, V(0), I(0), NONE);
+    c[k++] = INSN(TAC_ASSIGN, V(1), I(0), NONE);
+    c[k++] = INSN(TAC_LABEL, L(1), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(1), V(1), I(n));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(1), L(2));
+    c[k++] = INSN(TAC_PARAM, NONE, V(1), NONE);
+    c[k++] = INSN(TAC_CALL, T(2), L(10), I(1));
+    c[k++] = INSN(TAC_ADD, V(0), V(0), T(2));
+    c[k++] = INSN(TAC_ADD, V(1), V(1), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(1), NONE);
+    c[k++] = INSN(TAC_LABEL, L(2), NONE, NONE);
+    c[k++] = INSN(TAC_GOTO, NONE, L(3), NONE);
+    kernel->functions[kernel->function_count++] = FUNC(k, 5, 1);
+    c[k++] = INSN(TAC_LABEL, L(10), NONE, NONE);
+    c[k++] = INSN(TAC_ADD, T(5), V(5), I(1));
+    c[k++] = INSN(TAC_RETURN, NONE, T(5), NONE);
+    c[k++] = INSN(TAC_LABEL, L(3), NONE, NONE);
+    return k;
+}
+
+// sum = fib(n);  with fib(x) = x < 2 ? x : fib(x - 1) + fib(x - 2)
+static uint32_t build_fib_rec(bench_kernel_t* kernel, int32_t n) {
+    TACInstruction* c = kernel->code;
+    uint32_t k = 0;
+    c[k++] = INSN(TAC_PARAM, NONE, I(n), NONE);
+    c[k++] = INSN(TAC_CALL, T(1), L(10), I(1));
+    c[k++] = INSN(TAC_ASSIGN, V(0), T(1), NONE);
+    c[k++] = INSN(TAC_GOTO, NONE, L(3), NONE);
+    kernel->functions[kernel->function_count++] = FUNC(k, 5, 1);
+    c[k++] = INSN(TAC_LABEL, L(10), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(2), V(5), I(2));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(2), L(11));
+    c[k++] = INSN(TAC_RETURN, NONE, V(5), NONE);
+    c[k++] = INSN(TAC_LABEL, L(11), NONE, NONE);
+    c[k++] = INSN(TAC_SUB, T(3), V(5), I(1));
+    c[k++] = INSN(TAC_PARAM, NONE, T(3), NONE);
+    c[k++] = INSN(TAC_CALL, T(4), L(10), I(1));
+    c[k++] = INSN(TAC_SUB, T(5), V(5), I(2));
+    c[k++] = INSN(TAC_PARAM, NONE, T(5), NONE);
+    c[k++] = INSN(TAC_CALL, T(6), L(10), I(1));
+    c[k++] = INSN(TAC_ADD, T(7), T(4), T(6));
+    c[k++] = INSN(TAC_RETURN, NONE, T(7), NONE);
+    c[k++] = INSN(TAC_LABEL, L(3), NONE, NONE);
+    return k;
+}
+
+// sum = total(n, 0);  with total(x, acc) = x == 0 ? acc : total(x - 1, acc + x)
+// Deeper than max_call_depth: runs only because the recursive call is a tail call
+static uint32_t build_sum_tail(bench_kernel_t* kernel, int32_t n) {
+    TACInstruction* c = kernel->code;
+    uint32_t k = 0;
+    c[k++] = INSN(TAC_PARAM, NONE, I(n), NONE);
+    c[k++] = INSN(TAC_PARAM, NONE, I(0), NONE);
+    c[k++] = INSN(TAC_CALL, T(1), L(10), I(2));
+    c[k++] = INSN(TAC_ASSIGN, V(0), T(1), NONE);
+    c[k++] = INSN(TAC_GOTO, NONE, L(3), NONE);
+    kernel->functions[kernel->function_count++] = FUNC(k, 5, 2);
+    c[k++] = INSN(TAC_LABEL, L(10), NONE, NONE);
+    c[k++] = INSN(TAC_EQ, T(2), V(5), I(0));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(2), L(11));
+    c[k++] = INSN(TAC_RETURN, NONE, V(6), NONE);
+    c[k++] = INSN(TAC_LABEL, L(11), NONE, NONE);
+    c[k++] = INSN(TAC_SUB, T(3), V(5), I(1));
+    c[k++] = INSN(TAC_ADD, T(4), V(6), V(5));
+    c[k++] = INSN(TAC_PARAM, NONE, T(3), NONE);
+    c[k++] = INSN(TAC_PARAM, NONE, T(4), NONE);
+    c[k++] = INSN(TAC_CALL, T(5), L(10), I(2));
+    c[k++] = INSN(TAC_RETURN, NONE, T(5), NONE);
+    c[k++] = INSN(TAC_LABEL, L(3), NONE, NONE);
+    return k;
+}
+
+// for (i = 0; i < n; i++) sum += square(add_one(i));
+// with add_one(x) = x + 1 and square(x) = x * x: both parameters are v5
+static uint32_t build_square_add_one(bench_kernel_t* kernel, int32_t n) {
+    TACInstruction* c = kernel->code;
+    uint32_t k = 0;
+    c[k++] = INSN(TAC_ASSIGN, V(0), I(0), NONE);
+    c[k++] = INSN(TAC_ASSIGN, V(1), I(0), NONE);
+    c[k++] = INSN(TAC_LABEL, L(1), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(1), V(1), I(n));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(1), L(2));
+    c[k++] = INSN(TAC_PARAM, NONE, V(1), NONE);
+    c[k++] = INSN(TAC_CALL, T(2), L(10), I(1));
+    c[k++] = INSN(TAC_PARAM, NONE, T(2), NONE);
+    c[k++] = INSN(TAC_CALL, T(3), L(11), I(1));
+    c[k++] = INSN(TAC_ADD, V(0), V(0), T(3));
+    c[k++] = INSN(TAC_ADD, V(1), V(1), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(1), NONE);
+    c[k++] = INSN(TAC_LABEL, L(2), NONE, NONE);
+    c[k++] = INSN(TAC_GOTO, NONE, L(3), NONE);
+    kernel->functions[kernel->function_count++] = FUNC(k, 5, 1);
+    c[k++] = INSN(TAC_LABEL, L(10), NONE, NONE);
+    c[k++] = INSN(TAC_ADD, T(5), V(5), I(1));
+    c[k++] = INSN(TAC_RETURN, NONE, T(5), NONE);
+    kernel->functions[kernel->function_count++] = FUNC(k, 5, 1);
+    c[k++] = INSN(TAC_LABEL, L(11), NONE, NONE);
+    c[k++] = INSN(TAC_MUL, T(6), V(5), V(5));
+    c[k++] = INSN(TAC_RETURN, NONE, T(6), NONE);
+    c[k++] = INSN(TAC_LABEL, L(3), NONE, NONE);
+    return k;
+}
+
+// v3 = int[BENCH_ARRAY_LEN]; repeat: for (i...) { v3[i] = i; sum += v3[i]; }
+static uint32_t build_array_sum(TACInstruction* c, int32_t rounds) {
+    uint32_t k = 0;
+    c[k++] = INSN(TAC_ASSIGN, V(0), I(0), NONE);
+    c[k++] = INSN(TAC_ASSIGN, V(4), I(0), NONE);
+    c[k++] = INSN(TAC_LABEL, L(1), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(1), V(4), I(rounds));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(1), L(4));
+    c[k++] = INSN(TAC_ASSIGN, V(1), I(0), NONE);
+    c[k++] = INSN(TAC_LABEL, L(2), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(2), V(1), I(BENCH_ARRAY_LEN));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(2), L(3));
+    c[k++] = INSN(TAC_MUL, T(3), V(1), I(4));
+    c[k++] = INSN(TAC_ADD, T(4), V(3), T(3));
+    c[k++] = INSN(TAC_STORE, T(4), V(1), NONE);
+    c[k++] = INSN(TAC_INDEX, T(5), V(3), V(1));
+    c[k++] = INSN(TAC_ADD, V(0), V(0), T(5));
+    c[k++] = INSN(TAC_ADD, V(1), V(1), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(2), NONE);
+    c[k++] = INSN(TAC_LABEL, L(3), NONE, NONE);
+    c[k++] = INSN(TAC_ADD, V(4), V(4), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(1), NONE);
+    c[k++] = INSN(TAC_LABEL, L(4), NONE, NONE);
+    return k;
+}
+
+// v3 = list head; repeat: for (p = v3; p; p = p->next) sum += p->value;
+static uint32_t build_list_walk(TACInstruction* c, int32_t rounds) {
+    uint32_t k = 0;
+    c[k++] = INSN(TAC_ASSIGN, V(0), I(0), NONE);
+    c[k++] = INSN(TAC_ASSIGN, V(4), I(0), NONE);
+    c[k++] = INSN(TAC_LABEL, L(1), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(1), V(4), I(rounds));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(1), L(4));
+    c[k++] = INSN(TAC_ASSIGN, V(1), V(3), NONE);
+    c[k++] = INSN(TAC_LABEL, L(2), NONE, NONE);
+    c[k++] = INSN(TAC_NE, T(2), V(1), I(0));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(2), L(3));
+    c[k++] = INSN(TAC_LOAD, T(3), V(1), NONE);
+    c[k++] = INSN(TAC_ADD, V(0), V(0), T(3));
+    c[k++] = INSN(TAC_ADD, T(4), V(1), I(4));
+    c[k++] = INSN(TAC_LOAD, V(1), T(4), NONE);
+    c[k++] = INSN(TAC_GOTO, NONE, L(2), NONE);
+    c[k++] = INSN(TAC_LABEL, L(3), NONE, NONE);
+    c[k++] = INSN(TAC_ADD, V(4), V(4), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(1), NONE);
+    c[k++] = INSN(TAC_LABEL, L(4), NONE, NONE);
+    return k;
+}
+
+// v3 = int[BENCH_ARRAY_LEN]; repeat: count the primes below BENCH_ARRAY_LEN
+static uint32_t build_sieve(TACInstruction* c, int32_t rounds) {
+    uint32_t k = 0;
+    c[k++] = INSN(TAC_ASSIGN, V(4), I(0), NONE);
+    c[k++] = INSN(TAC_LABEL, L(1), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(1), V(4), I(rounds));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(1), L(7));
+    c[k++] = INSN(TAC_ASSIGN, V(1), I(0), NONE);
+    c[k++] = INSN(TAC_LABEL, L(2), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(2), V(1), I(BENCH_ARRAY_LEN));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(2), L(3));
+    c[k++] = INSN(TAC_MUL, T(3), V(1), I(4));
+    c[k++] = INSN(TAC_ADD, T(3), V(3), T(3));
+    c[k++] = INSN(TAC_STORE, T(3), I(0), NONE);
+    c[k++] = INSN(TAC_ADD, V(1), V(1), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(2), NONE);
+    c[k++] = INSN(TAC_LABEL, L(3), NONE, NONE);
+    c[k++] = INSN(TAC_ASSIGN, V(0), I(0), NONE);
+    c[k++] = INSN(TAC_ASSIGN, V(1), I(2), NONE);
+    c[k++] = INSN(TAC_LABEL, L(4), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(4), V(1), I(BENCH_ARRAY_LEN));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(4), L(6));
+    c[k++] = INSN(TAC_MUL, T(5), V(1), I(4));
+    c[k++] = INSN(TAC_ADD, T(5), V(3), T(5));
+    c[k++] = INSN(TAC_LOAD, T(6), T(5), NONE);
+    c[k++] = INSN(TAC_IF_TRUE, NONE, T(6), L(5));
+    c[k++] = INSN(TAC_ADD, V(0), V(0), I(1));
+    c[k++] = INSN(TAC_MUL, V(2), V(1), V(1));
+    c[k++] = INSN(TAC_LABEL, L(8), NONE, NONE);
+    c[k++] = INSN(TAC_LT, T(7), V(2), I(BENCH_ARRAY_LEN));
+    c[k++] = INSN(TAC_IF_FALSE, NONE, T(7), L(5));
+    c[k++] = INSN(TAC_MUL, T(8), V(2), I(4));
+    c[k++] = INSN(TAC_ADD, T(8), V(3), T(8));
+    c[k++] = INSN(TAC_STORE, T(8), I(1), NONE);
+    c[k++] = INSN(TAC_ADD, V(2), V(2), V(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(8), NONE);
+    c[k++] = INSN(TAC_LABEL, L(5), NONE, NONE);
+    c[k++] = INSN(TAC_ADD, V(1), V(1), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(4), NONE);
+    c[k++] = INSN(TAC_LABEL, L(6), NONE, NONE);
+    c[k++] = INSN(TAC_ADD, V(4), V(4), I(1));
+    c[k++] = INSN(TAC_GOTO, NONE, L(1), NONE);
+    c[k++] = INSN(TAC_LABEL, L(7), NONE, NONE);
+    return k;
+}
+
+static int setup_array(tac_engine_t* engine) {
+    uint32_t base = tac_engine_malloc(engine, BENCH_ARRAY_LEN * 4);
+    if (!base) {
+        return -1;
+    }
+    tac_value_t value = tac_value_int32((int32_t)base);
+    return tac_engine_set_var(engine, 3, &value) == TAC_ENGINE_OK ? 0 : -1;
+}
+
+// Nodes are { int32 value; uint32 next; }, allocated individually
+static int setup_list(tac_engine_t* engine) {
+    uint32_t head = 0;
+    for (int32_t i = 0; i < BENCH_LIST_LEN; i++) {
+        uint32_t node[2] = { (uint32_t)i, head };
+        uint32_t address = tac_engine_malloc(engine, sizeof(node));
+        if (!address || tac_engine_mem_write(engine, address, node, sizeof(node)) != TAC_ENGINE_OK) {
+            return -1;
+        }
+        head = address;
+    }
+    tac_value_t value = tac_value_int32((int32_t)head);
+    return tac_engine_set_var(engine, 3, &value) == TAC_ENGINE_OK ? 0 : -1;
+}
+
+// =============================================================================
+// DRIVER
+// =============================================================================
+
+typedef struct bench_mode {
+    const char* name;
+    tac_engine_exec_mode_t exec_mode;
+    bool superinstructions;
+} bench_mode_t;
+
+static const bench_mode_t bench_modes[] = {
+    { "interpret",  TAC_EXEC_INTERPRET,  false },
+    { "predecoded", TAC_EXEC_PREDECODED, false },
+    { "superinsn",  TAC_EXEC_PREDECODED, true },
+    { "bytecode",   TAC_EXEC_BYTECODE,   false },
+    { "jit",        TAC_EXEC_JIT,        false },
+    { "tiered",     TAC_EXEC_TIERED,     true },
+};
+
+#define BENCH_TOP_PAIRS 3
+
+static tac_engine_error_t load_kernel(tac_engine_t* engine, const bench_kernel_t* kernel) {
+    return tac_engine_load_program(engine, kernel->code, kernel->count,
+                                   kernel->functions, kernel->function_count);
+}
+
+/**
+ * @brief Run a kernel once in the given mode
+ * @return 0 on success, -1 on engine failure
+ */
+static int run_kernel(const bench_kernel_t* kernel, const bench_mode_t* mode,
+                      uint32_t* steps, double* seconds, int32_t* result) {
+    tac_engine_config_t config = tac_engine_default_config();
+    config.max_steps = UINT32_MAX;
+    config.exec_mode = mode->exec_mode;
+    config.enable_superinstructions = mode->superinstructions;
+
+    tac_engine_t* engine = tac_engine_create(&config);
+    if (!engine) {
+        return -1;
+    }
+
+    if (load_kernel(engine, kernel) != TAC_ENGINE_OK ||
+        (kernel->setup && kernel->setup(engine) != 0)) {
+        tac_engine_destroy(engine);
+        return -1;
+    }
+
+    clock_t start = clock();
+    tac_engine_error_t err = tac_engine_run(engine);
+    clock_t end = clock();
+
+    tac_value_t value;
+    if (err != TAC_ENGINE_OK ||
+        tac_engine_get_var(engine, kernel->result_var, &value) != TAC_ENGINE_OK) {
+        fprintf(stderr, "%s/%s: %s\n", kernel->name, mode->name,
+                tac_engine_error_string(err));
+        tac_engine_destroy(engine);
+        return -1;
+    }
+
+    *steps = tac_engine_get_step_count(engine);
+    *seconds = (double)(end - start) / CLOCKS_PER_SEC;
+    *result = value.data.i32;
+
+    tac_engine_destroy(engine);
+    return 0;
+}
+
+#define BENCH_PROFILE_DIR "build/profile"
+
+/**
+ * @brief Print the hottest branch and the functions of a profiled kernel,
+ *        and write its folded stacks to BENCH_PROFILE_DIR
+ * @return 0 if the profile accounts for every step, -1 otherwise
+ */
+static int report_profile(tac_engine_t* engine, const bench_kernel_t* kernel, uint32_t steps) {
+    tac_profile_t profile;
+    if (tac_engine_get_profile(engine, &profile) != TAC_ENGINE_OK) {
+        return -1;
+    }
+
+    uint64_t executed = 0;
+    uint32_t branch = UINT32_MAX;
+    for (uint32_t i = 0; i < profile.instruction_count; i++) {
+        executed += profile.executed[i];
+        TACOpcode opcode = kernel->code[i].opcode;
+        if ((opcode == TAC_IF_TRUE || opcode == TAC_IF_FALSE) &&
+            (branch == UINT32_MAX || profile.executed[i] > profile.executed[branch])) {
+            branch = i;
+        }
+    }
+    if (branch != UINT32_MAX && profile.executed[branch] > 0) {
+        fprintf(stderr, "%14s  branch @%u taken %.1f%% of %llu\n", "", branch,
+                100.0 * (double)profile.taken[branch] / (double)profile.executed[branch],
+                (unsigned long long)profile.executed[branch]);
+    }
+    for (uint32_t f = 0; f < profile.function_count; f++) {
+        const tac_function_profile_t* info = &profile.functions[f];
+        fprintf(stderr, "%14s  function @%-3u %9llu calls  self %5.1f%%  total %5.1f%%\n", "",
+                info->entry, (unsigned long long)info->calls,
+                steps ? 100.0 * (double)info->self_steps / steps : 0.0,
+                steps ? 100.0 * (double)info->total_steps / steps : 0.0);
+    }
+
+    char path[128];
+    snprintf(path, sizeof(path), "%s/%s.folded", BENCH_PROFILE_DIR, kernel->name);
+    mkdir(BENCH_PROFILE_DIR, 0777);
+    FILE* out = fopen(path, "w");
+    if (out) {
+        tac_engine_write_folded_stacks(engine, out);
+        fclose(out);
+    }
+
+    const tac_function_profile_t* top = &profile.functions[profile.function_count];
+    return (executed == steps && top->total_steps == steps) ? 0 : -1;
+}
+
+/**
+ * @brief Print the hottest opcode pairs of a kernel, then its profile
+ * @return 0 on success, -1 on engine failure
+ */
+static int profile_kernel(const bench_kernel_t* kernel) {
+    tac_engine_config_t config = tac_engine_default_config();
+    config.max_steps = UINT32_MAX;
+    config.enable_pair_profile = true;
+    config.enable_profile = true;
+
+    tac_engine_t* engine = tac_engine_create(&config);
+    if (!engine) {
+        return -1;
+    }
+
+    tac_pair_stat_t pairs[BENCH_TOP_PAIRS];
+    uint32_t count = 0;
+    if (load_kernel(engine, kernel) != TAC_ENGINE_OK ||
+        (kernel->setup && kernel->setup(engine) != 0) ||
+        tac_engine_run(engine) != TAC_ENGINE_OK ||
+        tac_engine_get_pair_profile(engine, pairs, BENCH_TOP_PAIRS, &count) != TAC_ENGINE_OK) {
+        tac_engine_destroy(engine);
+        return -1;
+    }
+
+    uint32_t steps = tac_engine_get_step_count(engine);
+    fprintf(stderr, "%-14s", kernel->name);
+    for (uint32_t i = 0; i < count; i++) {
+        fprintf(stderr, "  0x%02x>0x%02x%c %5.1f%%",
+                (unsigned)pairs[i].first, (unsigned)pairs[i].second,
+                pairs[i].fused ? '*' : ' ',
+                steps ? 100.0 * (double)pairs[i].count / steps : 0.0);
+    }
+    fprintf(stderr, "\n");
+
+    int result = report_profile(engine, kernel, steps);
+    tac_engine_destroy(engine);
+    return result;
+}
+
+// =============================================================================
+// NATIVE (AHEAD-OF-TIME C)
+// =============================================================================
+
+#define BENCH_AOT_DIR "build/aot"
+
+/**
+ * @brief Translate a kernel to C, build it and diff it against the engine
+ * @param steps Steps of the reference run, so rows stay comparable
+ * @return 0 on success, 1 if the kernel was skipped, -1 on a mismatch
+ */
+static int run_native(const bench_kernel_t* kernel, uint32_t* steps, double* seconds) {
+    char source[128];
+    char binary[128];
+    char command[512];
+    char error[128];
+
+    snprintf(source, sizeof(source), "%s/%s.c", BENCH_AOT_DIR, kernel->name);
+    snprintf(binary, sizeof(binary), "%s/%s", BENCH_AOT_DIR, kernel->name);
+    mkdir(BENCH_AOT_DIR, 0777);
+
+    FILE* out = fopen(source, "w");
+    if (!out) {
+        fprintf(stderr, "%-14s %-12s skipped: cannot write %s\n", kernel->name, "native", source);
+        return 1;
+    }
+    TACCGenOptions options = { 0, kernel->name, kernel->functions, kernel->function_count };
+    int translated = tac_cgen_emit(out, kernel->code, kernel->count, &options,
+                                   error, sizeof(error));
+    fclose(out);
+    if (translated != 0) {
+        fprintf(stderr, "%-14s %-12s skipped: %s\n", kernel->name, "native", error);
+        return 1;
+    }
+
+    const char* cc = getenv("CC");
+    snprintf(command, sizeof(command), "%s -O2 -o %s %s", (cc && *cc) ? cc : "cc",
+             binary, source);
+    if (system(command) != 0) {
+        fprintf(stderr, "%-14s %-12s skipped: '%s' failed\n", kernel->name, "native", command);
+        return 1;
+    }
+
+    // Reference run; the native program must agree on every variable it reports
+    tac_engine_config_t config = tac_engine_default_config();
+    config.max_steps = UINT32_MAX;
+    tac_engine_t* engine = tac_engine_create(&config);
+    if (!engine || load_kernel(engine, kernel) != TAC_ENGINE_OK) {
+        tac_engine_destroy(engine);
+        return -1;
+    }
+    tac_engine_error_t err = tac_engine_run(engine);
+    *steps = tac_engine_get_step_count(engine);
+
+    FILE* pipe = popen(binary, "r");
+    if (!pipe) {
+        tac_engine_destroy(engine);
+        return -1;
+    }
+
+    char line[128];
+    int mismatches = 0;
+    bool trapped = false;
+    *seconds = 0.0;
+    while (fgets(line, sizeof(line), pipe)) {
+        unsigned id;
+        int value;
+        tac_value_t expected;
+
+        if (sscanf(line, "v%u %d", &id, &value) == 2) {
+            if (tac_engine_get_var(engine, (uint16_t)id, &expected) != TAC_ENGINE_OK ||
+                expected.data.i32 != value) {
+                fprintf(stderr, "%s/native: v%u is %d, engine has %d\n",
+                        kernel->name, id, value, expected.data.i32);
+                mismatches++;
+            }
+        } else if (strncmp(line, "error ", 6) == 0) {
+            trapped = true;
+        } else if (sscanf(line, "seconds %lf", seconds) != 1) {
+            mismatches++;
+        }
+    }
+    if (pclose(pipe) != 0 && !trapped) {
+        mismatches++;
+    }
+    if (trapped != (err != TAC_ENGINE_OK)) {
+        fprintf(stderr, "%s/native: engine says '%s', native program %s\n", kernel->name,
+                tac_engine_error_string(err), trapped ? "trapped" : "finished");
+        mismatches++;
+    }
+
+    tac_engine_destroy(engine);
+    return mismatches ? -1 : 0;
+}
+
+// =============================================================================
+// BATCH THROUGHPUT
+// =============================================================================
+
+#define BENCH_BATCH_ROUNDS 4
+
+typedef struct bench_batch_slot {
+    const bench_kernel_t* kernel;
+    int32_t expected;
+    int32_t result;
+} bench_batch_slot_t;
+
+static tac_engine_error_t batch_prepare(tac_engine_t* engine, void* user_data) {
+    const bench_batch_slot_t* slot = user_data;
+    if (slot->kernel->setup && slot->kernel->setup(engine) != 0) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+    return TAC_ENGINE_OK;
+}
+
+static void batch_finish(tac_engine_t* engine, void* user_data) {
+    bench_batch_slot_t* slot = user_data;
+    tac_value_t value;
+    if (tac_engine_get_var(engine, slot->kernel->result_var, &value) == TAC_ENGINE_OK) {
+        slot->result = value.data.i32;
+    }
+}
+
+/**
+ * @brief Run every kernel BENCH_BATCH_ROUNDS times as one batch, first on
+ *        one thread and then on all online CPUs
+ * @return Number of jobs that failed or computed a different result
+ */
+static int run_batches(const bench_kernel_t* kernels, const int32_t* expected,
+                       uint32_t kernel_count) {
+    enum { jobs_max = 8 * BENCH_BATCH_ROUNDS };
+    tac_batch_job_t jobs[jobs_max];
+    bench_batch_slot_t slots[jobs_max];
+    const uint32_t thread_counts[] = { 1, 0 };
+    uint32_t job_count = kernel_count * BENCH_BATCH_ROUNDS;
+    double single = 0.0;
+    int failures = 0;
+
+    if (job_count > jobs_max) {
+        job_count = jobs_max;
+    }
+
+    tac_engine_config_t config = tac_engine_default_config();
+    config.max_steps = UINT32_MAX;
+    config.exec_mode = TAC_EXEC_PREDECODED;
+
+    fprintf(stderr, "\nbatch of %u jobs (predecoded, one engine per job)\n", job_count);
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++) {
+        for (uint32_t j = 0; j < job_count; j++) {
+            slots[j] = (bench_batch_slot_t){ &kernels[j % kernel_count],
+                                             expected[j % kernel_count], 0 };
+            jobs[j] = (tac_batch_job_t){ kernels[j % kernel_count].code,
+                                         kernels[j % kernel_count].count,
+                                         kernels[j % kernel_count].functions,
+                                         kernels[j % kernel_count].function_count,
+                                         batch_prepare, batch_finish, &slots[j],
+                                         TAC_ENGINE_OK, 0 };
+        }
+
+        tac_batch_stats_t stats;
+        if (tac_engine_run_batch(&config, jobs, job_count, thread_counts[t], &stats) != TAC_ENGINE_OK) {
+            return (int)job_count;
+        }
+        for (uint32_t j = 0; j < job_count; j++) {
+            if (jobs[j].error != TAC_ENGINE_OK || slots[j].result != slots[j].expected) {
+                fprintf(stderr, "batch job %u (%s): %s, result %d, expected %d\n", j,
+                        slots[j].kernel->name, tac_engine_error_string(jobs[j].error),
+                        slots[j].result, slots[j].expected);
+                failures++;
+            }
+        }
+
+        if (t == 0) {
+            single = stats.seconds;
+        }
+        fprintf(stderr, "%3u thread%s %12llu steps %10.3f s %14.0f insns/sec  x%.2f\n",
+                stats.threads, stats.threads == 1 ? " " : "s",
+                (unsigned long long)stats.steps, stats.seconds, stats.steps_per_second,
+                stats.seconds > 0.0 ? single / stats.seconds : 0.0);
+    }
+    return failures;
+}
+
+#define BENCH_TRACE_DIR "build/trace"
+
+/**
+ * @brief Run a kernel interpreted with and without a trace file, then read
+ *        the trace back and check it has one record per consecutive step
+ * @return 0 on success, -1 on failure
+ */
+static int run_trace(const bench_kernel_t* kernel) {
+    tac_engine_config_t config = tac_engine_default_config();
+    config.max_steps = UINT32_MAX;
+
+    char path[128];
+    snprintf(path, sizeof(path), "%s/%s.trace", BENCH_TRACE_DIR, kernel->name);
+    mkdir(BENCH_TRACE_DIR, 0777);
+
+    double seconds[2] = { 0.0, 0.0 };
+    uint32_t steps = 0;
+    for (int traced = 0; traced < 2; traced++) {
+        tac_engine_t* engine = tac_engine_create(&config);
+        if (!engine || load_kernel(engine, kernel) != TAC_ENGINE_OK ||
+            (kernel->setup && kernel->setup(engine) != 0) ||
+            (traced && tac_engine_trace_to_file(engine, path) != TAC_ENGINE_OK)) {
+            tac_engine_destroy(engine);
+            return -1;
+        }
+
+        clock_t start = clock();
+        tac_engine_error_t err = tac_engine_run(engine);
+        if (err == TAC_ENGINE_OK && traced) {
+            err = tac_engine_trace_stop(engine);
+        }
+        seconds[traced] = (double)(clock() - start) / CLOCKS_PER_SEC;
+        steps = tac_engine_get_step_count(engine);
+        tac_engine_destroy(engine);
+        if (err != TAC_ENGINE_OK) {
+            return -1;
+        }
+    }
+
+    tac_trace_reader_t* reader = tac_trace_reader_open(path);
+    if (!reader) {
+        return -1;
+    }
+    tac_trace_record_t record;
+    tac_engine_error_t err;
+    uint64_t records = 0;
+    uint64_t changes = 0;
+    while ((err = tac_trace_reader_next(reader, &record)) == TAC_ENGINE_OK &&
+           record.step == records && record.address < kernel->count) {
+        records++;
+        changes += record.changed;
+    }
+    tac_trace_reader_close(reader);
+
+    struct stat st;
+    double bytes = stat(path, &st) == 0 ? (double)st.st_size : 0.0;
+    fprintf(stderr, "%-14s %12u steps %10.3f s untraced %10.3f s traced  %5.2f bytes/step"
+                    "  %4.1f%% changes\n",
+            kernel->name, steps, seconds[0], seconds[1],
+            steps ? bytes / steps : 0.0, steps ? 100.0 * (double)changes / steps : 0.0);
+
+    return (err == TAC_ENGINE_ERR_NOT_FOUND && records == steps) ? 0 : -1;
+}
+
+#define BENCH_REPLAY_INTERVAL (1u << 20)
+
+/**
+ * @brief Record a kernel (setup included) in its fastest mode, replay the
+ *        log, then seek back to the middle and replay to the end again
+ * @return 0 on success, -1 on failure or a different result or step count
+ */
+static int run_replay(const bench_kernel_t* kernel, int32_t reference) {
+    tac_engine_config_t config = tac_engine_default_config();
+    config.max_steps = UINT32_MAX;
+    config.exec_mode = TAC_EXEC_PREDECODED;
+
+    char path[128];
+    snprintf(path, sizeof(path), "%s/%s.rec", BENCH_TRACE_DIR, kernel->name);
+    mkdir(BENCH_TRACE_DIR, 0777);
+
+    tac_engine_t* engine = tac_engine_create(&config);
+    if (!engine || load_kernel(engine, kernel) != TAC_ENGINE_OK ||
+        tac_engine_record_to_file(engine, path) != TAC_ENGINE_OK ||
+        (kernel->setup && kernel->setup(engine) != 0)) {
+        tac_engine_destroy(engine);
+        return -1;
+    }
+    clock_t start = clock();
+    tac_engine_error_t err = tac_engine_run(engine);
+    double recorded = (double)(clock() - start) / CLOCKS_PER_SEC;
+    uint32_t steps = tac_engine_get_step_count(engine);
+    if (err == TAC_ENGINE_OK) {
+        err = tac_engine_record_stop(engine);
+    }
+    tac_engine_destroy(engine);
+    if (err != TAC_ENGINE_OK) {
+        return -1;
+    }
+
+    engine = tac_engine_create(&config);
+    tac_replay_t* replay = NULL;
+    if (!engine || load_kernel(engine, kernel) != TAC_ENGINE_OK ||
+        tac_replay_open(engine, path, BENCH_REPLAY_INTERVAL, &replay) != TAC_ENGINE_OK) {
+        tac_engine_destroy(engine);
+        return -1;
+    }
+
+    int status = 0;
+    double seconds[2] = { 0.0, 0.0 };
+    for (int pass = 0; pass < 2; pass++) {
+        start = clock();
+        err = pass ? tac_replay_seek(replay, steps / 2) : TAC_ENGINE_OK;
+        if (err == TAC_ENGINE_OK) {
+            err = tac_replay_run(replay);
+        }
+        seconds[pass] = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        tac_value_t value = { 0 };
+        tac_engine_get_var(engine, kernel->result_var, &value);
+        if (err != TAC_ENGINE_OK || value.data.i32 != reference ||
+            tac_engine_get_step_count(engine) != steps) {
+            status = -1;
+        }
+    }
+    tac_replay_close(replay);
+    tac_engine_destroy(engine);
+
+    struct stat st;
+    fprintf(stderr, "%-14s %12u steps %10.3f s recorded %10.3f s replayed %10.3f s from middle"
+                    "  %6lld bytes\n",
+            kernel->name, steps, recorded, seconds[0], seconds[1],
+            stat(path, &st) == 0 ? (long long)st.st_size : -1LL);
+    return status;
+}
+
+static bool count_hook(tac_engine_t* engine, tac_hook_type_t type, uint32_t address,
+                       void* user_data) {
+    (void)engine;
+    (void)type;
+    (void)address;
+    (*(uint64_t*)user_data)++;
+    return true;
+}
+
+/**
+ * @brief Run a kernel interpreted without instrumentation, with a breakpoint
+ *        on its last instruction, with an instruction hook and with
+ *        watchpoints on a variable and a memory range it never writes
+ * @return 0 if every run matches the reference, the breakpoint stops once,
+ *         the hook sees every step and no watchpoint hits; -1 otherwise
+ */
+static int run_debug(const bench_kernel_t* kernel, int32_t reference) {
+    tac_engine_config_t config = tac_engine_default_config();
+    config.max_steps = UINT32_MAX;
+
+    double seconds[4] = { 0.0, 0.0, 0.0, 0.0 };
+    uint32_t steps = 0;
+    uint32_t stops = 0;
+    uint64_t hook_calls = 0;
+    int failures = 0;
+
+    for (int variant = 0; variant < 4; variant++) {
+        tac_engine_t* engine = tac_engine_create(&config);
+        if (!engine || load_kernel(engine, kernel) != TAC_ENGINE_OK ||
+            (kernel->setup && kernel->setup(engine) != 0) ||
+            (variant == 1 && tac_engine_add_breakpoint(engine, kernel->count - 1) != TAC_ENGINE_OK) ||
+            (variant == 2 && tac_engine_add_hook(engine, TAC_HOOK_INSTRUCTION, count_hook,
+                                                 &hook_calls) == 0) ||
+            (variant == 3 && (tac_engine_add_watchpoint(engine, TAC_WATCH_VARIABLE,
+                                                        config.max_variables - 1, 0) == 0 ||
+                              tac_engine_add_watchpoint(engine, TAC_WATCH_MEMORY,
+                                                        config.max_memory_size / 2, 64) == 0))) {
+            tac_engine_destroy(engine);
+            return -1;
+        }
+
+        clock_t start = clock();
+        tac_engine_error_t err = tac_engine_run(engine);
+        while (err == TAC_ENGINE_ERR_BREAKPOINT) {
+            stops++;
+            err = tac_engine_run(engine);
+        }
+        seconds[variant] = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        tac_value_t value = tac_value_int32(0);
+        if (err != TAC_ENGINE_OK ||
+            tac_engine_get_var(engine, kernel->result_var, &value) != TAC_ENGINE_OK ||
+            value.data.i32 != reference ||
+            (variant > 0 && tac_engine_get_step_count(engine) != steps)) {
+            failures++;
+        }
+        steps = tac_engine_get_step_count(engine);
+        tac_engine_destroy(engine);
+    }
+
+    fprintf(stderr, "%-14s %12u steps %8.3f s plain %8.3f s breakpoint %8.3f s hook"
+                    " %8.3f s watch\n",
+            kernel->name, steps, seconds[0], seconds[1], seconds[2], seconds[3]);
+    return (failures == 0 && stops == 1 && hook_calls == steps) ? 0 : -1;
+}
+
+#define BENCH_SNAPSHOT_RUNS 2000
+
+typedef enum bench_reset {
+    BENCH_RESET_FRESH,         // New engine, load and setup every run
+    BENCH_RESET_RESTORE,       // Restore one engine to the warmed-up snapshot
+    BENCH_RESET_FORK           // Fork the warmed-up engine every run
+} bench_reset_t;
+
+/**
+ * @brief Run a kernel BENCH_SNAPSHOT_RUNS times from the same starting state
+ * @return 0 if every run produced expected (or set it, if *expected < 0)
+ */
+static int run_resets(const bench_kernel_t* kernel, bench_reset_t reset,
+                      double* seconds, uint32_t* pages_copied, int32_t* expected) {
+    tac_engine_config_t config = tac_engine_default_config();
+    config.max_steps = UINT32_MAX;
+    config.exec_mode = TAC_EXEC_PREDECODED;
+
+    // Warm-up state shared by the restore and fork runs
+    tac_engine_t* warm = tac_engine_create(&config);
+    tac_snapshot_t* snapshot = NULL;
+    if (!warm || load_kernel(warm, kernel) != TAC_ENGINE_OK ||
+        (kernel->setup && kernel->setup(warm) != 0) ||
+        tac_engine_snapshot(warm, &snapshot) != TAC_ENGINE_OK) {
+        tac_engine_destroy(warm);
+        return -1;
+    }
+
+    int failures = 0;
+    *pages_copied = 0;
+    clock_t start = clock();
+    for (uint32_t r = 0; r < BENCH_SNAPSHOT_RUNS && failures == 0; r++) {
+        tac_engine_t* engine = warm;
+        if (reset == BENCH_RESET_FRESH) {
+            engine = tac_engine_create(&config);
+            if (!engine || load_kernel(engine, kernel) != TAC_ENGINE_OK ||
+                (kernel->setup && kernel->setup(engine) != 0)) {
+                engine = engine ? engine : warm;
+                failures++;
+            }
+        } else if (reset == BENCH_RESET_FORK) {
+            engine = tac_engine_fork(warm);
+            if (!engine) {
+                engine = warm;
+                failures++;
+            }
+        } else if (tac_engine_restore(warm, snapshot) != TAC_ENGINE_OK) {
+            failures++;
+        }
+
+        uint32_t copied_before = 0;
+        uint32_t copied_after = 0;
+        tac_value_t value = tac_value_int32(0);
+        tac_engine_get_page_stats(engine, NULL, &copied_before);
+        if (failures == 0 &&
+            (tac_engine_run(engine) != TAC_ENGINE_OK ||
+             tac_engine_get_var(engine, kernel->result_var, &value) != TAC_ENGINE_OK)) {
+            failures++;
+        }
+        tac_engine_get_page_stats(engine, NULL, &copied_after);
+        *pages_copied += copied_after - copied_before;
+
+        if (*expected < 0) {
+            *expected = value.data.i32;
+        } else if (value.data.i32 != *expected) {
+            fprintf(stderr, "%s: run %u result %d, expected %d\n",
+                    kernel->name, r, value.data.i32, *expected);
+            failures++;
+        }
+        if (engine != warm) {
+            tac_engine_destroy(engine);
+        }
+    }
+    *seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    tac_engine_snapshot_free(snapshot);
+    tac_engine_destroy(warm);
+    return failures;
+}
+
+/**
+ * @brief Compare fresh engines against snapshot restore and fork for short
+ *        memory kernels, where setting up the heap dominates each run
+ * @return Number of kernels that failed or computed a different result
+ */
+static int run_snapshots(void) {
+    static const char* const reset_names[] = { "fresh", "restore", "fork" };
+    static bench_kernel_t kernels[3];
+    int failures = 0;
+
+    kernels[0].name = "array_sum";
+    kernels[0].count = build_array_sum(kernels[0].code, 1);
+    kernels[0].setup = setup_array;
+    kernels[1].name = "list_walk";
+    kernels[1].count = build_list_walk(kernels[1].code, 1);
+    kernels[1].setup = setup_list;
+    kernels[2].name = "sieve";
+    kernels[2].count = build_sieve(kernels[2].code, 1);
+    kernels[2].setup = setup_array;
+
+    fprintf(stderr, "\n%u runs from a warmed-up state (predecoded)\n", BENCH_SNAPSHOT_RUNS);
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        int32_t expected = -1;
+        double fresh_seconds = 0.0;
+
+        for (int reset = BENCH_RESET_FRESH; reset <= BENCH_RESET_FORK; reset++) {
+            double seconds = 0.0;
+            uint32_t pages_copied = 0;
+            if (run_resets(&kernels[k], (bench_reset_t)reset, &seconds, &pages_copied,
+                           &expected) != 0) {
+                fprintf(stderr, "%s/%s: failed\n", kernels[k].name, reset_names[reset]);
+                failures++;
+                continue;
+            }
+            if (reset == BENCH_RESET_FRESH) {
+                fresh_seconds = seconds;
+            }
+            fprintf(stderr, "%-14s %-12s %10.1f us/run %8.2f pages copied/run  x%.1f\n",
+                    kernels[k].name, reset_names[reset],
+                    seconds * 1e6 / BENCH_SNAPSHOT_RUNS,
+                    (double)pages_copied / BENCH_SNAPSHOT_RUNS,
+                    seconds > 0.0 ? fresh_seconds / seconds : 0.0);
+        }
+    }
+    return failures;
+}
+
+int main(void) {
+    static bench_kernel_t kernels[10];
+    int32_t references[10] = { 0 };
+
+    kernels[0].name = "loop_sum";
+    kernels[0].count = build_loop_sum(kernels[0].code, 2000000);
+    kernels[1].name = "nested_loops";
+    kernels[1].count = build_nested_loops(kernels[1].code, 1000);
+    kernels[2].name = "fib_iter";
+    kernels[2].count = build_fib_iter(kernels[2].code, 2000000);
+    kernels[3].name = "call_heavy";
+    kernels[3].count = build_call_heavy(&kernels[3], 100000);
+    kernels[4].name = "array_sum";
+    kernels[4].count = build_array_sum(kernels[4].code, BENCH_MEM_ROUNDS);
+    kernels[4].setup = setup_array;
+    kernels[5].name = "list_walk";
+    kernels[5].count = build_list_walk(kernels[5].code, BENCH_MEM_ROUNDS);
+    kernels[5].setup = setup_list;
+    kernels[6].name = "fib_rec";
+    kernels[6].count = build_fib_rec(&kernels[6], 25);
+    kernels[7].name = "sieve";
+    kernels[7].count = build_sieve(kernels[7].code, BENCH_MEM_ROUNDS);
+    kernels[7].setup = setup_array;
+    kernels[8].name = "sum_tail";
+    kernels[8].count = build_sum_tail(&kernels[8], 50000);
+    kernels[9].name = "square_add_one";
+    kernels[9].count = build_square_add_one(&kernels[9], 1000);
+
+    const size_t mode_count = sizeof(bench_modes) / sizeof(bench_modes[0]);
+    int failures = 0;
+
+    fprintf(stderr, "%-14s %-12s %12s %10s %14s\n",
+            "kernel", "mode", "steps", "seconds", "insns/sec");
+
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        int32_t reference = 0;
+        double interpret_seconds = 0.0;
+        double jit_seconds = 0.0;
+
+        for (size_t m = 0; m < mode_count; m++) {
+            uint32_t steps = 0;
+            double seconds = 0.0;
+            int32_t result = 0;
+
+            if (run_kernel(&kernels[k], &bench_modes[m], &steps, &seconds, &result) != 0) {
+                failures++;
+                continue;
+            }
+            if (bench_modes[m].exec_mode == TAC_EXEC_INTERPRET) {
+                interpret_seconds = seconds;
+            } else if (bench_modes[m].exec_mode == TAC_EXEC_JIT) {
+                jit_seconds = seconds;
+            }
+
+            if (m == 0) {
+                reference = result;
+                references[k] = result;
+            } else if (result != reference) {
+                fprintf(stderr, "%s/%s: result %d differs from %d\n",
+                        kernels[k].name, bench_modes[m].name, result, reference);
+                failures++;
+            }
+
+            fprintf(stderr, "%-14s %-12s %12u %10.3f %14.0f\n",
+                    kernels[k].name, bench_modes[m].name, steps, seconds,
+                    seconds > 0.0 ? (double)steps / seconds : 0.0);
+        }
+
+        uint32_t steps = 0;
+        double seconds = 0.0;
+        int native = run_native(&kernels[k], &steps, &seconds);
+        if (native < 0) {
+            fprintf(stderr, "%s/native: differs from tac_engine_run()\n", kernels[k].name);
+            failures++;
+        } else if (native == 0) {
+            // -O2 may fold whole loops, so the speedup is an upper bound
+            fprintf(stderr, "%-14s %-12s %12u %10.3f %14.0f  x%.0f interpret, x%.1f jit\n",
+                    kernels[k].name, "native", steps, seconds,
+                    seconds > 0.0 ? (double)steps / seconds : 0.0,
+                    seconds > 0.0 ? interpret_seconds / seconds : 0.0,
+                    seconds > 0.0 ? jit_seconds / seconds : 0.0);
+        }
+    }
+
+    failures += run_batches(kernels, references, sizeof(kernels) / sizeof(kernels[0]));
+    failures += run_snapshots();
+
+    fprintf(stderr, "\nbreakpoints, hooks and watchpoints (interpreted)\n");
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        if (run_debug(&kernels[k], references[k]) != 0) {
+            fprintf(stderr, "%s: breakpoint or hook run differs\n", kernels[k].name);
+            failures++;
+        }
+    }
+
+    fprintf(stderr, "\nbinary trace (interpreted, files in " BENCH_TRACE_DIR ")\n");
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        if (run_trace(&kernels[k]) != 0) {
+            fprintf(stderr, "%s: trace does not match the run\n", kernels[k].name);
+            failures++;
+        }
+    }
+
+    fprintf(stderr, "\nrecord and replay (logs in " BENCH_TRACE_DIR ")\n");
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        if (run_replay(&kernels[k], references[k]) != 0) {
+            fprintf(stderr, "%s: replay does not match the recorded run\n", kernels[k].name);
+            failures++;
+        }
+    }
+
+    fprintf(stderr, "\nhottest opcode pairs (share of steps, * = superinstruction), hottest\n"
+                    "branch and functions; folded stacks in " BENCH_PROFILE_DIR "\n");
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        if (profile_kernel(&kernels[k]) != 0) {
+            fprintf(stderr, "%s: pair profile failed\n", kernels[k].name);
+            failures++;
+        }
+    }
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,634 @@
+/**
+ * @file tac_engine_call.c
+ * @brief TAC Engine function metadata, call frames and CALL/RETURN
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * Every CALL target starts a function whose body is the code reachable
+ * from it without following calls. Variables and temporaries referenced
+ * only by one body are owned by that function. Its parameters come from
+ * the function records loaded with the code (cc2's function section, or
+ * the SYM_FUNCTION entries of the symbol table, see tac_function.h) and
+ * are bound in declaration order; a function without a record takes none.
+ * Parameters need not be owned: hand-written TAC may give the parameters
+ * of two functions the same id.
+ *
+ * Owned slots are still the engine's global variable/temporary cells, so a
+ * call costs nothing beyond binding its parameters. Only when a function is
+ * re-entered (recursion) does the new frame save the callee's slots to the
+ * value stack, which is restored and rewound when the frame pops; parameters
+ * shared with another function are saved on every call. Frames and
+ * the value stack are contiguous arrays that double when full, so recursion
+ * depth is bounded by max_call_depth (or memory, if 0) and a call allocates
+ * nothing once the stack has reached its working size.
+ *
+ * A CALL immediately followed by a RETURN of its result is a tail call: the
+ * caller's frame would only pass the value on, so the callee takes it over
+ * and returns straight to the original caller.
+ */
+
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+#include "tac_engine_log.h"
+#include "../../ir/tac_function.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TAC_INITIAL_FRAMES  16u     // First frame array allocation
+#define TAC_INITIAL_SAVES   64u     // First value stack allocation
+
+// =============================================================================
+// FUNCTION TABLE
+// =============================================================================
+
+/**
+ * @brief Slot key of an operand: variables first, then temporaries
+ * @return Key, or TAC_NO_TARGET if the operand is not a storable slot
+ */
+static uint32_t tac_slot_key(const tac_engine_t* engine, const TACOperand* operand) {
+    if (operand->type == TAC_OP_VAR &&
+        operand->data.variable.id < engine->config.max_variables) {
+        return operand->data.variable.id;
+    }
+    if (operand->type == TAC_OP_TEMP &&
+        operand->data.variable.id < engine->config.max_temporaries) {
+        return engine->config.max_variables + operand->data.variable.id;
+    }
+    return TAC_NO_TARGET;
+}
+
+static tac_value_t* tac_slot_cell(tac_engine_t* engine, uint32_t key) {
+    if (key < engine->config.max_variables) {
+        return &engine->variables[key];
+    }
+    return &engine->temporaries[key - engine->config.max_variables];
+}
+
+/**
+ * @brief Collect the slot keys an instruction reads, then the one it writes
+ * @return Number of keys; *reads tells how many leading keys are reads
+ */
+static uint32_t tac_instruction_slots(const tac_engine_t* engine,
+                                      const TACInstruction* inst,
+                                      uint32_t keys[3], uint32_t* reads) {
+    uint32_t count = 0;
+    uint32_t key;
+
+    // STORE reads its result operand: it holds the address
+    if (inst->opcode == TAC_STORE &&
+        (key = tac_slot_key(engine, &inst->result)) != TAC_NO_TARGET) {
+        keys[count++] = key;
+    }
+    if ((key = tac_slot_key(engine, &inst->operand1)) != TAC_NO_TARGET) {
+        keys[count++] = key;
+    }
+    if ((key = tac_slot_key(engine, &inst->operand2)) != TAC_NO_TARGET) {
+        keys[count++] = key;
+    }
+    *reads = count;
+
+    if (inst->opcode != TAC_STORE &&
+        (key = tac_slot_key(engine, &inst->result)) != TAC_NO_TARGET) {
+        keys[count++] = key;
+    }
+    return count;
+}
+
+/**
+ * @brief Mark the body of a function in owner[]
+ *
+ * Follows fall-through and branches, stops at returns and at other
+ * function entries. Instructions already claimed keep their first owner.
+ */
+static void tac_mark_function_body(const tac_engine_t* engine,
+                                   uint32_t function,
+                                   const uint32_t* entry_of,
+                                   uint32_t* owner,
+                                   uint32_t* worklist) {
+    uint32_t entry = engine->functions[function].entry;
+    uint32_t top = 0;
+
+    worklist[top++] = entry;
+    while (top > 0) {
+        uint32_t i = worklist[--top];
+        if (i >= engine->instruction_count || owner[i] != TAC_NO_TARGET ||
+            (i != entry && entry_of[i] != 0)) {
+            continue;
+        }
+        owner[i] = function;
+
+        const TACInstruction* inst = &engine->instructions[i];
+        switch (inst->opcode) {
+            case TAC_RETURN:
+            case TAC_RETURN_VOID:
+                break;
+            case TAC_GOTO:
+                if (engine->jump_targets[i] != TAC_NO_TARGET) {
+                    worklist[top++] = engine->jump_targets[i];
+                }
+                break;
+            case TAC_IF_TRUE:
+            case TAC_IF_FALSE:
+                if (engine->jump_targets[i] != TAC_NO_TARGET) {
+                    worklist[top++] = engine->jump_targets[i];
+                }
+                worklist[top++] = i + 1;
+                break;
+            default:
+                worklist[top++] = i + 1;
+                break;
+        }
+    }
+}
+
+tac_engine_error_t tac_build_function_table(tac_engine_t* engine) {
+    if (!engine || !engine->instructions || !engine->jump_targets) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_reset_call_stack(engine);
+    tac_function_table_cleanup(engine);
+
+    uint32_t count = engine->instruction_count;
+    uint32_t key_count = engine->config.max_variables + engine->config.max_temporaries;
+    tac_engine_error_t err = TAC_ENGINE_ERR_OUT_OF_MEMORY;
+
+    uint32_t* entry_of = calloc(count + 1, sizeof(uint32_t));     // function + 1
+    uint32_t* owner = malloc((count + 1) * sizeof(uint32_t));
+    uint32_t* worklist = malloc((2 * (size_t)count + 1) * sizeof(uint32_t));
+    uint32_t* key_owner = malloc((size_t)key_count * sizeof(uint32_t));
+    uint32_t* key_param_of = calloc(key_count, sizeof(uint32_t));   // function + 1
+    uint32_t* param_keys = NULL;
+    engine->call_functions = malloc((count + 1) * sizeof(uint32_t));
+    if (!entry_of || !owner || !worklist || !key_owner || !key_param_of ||
+        !engine->call_functions) {
+        goto done;
+    }
+
+    // Functions are CALL targets, numbered in code order
+    for (uint32_t i = 0; i < count; i++) {
+        if (engine->instructions[i].opcode == TAC_CALL &&
+            engine->jump_targets[i] != TAC_NO_TARGET) {
+            entry_of[engine->jump_targets[i]] = 1;
+        }
+    }
+    uint32_t function_count = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (entry_of[i]) {
+            entry_of[i] = ++function_count;
+        }
+    }
+
+    engine->functions = calloc(function_count + 1, sizeof(tac_function_info_t));
+    param_keys = malloc(((size_t)function_count * TAC_MAX_CALL_PARAMS + 1) * sizeof(uint32_t));
+    if (!engine->functions || !param_keys) {
+        goto done;
+    }
+    engine->function_count = function_count;
+
+    for (uint32_t i = 0; i < count; i++) {
+        owner[i] = TAC_NO_TARGET;
+        engine->call_functions[i] = TAC_NO_TARGET;
+        if (entry_of[i]) {
+            engine->functions[entry_of[i] - 1].entry = i;
+        }
+        if (engine->instructions[i].opcode == TAC_CALL &&
+            engine->jump_targets[i] != TAC_NO_TARGET) {
+            engine->call_functions[i] = entry_of[engine->jump_targets[i]] - 1;
+        }
+    }
+
+    for (uint32_t f = 0; f < function_count; f++) {
+        tac_mark_function_body(engine, f, entry_of, owner, worklist);
+    }
+
+    // A slot belongs to a function only if nothing else references it;
+    // function_count stands for top-level code, function_count + 1 for shared
+    uint32_t top_level = function_count;
+    uint32_t shared = function_count + 1;
+    for (uint32_t k = 0; k < key_count; k++) {
+        key_owner[k] = TAC_NO_TARGET;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t keys[3];
+        uint32_t reads;
+        uint32_t n = tac_instruction_slots(engine, &engine->instructions[i], keys, &reads);
+        uint32_t who = (owner[i] != TAC_NO_TARGET) ? owner[i] : top_level;
+
+        for (uint32_t j = 0; j < n; j++) {
+            if (key_owner[keys[j]] == TAC_NO_TARGET) {
+                key_owner[keys[j]] = who;
+            } else if (key_owner[keys[j]] != who) {
+                key_owner[keys[j]] = shared;
+            }
+        }
+    }
+
+    // Parameters come from the function records, in declaration order.
+    // They need not be owned: the TAC may give two functions' parameters
+    // one id, and a parameter the body never reads is still bound.
+    uint32_t total_slots = 0;
+    for (uint32_t f = 0; f < function_count; f++) {
+        tac_function_info_t* info = &engine->functions[f];
+        uint16_t ids[TAC_MAX_CALL_PARAMS];
+        uint32_t n = tac_function_params(tac_function_at(engine->function_records,
+                                                         engine->function_record_count,
+                                                         info->entry),
+                                         ids, TAC_MAX_CALL_PARAMS);
+        uint32_t params = 0;
+        bool shared_params = false;
+
+        for (uint32_t p = 0; p < n && ids[p] < engine->config.max_variables; p++) {
+            uint32_t k = ids[p];
+            param_keys[f * TAC_MAX_CALL_PARAMS + params++] = k;
+            if (key_owner[k] == f) {
+                key_param_of[k] = f + 1;
+            } else if (key_owner[k] != TAC_NO_TARGET) {
+                shared_params = true;   // Another function uses it too
+            }
+        }
+        info->param_count = params;
+        info->save_count = shared_params ? params : 0;
+        info->slot_count = params;
+    }
+    for (uint32_t k = 0; k < key_count; k++) {
+        if (key_owner[k] < function_count && key_param_of[k] != key_owner[k] + 1) {
+            engine->functions[key_owner[k]].slot_count++;
+        }
+    }
+    for (uint32_t f = 0; f < function_count; f++) {
+        tac_function_info_t* info = &engine->functions[f];
+        info->slot_base = total_slots;
+        total_slots += info->slot_count;
+    }
+
+    engine->function_slots = malloc(((size_t)total_slots + 1) * sizeof(tac_value_t*));
+    if (!engine->function_slots) {
+        goto done;
+    }
+
+    // Parameters first, in declaration order, then the owned rest;
+    // worklist doubles as the per-function fill cursor
+    for (uint32_t f = 0; f < function_count; f++) {
+        const tac_function_info_t* info = &engine->functions[f];
+        for (uint32_t p = 0; p < info->param_count; p++) {
+            engine->function_slots[info->slot_base + p] =
+                tac_slot_cell(engine, param_keys[f * TAC_MAX_CALL_PARAMS + p]);
+        }
+        worklist[f] = info->param_count;
+    }
+    for (uint32_t k = 0; k < key_count; k++) {
+        uint32_t f = key_owner[k];
+        if (f < function_count && key_param_of[k] != f + 1) {
+            engine->function_slots[engine->functions[f].slot_base + worklist[f]++] =
+                tac_slot_cell(engine, k);
+        }
+    }
+
+    for (uint32_t f = 0; f < function_count; f++) {
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_CALLS,
+                      "Function %u: entry %u, %u params, %u slots",
+                      f, engine->functions[f].entry,
+                      engine->functions[f].param_count, engine->functions[f].slot_count);
+    }
+    err = TAC_ENGINE_OK;
+
+done:
+    free(entry_of);
+    free(owner);
+    free(worklist);
+    free(key_owner);
+    free(key_param_of);
+    free(param_keys);
+    if (err != TAC_ENGINE_OK) {
+        tac_function_table_cleanup(engine);
+    }
+    return err;
+}
+
+void tac_function_table_cleanup(tac_engine_t* engine) {
+    if (!engine) {
+        return;
+    }
+
+    free(engine->functions);
+    free(engine->function_slots);
+    free(engine->call_functions);
+    free(engine->value_stack);
+    engine->functions = NULL;
+    engine->function_slots = NULL;
+    engine->call_functions = NULL;
+    engine->value_stack = NULL;
+    engine->function_count = 0;
+    engine->value_stack_size = 0;
+    engine->value_sp = 0;
+}
+
+/**
+ * @brief Function entered at an instruction index (binary search by entry)
+ */
+static uint32_t tac_find_function(const tac_engine_t* engine, uint32_t entry) {
+    uint32_t lo = 0;
+    uint32_t hi = engine->function_count;
+
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (engine->functions[mid].entry < entry) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return (lo < engine->function_count && engine->functions[lo].entry == entry)
+        ? lo : TAC_NO_TARGET;
+}
+
+// =============================================================================
+// CALL STACK
+// =============================================================================
+
+/**
+ * @brief Capacity for at least `needed` entries: double, clamp to `limit` (0: none)
+ */
+static size_t tac_grown_capacity(uint32_t current, uint32_t needed,
+                                 uint32_t initial, uint32_t limit) {
+    size_t capacity = current ? (size_t)current * 2 : initial;
+    if (capacity < needed) {
+        capacity = needed;
+    }
+    if (limit && capacity > limit) {
+        capacity = limit > needed ? limit : needed;
+    }
+    return capacity > UINT32_MAX ? UINT32_MAX : capacity;
+}
+
+tac_engine_error_t tac_reserve_call_stack(tac_engine_t* engine, uint32_t frames, uint32_t values) {
+    if (frames > engine->frame_capacity) {
+        size_t capacity = tac_grown_capacity(engine->frame_capacity, frames,
+                                             TAC_INITIAL_FRAMES, engine->config.max_call_depth);
+        tac_stack_frame_t* grown = realloc(engine->frames, capacity * sizeof(tac_stack_frame_t));
+        if (!grown) {
+            return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        }
+        engine->frames = grown;
+        engine->frame_capacity = (uint32_t)capacity;
+    }
+
+    if (values > engine->value_stack_size) {
+        size_t capacity = tac_grown_capacity(engine->value_stack_size, values,
+                                             TAC_INITIAL_SAVES, 0);
+        tac_value_t* grown = realloc(engine->value_stack, capacity * sizeof(tac_value_t));
+        if (!grown) {
+            return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        }
+        engine->value_stack = grown;
+        engine->value_stack_size = (uint32_t)capacity;
+    }
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_push_frame(tac_engine_t* engine,
+                                 uint32_t call_site,
+                                 uint32_t function) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    if ((engine->config.max_call_depth && engine->call_depth >= engine->config.max_call_depth) ||
+        engine->call_depth == UINT32_MAX) {
+        return TAC_ENGINE_ERR_STACK_OVERFLOW;
+    }
+    if (engine->call_depth >= engine->frame_capacity) {
+        tac_engine_error_t err = tac_reserve_call_stack(engine, engine->call_depth + 1, 0);
+        if (err != TAC_ENGINE_OK) {
+            return err;
+        }
+    }
+
+    tac_stack_frame_t* frame = &engine->frames[engine->call_depth];
+    frame->return_address = call_site + 1;
+    frame->call_site = call_site;
+    frame->function = function;
+    frame->save_base = engine->value_sp;
+    frame->save_count = 0;
+
+    if (function != TAC_NO_TARGET) {
+        tac_function_info_t* info = &engine->functions[function];
+
+        // Re-entry: keep the outer activation's slots on the value stack;
+        // otherwise only parameters another function may be using
+        uint32_t saves = info->active > 0 ? info->slot_count : info->save_count;
+        if (saves > 0) {
+            if (saves > engine->value_stack_size - engine->value_sp) {
+                if (saves > UINT32_MAX - engine->value_sp) {
+                    return TAC_ENGINE_ERR_STACK_OVERFLOW;
+                }
+                tac_engine_error_t err = tac_reserve_call_stack(
+                    engine, 0, engine->value_sp + saves);
+                if (err != TAC_ENGINE_OK) {
+                    return err;
+                }
+            }
+            tac_value_t** slots = &engine->function_slots[info->slot_base];
+            tac_value_t* save = &engine->value_stack[engine->value_sp];
+            for (uint32_t i = 0; i < saves; i++) {
+                save[i] = *slots[i];
+            }
+            frame->save_count = saves;
+            engine->value_sp += saves;
+        }
+        info->active++;
+    }
+
+    engine->call_depth++;
+    return TAC_ENGINE_OK;
+}
+
+const tac_stack_frame_t* tac_pop_frame(tac_engine_t* engine) {
+    if (!engine || engine->call_depth == 0) {
+        return NULL;
+    }
+
+    const tac_stack_frame_t* frame = &engine->frames[--engine->call_depth];
+    if (frame->function != TAC_NO_TARGET) {
+        tac_function_info_t* info = &engine->functions[frame->function];
+        if (frame->save_count > 0) {
+            tac_value_t** slots = &engine->function_slots[info->slot_base];
+            const tac_value_t* save = &engine->value_stack[frame->save_base];
+            for (uint32_t i = 0; i < frame->save_count; i++) {
+                *slots[i] = save[i];
+            }
+        }
+        info->active--;
+    }
+    engine->value_sp = frame->save_base;
+    return frame;
+}
+
+void tac_reset_call_stack(tac_engine_t* engine) {
+    if (!engine) {
+        return;
+    }
+
+    while (tac_pop_frame(engine)) {
+        // Innermost first, so outer activations are restored last
+    }
+    engine->value_sp = 0;
+    engine->param_counter = 0;
+}
+
+/**
+ * @brief Hand the innermost frame to a tail-called function
+ *
+ * The frame keeps its call site, so the callee returns straight to the
+ * original caller. A function calling itself keeps the frame unchanged;
+ * otherwise the caller's activation is popped, restoring any slots it
+ * saved, and the callee's pushed in its place.
+ */
+static tac_engine_error_t tac_replace_frame(tac_engine_t* engine, uint32_t function) {
+    const tac_stack_frame_t* frame = &engine->frames[engine->call_depth - 1];
+    if (function != TAC_NO_TARGET && frame->function == function) {
+        return TAC_ENGINE_OK;
+    }
+
+    uint32_t call_site = frame->call_site;
+    tac_pop_frame(engine);
+    return tac_push_frame(engine, call_site, function);
+}
+
+// =============================================================================
+// CALL AND RETURN
+// =============================================================================
+
+/**
+ * @brief Whether the CALL at pc is a tail call (followed by RETURN of its result)
+ *
+ * Only inside a function: at top level the RETURN ends the program. A
+ * breakpoint on the RETURN keeps the ordinary call so the stop is reached.
+ */
+static bool tac_is_tail_call(const tac_engine_t* engine, uint32_t pc) {
+    if (!engine->config.enable_tail_calls || engine->call_depth == 0 ||
+        pc + 1 >= engine->instruction_count) {
+        return false;
+    }
+
+    const TACOperand* result = &engine->instructions[pc].result;
+    const TACInstruction* next = &engine->instructions[pc + 1];
+    return (result->type == TAC_OP_VAR || result->type == TAC_OP_TEMP) &&
+           next->opcode == TAC_RETURN &&
+           next->operand1.type == result->type &&
+           next->operand1.data.variable.id == result->data.variable.id &&
+           !(engine->breakpoint_count > 0 && tac_has_breakpoint(engine, pc + 1));
+}
+
+tac_engine_error_t tac_execute_call(tac_engine_t* engine,
+                                   const TACInstruction* instruction) {
+    bool current = engine->pc < engine->instruction_count &&
+                   instruction == &engine->instructions[engine->pc];
+    uint32_t target = (current && engine->jump_targets)
+        ? engine->jump_targets[engine->pc] : TAC_NO_TARGET;
+    uint32_t function = (current && engine->call_functions)
+        ? engine->call_functions[engine->pc] : TAC_NO_TARGET;
+
+    if (target == TAC_NO_TARGET) {
+        if (instruction->operand1.type == TAC_OP_LABEL) {
+            uint16_t label_id = instruction->operand1.data.label.offset;
+            if (tac_resolve_label(&engine->label_table, label_id, &target) != TAC_ENGINE_OK) {
+                tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND,
+                             "Failed to resolve call target label %u", label_id);
+                return TAC_ENGINE_ERR_INVALID_OPERAND;
+            }
+        } else if (instruction->operand1.type == TAC_OP_IMMEDIATE) {
+            // Legacy immediate address handling
+            target = (uint32_t)instruction->operand1.data.immediate.value;
+        } else {
+            tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND,
+                         "Call target must be label or immediate, got type %d",
+                         instruction->operand1.type);
+            return TAC_ENGINE_ERR_INVALID_OPERAND;
+        }
+
+        if (target >= engine->instruction_count) {
+            tac_set_error(engine, TAC_ENGINE_ERR_INVALID_MEMORY,
+                         "Call target %u out of bounds", target);
+            return TAC_ENGINE_ERR_INVALID_MEMORY;
+        }
+        function = tac_find_function(engine, target);
+    }
+
+    tac_engine_error_t err = (current && tac_is_tail_call(engine, engine->pc))
+        ? tac_replace_frame(engine, function)
+        : tac_push_frame(engine, engine->pc, function);
+    if (err == TAC_ENGINE_ERR_STACK_OVERFLOW) {
+        tac_set_error(engine, err, "Call depth limit %u exceeded",
+                     engine->config.max_call_depth);
+        return err;
+    }
+    if (err != TAC_ENGINE_OK) {
+        tac_set_error(engine, err, "Cannot grow the call stack at depth %u",
+                     engine->call_depth);
+        return err;
+    }
+
+    // Bind arguments to the callee's parameter slots, in order
+    if (function != TAC_NO_TARGET) {
+        const tac_function_info_t* info = &engine->functions[function];
+        tac_value_t** params = &engine->function_slots[info->slot_base];
+        uint32_t bound = engine->param_counter < info->param_count
+            ? engine->param_counter : info->param_count;
+
+        for (uint32_t i = 0; i < bound; i++) {
+            *params[i] = engine->param_stack[i];
+            tac_watch_slot(engine, (uint32_t)(params[i] - engine->registers));
+        }
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_CALLS,
+                      "Call %u -> %u: bound %u of %u arguments (%u params)",
+                      engine->pc, target, bound, engine->param_counter, info->param_count);
+    }
+
+    engine->param_counter = 0;
+    engine->pc = target;
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_execute_return(tac_engine_t* engine,
+                                     const TACInstruction* instruction) {
+    tac_value_t return_value;
+    bool has_value = false;
+
+    // Evaluate before the frame's saved slots are restored
+    if (instruction->operand1.type != TAC_OP_NONE &&
+        tac_eval_operand(engine, &instruction->operand1, &return_value) == TAC_ENGINE_OK) {
+        // Also kept in temp 0 for retrieval by tests
+        engine->temporaries[0] = return_value;
+        tac_watch_slot(engine, engine->config.max_variables);
+        has_value = true;
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_CALLS, "Function returning value %d (stored in t0)",
+                      return_value.data.i32);
+    }
+
+    const tac_stack_frame_t* frame = tac_pop_frame(engine);
+    if (!frame) {
+        // Top-level return - finish program execution
+        engine->state = TAC_ENGINE_FINISHED;
+        engine->pc = engine->instruction_count;
+        return TAC_ENGINE_OK;
+    }
+
+    // The frame's own CALL receives the value, so nested calls are safe
+    const TACInstruction* call_inst = (frame->call_site < engine->instruction_count)
+        ? &engine->instructions[frame->call_site] : NULL;
+    if (has_value && call_inst && call_inst->opcode == TAC_CALL &&
+        call_inst->result.type != TAC_OP_NONE) {
+        tac_engine_error_t err = tac_store_operand(engine, &call_inst->result, &return_value);
+        if (err != TAC_ENGINE_OK) {
+            // Log warning but don't fail the return
+            tac_set_error(engine, err, "Failed to store call result");
+        }
+    }
+
+    engine->pc = frame->return_address;
+    return TAC_ENGINE_OK;
+}
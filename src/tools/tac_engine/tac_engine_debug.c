@@ -0,0 +1,523 @@
+/**
+ * @file tac_engine_debug.c
+ * @brief TAC Engine breakpoints, watchpoints, execution hooks and instrumented stepping
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * Breakpoints are one bit per instruction in a bitmap sized at load time,
+ * and hooks are kept in one list per tac_hook_type_t, so checking either
+ * costs the same however many are registered. Whether anything observes
+ * execution at all is summarized in engine->instrumentation: the run loop
+ * tests that word once per instruction and only calls
+ * tac_execute_observed() when it is nonzero.
+ *
+ * Watchpoints cost nothing per step. They are shadow bitmaps, one bit per
+ * register slot and one per memory page, tested only where the
+ * interpreter stores a slot or writes memory; a set bit sends the write to
+ * tac_watch_hit(), which finds the watchpoint and requests a stop.
+ *
+ * Stops: a breakpoint, or an instruction hook returning false, pauses
+ * before the instruction runs; watchpoints, and call, return and memory
+ * hooks returning false, pause after it. Either way the engine is left TAC_ENGINE_PAUSED
+ * and tac_engine_run()/tac_engine_step() resume from the next unexecuted
+ * instruction, passing the stop just reported without reporting it again.
+ */
+
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+#include "tac_engine_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+// =============================================================================
+// INSTRUMENTATION MASK
+// =============================================================================
+
+void tac_update_instrumentation(tac_engine_t* engine) {
+    uint32_t mask = 0;
+
+    if (engine->breakpoint_count > 0) {
+        mask |= TAC_INSTR_BREAKPOINTS;
+    }
+    if (engine->pair_counts) {
+        mask |= TAC_INSTR_PAIRS;
+    }
+    if (engine->profile) {
+        mask |= TAC_INSTR_PROFILE;
+    }
+    if (engine->trace_stream) {
+        mask |= TAC_INSTR_TRACE;
+    }
+    if (engine->hook_stop) {
+        mask |= TAC_INSTR_STOP;
+    }
+    if (engine->watch_count > 0) {
+        mask |= TAC_INSTR_WATCH;
+    }
+    if (engine->replay) {
+        mask |= TAC_INSTR_REPLAY;
+    }
+    for (uint32_t type = 0; type < TAC_HOOK_TYPE_COUNT; type++) {
+        if (engine->hook_counts[type] > 0) {
+            mask |= TAC_INSTR_HOOK(type);
+        }
+    }
+    engine->instrumentation = mask;
+}
+
+// =============================================================================
+// BREAKPOINTS
+// =============================================================================
+
+tac_engine_error_t tac_debug_reset(tac_engine_t* engine) {
+    // Breakpoints are instruction addresses, so they describe one program;
+    // watchpoints name slots and memory and stay
+    free(engine->breakpoints);
+    engine->breakpoints = NULL;
+    engine->breakpoint_count = 0;
+    engine->paused_at = TAC_NO_TARGET;
+    engine->hook_stop = false;
+    engine->watch_hit_valid = false;
+
+    if (engine->instruction_count > 0) {
+        engine->breakpoints = calloc(((size_t)engine->instruction_count + 31) / 32,
+                                     sizeof(uint32_t));
+        if (!engine->breakpoints) {
+            tac_update_instrumentation(engine);
+            return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        }
+    }
+    tac_update_instrumentation(engine);
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_engine_add_breakpoint(tac_engine_t* engine, uint32_t address) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    if (!engine->breakpoints || address >= engine->instruction_count) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    if (!tac_has_breakpoint(engine, address)) {
+        engine->breakpoints[address >> 5] |= 1u << (address & 31);
+        engine->breakpoint_count++;
+        tac_update_instrumentation(engine);
+    }
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_engine_remove_breakpoint(tac_engine_t* engine, uint32_t address) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    if (!engine->breakpoints || !tac_has_breakpoint(engine, address)) {
+        return TAC_ENGINE_ERR_NOT_FOUND;
+    }
+
+    engine->breakpoints[address >> 5] &= ~(1u << (address & 31));
+    engine->breakpoint_count--;
+    tac_update_instrumentation(engine);
+    return TAC_ENGINE_OK;
+}
+
+// =============================================================================
+// HOOKS
+// =============================================================================
+
+uint32_t tac_engine_add_hook(tac_engine_t* engine,
+                             tac_hook_type_t hook_type,
+                             tac_hook_callback_t callback,
+                             void* user_data) {
+    if (!engine || !callback || (uint32_t)hook_type >= TAC_HOOK_TYPE_COUNT) {
+        return 0;
+    }
+
+    tac_hook_entry_t* hook = malloc(sizeof(tac_hook_entry_t));
+    if (!hook) {
+        return 0;
+    }
+    hook->id = ++engine->next_hook_id;
+    hook->type = hook_type;
+    hook->callback = callback;
+    hook->user_data = user_data;
+    hook->enabled = true;
+    hook->next = NULL;
+
+    // Append, so hooks of a type run in the order they were added
+    tac_hook_entry_t** link = &engine->hooks[hook_type];
+    while (*link) {
+        link = &(*link)->next;
+    }
+    *link = hook;
+    engine->hook_counts[hook_type]++;
+    tac_update_instrumentation(engine);
+    return hook->id;
+}
+
+/**
+ * @brief Free hooks removed while a dispatch was walking their list
+ */
+static void tac_purge_hooks(tac_engine_t* engine) {
+    for (uint32_t type = 0; type < TAC_HOOK_TYPE_COUNT; type++) {
+        tac_hook_entry_t** link = &engine->hooks[type];
+        while (*link) {
+            tac_hook_entry_t* hook = *link;
+            if (hook->enabled) {
+                link = &hook->next;
+            } else {
+                *link = hook->next;
+                free(hook);
+            }
+        }
+    }
+}
+
+tac_engine_error_t tac_engine_remove_hook(tac_engine_t* engine, uint32_t hook_id) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    for (uint32_t type = 0; type < TAC_HOOK_TYPE_COUNT; type++) {
+        for (tac_hook_entry_t* hook = engine->hooks[type]; hook; hook = hook->next) {
+            if (hook->id != hook_id || !hook->enabled) {
+                continue;
+            }
+
+            // A callback may remove hooks; the walk in progress still
+            // needs the entries, so they are only unlinked afterwards
+            hook->enabled = false;
+            engine->hook_counts[type]--;
+            if (engine->hook_depth == 0) {
+                tac_purge_hooks(engine);
+            } else {
+                engine->hook_purge = true;
+            }
+            tac_update_instrumentation(engine);
+            return TAC_ENGINE_OK;
+        }
+    }
+    return TAC_ENGINE_ERR_NOT_FOUND;
+}
+
+bool tac_trigger_hooks(tac_engine_t* engine, tac_hook_type_t type, uint32_t address) {
+    bool proceed = true;
+
+    // API calls from the hooks are recorded as made at this point of the step
+    uint8_t phase = engine->input_phase;
+    switch (type) {
+        case TAC_HOOK_INSTRUCTION:
+            engine->input_phase = TAC_INPUT_BEFORE;
+            break;
+        case TAC_HOOK_MEMORY_READ:
+        case TAC_HOOK_MEMORY_WRITE:
+            engine->input_phase = TAC_INPUT_MEMORY;
+            break;
+        default:
+            engine->input_phase = TAC_INPUT_AFTER;
+            break;
+    }
+
+    engine->hook_depth++;
+    for (tac_hook_entry_t* hook = engine->hooks[type]; hook; hook = hook->next) {
+        if (hook->enabled && !hook->callback(engine, type, address, hook->user_data)) {
+            proceed = false;
+            break;
+        }
+    }
+    if (--engine->hook_depth == 0 && engine->hook_purge) {
+        engine->hook_purge = false;
+        tac_purge_hooks(engine);
+    }
+    engine->input_phase = phase;
+    return proceed;
+}
+
+void tac_trigger_hooks_after(tac_engine_t* engine, tac_hook_type_t type, uint32_t address) {
+    if (!tac_trigger_hooks(engine, type, address)) {
+        tac_request_stop(engine);
+    }
+}
+
+void tac_debug_cleanup(tac_engine_t* engine) {
+    for (uint32_t type = 0; type < TAC_HOOK_TYPE_COUNT; type++) {
+        while (engine->hooks[type]) {
+            tac_hook_entry_t* hook = engine->hooks[type];
+            engine->hooks[type] = hook->next;
+            free(hook);
+        }
+        engine->hook_counts[type] = 0;
+    }
+    free(engine->breakpoints);
+    engine->breakpoints = NULL;
+    engine->breakpoint_count = 0;
+
+    free(engine->watches);
+    free(engine->watch_slots);
+    free(engine->watch_pages);
+    engine->watches = NULL;
+    engine->watch_slots = NULL;
+    engine->watch_pages = NULL;
+    engine->watch_count = 0;
+    engine->watch_capacity = 0;
+    engine->instrumentation = 0;
+}
+
+// =============================================================================
+// WATCHPOINTS
+// =============================================================================
+
+static uint32_t tac_register_count(const tac_engine_t* engine) {
+    return engine->config.max_variables + engine->config.max_temporaries;
+}
+
+/**
+ * @brief Redraw the shadow bitmaps from the watchpoint list
+ */
+static void tac_watch_rebuild(tac_engine_t* engine) {
+    if (engine->watch_slots) {
+        memset(engine->watch_slots, 0,
+               (((size_t)tac_register_count(engine) + 31) / 32) * sizeof(uint32_t));
+    }
+    if (engine->watch_pages) {
+        memset(engine->watch_pages, 0,
+               (((size_t)engine->memory.page_count + 31) / 32) * sizeof(uint32_t));
+    }
+
+    for (uint32_t i = 0; i < engine->watch_count; i++) {
+        const tac_watchpoint_t* watch = &engine->watches[i];
+        if (watch->kind == TAC_WATCH_MEMORY) {
+            uint32_t last = (watch->location + watch->size - 1) >> TAC_PAGE_SHIFT;
+            for (uint32_t page = watch->location >> TAC_PAGE_SHIFT; page <= last; page++) {
+                engine->watch_pages[page >> 5] |= 1u << (page & 31);
+            }
+        } else {
+            engine->watch_slots[watch->location >> 5] |= 1u << (watch->location & 31);
+        }
+    }
+}
+
+uint32_t tac_engine_add_watchpoint(tac_engine_t* engine, tac_watch_kind_t kind,
+                                   uint32_t location, uint32_t size) {
+    if (!engine) {
+        return 0;
+    }
+
+    // Slots are watched by register index, memory by byte range
+    uint32_t** shadow = NULL;
+    size_t bits = 0;
+    if (kind == TAC_WATCH_VARIABLE || kind == TAC_WATCH_TEMPORARY) {
+        uint32_t limit = kind == TAC_WATCH_VARIABLE ? engine->config.max_variables
+                                                    : engine->config.max_temporaries;
+        if (location >= limit) {
+            return 0;
+        }
+        if (kind == TAC_WATCH_TEMPORARY) {
+            location += engine->config.max_variables;
+        }
+        size = 1;
+        shadow = &engine->watch_slots;
+        bits = tac_register_count(engine);
+    } else if (kind == TAC_WATCH_MEMORY) {
+        if (size == 0 || location >= engine->memory.limit ||
+            size > engine->memory.limit - location) {
+            return 0;
+        }
+        shadow = &engine->watch_pages;
+        bits = engine->memory.page_count;
+    } else {
+        return 0;
+    }
+
+    if (!*shadow) {
+        *shadow = calloc((bits + 31) / 32, sizeof(uint32_t));
+        if (!*shadow) {
+            return 0;
+        }
+    }
+    if (engine->watch_count == engine->watch_capacity) {
+        uint32_t capacity = engine->watch_capacity ? engine->watch_capacity * 2 : 8;
+        tac_watchpoint_t* watches = realloc(engine->watches, capacity * sizeof(tac_watchpoint_t));
+        if (!watches) {
+            return 0;
+        }
+        engine->watches = watches;
+        engine->watch_capacity = capacity;
+    }
+
+    tac_watchpoint_t* watch = &engine->watches[engine->watch_count++];
+    watch->id = ++engine->next_watch_id;
+    watch->kind = kind;
+    watch->location = location;
+    watch->size = size;
+    tac_watch_rebuild(engine);
+    tac_update_instrumentation(engine);
+    return watch->id;
+}
+
+tac_engine_error_t tac_engine_remove_watchpoint(tac_engine_t* engine, uint32_t watch_id) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    for (uint32_t i = 0; i < engine->watch_count; i++) {
+        if (engine->watches[i].id == watch_id) {
+            memmove(&engine->watches[i], &engine->watches[i + 1],
+                    (size_t)(engine->watch_count - i - 1) * sizeof(tac_watchpoint_t));
+            engine->watch_count--;
+            tac_watch_rebuild(engine);
+            tac_update_instrumentation(engine);
+            return TAC_ENGINE_OK;
+        }
+    }
+    return TAC_ENGINE_ERR_NOT_FOUND;
+}
+
+void tac_watch_hit(tac_engine_t* engine, tac_watch_kind_t kind, uint32_t location, uint32_t size) {
+    // The shadow bit only says a watchpoint shares the slot or page
+    for (uint32_t i = 0; i < engine->watch_count; i++) {
+        const tac_watchpoint_t* watch = &engine->watches[i];
+        bool hit = kind == TAC_WATCH_MEMORY
+            ? watch->kind == TAC_WATCH_MEMORY && location < watch->location + watch->size &&
+              watch->location < location + size
+            : watch->kind != TAC_WATCH_MEMORY && watch->location == location;
+        if (!hit) {
+            continue;
+        }
+
+        // The first write of an instruction is the one reported
+        if (!engine->hook_stop) {
+            engine->watch_hit.watchpoint = watch->id;
+            engine->watch_hit.kind = watch->kind;
+            engine->watch_hit.location = location;
+            if (watch->kind == TAC_WATCH_TEMPORARY) {
+                engine->watch_hit.location -= engine->config.max_variables;
+            }
+            engine->watch_hit.address = engine->pc;
+            engine->watch_hit_valid = true;
+            TAC_LOG_DEBUG(engine, TAC_LOG_CAT_DISPATCH, "Watchpoint %u hit at %u",
+                          watch->id, engine->pc);
+        }
+        tac_request_stop(engine);
+        return;
+    }
+}
+
+tac_engine_error_t tac_engine_get_watch_hit(tac_engine_t* engine, tac_watch_hit_t* hit) {
+    if (!engine || !hit) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    if (!engine->watch_hit_valid) {
+        return TAC_ENGINE_ERR_NOT_FOUND;
+    }
+
+    *hit = engine->watch_hit;
+    return TAC_ENGINE_OK;
+}
+
+// =============================================================================
+// INSTRUMENTED STEP
+// =============================================================================
+
+void tac_request_stop(tac_engine_t* engine) {
+    engine->hook_stop = true;
+    engine->instrumentation |= TAC_INSTR_STOP;
+}
+
+tac_engine_error_t tac_debug_pause(tac_engine_t* engine, bool executed) {
+    engine->hook_stop = false;
+    engine->instrumentation &= ~TAC_INSTR_STOP;
+    engine->state = TAC_ENGINE_PAUSED;
+    if (executed) {
+        engine->step_count++;
+        engine->paused_at = TAC_NO_TARGET;
+    }
+    return TAC_ENGINE_ERR_BREAKPOINT;
+}
+
+tac_engine_error_t tac_execute_observed(tac_engine_t* engine,
+                                        const TACInstruction* instruction) {
+    uint32_t index = engine->pc;
+    uint32_t mask = engine->instrumentation;
+
+    // A stop requested by the previous instruction, outside this function
+    if (mask & TAC_INSTR_STOP) {
+        engine->paused_at = TAC_NO_TARGET;
+        return tac_debug_pause(engine, false);
+    }
+
+    // Resuming passes the stop just reported at this instruction
+    bool resumed = engine->paused_at == index;
+    engine->paused_at = TAC_NO_TARGET;
+    if (mask & TAC_INSTR_REPLAY) {
+        tac_engine_error_t err = tac_replay_before(engine);
+        if (err == TAC_ENGINE_ERR_BREAKPOINT) {
+            engine->paused_at = index;
+            return tac_debug_pause(engine, false);
+        }
+        if (err != TAC_ENGINE_OK) {
+            return err;
+        }
+    }
+    if (!resumed) {
+        if ((mask & TAC_INSTR_BREAKPOINTS) && tac_has_breakpoint(engine, index)) {
+            engine->paused_at = index;
+            TAC_LOG_DEBUG(engine, TAC_LOG_CAT_DISPATCH, "Breakpoint at %u", index);
+            return tac_debug_pause(engine, false);
+        }
+        if ((mask & TAC_INSTR_HOOK(TAC_HOOK_INSTRUCTION)) &&
+            !tac_trigger_hooks(engine, TAC_HOOK_INSTRUCTION, index)) {
+            engine->paused_at = index;
+            return tac_debug_pause(engine, false);
+        }
+    }
+
+    if (mask & TAC_INSTR_PAIRS) {
+        tac_profile_pair(engine, index);
+    }
+    if (mask & TAC_INSTR_PROFILE) {
+        tac_profile_before(engine, index);
+    }
+    if (mask & TAC_INSTR_TRACE) {
+        tac_trace_before(engine, index);
+    }
+
+    uint32_t depth = engine->call_depth;
+    tac_engine_error_t err = tac_execute_instruction(engine, instruction);
+    if (err != TAC_ENGINE_OK) {
+        if (mask & TAC_INSTR_HOOK(TAC_HOOK_ERROR)) {
+            tac_trigger_hooks(engine, TAC_HOOK_ERROR, index);
+        }
+        engine->hook_stop = false;
+        engine->instrumentation &= ~TAC_INSTR_STOP;
+        return err;
+    }
+
+    if (mask & TAC_INSTR_PROFILE) {
+        tac_profile_after(engine, index);
+    }
+    if (mask & TAC_INSTR_TRACE) {
+        tac_trace_after(engine, index);
+    }
+    if (mask & TAC_INSTR_REPLAY) {
+        err = tac_replay_apply(engine, TAC_INPUT_AFTER);
+        if (err != TAC_ENGINE_OK) {
+            return err;
+        }
+    }
+
+    // Call and return hooks see the CALL or RETURN instruction's address; a
+    // tail call enters the callee without changing the depth
+    if ((engine->call_depth > depth || instruction->opcode == TAC_CALL) &&
+        (mask & TAC_INSTR_HOOK(TAC_HOOK_FUNCTION_CALL))) {
+        tac_trigger_hooks_after(engine, TAC_HOOK_FUNCTION_CALL, index);
+    } else if (engine->call_depth < depth && (mask & TAC_INSTR_HOOK(TAC_HOOK_FUNCTION_RETURN))) {
+        tac_trigger_hooks_after(engine, TAC_HOOK_FUNCTION_RETURN, index);
+    }
+    if (engine->hook_stop) {
+        return tac_debug_pause(engine, true);
+    }
+    return TAC_ENGINE_OK;
+}
@@ -0,0 +1,832 @@
+/**
+ * @file tac_engine_dispatch.c
+ * @brief TAC Engine pre-decoder and threaded dispatch loop
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * The pre-decoder lowers every loaded TACInstruction once into a compact
+ * tac_decoded_insn_t with its operands resolved to value slots and its
+ * branch target resolved to an instruction index. tac_run_predecoded()
+ * then executes that form with computed-goto threaded dispatch on GCC and
+ * Clang, or a plain switch elsewhere.
+ *
+ * Only the common integer paths are specialized. Anything else (calls,
+ * returns, memory operations, non-int32 operands, faulting divisions) is
+ * routed through tac_execute_instruction() so error reporting and
+ * semantics stay identical to the interpreter.
+ *
+ * After decoding, hot sequences listed in tac_superinsn_patterns are fused
+ * into superinstructions. A fused handler still counts one step per source
+ * instruction, and falls back to its first instruction's plain handling
+ * when a guard fails (non-int32 operand, step limit within reach).
+ */
+
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+#include "tac_engine_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && !defined(TAC_ENGINE_NO_THREADED_DISPATCH)
+#define TAC_THREADED_DISPATCH 1
+#else
+#define TAC_THREADED_DISPATCH 0
+#endif
+
+// =============================================================================
+// PRE-DECODER
+// =============================================================================
+
+/**
+ * @brief Resolve a source operand to a value slot
+ * @return Slot pointer, or NULL if the operand needs the generic path
+ */
+static const tac_value_t* tac_decode_source(tac_engine_t* engine,
+                                            const TACOperand* operand,
+                                            tac_value_t* constant) {
+    switch (operand->type) {
+        case TAC_OP_TEMP:
+            if (operand->data.variable.id >= engine->config.max_temporaries) {
+                return NULL;
+            }
+            return &engine->temporaries[operand->data.variable.id];
+
+        case TAC_OP_VAR:
+            if (operand->data.variable.id >= engine->config.max_variables) {
+                return NULL;
+            }
+            return &engine->variables[operand->data.variable.id];
+
+        case TAC_OP_IMMEDIATE:
+            *constant = tac_value_int32(operand->data.immediate.value);
+            return constant;
+
+        case TAC_OP_LABEL:
+            *constant = tac_value_int32(operand->data.label.offset);
+            return constant;
+
+        default:
+            return NULL;
+    }
+}
+
+/**
+ * @brief Resolve a result operand to a value slot
+ * @return Slot pointer, or NULL if the operand needs the generic path
+ */
+static tac_value_t* tac_decode_result(tac_engine_t* engine,
+                                      const TACOperand* operand) {
+    switch (operand->type) {
+        case TAC_OP_TEMP:
+            if (operand->data.variable.id >= engine->config.max_temporaries) {
+                return NULL;
+            }
+            return &engine->temporaries[operand->data.variable.id];
+
+        case TAC_OP_VAR:
+            if (operand->data.variable.id >= engine->config.max_variables) {
+                return NULL;
+            }
+            return &engine->variables[operand->data.variable.id];
+
+        default:
+            return NULL;
+    }
+}
+
+/**
+ * @brief Fetch the load-time jump target of an instruction
+ * @return true if the target was resolved (see tac_resolve_jump_targets())
+ */
+static bool tac_decode_target(const tac_engine_t* engine, uint32_t index,
+                              uint32_t* target) {
+    if (!engine->jump_targets || engine->jump_targets[index] == TAC_NO_TARGET) {
+        return false;
+    }
+    *target = engine->jump_targets[index];
+    return true;
+}
+
+/**
+ * @brief Map a binary/unary TAC opcode to its decoded operation
+ */
+static tac_decoded_op_t tac_decode_arith_op(TACOpcode opcode) {
+    switch (opcode) {
+        case TAC_ADD:         return TAC_DOP_ADD;
+        case TAC_SUB:         return TAC_DOP_SUB;
+        case TAC_MUL:         return TAC_DOP_MUL;
+        case TAC_DIV:         return TAC_DOP_DIV;
+        case TAC_MOD:         return TAC_DOP_MOD;
+        case TAC_AND:         return TAC_DOP_AND;
+        case TAC_OR:          return TAC_DOP_OR;
+        case TAC_XOR:         return TAC_DOP_XOR;
+        case TAC_SHL:         return TAC_DOP_SHL;
+        case TAC_SHR:         return TAC_DOP_SHR;
+        case TAC_EQ:          return TAC_DOP_EQ;
+        case TAC_NE:          return TAC_DOP_NE;
+        case TAC_LT:          return TAC_DOP_LT;
+        case TAC_LE:          return TAC_DOP_LE;
+        case TAC_GT:          return TAC_DOP_GT;
+        case TAC_GE:          return TAC_DOP_GE;
+        case TAC_LOGICAL_AND: return TAC_DOP_LOGICAL_AND;
+        case TAC_LOGICAL_OR:  return TAC_DOP_LOGICAL_OR;
+        case TAC_NEG:         return TAC_DOP_NEG;
+        case TAC_NOT:         return TAC_DOP_NOT;
+        case TAC_BITWISE_NOT: return TAC_DOP_BITWISE_NOT;
+        default:              return TAC_DOP_GENERIC;
+    }
+}
+
+/**
+ * @brief Decode a single instruction
+ */
+static void tac_decode_insn(tac_engine_t* engine,
+                            uint32_t index,
+                            const TACInstruction* inst,
+                            tac_decoded_insn_t* out,
+                            tac_value_t* constants) {
+    memset(out, 0, sizeof(*out));
+    out->op = TAC_DOP_GENERIC;
+
+    switch (inst->opcode) {
+        case TAC_NOP:
+        case TAC_LABEL:
+            out->op = TAC_DOP_NOP;
+            break;
+
+        case TAC_ASSIGN:
+            out->dst = tac_decode_result(engine, &inst->result);
+            out->src1 = tac_decode_source(engine, &inst->operand1, &constants[0]);
+            if (out->dst && out->src1) {
+                out->op = TAC_DOP_MOVE;
+            }
+            break;
+
+        case TAC_ADD:
+            // Add-immediate keeps the constant in the instruction itself
+            out->dst = tac_decode_result(engine, &inst->result);
+            out->src1 = tac_decode_source(engine, &inst->operand1, &constants[0]);
+            out->src2 = tac_decode_source(engine, &inst->operand2, &constants[1]);
+            if (out->dst && out->src1 && out->src2) {
+                out->op = TAC_DOP_ADD;
+                if (inst->operand2.type == TAC_OP_IMMEDIATE && engine->config.enable_superinstructions) {
+                    out->op = TAC_DOP_ADDI;
+                    out->target = (uint32_t)inst->operand2.data.immediate.value;
+                }
+            }
+            break;
+
+        case TAC_SUB: case TAC_MUL: case TAC_DIV: case TAC_MOD:
+        case TAC_AND: case TAC_OR: case TAC_XOR: case TAC_SHL: case TAC_SHR:
+        case TAC_EQ: case TAC_NE: case TAC_LT: case TAC_LE: case TAC_GT: case TAC_GE:
+        case TAC_LOGICAL_AND: case TAC_LOGICAL_OR:
+            out->dst = tac_decode_result(engine, &inst->result);
+            out->src1 = tac_decode_source(engine, &inst->operand1, &constants[0]);
+            out->src2 = tac_decode_source(engine, &inst->operand2, &constants[1]);
+            if (out->dst && out->src1 && out->src2) {
+                out->op = (uint16_t)tac_decode_arith_op(inst->opcode);
+            }
+            break;
+
+        case TAC_NEG:
+        case TAC_NOT:
+        case TAC_BITWISE_NOT:
+            out->dst = tac_decode_result(engine, &inst->result);
+            out->src1 = tac_decode_source(engine, &inst->operand1, &constants[0]);
+            if (out->dst && out->src1) {
+                out->op = (uint16_t)tac_decode_arith_op(inst->opcode);
+            }
+            break;
+
+        case TAC_GOTO:
+            if (tac_decode_target(engine, index, &out->target)) {
+                out->op = TAC_DOP_GOTO;
+            }
+            break;
+
+        case TAC_IF_TRUE:
+        case TAC_IF_FALSE:
+            out->src1 = tac_decode_source(engine, &inst->operand1, &constants[0]);
+            if (out->src1 && tac_decode_target(engine, index, &out->target)) {
+                out->op = (inst->opcode == TAC_IF_TRUE) ? TAC_DOP_IF_TRUE : TAC_DOP_IF_FALSE;
+            }
+            break;
+
+        case TAC_PARAM:
+            out->src1 = tac_decode_source(engine, &inst->operand1, &constants[0]);
+            if (out->src1) {
+                out->op = TAC_DOP_PARAM;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    // Anything left generic must not carry half-resolved slots
+    if (out->op == TAC_DOP_GENERIC) {
+        out->dst = NULL;
+        out->src1 = NULL;
+        out->src2 = NULL;
+    }
+}
+
+// =============================================================================
+// SUPERINSTRUCTIONS
+// =============================================================================
+
+/**
+ * @brief Fuse the sequence starting at index, if its operands allow it
+ * @return true if insns[index] became a superinstruction
+ */
+typedef bool (*tac_superinsn_fuse_t)(const tac_engine_t* engine,
+                                     tac_decoded_insn_t* insns,
+                                     uint32_t index);
+
+typedef struct tac_superinsn_pattern {
+    TACOpcode first;
+    TACOpcode second;
+    tac_superinsn_fuse_t fuse;
+} tac_superinsn_pattern_t;
+
+// compare; if_false  ->  compare-and-branch
+static bool tac_fuse_cmp_branch(const tac_engine_t* engine,
+                                tac_decoded_insn_t* insns, uint32_t index) {
+    (void)engine;
+    tac_decoded_insn_t* cmp = &insns[index];
+    const tac_decoded_insn_t* branch = &insns[index + 1];
+
+    if (cmp->op < TAC_DOP_EQ || cmp->op > TAC_DOP_GE ||
+        branch->op != TAC_DOP_IF_FALSE || branch->src1 != cmp->dst) {
+        return false;
+    }
+
+    cmp->op = (uint16_t)(TAC_DOP_EQ_IF_FALSE + (cmp->op - TAC_DOP_EQ));
+    cmp->target = branch->target;
+    cmp->span = 2;
+    return true;
+}
+
+// x = y + imm; goto  ->  loop increment and back edge
+static bool tac_fuse_addi_goto(const tac_engine_t* engine,
+                               tac_decoded_insn_t* insns, uint32_t index) {
+    (void)engine;
+    tac_decoded_insn_t* add = &insns[index];
+    const tac_decoded_insn_t* jump = &insns[index + 1];
+
+    if (add->op != TAC_DOP_ADDI || jump->op != TAC_DOP_GOTO) {
+        return false;
+    }
+
+    add->op = TAC_DOP_ADDI_GOTO;
+    add->target = jump->target;
+    add->span = 2;
+    return true;
+}
+
+// param; ...; param; call  ->  push all arguments in one dispatch
+static bool tac_fuse_call_args(const tac_engine_t* engine,
+                               tac_decoded_insn_t* insns, uint32_t index) {
+    uint32_t n = 0;
+
+    while (index + n < engine->instruction_count && n < TAC_MAX_CALL_PARAMS &&
+           insns[index + n].op == TAC_DOP_PARAM) {
+        n++;
+    }
+    if (n == 0 || index + n >= engine->instruction_count ||
+        engine->instructions[index + n].opcode != TAC_CALL) {
+        return false;
+    }
+
+    insns[index].op = TAC_DOP_CALL_ARGS;
+    insns[index].span = (uint16_t)n;
+    return true;
+}
+
+/**
+ * @brief Static pattern table, also consulted by the pair profiler
+ *
+ * Patterns are tried in order; the first one that fuses wins.
+ */
+static const tac_superinsn_pattern_t tac_superinsn_patterns[] = {
+    { TAC_EQ,    TAC_IF_FALSE, tac_fuse_cmp_branch },
+    { TAC_NE,    TAC_IF_FALSE, tac_fuse_cmp_branch },
+    { TAC_LT,    TAC_IF_FALSE, tac_fuse_cmp_branch },
+    { TAC_LE,    TAC_IF_FALSE, tac_fuse_cmp_branch },
+    { TAC_GT,    TAC_IF_FALSE, tac_fuse_cmp_branch },
+    { TAC_GE,    TAC_IF_FALSE, tac_fuse_cmp_branch },
+    { TAC_ADD,   TAC_GOTO,     tac_fuse_addi_goto },
+    { TAC_PARAM, TAC_CALL,     tac_fuse_call_args },
+    { TAC_PARAM, TAC_PARAM,    tac_fuse_call_args },
+};
+
+#define TAC_SUPERINSN_PATTERN_COUNT \
+    (sizeof(tac_superinsn_patterns) / sizeof(tac_superinsn_patterns[0]))
+
+/**
+ * @brief Fuse pattern matches in a decoded program
+ * @return Number of superinstructions formed
+ */
+static uint32_t tac_fuse_program(const tac_engine_t* engine, tac_decoded_insn_t* insns) {
+    uint32_t fused = 0;
+
+    for (uint32_t i = 0; i + 1 < engine->instruction_count; i++) {
+        TACOpcode first = engine->instructions[i].opcode;
+        TACOpcode second = engine->instructions[i + 1].opcode;
+
+        for (size_t p = 0; p < TAC_SUPERINSN_PATTERN_COUNT; p++) {
+            const tac_superinsn_pattern_t* pattern = &tac_superinsn_patterns[p];
+            if (pattern->first == first && pattern->second == second &&
+                pattern->fuse(engine, insns, i)) {
+                fused++;
+                break;
+            }
+        }
+    }
+    return fused;
+}
+
+bool tac_superinsn_covers(TACOpcode first, TACOpcode second) {
+    for (size_t p = 0; p < TAC_SUPERINSN_PATTERN_COUNT; p++) {
+        if (tac_superinsn_patterns[p].first == first &&
+            tac_superinsn_patterns[p].second == second) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// =============================================================================
+// PAIR PROFILE
+// =============================================================================
+
+void tac_profile_pair(tac_engine_t* engine, uint32_t index) {
+    uint32_t prev = engine->pair_prev;
+    engine->pair_prev = index;
+
+    // Only straight-line neighbours can be fused
+    if (prev == TAC_NO_TARGET || index != prev + 1) {
+        return;
+    }
+
+    uint32_t first = engine->instructions[prev].opcode;
+    uint32_t second = engine->instructions[index].opcode;
+    if (first < TAC_PAIR_OPCODES && second < TAC_PAIR_OPCODES) {
+        engine->pair_counts[first * TAC_PAIR_OPCODES + second]++;
+    }
+}
+
+static int tac_pair_stat_compare(const void* a, const void* b) {
+    const tac_pair_stat_t* x = a;
+    const tac_pair_stat_t* y = b;
+    return (x->count < y->count) - (x->count > y->count);
+}
+
+tac_engine_error_t tac_engine_get_pair_profile(tac_engine_t* engine,
+                                               tac_pair_stat_t* pairs,
+                                               uint32_t max_pairs,
+                                               uint32_t* pair_count) {
+    if (!engine || !pair_count || (!pairs && max_pairs > 0)) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    if (!engine->pair_counts) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    uint32_t used = 0;
+    for (uint32_t i = 0; i < TAC_PAIR_OPCODES * TAC_PAIR_OPCODES; i++) {
+        used += engine->pair_counts[i] != 0;
+    }
+
+    tac_pair_stat_t* all = malloc(((size_t)used + 1) * sizeof(tac_pair_stat_t));
+    if (!all) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < TAC_PAIR_OPCODES * TAC_PAIR_OPCODES; i++) {
+        if (engine->pair_counts[i] != 0) {
+            all[n].first = (TACOpcode)(i / TAC_PAIR_OPCODES);
+            all[n].second = (TACOpcode)(i % TAC_PAIR_OPCODES);
+            all[n].count = engine->pair_counts[i];
+            all[n].fused = tac_superinsn_covers(all[n].first, all[n].second);
+            n++;
+        }
+    }
+    qsort(all, n, sizeof(tac_pair_stat_t), tac_pair_stat_compare);
+
+    *pair_count = n < max_pairs ? n : max_pairs;
+    if (*pair_count > 0) {
+        memcpy(pairs, all, (size_t)*pair_count * sizeof(tac_pair_stat_t));
+    }
+    free(all);
+    return TAC_ENGINE_OK;
+}
+
+// =============================================================================
+// PROGRAM
+// =============================================================================
+
+tac_engine_error_t tac_decode_program(tac_engine_t* engine) {
+    if (!engine || !engine->instructions) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_decoded_program_t* program = &engine->decoded;
+    tac_decoded_program_cleanup(program);
+
+    uint32_t count = engine->instruction_count;
+    program->insns = calloc((size_t)count + 1, sizeof(tac_decoded_insn_t));
+    program->constants = calloc((size_t)count * 2 + 1, sizeof(tac_value_t));
+    if (!program->insns || !program->constants) {
+        tac_decoded_program_cleanup(program);
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        tac_decode_insn(engine, i, &engine->instructions[i], &program->insns[i],
+                        &program->constants[i * 2]);
+        program->insns[i].span = 1;
+    }
+
+    if (engine->config.enable_superinstructions) {
+        uint32_t fused = tac_fuse_program(engine, program->insns);
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_DISPATCH, "Formed %u superinstructions", fused);
+    }
+
+    // Sentinel: falling off the end halts without a bounds check per step
+    program->insns[count].op = TAC_DOP_HALT;
+    program->count = count;
+    program->threaded = false;
+
+    return TAC_ENGINE_OK;
+}
+
+void tac_decoded_program_cleanup(tac_decoded_program_t* program) {
+    if (!program) {
+        return;
+    }
+
+    free(program->insns);
+    free(program->constants);
+    program->insns = NULL;
+    program->constants = NULL;
+    program->count = 0;
+    program->threaded = false;
+}
+
+// =============================================================================
+// DISPATCH LOOP
+// =============================================================================
+
+// Result write: the whole value is replaced, as in tac_execute_binary_op()
+#define TAC_SET_I32(slot, expr) \
+    do { \
+        tac_value_t result_ = {TAC_VALUE_INT32, {.i64 = 0}}; \
+        result_.data.i32 = (expr); \
+        *(slot) = result_; \
+    } while (0)
+
+// Wrapping 32-bit arithmetic without signed-overflow UB
+#define TAC_WRAP_I32(a, op, b) \
+    ((int32_t)((uint32_t)(a) op (uint32_t)(b)))
+
+tac_engine_error_t tac_run_predecoded(tac_engine_t* engine) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_decoded_program_t* program = &engine->decoded;
+    if (!program->insns || program->count != engine->instruction_count) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    tac_decoded_insn_t* const base = program->insns;
+    const uint32_t max_steps = engine->config.max_steps;
+    uint32_t steps = engine->step_count;
+    tac_decoded_insn_t* ip = &base[engine->pc < program->count ? engine->pc : program->count];
+    tac_engine_error_t err = TAC_ENGINE_OK;
+
+    engine->state = TAC_ENGINE_RUNNING;
+
+#if TAC_THREADED_DISPATCH
+    static const void* const dispatch_table[TAC_DOP_COUNT] = {
+        [TAC_DOP_GENERIC]     = &&op_generic,
+        [TAC_DOP_NOP]         = &&op_nop,
+        [TAC_DOP_MOVE]        = &&op_move,
+        [TAC_DOP_ADD]         = &&op_add,
+        [TAC_DOP_SUB]         = &&op_sub,
+        [TAC_DOP_MUL]         = &&op_mul,
+        [TAC_DOP_DIV]         = &&op_div,
+        [TAC_DOP_MOD]         = &&op_mod,
+        [TAC_DOP_AND]         = &&op_and,
+        [TAC_DOP_OR]          = &&op_or,
+        [TAC_DOP_XOR]         = &&op_xor,
+        [TAC_DOP_SHL]         = &&op_shl,
+        [TAC_DOP_SHR]         = &&op_shr,
+        [TAC_DOP_EQ]          = &&op_eq,
+        [TAC_DOP_NE]          = &&op_ne,
+        [TAC_DOP_LT]          = &&op_lt,
+        [TAC_DOP_LE]          = &&op_le,
+        [TAC_DOP_GT]          = &&op_gt,
+        [TAC_DOP_GE]          = &&op_ge,
+        [TAC_DOP_LOGICAL_AND] = &&op_logical_and,
+        [TAC_DOP_LOGICAL_OR]  = &&op_logical_or,
+        [TAC_DOP_NEG]         = &&op_neg,
+        [TAC_DOP_NOT]         = &&op_not,
+        [TAC_DOP_BITWISE_NOT] = &&op_bitwise_not,
+        [TAC_DOP_GOTO]        = &&op_goto,
+        [TAC_DOP_IF_TRUE]     = &&op_if_true,
+        [TAC_DOP_IF_FALSE]    = &&op_if_false,
+        [TAC_DOP_PARAM]       = &&op_param,
+        [TAC_DOP_ADDI]        = &&op_addi,
+        [TAC_DOP_EQ_IF_FALSE] = &&op_eq_if_false,
+        [TAC_DOP_NE_IF_FALSE] = &&op_ne_if_false,
+        [TAC_DOP_LT_IF_FALSE] = &&op_lt_if_false,
+        [TAC_DOP_LE_IF_FALSE] = &&op_le_if_false,
+        [TAC_DOP_GT_IF_FALSE] = &&op_gt_if_false,
+        [TAC_DOP_GE_IF_FALSE] = &&op_ge_if_false,
+        [TAC_DOP_ADDI_GOTO]   = &&op_addi_goto,
+        [TAC_DOP_CALL_ARGS]   = &&op_call_args,
+        [TAC_DOP_HALT]        = &&op_halt,
+    };
+
+    // Bind handlers once per decoded program
+    if (!program->threaded) {
+        for (uint32_t i = 0; i <= program->count; i++) {
+            base[i].handler = dispatch_table[base[i].op];
+        }
+        program->threaded = true;
+    }
+
+#define TAC_OP(name)    op_##name
+#define TAC_DISPATCH()  goto *ip->handler
+#else
+#define TAC_OP(name)    case_##name
+#define TAC_DISPATCH()  goto dispatch
+#endif
+
+    // One step accounting point for every instruction, control flow included
+#define TAC_NEXT() \
+    do { \
+        if (++steps >= max_steps) goto out_of_steps; \
+        TAC_DISPATCH(); \
+    } while (0)
+
+    // Superinstructions account for every source instruction at once; the
+    // caller has checked that the step limit is not reached on the way
+#define TAC_NEXT_SPAN(n) \
+    do { \
+        steps += (n); \
+        TAC_DISPATCH(); \
+    } while (0)
+
+    // True if a superinstruction could hit the step limit part way through
+#define TAC_SPAN_LIMITED(n) (max_steps - steps <= (n))
+
+#define TAC_BINARY_I32(name, expr) \
+    TAC_OP(name): { \
+        if (ip->src1->type != TAC_VALUE_INT32) goto TAC_OP(generic); \
+        const int32_t a = ip->src1->data.i32; \
+        const int32_t b = ip->src2->data.i32; \
+        TAC_SET_I32(ip->dst, (expr)); \
+        ip++; \
+        TAC_NEXT(); \
+    }
+
+#if TAC_THREADED_DISPATCH
+    TAC_DISPATCH();
+#else
+dispatch:
+    switch (ip->op) {
+        case TAC_DOP_GENERIC:     goto TAC_OP(generic);
+        case TAC_DOP_NOP:         goto TAC_OP(nop);
+        case TAC_DOP_MOVE:        goto TAC_OP(move);
+        case TAC_DOP_ADD:         goto TAC_OP(add);
+        case TAC_DOP_SUB:         goto TAC_OP(sub);
+        case TAC_DOP_MUL:         goto TAC_OP(mul);
+        case TAC_DOP_DIV:         goto TAC_OP(div);
+        case TAC_DOP_MOD:         goto TAC_OP(mod);
+        case TAC_DOP_AND:         goto TAC_OP(and);
+        case TAC_DOP_OR:          goto TAC_OP(or);
+        case TAC_DOP_XOR:         goto TAC_OP(xor);
+        case TAC_DOP_SHL:         goto TAC_OP(shl);
+        case TAC_DOP_SHR:         goto TAC_OP(shr);
+        case TAC_DOP_EQ:          goto TAC_OP(eq);
+        case TAC_DOP_NE:          goto TAC_OP(ne);
+        case TAC_DOP_LT:          goto TAC_OP(lt);
+        case TAC_DOP_LE:          goto TAC_OP(le);
+        case TAC_DOP_GT:          goto TAC_OP(gt);
+        case TAC_DOP_GE:          goto TAC_OP(ge);
+        case TAC_DOP_LOGICAL_AND: goto TAC_OP(logical_and);
+        case TAC_DOP_LOGICAL_OR:  goto TAC_OP(logical_or);
+        case TAC_DOP_NEG:         goto TAC_OP(neg);
+        case TAC_DOP_NOT:         goto TAC_OP(not);
+        case TAC_DOP_BITWISE_NOT: goto TAC_OP(bitwise_not);
+        case TAC_DOP_GOTO:        goto TAC_OP(goto);
+        case TAC_DOP_IF_TRUE:     goto TAC_OP(if_true);
+        case TAC_DOP_IF_FALSE:    goto TAC_OP(if_false);
+        case TAC_DOP_PARAM:       goto TAC_OP(param);
+        case TAC_DOP_ADDI:        goto TAC_OP(addi);
+        case TAC_DOP_EQ_IF_FALSE: goto TAC_OP(eq_if_false);
+        case TAC_DOP_NE_IF_FALSE: goto TAC_OP(ne_if_false);
+        case TAC_DOP_LT_IF_FALSE: goto TAC_OP(lt_if_false);
+        case TAC_DOP_LE_IF_FALSE: goto TAC_OP(le_if_false);
+        case TAC_DOP_GT_IF_FALSE: goto TAC_OP(gt_if_false);
+        case TAC_DOP_GE_IF_FALSE: goto TAC_OP(ge_if_false);
+        case TAC_DOP_ADDI_GOTO:   goto TAC_OP(addi_goto);
+        case TAC_DOP_CALL_ARGS:   goto TAC_OP(call_args);
+        case TAC_DOP_HALT:        goto TAC_OP(halt);
+        default:                  goto TAC_OP(generic);
+    }
+#endif
+
+    TAC_OP(generic): {
+        // Synchronize engine state and defer to the interpreter
+        uint32_t index = (uint32_t)(ip - base);
+        engine->pc = index;
+        engine->step_count = steps;
+        err = tac_execute_instruction(engine, &engine->instructions[index]);
+        if (err != TAC_ENGINE_OK) {
+            engine->state = TAC_ENGINE_ERROR;
+            return err;
+        }
+        ip = &base[engine->pc < program->count ? engine->pc : program->count];
+
+        // Tiered mode: a call boundary into interpreted code leaves this loop
+        if (engine->tier && tac_is_call_boundary(engine->instructions[index].opcode) &&
+            !tac_tier_call_boundary(engine, engine->instructions[index].opcode)) {
+            if (++steps >= max_steps) goto out_of_steps;
+            engine->pc = (uint32_t)(ip - base);
+            engine->step_count = steps;
+            return TAC_ENGINE_OK;
+        }
+        TAC_NEXT();
+    }
+
+    TAC_OP(nop): {
+        ip++;
+        TAC_NEXT();
+    }
+
+    TAC_OP(move): {
+        *ip->dst = *ip->src1;
+        ip++;
+        TAC_NEXT();
+    }
+
+    TAC_BINARY_I32(add, TAC_WRAP_I32(a, +, b))
+    TAC_BINARY_I32(sub, TAC_WRAP_I32(a, -, b))
+    TAC_BINARY_I32(mul, TAC_WRAP_I32(a, *, b))
+    TAC_BINARY_I32(and, a & b)
+    TAC_BINARY_I32(or, a | b)
+    TAC_BINARY_I32(xor, a ^ b)
+    TAC_BINARY_I32(shl, tac_shl_i32(a, b))
+    TAC_BINARY_I32(shr, tac_shr_i32(a, b))
+    TAC_BINARY_I32(eq, (a == b) ? 1 : 0)
+    TAC_BINARY_I32(ne, (a != b) ? 1 : 0)
+    TAC_BINARY_I32(lt, (a < b) ? 1 : 0)
+    TAC_BINARY_I32(le, (a <= b) ? 1 : 0)
+    TAC_BINARY_I32(gt, (a > b) ? 1 : 0)
+    TAC_BINARY_I32(ge, (a >= b) ? 1 : 0)
+    TAC_BINARY_I32(logical_and, (a && b) ? 1 : 0)
+    TAC_BINARY_I32(logical_or, (a || b) ? 1 : 0)
+
+    TAC_OP(div): {
+        // Zero divisors take the generic path for the error report
+        if (ip->src1->type != TAC_VALUE_INT32 || ip->src2->data.i32 == 0) {
+            goto TAC_OP(generic);
+        }
+        TAC_SET_I32(ip->dst, tac_div_i32(ip->src1->data.i32, ip->src2->data.i32));
+        ip++;
+        TAC_NEXT();
+    }
+
+    TAC_OP(mod): {
+        if (ip->src1->type != TAC_VALUE_INT32 || ip->src2->data.i32 == 0) {
+            goto TAC_OP(generic);
+        }
+        TAC_SET_I32(ip->dst, tac_mod_i32(ip->src1->data.i32, ip->src2->data.i32));
+        ip++;
+        TAC_NEXT();
+    }
+
+    TAC_OP(neg): {
+        if (ip->src1->type != TAC_VALUE_INT32) goto TAC_OP(generic);
+        TAC_SET_I32(ip->dst, TAC_WRAP_I32(0, -, ip->src1->data.i32));
+        ip++;
+        TAC_NEXT();
+    }
+
+    TAC_OP(not): {
+        if (ip->src1->type != TAC_VALUE_INT32) goto TAC_OP(generic);
+        TAC_SET_I32(ip->dst, !ip->src1->data.i32 ? 1 : 0);
+        ip++;
+        TAC_NEXT();
+    }
+
+    TAC_OP(bitwise_not): {
+        if (ip->src1->type != TAC_VALUE_INT32) goto TAC_OP(generic);
+        TAC_SET_I32(ip->dst, ~ip->src1->data.i32);
+        ip++;
+        TAC_NEXT();
+    }
+
+    TAC_OP(goto): {
+        ip = &base[ip->target];
+        TAC_NEXT();
+    }
+
+    TAC_OP(if_true): {
+        if (ip->src1->type != TAC_VALUE_INT32) goto TAC_OP(generic);
+        ip = ip->src1->data.i32 != 0 ? &base[ip->target] : ip + 1;
+        TAC_NEXT();
+    }
+
+    TAC_OP(if_false): {
+        if (ip->src1->type != TAC_VALUE_INT32) goto TAC_OP(generic);
+        ip = ip->src1->data.i32 == 0 ? &base[ip->target] : ip + 1;
+        TAC_NEXT();
+    }
+
+    TAC_OP(param): {
+        // Overflow of the parameter stack is reported by the interpreter
+        if (engine->param_counter >= TAC_MAX_CALL_PARAMS) goto TAC_OP(generic);
+        engine->param_stack[engine->param_counter++] = *ip->src1;
+        ip++;
+        TAC_NEXT();
+    }
+
+    TAC_OP(addi): {
+        if (ip->src1->type != TAC_VALUE_INT32) goto TAC_OP(generic);
+        TAC_SET_I32(ip->dst, TAC_WRAP_I32(ip->src1->data.i32, +, ip->target));
+        ip++;
+        TAC_NEXT();
+    }
+
+    // Fused compare and TAC_IF_FALSE; the compare result is still stored
+#define TAC_CMP_IF_FALSE_I32(name, cmp, op) \
+    TAC_OP(name): { \
+        if (ip->src1->type != TAC_VALUE_INT32 || TAC_SPAN_LIMITED(2)) goto TAC_OP(cmp); \
+        const int32_t taken = !(ip->src1->data.i32 op ip->src2->data.i32); \
+        TAC_SET_I32(ip->dst, !taken); \
+        ip = taken ? &base[ip->target] : ip + 2; \
+        TAC_NEXT_SPAN(2); \
+    }
+
+    TAC_CMP_IF_FALSE_I32(eq_if_false, eq, ==)
+    TAC_CMP_IF_FALSE_I32(ne_if_false, ne, !=)
+    TAC_CMP_IF_FALSE_I32(lt_if_false, lt, <)
+    TAC_CMP_IF_FALSE_I32(le_if_false, le, <=)
+    TAC_CMP_IF_FALSE_I32(gt_if_false, gt, >)
+    TAC_CMP_IF_FALSE_I32(ge_if_false, ge, >=)
+
+#undef TAC_CMP_IF_FALSE_I32
+
+    TAC_OP(addi_goto): {
+        // src2 is the immediate from the constant pool, always int32
+        if (ip->src1->type != TAC_VALUE_INT32 || TAC_SPAN_LIMITED(2)) goto TAC_OP(add);
+        TAC_SET_I32(ip->dst, TAC_WRAP_I32(ip->src1->data.i32, +, ip->src2->data.i32));
+        ip = &base[ip->target];
+        TAC_NEXT_SPAN(2);
+    }
+
+    TAC_OP(call_args): {
+        const uint32_t n = ip->span;
+        if (engine->param_counter + n > TAC_MAX_CALL_PARAMS || TAC_SPAN_LIMITED(n)) {
+            goto TAC_OP(param);
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            engine->param_stack[engine->param_counter++] = *ip[i].src1;
+        }
+        ip += n;
+        steps += n;
+
+        // The TAC_CALL itself goes through the interpreter
+        goto TAC_OP(generic);
+    }
+
+    TAC_OP(halt): {
+        engine->pc = (uint32_t)(ip - base);
+        engine->step_count = steps;
+        engine->state = TAC_ENGINE_FINISHED;
+        return TAC_ENGINE_OK;
+    }
+
+out_of_steps:
+    engine->pc = (uint32_t)(ip - base);
+    engine->step_count = steps;
+    tac_set_error(engine, TAC_ENGINE_ERR_MAX_STEPS,
+                 "Execution exceeded maximum steps: %u", max_steps);
+    engine->state = TAC_ENGINE_STOPPED;
+    return TAC_ENGINE_ERR_MAX_STEPS;
+
+#undef TAC_BINARY_I32
+#undef TAC_SPAN_LIMITED
+#undef TAC_NEXT_SPAN
+#undef TAC_NEXT
+#undef TAC_DISPATCH
+#undef TAC_OP
+}
@@ -17,36 +17,99 @@
 #include "tac_engine.h"
 #include <stdio.h>
 
+// Virtual memory layout: 4 KB pages, page 0 never mapped (NULL guard)
+#define TAC_PAGE_SHIFT          12
+#define TAC_PAGE_SIZE           (1u << TAC_PAGE_SHIFT)
+#define TAC_PAGE_MASK           (TAC_PAGE_SIZE - 1u)
+#define TAC_MEMORY_BASE         TAC_PAGE_SIZE
+#define TAC_SIZE_CLASS_COUNT    8       // 16, 32, ... 2048 bytes
+#define TAC_SIZE_CLASS_MAX      (16u << (TAC_SIZE_CLASS_COUNT - 1))
+
+// TAC_ADDR results: the top 1 MB of the address space, never mapped, so
+// loads and stores through the address of a variable or temporary fault
+#define TAC_ADDR_RESERVED_BASE  0xFFF00000u
+#define TAC_ADDR_VAR_BASE       TAC_ADDR_RESERVED_BASE
+#define TAC_ADDR_TEMP_BASE      (TAC_ADDR_RESERVED_BASE + 0x40000u)
+#define TAC_ADDR_OTHER          (TAC_ADDR_RESERVED_BASE + 0x80000u)
+
 /**
- * @brief Virtual memory block
+ * @brief Free large block (allocations above TAC_SIZE_CLASS_MAX)
  */
 typedef struct tac_memory_block {
-    uint32_t address;               // Virtual address
-    uint32_t size;                  // Block size
-    uint8_t* data;                  // Actual data
-    bool allocated;                 // Allocation status
-    struct tac_memory_block* next;  // Next block in list
+    uint32_t address;               // Virtual address of the payload
+    uint32_t size;                  // Payload size
+    struct tac_memory_block* next;  // Next free large block
 } tac_memory_block_t;
 
 /**
  * @brief Virtual memory manager
+ *
+ * Flat page table over a 32-bit address space. Pages are allocated on first
+ * write; reads of untouched pages return zeroes. Small blocks come from
+ * per-size-class free lists threaded through the freed payloads themselves.
+ * Host pages may be shared with snapshots and forks and are copied on write.
  */
 typedef struct tac_memory_manager {
-    tac_memory_block_t* blocks;     // Linked list of memory blocks
-    uint32_t next_address;          // Next available address
-    uint32_t total_allocated;       // Total allocated bytes
-    uint32_t max_size;              // Maximum memory size
+    uint8_t** pages;                // Page table (NULL entries not yet touched)
+    uint32_t page_count;            // Number of page table entries
+    uint32_t limit;                 // End of the address space
+    uint32_t brk;                   // End of the carved heap
+    uint32_t free_lists[TAC_SIZE_CLASS_COUNT]; // Free small blocks (0 = empty)
+    tac_memory_block_t* large_free; // Free large blocks
+    uint32_t total_allocated;       // Live payload bytes
+    uint32_t pages_touched;         // Pages backed by host memory
+    uint32_t pages_copied;          // Shared pages copied on write
+    uint32_t max_size;              // Maximum heap size
+    bool bounds_check;              // Reject accesses outside [base, brk)
 } tac_memory_manager_t;
 
+#define TAC_MAX_CALL_PARAMS     10      // Arguments staged by TAC_PARAM per call
+
+// FNV-1a, for program and state identity (snapshots, input logs)
+#define TAC_FNV_OFFSET          2166136261u
+#define TAC_FNV_PRIME           16777619u
+
+/**
+ * @brief Per-function metadata, derived from the loaded code
+ *
+ * A function is a CALL target; its body is everything reachable from the
+ * entry without following calls. Its parameters and the slots it owns
+ * (variables and temporaries referenced by no other function or top-level
+ * code) are listed in engine->function_slots[slot_base ...], parameters
+ * first.
+ */
+typedef struct tac_function_info {
+    uint32_t entry;                 // Entry instruction (usually its label)
+    uint32_t param_count;           // Leading slots bound from TAC_PARAM
+    uint32_t slot_base;             // First entry in engine->function_slots
+    uint32_t slot_count;            // Parameters and owned slots
+    uint32_t save_count;            // Leading slots saved on every call (shared parameters)
+    uint32_t active;                // Live activations (>0: calls re-enter)
+} tac_function_info_t;
+
+/**
+ * @brief Hotness of one function under TAC_EXEC_TIERED (tac_engine_tier.c)
+ */
+typedef struct tac_tier_counter {
+    uint32_t entries;               // Calls into the function
+    uint32_t back_edges;            // Backward jumps taken inside it
+    bool promoted;                  // Runs in the pre-decoded tier
+} tac_tier_counter_t;
+
 /**
  * @brief Call stack frame
+ *
+ * Frames live in one contiguous array that doubles when full, up to
+ * max_call_depth entries (unbounded if 0). Only re-entrant activations save
+ * the callee's slots, into the shared value stack, which grows the same
+ * way; popping a frame rewinds the value stack pointer.
  */
 typedef struct tac_stack_frame {
     uint32_t return_address;        // Return instruction address
-    uint32_t local_var_base;        // Base for local variables
-    uint32_t param_count;           // Number of parameters
-    tac_value_t* locals;            // Local variable storage
-    struct tac_stack_frame* prev;   // Previous frame
+    uint32_t call_site;             // CALL instruction receiving the result
+    uint32_t function;              // Callee index or TAC_NO_TARGET
+    uint32_t save_base;             // First saved slot in the value stack
+    uint32_t save_count;            // Saved slots (0 unless re-entrant)
 } tac_stack_frame_t;
 
 /**
@@ -57,18 +120,43 @@ typedef struct tac_hook_entry {
     tac_hook_type_t type;           // Hook type
     tac_hook_callback_t callback;   // Callback function
     void* user_data;                // User data
-    bool enabled;                   // Hook enabled flag
-    struct tac_hook_entry* next;    // Next hook in list
+    bool enabled;                   // Cleared when removed during dispatch
+    struct tac_hook_entry* next;    // Next hook of the same type
 } tac_hook_entry_t;
 
+#define TAC_HOOK_TYPE_COUNT     (TAC_HOOK_ERROR + 1)
+
 /**
- * @brief Breakpoint entry
+ * @brief Instrumentation mask bits (tac_engine.instrumentation)
+ *
+ * The mask is zero unless something observes execution, so the dispatch
+ * loop tests one word per instruction and only then looks at which
+ * observers are active. Anything nonzero also keeps execution in the
+ * interpreter rather than the predecoded, bytecode or native paths.
  */
-typedef struct tac_breakpoint {
-    uint32_t address;               // Instruction address
-    bool enabled;                   // Breakpoint enabled
-    struct tac_breakpoint* next;    // Next breakpoint
-} tac_breakpoint_t;
+#define TAC_INSTR_BREAKPOINTS   (1u << 0)   // At least one breakpoint set
+#define TAC_INSTR_PAIRS         (1u << 1)   // Opcode pair profiling
+#define TAC_INSTR_PROFILE       (1u << 2)   // Execution profile
+#define TAC_INSTR_TRACE         (1u << 3)   // Binary trace stream
+#define TAC_INSTR_STOP          (1u << 4)   // Pause requested mid-instruction
+#define TAC_INSTR_WATCH         (1u << 5)   // At least one watchpoint set
+#define TAC_INSTR_REPLAY        (1u << 6)   // Replaying a recording (tac_replay_open)
+#define TAC_INSTR_HOOK(type)    (1u << (8 + (unsigned)(type)))  // Hooks of a type registered
+
+// Observers checked where slots and memory are written or read rather
+// than on every step; they only need the interpreter's store paths
+#define TAC_INSTR_ACCESS_ONLY   (TAC_INSTR_WATCH | TAC_INSTR_HOOK(TAC_HOOK_MEMORY_READ) | \
+                                 TAC_INSTR_HOOK(TAC_HOOK_MEMORY_WRITE))
+
+/**
+ * @brief Watchpoint entry
+ */
+typedef struct tac_watchpoint {
+    uint32_t id;                    // Unique watchpoint ID
+    tac_watch_kind_t kind;
+    uint32_t location;              // Register slot, or first watched address
+    uint32_t size;                  // Watched bytes (memory), 1 otherwise
+} tac_watchpoint_t;
 
 /**
  * @brief Execution trace entry
@@ -92,6 +180,42 @@ typedef struct tac_trace_buffer {
     bool enabled;                   // Tracing enabled
 } tac_trace_buffer_t;
 
+/**
+ * @brief Streaming binary trace writer (tac_engine_trace.c)
+ */
+typedef struct tac_trace_stream tac_trace_stream_t;
+
+/**
+ * @brief Input log writer (tac_engine_replay.c)
+ */
+typedef struct tac_recorder tac_recorder_t;
+
+/**
+ * @brief When, relative to the step at engine->step_count, a host input happens
+ *
+ * Hosts call the API between steps, or from hooks: instruction hooks run
+ * before a step, memory hooks at its memory access, call, return and
+ * error hooks after it.
+ */
+typedef enum tac_input_phase {
+    TAC_INPUT_BEFORE = 0,
+    TAC_INPUT_MEMORY,
+    TAC_INPUT_AFTER
+} tac_input_phase_t;
+
+/**
+ * @brief Input log record kinds
+ */
+typedef enum tac_record_kind {
+    TAC_RECORD_END = 0,             // Recording stopped
+    TAC_RECORD_SET_VAR,             // tac_engine_set_var()
+    TAC_RECORD_SET_TEMP,            // tac_engine_set_temp()
+    TAC_RECORD_MEM_WRITE,           // tac_engine_mem_write()
+    TAC_RECORD_MALLOC,              // tac_engine_malloc() and the address it returned
+    TAC_RECORD_FREE,                // tac_engine_free()
+    TAC_RECORD_RESUME               // tac_engine_run()/tac_engine_step() from a PC
+} tac_record_kind_t;
+
 /**
  * @brief Label table entry for jump resolution
  */
@@ -101,6 +225,14 @@ typedef struct tac_label_entry {
     struct tac_label_entry* next;   // Next entry in hash table
 } tac_label_entry_t;
 
+/**
+ * @brief Sentinel for instructions without a resolved branch/call target
+ */
+#define TAC_NO_TARGET UINT32_MAX
+
+// Opcodes below this value are tracked by the pair profiler
+#define TAC_PAIR_OPCODES        0x70
+
 /**
  * @brief Label resolution table
  */
@@ -109,6 +241,130 @@ typedef struct tac_label_table {
     uint32_t count;                 // Number of labels
 } tac_label_table_t;
 
+/**
+ * @brief Decoded operations for the pre-decoded dispatch loop
+ *
+ * Each TACInstruction is lowered to one of these at load time. Anything the
+ * fast loop does not specialize is executed through TAC_DOP_GENERIC, which
+ * falls back to tac_execute_instruction() on the original instruction.
+ */
+typedef enum tac_decoded_op {
+    TAC_DOP_GENERIC = 0,            // Fallback to tac_execute_instruction()
+    TAC_DOP_NOP,                    // TAC_NOP / TAC_LABEL
+    TAC_DOP_MOVE,                   // dst = src1
+    TAC_DOP_ADD,
+    TAC_DOP_SUB,
+    TAC_DOP_MUL,
+    TAC_DOP_DIV,
+    TAC_DOP_MOD,
+    TAC_DOP_AND,
+    TAC_DOP_OR,
+    TAC_DOP_XOR,
+    TAC_DOP_SHL,
+    TAC_DOP_SHR,
+    TAC_DOP_EQ,
+    TAC_DOP_NE,
+    TAC_DOP_LT,
+    TAC_DOP_LE,
+    TAC_DOP_GT,
+    TAC_DOP_GE,
+    TAC_DOP_LOGICAL_AND,
+    TAC_DOP_LOGICAL_OR,
+    TAC_DOP_NEG,
+    TAC_DOP_NOT,
+    TAC_DOP_BITWISE_NOT,
+    TAC_DOP_GOTO,                   // pc = target
+    TAC_DOP_IF_TRUE,                // if (src1) pc = target
+    TAC_DOP_IF_FALSE,               // if (!src1) pc = target
+    TAC_DOP_PARAM,                  // param_stack[param_counter++] = src1
+
+    // Superinstructions (see tac_superinsn_patterns in tac_engine_dispatch.c)
+    TAC_DOP_ADDI,                   // dst = src1 + (int32_t)target
+    TAC_DOP_EQ_IF_FALSE,            // dst = src1 == src2; if (!dst) pc = target
+    TAC_DOP_NE_IF_FALSE,
+    TAC_DOP_LT_IF_FALSE,
+    TAC_DOP_LE_IF_FALSE,
+    TAC_DOP_GT_IF_FALSE,
+    TAC_DOP_GE_IF_FALSE,
+    TAC_DOP_ADDI_GOTO,              // dst = src1 + src2; pc = target
+    TAC_DOP_CALL_ARGS,              // span TAC_PARAMs, then the TAC_CALL
+
+    TAC_DOP_HALT,                   // End-of-code sentinel
+    TAC_DOP_COUNT
+} tac_decoded_op_t;
+
+/**
+ * @brief Pre-decoded instruction
+ *
+ * Operands are resolved once to pointers into the engine's temporary and
+ * variable arrays (or into the constant pool for immediates), so the hot
+ * loop never switches on TACOperand::type or re-checks bounds.
+ *
+ * A superinstruction replaces the first entry of the sequence it covers;
+ * the following entries keep their own decoding, so branches into the
+ * middle of a fused sequence still execute correctly.
+ */
+typedef struct tac_decoded_insn {
+    const void* handler;            // Threaded dispatch target (computed goto)
+    tac_value_t* dst;               // Result slot
+    const tac_value_t* src1;        // First source slot
+    const tac_value_t* src2;        // Second source slot
+    uint32_t target;                // Resolved branch target
+    uint16_t op;                    // tac_decoded_op_t
+    uint16_t span;                  // Source instructions covered (superinstructions)
+} tac_decoded_insn_t;
+
+/**
+ * @brief Pre-decoded program
+ */
+typedef struct tac_decoded_program {
+    tac_decoded_insn_t* insns;      // instruction_count + 1 (HALT sentinel)
+    tac_value_t* constants;         // Constant pool for immediate operands
+    uint32_t count;                 // Number of decoded instructions
+    bool threaded;                  // Handlers bound to dispatch labels
+} tac_decoded_program_t;
+
+/**
+ * @brief Register bytecode program (tac_engine_vm.c)
+ */
+typedef struct tac_bytecode {
+    uint32_t* code;                 // Instruction words, HALT last
+    uint32_t* offsets;              // Word offset per TAC instruction (count + 1)
+    uint32_t size;                  // Words in code
+    uint32_t count;                 // TAC instructions compiled
+} tac_bytecode_t;
+
+/**
+ * @brief Native code for a loaded program (tac_engine_jit.c)
+ */
+typedef struct tac_jit_code tac_jit_code_t;
+
+/**
+ * @brief Calling context tree node (tac_engine_profile.c)
+ */
+typedef struct tac_profile_node {
+    uint32_t function;              // Callee index, TAC_NO_TARGET for the root
+    uint32_t parent;                // Parent node or TAC_NO_TARGET
+    uint32_t first_child;           // Child list head or TAC_NO_TARGET
+    uint32_t next_sibling;          // Next child of the parent
+    uint32_t depth;                 // Call depth (root: 0)
+    uint64_t steps;                 // Steps executed directly in this context
+    uint64_t calls;                 // Times this context was entered
+} tac_profile_node_t;
+
+/**
+ * @brief Execution profile of the loaded program (config.enable_profile)
+ */
+typedef struct tac_profile_data {
+    uint64_t* executed;             // Per instruction: times executed
+    uint64_t* taken;                // Per instruction: conditional branches taken
+    tac_profile_node_t* nodes;      // Calling context tree, nodes[0] = top level
+    uint32_t node_count;
+    uint32_t node_capacity;
+    uint32_t current;               // Node of the executing activation
+    tac_function_profile_t* functions; // function_count + 1, see tac_engine_get_profile()
+} tac_profile_data_t;
+
 /**
  * @brief Symbol table integration for TAC engine
  */
@@ -116,6 +372,13 @@ typedef struct tac_symbol_context {
     bool loaded;                    // Symbol table loaded flag
     char symtab_filename[256];      // Symbol table file path
     char sstore_filename[256];      // String store file path
+
+    // Instance-owned copies of both files, so engines never touch the
+    // process-wide symtab/sstore state and can run on separate threads
+    SymTabEntry* entries;           // Symbol table, entries[id - 1]
+    uint32_t entry_count;
+    char* strings;                  // String store image
+    size_t strings_size;
     
     // Symbol resolution cache (for performance)
     struct {
@@ -146,11 +409,23 @@ struct tac_engine {
     // Code storage
     TACInstruction* instructions;   // Loaded instructions
     uint32_t instruction_count;     // Number of instructions
-    tac_label_table_t label_table;  // Label resolution table
+    uint32_t code_hash;             // Hash of the program, see tac_engine_restore()
+    TACFunction* function_records;  // Function metadata, see tac_engine_load_program()
+    uint32_t function_record_count; // Number of function records
+    tac_label_table_t label_table;  // Label resolution table (tooling, load time)
+    uint32_t* jump_targets;         // Per-instruction resolved target or TAC_NO_TARGET
+    tac_decoded_program_t decoded;  // Pre-decoded form (TAC_EXEC_PREDECODED, TIERED once hot)
+    tac_bytecode_t bytecode;        // Register bytecode (TAC_EXEC_BYTECODE)
+    tac_jit_code_t* jit;            // Native code (TAC_EXEC_JIT)
+    void* jit_entry;                // Entry trampoline into jit code
+    uint64_t* pair_counts;          // [TAC_PAIR_OPCODES^2] when pair profiling
+    uint32_t pair_prev;             // Last profiled instruction or TAC_NO_TARGET
+    tac_profile_data_t* profile;    // Execution profile (config.enable_profile)
 
     // Variable storage
-    tac_value_t* temporaries;       // Temporary variables
-    tac_value_t* variables;         // Named variables
+    tac_value_t* registers;         // max_variables + max_temporaries slots
+    tac_value_t* temporaries;       // Temporary variables (inside registers)
+    tac_value_t* variables;         // Named variables (start of registers)
     uint32_t temp_count;            // Number of temporaries
     uint32_t var_count;             // Number of variables
 
@@ -158,20 +433,63 @@ struct tac_engine {
     tac_memory_manager_t memory;
 
     // Call stack
-    tac_stack_frame_t* call_stack;
+    tac_stack_frame_t* frames;      // frame_capacity frames, see tac_reserve_call_stack()
+    uint32_t frame_capacity;
     uint32_t call_depth;
-    uint32_t last_call_instruction;  // Address of last CALL instruction for return value handling
+    tac_value_t* value_stack;       // Slots saved by re-entrant calls
+    uint32_t value_stack_size;
+    uint32_t value_sp;
     uint32_t param_counter;          // Counter for parameter passing
-    tac_value_t param_stack[10];     // Temporary parameter storage for function calls
+    tac_value_t param_stack[TAC_MAX_CALL_PARAMS]; // Arguments for the next call
+
+    // Function metadata (load time)
+    tac_function_info_t* functions; // Sorted by entry
+    uint32_t function_count;
+    tac_value_t** function_slots;   // Slot storage, see tac_function_info_t
+    uint32_t* call_functions;       // Per-instruction callee index or TAC_NO_TARGET
+
+    // Tiered execution, see tac_run_tiered()
+    tac_tier_counter_t* tier;       // function_count + 1, top level last (TAC_EXEC_TIERED)
+    uint32_t tier_promotions;       // Counters that reached their threshold
+    uint32_t tier_switches;         // Entries into the pre-decoded tier
+
+    // Static slot types, see tac_types_infer()
+    uint32_t* dynamic_slots;        // Bitmap, slots that may hold a non-int32 value
+    uint32_t* int32_ops;            // Bitmap, instructions run by tac_execute_binary_i32()
 
     // Symbol table integration
     tac_symbol_context_t symbols;
 
     // Debugging support
-    tac_hook_entry_t* hooks;
+    uint32_t instrumentation;       // TAC_INSTR_* bits, see tac_update_instrumentation()
+    tac_hook_entry_t* hooks[TAC_HOOK_TYPE_COUNT]; // Per type, in registration order
+    uint32_t hook_counts[TAC_HOOK_TYPE_COUNT];
     uint32_t next_hook_id;
-    tac_breakpoint_t* breakpoints;
+    uint32_t hook_depth;            // Nested hook dispatches; removal is deferred while > 0
+    bool hook_purge;                // Hooks removed during a dispatch await unlinking
+    bool hook_stop;                 // A hook or watchpoint asked to pause after the instruction
+    uint32_t* breakpoints;          // Bitmap, one bit per instruction
+    uint32_t breakpoint_count;      // Bits set
+    uint32_t paused_at;             // Instruction whose stop was reported, or TAC_NO_TARGET
+    tac_watchpoint_t* watches;      // Watchpoints, in ID order
+    uint32_t watch_count;
+    uint32_t watch_capacity;
+    uint32_t next_watch_id;
+    uint32_t* watch_slots;          // Shadow bitmap, one bit per register slot
+    uint32_t* watch_pages;          // Shadow bitmap, one bit per memory page
+    tac_watch_hit_t watch_hit;      // Last hit (valid if watch_hit_valid)
+    bool watch_hit_valid;
     tac_trace_buffer_t trace;
+    tac_trace_stream_t* trace_stream; // Binary trace file (tac_engine_trace_to_file)
+
+    // Record and replay, see tac_engine_replay.c
+    tac_recorder_t* recorder;       // Input log being written (tac_engine_record_to_file)
+    tac_replay_t* replay;           // Replay driving this engine (tac_replay_open)
+    uint8_t input_phase;            // tac_input_phase_t of host calls made now
+
+    // Diagnostics
+    tac_engine_log_sink_t log_sink; // NULL: default stderr sink
+    void* log_user_data;
 
     // Error context
     char error_message[256];        // Detailed error message
@@ -213,6 +531,17 @@ tac_engine_error_t tac_build_label_table(tac_engine_t* engine);
  */
 tac_engine_error_t tac_resolve_label(const tac_label_table_t* table, uint16_t label_id, uint32_t* address);
 
+/**
+ * @brief Resolve every GOTO, IF_TRUE/IF_FALSE and CALL target to an instruction index
+ * @param engine TAC engine with instructions and label table built
+ * @return TAC_ENGINE_OK on success
+ *
+ * Fills engine->jump_targets in parallel with engine->instructions, which
+ * are left untouched. Unresolvable or out-of-range targets are recorded as
+ * TAC_NO_TARGET so execution reports them through the label table path.
+ */
+tac_engine_error_t tac_resolve_jump_targets(tac_engine_t* engine);
+
 /**
  * @brief Cleanup label table
  * @param table Label table to cleanup
@@ -225,6 +554,27 @@ void tac_label_table_cleanup(tac_label_table_t* table);
  */
 void tac_memory_cleanup(tac_memory_manager_t* memory);
 
+/**
+ * @brief Initialize a memory manager as a copy-on-write copy of another
+ * @param memory Uninitialized memory manager
+ * @param source Memory to share pages with
+ * @return TAC_ENGINE_OK on success; on failure memory still needs cleanup
+ */
+tac_engine_error_t tac_memory_clone(tac_memory_manager_t* memory,
+                                    const tac_memory_manager_t* source);
+
+/**
+ * @brief Make a memory manager share the pages and heap state of another
+ * @param memory Memory manager of the same size as source
+ * @param source Memory to share pages with
+ * @return TAC_ENGINE_OK on success (memory is unchanged on failure)
+ *
+ * Only page table entries that differ from source are touched, so
+ * resetting to a snapshot costs the pages written since it was taken.
+ */
+tac_engine_error_t tac_memory_assign(tac_memory_manager_t* memory,
+                                     const tac_memory_manager_t* source);
+
 /**
  * @brief Allocate memory block
  * @param memory Memory manager
@@ -269,6 +619,10 @@ tac_engine_error_t tac_memory_write(tac_memory_manager_t* memory,
 
 /**
  * @brief Execute single TAC instruction
+ *
+ * Control-flow instructions set the program counter themselves; all other
+ * instructions advance it by one.
+ *
  * @param engine Engine instance
  * @param instruction Instruction to execute
  * @return TAC_ENGINE_OK on success
@@ -276,6 +630,258 @@ tac_engine_error_t tac_memory_write(tac_memory_manager_t* memory,
 tac_engine_error_t tac_execute_instruction(tac_engine_t* engine,
                                            const TACInstruction* instruction);
 
+/**
+ * @brief Pre-decode loaded instructions for the fast dispatch loop
+ * @param engine Engine instance with instructions and label table loaded
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_decode_program(tac_engine_t* engine);
+
+/**
+ * @brief Release the pre-decoded program
+ * @param program Decoded program to release
+ */
+void tac_decoded_program_cleanup(tac_decoded_program_t* program);
+
+/**
+ * @brief Run pre-decoded code with threaded dispatch
+ * @param engine Engine instance
+ * @return TAC_ENGINE_OK on successful completion
+ */
+tac_engine_error_t tac_run_predecoded(tac_engine_t* engine);
+
+/**
+ * @brief Allocate zeroed tier counters for the loaded program (TAC_EXEC_TIERED)
+ * @param engine Engine instance with the function table built
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_tier_reset(tac_engine_t* engine);
+
+/**
+ * @brief Release the tier counters, if any
+ * @param engine Engine instance
+ */
+void tac_tier_cleanup(tac_engine_t* engine);
+
+/**
+ * @brief Run from the current PC, promoting hot functions to the pre-decoded tier
+ * @param engine Engine instance (tier counters allocated)
+ * @return TAC_ENGINE_OK on successful completion
+ */
+tac_engine_error_t tac_run_tiered(tac_engine_t* engine);
+
+/**
+ * @brief Whether an opcode moves execution between functions
+ */
+static inline bool tac_is_call_boundary(TACOpcode opcode) {
+    return opcode == TAC_CALL || opcode == TAC_RETURN || opcode == TAC_RETURN_VOID;
+}
+
+/**
+ * @brief Account for a CALL or RETURN that just executed (tiered mode)
+ * @param engine Engine instance (tier counters allocated)
+ * @param opcode Opcode executed; a CALL counts an entry of the callee
+ * @return True if the function now running is promoted
+ */
+bool tac_tier_call_boundary(tac_engine_t* engine, TACOpcode opcode);
+
+/**
+ * @brief Compile the loaded program to register bytecode
+ * @param engine Engine instance with jump targets resolved
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_compile_bytecode(tac_engine_t* engine);
+
+/**
+ * @brief Release a bytecode program
+ * @param program Bytecode to release
+ */
+void tac_bytecode_cleanup(tac_bytecode_t* program);
+
+/**
+ * @brief Run register bytecode from the current PC
+ * @param engine Engine instance
+ * @return TAC_ENGINE_OK on successful completion
+ */
+tac_engine_error_t tac_run_bytecode(tac_engine_t* engine);
+
+/**
+ * @brief Compile the loaded program to native code (TAC_EXEC_JIT)
+ * @param engine Engine instance with jump targets resolved
+ * @return TAC_ENGINE_OK, or TAC_ENGINE_ERR_UNSUPPORTED on hosts without a JIT
+ */
+tac_engine_error_t tac_jit_compile(tac_engine_t* engine);
+
+/**
+ * @brief Release native code, if any
+ * @param engine Engine instance
+ */
+void tac_jit_release(tac_engine_t* engine);
+
+/**
+ * @brief Run compiled code from the current PC
+ * @param engine Engine instance (jit compiled, step_count below max_steps)
+ * @return TAC_ENGINE_OK on successful completion
+ */
+tac_engine_error_t tac_run_jit(tac_engine_t* engine);
+
+/**
+ * @brief Count an executed fall-through opcode pair (pair profiling)
+ * @param engine Engine instance (pair_counts allocated)
+ * @param index Instruction about to execute
+ */
+void tac_profile_pair(tac_engine_t* engine, uint32_t index);
+
+/**
+ * @brief Allocate a zeroed profile for the loaded program, if enabled
+ * @param engine Engine instance with the function table built
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_profile_reset(tac_engine_t* engine);
+
+/**
+ * @brief Release the profile, if any
+ * @param engine Engine instance
+ */
+void tac_profile_cleanup(tac_engine_t* engine);
+
+/**
+ * @brief Infer which register slots only ever hold int32 values
+ * @param engine Engine instance with the function table built
+ * @return TAC_ENGINE_OK on success
+ *
+ * Rebuilds engine->dynamic_slots from the current register contents and
+ * the loaded code, and flags the binary operations that can use
+ * tac_execute_binary_i32() in engine->int32_ops.
+ */
+tac_engine_error_t tac_types_infer(tac_engine_t* engine);
+
+/**
+ * @brief Re-infer slot types after a non-int32 value was stored in a slot
+ * @param engine Engine instance
+ * @param slot Register slot written
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_types_widen(tac_engine_t* engine, uint32_t slot);
+
+/**
+ * @brief Release the slot type bitmaps
+ * @param engine Engine instance
+ */
+void tac_types_cleanup(tac_engine_t* engine);
+
+/**
+ * @brief Words in engine->dynamic_slots (one spare word)
+ */
+static inline size_t tac_types_slot_words(const tac_engine_t* engine) {
+    return ((size_t)engine->config.max_variables + engine->config.max_temporaries + 31) / 32 + 1;
+}
+
+/**
+ * @brief Words in engine->int32_ops (one spare word)
+ */
+static inline size_t tac_types_op_words(const tac_engine_t* engine) {
+    return ((size_t)engine->instruction_count + 31) / 32 + 1;
+}
+
+/**
+ * @brief Whether an instruction about to execute has int32-only operands
+ * @param engine Engine instance
+ * @param instruction Instruction, normally the one at engine->pc
+ */
+static inline bool tac_is_int32_op(const tac_engine_t* engine,
+                                   const TACInstruction* instruction) {
+    uint32_t pc = engine->pc;
+    return engine->int32_ops && pc < engine->instruction_count &&
+           instruction == &engine->instructions[pc] &&
+           (engine->int32_ops[pc >> 5] & (1u << (pc & 31))) != 0;
+}
+
+/**
+ * @brief Count an instruction about to execute (profiling)
+ * @param engine Engine instance (profile allocated)
+ * @param index Instruction about to execute
+ */
+void tac_profile_before(tac_engine_t* engine, uint32_t index);
+
+/**
+ * @brief Record branch outcome and call stack change of an executed instruction
+ * @param engine Engine instance (profile allocated)
+ * @param index Instruction just executed
+ */
+void tac_profile_after(tac_engine_t* engine, uint32_t index);
+
+/**
+ * @brief Remember the result operand of an instruction about to execute (tracing)
+ * @param engine Engine instance (trace_stream open)
+ * @param index Instruction about to execute
+ */
+void tac_trace_before(tac_engine_t* engine, uint32_t index);
+
+/**
+ * @brief Append the trace record of an executed instruction
+ * @param engine Engine instance (trace_stream open, step_count not yet advanced)
+ * @param index Instruction just executed
+ */
+void tac_trace_after(tac_engine_t* engine, uint32_t index);
+
+/**
+ * @brief Append a varint to a buffer (trace and input log encoding)
+ * @return Position after the varint (at most 10 bytes)
+ */
+uint8_t* tac_trace_put_varint(uint8_t* out, uint64_t value);
+
+/**
+ * @brief Value payload as stored in trace and input log records
+ */
+uint64_t tac_trace_value_bits(const tac_value_t* value);
+
+/**
+ * @brief Rebuild a value from its type and tac_trace_value_bits() payload
+ */
+tac_value_t tac_trace_value_from_bits(tac_value_type_t type, uint64_t bits);
+
+/**
+ * @brief Log a register write made through the API (engine->recorder open)
+ * @param kind TAC_RECORD_SET_VAR or TAC_RECORD_SET_TEMP
+ */
+void tac_record_value(tac_engine_t* engine, tac_record_kind_t kind, uint16_t id,
+                      const tac_value_t* value);
+
+/**
+ * @brief Log a memory operation made through the API (engine->recorder open)
+ * @param kind TAC_RECORD_MEM_WRITE (data, size bytes), TAC_RECORD_MALLOC
+ *             (size, returned address) or TAC_RECORD_FREE (address)
+ */
+void tac_record_memory(tac_engine_t* engine, tac_record_kind_t kind, uint32_t address,
+                       uint32_t size, const void* data);
+
+/**
+ * @brief Log the PC execution resumes from (engine->recorder open)
+ */
+void tac_record_resume(tac_engine_t* engine);
+
+/**
+ * @brief Apply recorded inputs due before the step at engine->step_count (replay)
+ * @param engine Engine instance (replay open)
+ * @return TAC_ENGINE_OK, TAC_ENGINE_ERR_BREAKPOINT if the replay stops
+ *         here, or an error if the execution diverged from the recording
+ */
+tac_engine_error_t tac_replay_before(tac_engine_t* engine);
+
+/**
+ * @brief Apply recorded inputs of the current step made at a memory access or after it
+ * @param engine Engine instance (replay open)
+ * @param phase TAC_INPUT_MEMORY or TAC_INPUT_AFTER
+ * @return TAC_ENGINE_OK, or an error if the execution diverged
+ */
+tac_engine_error_t tac_replay_apply(tac_engine_t* engine, tac_input_phase_t phase);
+
+/**
+ * @brief True if an adjacent opcode pair is covered by a superinstruction
+ */
+bool tac_superinsn_covers(TACOpcode first, TACOpcode second);
+
 /**
  * @brief Evaluate TAC operand to value
  * @param engine Engine instance
@@ -298,23 +904,49 @@ tac_engine_error_t tac_store_operand(tac_engine_t* engine,
                                      const TACOperand* operand,
                                      const tac_value_t* value);
 
+/**
+ * @brief Build per-function metadata and size the value stack
+ * @param engine TAC engine (jump targets must be resolved)
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_build_function_table(tac_engine_t* engine);
+
+/**
+ * @brief Release function metadata and call stack storage
+ */
+void tac_function_table_cleanup(tac_engine_t* engine);
+
+/**
+ * @brief Unwind all frames, restoring saved slots
+ */
+void tac_reset_call_stack(tac_engine_t* engine);
+
 /**
  * @brief Push call stack frame
  * @param engine Engine instance
- * @param return_address Return address
- * @param param_count Number of parameters
+ * @param call_site CALL instruction address (returns to call_site + 1)
+ * @param function Callee index or TAC_NO_TARGET
  * @return TAC_ENGINE_OK on success
  */
 tac_engine_error_t tac_push_frame(tac_engine_t* engine,
-                                  uint32_t return_address,
-                                  uint32_t param_count);
+                                 uint32_t call_site,
+                                 uint32_t function);
+
+/**
+ * @brief Pop call stack frame, restoring any slots it saved
+ * @param engine Engine instance
+ * @return Popped frame (valid until the next push) or NULL if empty
+ */
+const tac_stack_frame_t* tac_pop_frame(tac_engine_t* engine);
 
 /**
- * @brief Pop call stack frame
+ * @brief Grow the frame array and value stack to hold at least the given sizes
  * @param engine Engine instance
- * @return Return address or 0 on error
+ * @param frames Frames needed (at most max_call_depth unless that is 0)
+ * @param values Saved slots needed on the value stack
+ * @return TAC_ENGINE_OK on success, TAC_ENGINE_ERR_OUT_OF_MEMORY otherwise
  */
-uint32_t tac_pop_frame(tac_engine_t* engine);
+tac_engine_error_t tac_reserve_call_stack(tac_engine_t* engine, uint32_t frames, uint32_t values);
 
 /**
  * @brief Check if breakpoint is set at address
@@ -322,7 +954,10 @@ uint32_t tac_pop_frame(tac_engine_t* engine);
  * @param address Instruction address
  * @return true if breakpoint exists
  */
-bool tac_has_breakpoint(tac_engine_t* engine, uint32_t address);
+static inline bool tac_has_breakpoint(const tac_engine_t* engine, uint32_t address) {
+    return address < engine->instruction_count &&
+           (engine->breakpoints[address >> 5] & (1u << (address & 31))) != 0;
+}
 
 /**
  * @brief Trigger execution hooks
@@ -335,6 +970,103 @@ bool tac_trigger_hooks(tac_engine_t* engine,
                        tac_hook_type_t hook_type,
                        uint32_t address);
 
+/**
+ * @brief Trigger hooks mid-instruction; one returning false pauses after it
+ * @param engine Engine instance
+ * @param hook_type Memory, call or return hook type
+ * @param address Memory address, or the CALL/RETURN instruction address
+ */
+void tac_trigger_hooks_after(tac_engine_t* engine,
+                             tac_hook_type_t hook_type,
+                             uint32_t address);
+
+/**
+ * @brief Record a write to a watched register slot or memory range and pause
+ * @param engine Engine instance
+ * @param kind TAC_WATCH_MEMORY, or TAC_WATCH_VARIABLE for any register slot
+ * @param location Register slot, or first address written
+ * @param size Bytes written (memory)
+ */
+void tac_watch_hit(tac_engine_t* engine, tac_watch_kind_t kind,
+                   uint32_t location, uint32_t size);
+
+/**
+ * @brief Check a register slot write against the watchpoints
+ * @param engine Engine instance
+ * @param slot Index into engine->registers
+ */
+static inline void tac_watch_slot(tac_engine_t* engine, uint32_t slot) {
+    if ((engine->instrumentation & TAC_INSTR_WATCH) && engine->watch_slots &&
+        (engine->watch_slots[slot >> 5] & (1u << (slot & 31)))) {
+        tac_watch_hit(engine, TAC_WATCH_VARIABLE, slot, 1);
+    }
+}
+
+/**
+ * @brief Check a memory write against the watchpoints
+ * @param engine Engine instance
+ * @param address First byte written
+ * @param size Bytes written (at most one page)
+ */
+static inline void tac_watch_memory(tac_engine_t* engine, uint32_t address, uint32_t size) {
+    if ((engine->instrumentation & TAC_INSTR_WATCH) && engine->watch_pages) {
+        uint32_t first = address >> TAC_PAGE_SHIFT;
+        uint32_t last = (address + size - 1) >> TAC_PAGE_SHIFT;
+        if ((first < engine->memory.page_count &&
+             (engine->watch_pages[first >> 5] & (1u << (first & 31)))) ||
+            (last < engine->memory.page_count &&
+             (engine->watch_pages[last >> 5] & (1u << (last & 31))))) {
+            tac_watch_hit(engine, TAC_WATCH_MEMORY, address, size);
+        }
+    }
+}
+
+/**
+ * @brief Ask for a pause once the current instruction completes
+ * @param engine Engine instance
+ */
+void tac_request_stop(tac_engine_t* engine);
+
+/**
+ * @brief Pause execution, as reported by TAC_ENGINE_ERR_BREAKPOINT
+ * @param engine Engine instance
+ * @param executed True if the instruction at the stop already ran (it
+ *        then counts as a step)
+ * @return TAC_ENGINE_ERR_BREAKPOINT
+ */
+tac_engine_error_t tac_debug_pause(tac_engine_t* engine, bool executed);
+
+/**
+ * @brief Recompute the instrumentation mask after an observer changed
+ * @param engine Engine instance
+ */
+void tac_update_instrumentation(tac_engine_t* engine);
+
+/**
+ * @brief Size the breakpoint bitmap for newly loaded code, clearing it and
+ *        any pending stop
+ * @param engine Engine instance with instruction_count set
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_debug_reset(tac_engine_t* engine);
+
+/**
+ * @brief Release breakpoints, watchpoints and hooks
+ * @param engine Engine instance
+ */
+void tac_debug_cleanup(tac_engine_t* engine);
+
+/**
+ * @brief Execute one instruction under breakpoints, hooks, profiling and tracing
+ * @param engine Engine instance (instrumentation nonzero)
+ * @param instruction Instruction at engine->pc
+ * @return TAC_ENGINE_ERR_BREAKPOINT when execution paused, with the state set
+ *         to TAC_ENGINE_PAUSED and step_count already advanced if the
+ *         instruction ran; otherwise as tac_execute_instruction()
+ */
+tac_engine_error_t tac_execute_observed(tac_engine_t* engine,
+                                        const TACInstruction* instruction);
+
 /**
  * @brief Add trace entry
  * @param engine Engine instance
@@ -396,6 +1128,49 @@ tac_engine_error_t tac_execute_assign(tac_engine_t* engine,
 tac_engine_error_t tac_execute_binary_op(tac_engine_t* engine,
                                          const TACInstruction* instruction);
 
+/**
+ * @brief int32 quotient of a nonzero divisor, every execution mode
+ *
+ * INT32_MIN / -1 wraps to INT32_MIN like the other arithmetic instead of
+ * raising SIGFPE, as the host division would.
+ */
+static inline int32_t tac_div_i32(int32_t a, int32_t b) {
+    return (b == -1) ? (int32_t)(0u - (uint32_t)a) : a / b;
+}
+
+/**
+ * @brief int32 remainder of a nonzero divisor (INT32_MIN % -1 is 0)
+ */
+static inline int32_t tac_mod_i32(int32_t a, int32_t b) {
+    return (b == -1) ? 0 : a % b;
+}
+
+/**
+ * @brief int32 left shift, every execution mode
+ *
+ * The count is masked to 5 bits and the shift done unsigned, as x86 shl
+ * and the C that cc2c emits do, so no count or operand is undefined.
+ */
+static inline int32_t tac_shl_i32(int32_t a, int32_t b) {
+    return (int32_t)((uint32_t)a << (b & 31));
+}
+
+/**
+ * @brief int32 arithmetic right shift, count masked to 5 bits like sar
+ */
+static inline int32_t tac_shr_i32(int32_t a, int32_t b) {
+    return a >> (b & 31);
+}
+
+/**
+ * @brief Execute a binary operation flagged in engine->int32_ops
+ * @param engine Engine instance
+ * @param instruction Instruction whose operands are known int32s
+ * @return TAC_ENGINE_OK on success
+ */
+tac_engine_error_t tac_execute_binary_i32(tac_engine_t* engine,
+                                          const TACInstruction* instruction);
+
 /**
  * @brief Execute jump instruction
  * @param engine Engine instance
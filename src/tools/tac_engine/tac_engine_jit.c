@@ -0,0 +1,844 @@
+/**
+ * @file tac_engine_jit.c
+ * @brief TAC Engine template JIT for x86-64 Linux
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * tac_jit_compile() translates the loaded program, one fixed template per
+ * instruction, into native code in an mmap'd buffer that is made
+ * executable (and read-only) once emitted. Every instruction gets an entry
+ * in a native address table, so execution can enter or resume at any PC.
+ *
+ * Native code works directly on the engine's variable and temporary
+ * arrays, so there is no state to copy back. int32 arithmetic,
+ * comparisons, moves and branches are emitted inline behind type guards.
+ * Everything else (calls, returns, memory access, non-int32 operands,
+ * faulting divisions) calls tac_jit_helper(), which syncs pc/step_count
+ * and runs the interpreter for that one instruction; native code then
+ * continues at the engine's new PC through the address table.
+ *
+ * Register use inside generated code (all callee-saved):
+ *   rbx = variables, r12 = temporaries, r13 = address table,
+ *   r14 = remaining step budget, r15 = tac_jit_state_t
+ *
+ * On other hosts tac_jit_compile() reports TAC_ENGINE_ERR_UNSUPPORTED and
+ * the engine keeps interpreting.
+ */
+
+#if defined(__x86_64__) && defined(__linux__)
+#define _DEFAULT_SOURCE             // MAP_ANONYMOUS under -std=c99
+#define TAC_JIT_SUPPORTED 1
+#else
+#define TAC_JIT_SUPPORTED 0
+#endif
+
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+#include "tac_engine_log.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if TAC_JIT_SUPPORTED
+#include <sys/mman.h>
+#endif
+
+/**
+ * @brief Why generated code returned to C
+ */
+typedef enum tac_jit_exit {
+    TAC_JIT_EXIT_END = 0,           // Fell off the end of the code
+    TAC_JIT_EXIT_STEPS,             // Step budget exhausted
+    TAC_JIT_EXIT_HELPER             // Helper finished or failed (see state)
+} tac_jit_exit_t;
+
+/**
+ * @brief Shared between the runner, generated code and the helper
+ */
+typedef struct tac_jit_state {
+    tac_engine_t* engine;
+    tac_value_t* variables;
+    tac_value_t* temporaries;
+    void** native;                  // Address table
+    uint64_t budget;                // Steps left before max_steps
+    uint32_t exit_pc;
+    uint32_t reason;                // tac_jit_exit_t
+    tac_engine_error_t error;       // Set by the helper
+    bool finished;                  // Set by the helper
+} tac_jit_state_t;
+
+typedef void (*tac_jit_entry_t)(tac_jit_state_t* state, void* target);
+
+/**
+ * @brief Compiled program
+ */
+struct tac_jit_code {
+    uint8_t* code;                  // mmap'd buffer
+    size_t capacity;                // Mapped size
+    void** native;                  // instruction_count + 1 entries
+    uint32_t count;
+    uint32_t inline_count;          // Instructions with a native template
+};
+
+#if TAC_JIT_SUPPORTED
+
+// =============================================================================
+// EMITTER
+// =============================================================================
+
+#define TAC_JIT_RAX 0
+#define TAC_JIT_RCX 1
+#define TAC_JIT_RDX 2
+#define TAC_JIT_RBX 3
+#define TAC_JIT_R12 12
+
+typedef struct tac_jit_fixup {
+    uint32_t pos;                   // rel32 to patch
+    uint32_t index;                 // Target instruction (or slow-path owner)
+} tac_jit_fixup_t;
+
+typedef struct tac_jit_emitter {
+    uint8_t* code;
+    size_t size;
+    size_t capacity;
+    bool overflow;
+
+    tac_jit_fixup_t* jumps;         // rel32 -> native[index]
+    uint32_t jump_count;
+    tac_jit_fixup_t* slow;          // rel32 -> helper stub for index
+    uint32_t slow_count;
+    uint32_t fixup_capacity;
+
+    size_t steps_exit;              // eax = pc
+    size_t helper_exit;
+    size_t end_exit;
+} tac_jit_emitter_t;
+
+/**
+ * @brief Operand resolved for a template
+ */
+typedef struct tac_jit_operand {
+    bool immediate;
+    int32_t value;                  // Immediate value
+    int base;                       // TAC_JIT_RBX or TAC_JIT_R12
+    int32_t disp;                   // Slot offset from base
+} tac_jit_operand_t;
+
+static void tac_jit_byte(tac_jit_emitter_t* e, uint8_t byte) {
+    if (e->size >= e->capacity) {
+        e->overflow = true;
+        return;
+    }
+    e->code[e->size++] = byte;
+}
+
+static void tac_jit_bytes(tac_jit_emitter_t* e, const uint8_t* bytes, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        tac_jit_byte(e, bytes[i]);
+    }
+}
+
+static void tac_jit_u32(tac_jit_emitter_t* e, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        tac_jit_byte(e, (uint8_t)(value >> (8 * i)));
+    }
+}
+
+static void tac_jit_u64(tac_jit_emitter_t* e, uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        tac_jit_byte(e, (uint8_t)(value >> (8 * i)));
+    }
+}
+
+static void tac_jit_patch(tac_jit_emitter_t* e, size_t pos, size_t target) {
+    if (e->overflow || pos + 4 > e->size) {
+        return;
+    }
+    int32_t rel = (int32_t)((int64_t)target - (int64_t)(pos + 4));
+    memcpy(&e->code[pos], &rel, sizeof(rel));
+}
+
+/**
+ * @brief Emit a rel32 branch to a known position (prefix: E9 or 0F 8x)
+ */
+static void tac_jit_branch_to(tac_jit_emitter_t* e, const uint8_t* prefix,
+                              size_t prefix_len, size_t target) {
+    tac_jit_bytes(e, prefix, prefix_len);
+    size_t pos = e->size;
+    tac_jit_u32(e, 0);
+    tac_jit_patch(e, pos, target);
+}
+
+static void tac_jit_add_fixup(tac_jit_emitter_t* e, bool slow, uint32_t index) {
+    tac_jit_fixup_t* list = slow ? e->slow : e->jumps;
+    uint32_t* count = slow ? &e->slow_count : &e->jump_count;
+
+    if (*count >= e->fixup_capacity) {
+        e->overflow = true;
+        return;
+    }
+    list[*count].pos = (uint32_t)(e->size - 4);
+    list[*count].index = index;
+    (*count)++;
+}
+
+/**
+ * @brief Emit a rel32 branch to native[index], patched after emission
+ */
+static void tac_jit_branch_native(tac_jit_emitter_t* e, const uint8_t* prefix,
+                                  size_t prefix_len, uint32_t index) {
+    tac_jit_bytes(e, prefix, prefix_len);
+    tac_jit_u32(e, 0);
+    tac_jit_add_fixup(e, false, index);
+}
+
+/**
+ * @brief Emit "jcc <slow path of index>" (cc: 0x84 = je, 0x85 = jne)
+ */
+static void tac_jit_jcc_slow(tac_jit_emitter_t* e, uint8_t cc, uint32_t index) {
+    tac_jit_byte(e, 0x0F);
+    tac_jit_byte(e, cc);
+    tac_jit_u32(e, 0);
+    tac_jit_add_fixup(e, true, index);
+}
+
+#define tac_jit_jne_slow(e, index) tac_jit_jcc_slow((e), 0x85, (index))
+#define tac_jit_je_slow(e, index)  tac_jit_jcc_slow((e), 0x84, (index))
+
+/**
+ * @brief Emit [REX] opcode ModRM(mod=10) [SIB] disp32 for a slot access
+ */
+static void tac_jit_mem(tac_jit_emitter_t* e, bool wide, const uint8_t* opcode,
+                        size_t opcode_len, int reg, int base, int32_t disp) {
+    uint8_t rex = (uint8_t)(0x40 | (wide ? 0x08 : 0) | (base >= 8 ? 0x01 : 0));
+    if (rex != 0x40) {
+        tac_jit_byte(e, rex);
+    }
+    tac_jit_bytes(e, opcode, opcode_len);
+    tac_jit_byte(e, (uint8_t)(0x80 | ((reg & 7) << 3) | (base & 7)));
+    if ((base & 7) == 4) {
+        tac_jit_byte(e, 0x24);      // SIB: base only
+    }
+    tac_jit_u32(e, (uint32_t)disp);
+}
+
+/**
+ * @brief cmp dword [slot.type], TAC_VALUE_INT32; jne slow
+ */
+static void tac_jit_guard_int32(tac_jit_emitter_t* e, const tac_jit_operand_t* op,
+                                uint32_t index) {
+    static const uint8_t cmp_imm32[] = { 0x81 };
+    if (op->immediate) {
+        return;
+    }
+    tac_jit_mem(e, false, cmp_imm32, 1, 7, op->base,
+                op->disp + (int32_t)offsetof(tac_value_t, type));
+    tac_jit_u32(e, TAC_VALUE_INT32);
+    tac_jit_jne_slow(e, index);
+}
+
+/**
+ * @brief mov reg32, operand
+ */
+static void tac_jit_load(tac_jit_emitter_t* e, const tac_jit_operand_t* op, int reg) {
+    static const uint8_t mov_load[] = { 0x8B };
+    if (op->immediate) {
+        tac_jit_byte(e, (uint8_t)(0xB8 + reg));
+        tac_jit_u32(e, (uint32_t)op->value);
+    } else {
+        tac_jit_mem(e, false, mov_load, 1, reg, op->base,
+                    op->disp + (int32_t)offsetof(tac_value_t, data));
+    }
+}
+
+/**
+ * @brief Store eax as an int32 value: type tag, then zero-extended data
+ */
+static void tac_jit_store_eax(tac_jit_emitter_t* e, const tac_jit_operand_t* dst) {
+    static const uint8_t mov_imm32[] = { 0xC7 };
+    static const uint8_t mov_store[] = { 0x89 };
+    tac_jit_mem(e, false, mov_imm32, 1, 0, dst->base,
+                dst->disp + (int32_t)offsetof(tac_value_t, type));
+    tac_jit_u32(e, TAC_VALUE_INT32);
+    tac_jit_mem(e, true, mov_store, 1, TAC_JIT_RAX, dst->base,
+                dst->disp + (int32_t)offsetof(tac_value_t, data));
+}
+
+/**
+ * @brief Count one step: dec r14; jz -> steps exit with pc
+ */
+static void tac_jit_step(tac_jit_emitter_t* e, uint32_t pc) {
+    static const uint8_t dec_r14_jnz[] = { 0x49, 0xFF, 0xCE, 0x75, 0x0A };
+    static const uint8_t jmp[] = { 0xE9 };
+    tac_jit_bytes(e, dec_r14_jnz, sizeof(dec_r14_jnz));
+    tac_jit_byte(e, 0xB8);          // mov eax, pc
+    tac_jit_u32(e, pc);
+    tac_jit_branch_to(e, jmp, sizeof(jmp), e->steps_exit);
+}
+
+/**
+ * @brief Run instruction index through the helper, then continue natively
+ */
+static void tac_jit_emit_helper_call(tac_jit_emitter_t* e, uint32_t index);
+
+// =============================================================================
+// RUNTIME HELPER
+// =============================================================================
+
+/**
+ * @brief Execute one instruction with the interpreter on behalf of native code
+ * @return Next PC, or TAC_NO_TARGET to leave native code
+ */
+static uint32_t tac_jit_helper(tac_jit_state_t* state, uint32_t index, uint64_t budget) {
+    tac_engine_t* engine = state->engine;
+
+    engine->pc = index;
+    engine->step_count = engine->config.max_steps - (uint32_t)budget;
+
+    tac_engine_error_t err = tac_execute_instruction(engine, &engine->instructions[index]);
+    if (err != TAC_ENGINE_OK) {
+        state->error = err;
+        return TAC_NO_TARGET;
+    }
+    if (engine->state == TAC_ENGINE_FINISHED || engine->pc >= engine->instruction_count) {
+        state->finished = true;
+        return TAC_NO_TARGET;
+    }
+    return engine->pc;
+}
+
+static void tac_jit_emit_helper_call(tac_jit_emitter_t* e, uint32_t index) {
+    static const uint8_t mov_rdi_r15[] = { 0x4C, 0x89, 0xFF };
+    static const uint8_t mov_rdx_r14[] = { 0x4C, 0x89, 0xF2 };
+    static const uint8_t mov_rax_imm64[] = { 0x48, 0xB8 };
+    static const uint8_t call_rax[] = { 0xFF, 0xD0 };
+    static const uint8_t cmp_eax_m1[] = { 0x83, 0xF8, 0xFF };
+    static const uint8_t je[] = { 0x0F, 0x84 };
+    static const uint8_t dec_r14[] = { 0x49, 0xFF, 0xCE };
+    static const uint8_t jmp_table[] = { 0x41, 0xFF, 0x64, 0xC5, 0x00 };  // jmp [r13+rax*8]
+
+    tac_jit_bytes(e, mov_rdi_r15, sizeof(mov_rdi_r15));
+    tac_jit_byte(e, 0xBE);          // mov esi, index
+    tac_jit_u32(e, index);
+    tac_jit_bytes(e, mov_rdx_r14, sizeof(mov_rdx_r14));
+    tac_jit_bytes(e, mov_rax_imm64, sizeof(mov_rax_imm64));
+    tac_jit_u64(e, (uint64_t)(uintptr_t)&tac_jit_helper);
+    tac_jit_bytes(e, call_rax, sizeof(call_rax));
+    tac_jit_bytes(e, cmp_eax_m1, sizeof(cmp_eax_m1));
+    tac_jit_branch_to(e, je, sizeof(je), e->helper_exit);
+    tac_jit_bytes(e, dec_r14, sizeof(dec_r14));
+    tac_jit_branch_to(e, je, sizeof(je), e->steps_exit);
+    tac_jit_bytes(e, jmp_table, sizeof(jmp_table));
+}
+
+// =============================================================================
+// TEMPLATES
+// =============================================================================
+
+static bool tac_jit_operand(const tac_engine_t* engine, const TACOperand* operand,
+                            bool allow_immediate, tac_jit_operand_t* out) {
+    memset(out, 0, sizeof(*out));
+    switch (operand->type) {
+        case TAC_OP_VAR:
+            if (operand->data.variable.id >= engine->config.max_variables) {
+                return false;
+            }
+            out->base = TAC_JIT_RBX;
+            out->disp = (int32_t)(operand->data.variable.id * sizeof(tac_value_t));
+            return true;
+
+        case TAC_OP_TEMP:
+            if (operand->data.variable.id >= engine->config.max_temporaries) {
+                return false;
+            }
+            out->base = TAC_JIT_R12;
+            out->disp = (int32_t)(operand->data.variable.id * sizeof(tac_value_t));
+            return true;
+
+        case TAC_OP_IMMEDIATE:
+            out->immediate = true;
+            out->value = operand->data.immediate.value;
+            return allow_immediate;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief ALU bytes for "eax = eax op ecx" (after loads), or NULL
+ */
+static const uint8_t* tac_jit_alu(TACOpcode opcode, size_t* len) {
+    static const uint8_t add[] = { 0x01, 0xC8 };
+    static const uint8_t sub[] = { 0x29, 0xC8 };
+    static const uint8_t imul[] = { 0x0F, 0xAF, 0xC1 };
+    static const uint8_t and_[] = { 0x21, 0xC8 };
+    static const uint8_t or_[] = { 0x09, 0xC8 };
+    static const uint8_t xor_[] = { 0x31, 0xC8 };
+    static const uint8_t shl[] = { 0xD3, 0xE0 };
+    static const uint8_t sar[] = { 0xD3, 0xF8 };
+    // cmp eax, ecx; setcc al; movzx eax, al
+    static const uint8_t eq[] = { 0x39, 0xC8, 0x0F, 0x94, 0xC0, 0x0F, 0xB6, 0xC0 };
+    static const uint8_t ne[] = { 0x39, 0xC8, 0x0F, 0x95, 0xC0, 0x0F, 0xB6, 0xC0 };
+    static const uint8_t lt[] = { 0x39, 0xC8, 0x0F, 0x9C, 0xC0, 0x0F, 0xB6, 0xC0 };
+    static const uint8_t le[] = { 0x39, 0xC8, 0x0F, 0x9E, 0xC0, 0x0F, 0xB6, 0xC0 };
+    static const uint8_t gt[] = { 0x39, 0xC8, 0x0F, 0x9F, 0xC0, 0x0F, 0xB6, 0xC0 };
+    static const uint8_t ge[] = { 0x39, 0xC8, 0x0F, 0x9D, 0xC0, 0x0F, 0xB6, 0xC0 };
+    // test eax, eax; setne al; test ecx, ecx; setne cl; and/or al, cl; movzx eax, al
+    static const uint8_t land[] = { 0x85, 0xC0, 0x0F, 0x95, 0xC0, 0x85, 0xC9, 0x0F, 0x95,
+                                    0xC1, 0x20, 0xC8, 0x0F, 0xB6, 0xC0 };
+    static const uint8_t lor[] = { 0x85, 0xC0, 0x0F, 0x95, 0xC0, 0x85, 0xC9, 0x0F, 0x95,
+                                   0xC1, 0x08, 0xC8, 0x0F, 0xB6, 0xC0 };
+
+#define TAC_JIT_ALU(bytes) do { *len = sizeof(bytes); return (bytes); } while (0)
+    switch (opcode) {
+        case TAC_ADD:         TAC_JIT_ALU(add);
+        case TAC_SUB:         TAC_JIT_ALU(sub);
+        case TAC_MUL:         TAC_JIT_ALU(imul);
+        case TAC_AND:         TAC_JIT_ALU(and_);
+        case TAC_OR:          TAC_JIT_ALU(or_);
+        case TAC_XOR:         TAC_JIT_ALU(xor_);
+        case TAC_SHL:         TAC_JIT_ALU(shl);
+        case TAC_SHR:         TAC_JIT_ALU(sar);
+        case TAC_EQ:          TAC_JIT_ALU(eq);
+        case TAC_NE:          TAC_JIT_ALU(ne);
+        case TAC_LT:          TAC_JIT_ALU(lt);
+        case TAC_LE:          TAC_JIT_ALU(le);
+        case TAC_GT:          TAC_JIT_ALU(gt);
+        case TAC_GE:          TAC_JIT_ALU(ge);
+        case TAC_LOGICAL_AND: TAC_JIT_ALU(land);
+        case TAC_LOGICAL_OR:  TAC_JIT_ALU(lor);
+        default:              return NULL;
+    }
+#undef TAC_JIT_ALU
+}
+
+/**
+ * @brief Emit the native template for one instruction
+ * @return false if the instruction has no template (caller emits a helper call)
+ */
+static bool tac_jit_emit_insn(tac_jit_emitter_t* e, const tac_engine_t* engine,
+                              uint32_t index) {
+    const TACInstruction* inst = &engine->instructions[index];
+    const uint32_t target = engine->jump_targets ? engine->jump_targets[index] : TAC_NO_TARGET;
+    tac_jit_operand_t dst, a, b;
+    static const uint8_t jmp[] = { 0xE9 };
+
+    switch (inst->opcode) {
+        case TAC_NOP:
+        case TAC_LABEL:
+            tac_jit_step(e, index + 1);
+            return true;
+
+        case TAC_ASSIGN: {
+            if (!tac_jit_operand(engine, &inst->result, false, &dst) ||
+                !tac_jit_operand(engine, &inst->operand1, true, &a)) {
+                return false;
+            }
+            if (a.immediate) {
+                tac_jit_load(e, &a, TAC_JIT_RAX);
+                tac_jit_store_eax(e, &dst);
+            } else {
+                // Whole-value copy, any type: movups xmm0, [src]; movups [dst], xmm0
+                static const uint8_t movups_load[] = { 0x0F, 0x10 };
+                static const uint8_t movups_store[] = { 0x0F, 0x11 };
+                tac_jit_mem(e, false, movups_load, 2, 0, a.base, a.disp);
+                tac_jit_mem(e, false, movups_store, 2, 0, dst.base, dst.disp);
+            }
+            tac_jit_step(e, index + 1);
+            return true;
+        }
+
+        case TAC_ADD: case TAC_SUB: case TAC_MUL: case TAC_AND: case TAC_OR:
+        case TAC_XOR: case TAC_SHL: case TAC_SHR: case TAC_EQ: case TAC_NE:
+        case TAC_LT: case TAC_LE: case TAC_GT: case TAC_GE:
+        case TAC_LOGICAL_AND: case TAC_LOGICAL_OR: {
+            size_t len = 0;
+            const uint8_t* alu = tac_jit_alu(inst->opcode, &len);
+            if (!alu ||
+                !tac_jit_operand(engine, &inst->result, false, &dst) ||
+                !tac_jit_operand(engine, &inst->operand1, true, &a) ||
+                !tac_jit_operand(engine, &inst->operand2, true, &b)) {
+                return false;
+            }
+            tac_jit_guard_int32(e, &a, index);
+            tac_jit_guard_int32(e, &b, index);
+            tac_jit_load(e, &a, TAC_JIT_RAX);
+            tac_jit_load(e, &b, TAC_JIT_RCX);
+            tac_jit_bytes(e, alu, len);
+            tac_jit_store_eax(e, &dst);
+            tac_jit_step(e, index + 1);
+            return true;
+        }
+
+        case TAC_DIV:
+        case TAC_MOD: {
+            // A zero divisor takes the helper for the error report; -1 is
+            // branched around idiv, which faults on INT_MIN / -1:
+            // x / -1 = neg x (wrapping), x % -1 = 0
+            static const uint8_t test_ecx[] = { 0x85, 0xC9 };
+            static const uint8_t cmp_ecx_m1[] = { 0x83, 0xF9, 0xFF };
+            static const uint8_t jne_idiv[] = { 0x75, 0x04 };
+            static const uint8_t neg_eax[] = { 0xF7, 0xD8 };
+            static const uint8_t xor_eax[] = { 0x31, 0xC0 };
+            static const uint8_t cdq_idiv[] = { 0x99, 0xF7, 0xF9 };
+            static const uint8_t mov_eax_edx[] = { 0x89, 0xD0 };
+            const bool mod = inst->opcode == TAC_MOD;
+            const uint8_t jmp_done[] = { 0xEB, (uint8_t)(sizeof(cdq_idiv) +
+                                                         (mod ? sizeof(mov_eax_edx) : 0)) };
+            if (!tac_jit_operand(engine, &inst->result, false, &dst) ||
+                !tac_jit_operand(engine, &inst->operand1, true, &a) ||
+                !tac_jit_operand(engine, &inst->operand2, true, &b)) {
+                return false;
+            }
+            tac_jit_guard_int32(e, &a, index);
+            tac_jit_guard_int32(e, &b, index);
+            tac_jit_load(e, &a, TAC_JIT_RAX);
+            tac_jit_load(e, &b, TAC_JIT_RCX);
+            tac_jit_bytes(e, test_ecx, sizeof(test_ecx));
+            tac_jit_je_slow(e, index);
+            tac_jit_bytes(e, cmp_ecx_m1, sizeof(cmp_ecx_m1));
+            tac_jit_bytes(e, jne_idiv, sizeof(jne_idiv));
+            tac_jit_bytes(e, mod ? xor_eax : neg_eax, 2);
+            tac_jit_bytes(e, jmp_done, sizeof(jmp_done));
+            tac_jit_bytes(e, cdq_idiv, sizeof(cdq_idiv));
+            if (mod) {
+                tac_jit_bytes(e, mov_eax_edx, sizeof(mov_eax_edx));
+            }
+            tac_jit_store_eax(e, &dst);
+            tac_jit_step(e, index + 1);
+            return true;
+        }
+
+        case TAC_NEG:
+        case TAC_NOT:
+        case TAC_BITWISE_NOT: {
+            static const uint8_t neg[] = { 0xF7, 0xD8 };
+            static const uint8_t not_[] = { 0xF7, 0xD0 };
+            static const uint8_t lnot[] = { 0x85, 0xC0, 0x0F, 0x94, 0xC0, 0x0F, 0xB6, 0xC0 };
+            if (!tac_jit_operand(engine, &inst->result, false, &dst) ||
+                !tac_jit_operand(engine, &inst->operand1, true, &a)) {
+                return false;
+            }
+            tac_jit_guard_int32(e, &a, index);
+            tac_jit_load(e, &a, TAC_JIT_RAX);
+            if (inst->opcode == TAC_NEG) {
+                tac_jit_bytes(e, neg, sizeof(neg));
+            } else if (inst->opcode == TAC_BITWISE_NOT) {
+                tac_jit_bytes(e, not_, sizeof(not_));
+            } else {
+                tac_jit_bytes(e, lnot, sizeof(lnot));
+            }
+            tac_jit_store_eax(e, &dst);
+            tac_jit_step(e, index + 1);
+            return true;
+        }
+
+        case TAC_GOTO:
+            if (target == TAC_NO_TARGET) {
+                return false;
+            }
+            tac_jit_step(e, target);
+            tac_jit_branch_native(e, jmp, sizeof(jmp), target);
+            return true;
+
+        case TAC_IF_TRUE:
+        case TAC_IF_FALSE: {
+            static const uint8_t cmp_imm8[] = { 0x83 };
+            if (target == TAC_NO_TARGET ||
+                !tac_jit_operand(engine, &inst->operand1, false, &a)) {
+                return false;
+            }
+            tac_jit_guard_int32(e, &a, index);
+            tac_jit_mem(e, false, cmp_imm8, 1, 7, a.base,
+                        a.disp + (int32_t)offsetof(tac_value_t, data));
+            tac_jit_byte(e, 0x00);
+            // Skip the taken path: IF_FALSE falls through on non-zero
+            tac_jit_byte(e, 0x0F);
+            tac_jit_byte(e, inst->opcode == TAC_IF_FALSE ? 0x85 : 0x84);
+            size_t skip = e->size;
+            tac_jit_u32(e, 0);
+            tac_jit_step(e, target);
+            tac_jit_branch_native(e, jmp, sizeof(jmp), target);
+            tac_jit_patch(e, skip, e->size);
+            tac_jit_step(e, index + 1);
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+// =============================================================================
+// COMPILER
+// =============================================================================
+
+/**
+ * @brief Prologue, shared exits and epilogue
+ */
+static size_t tac_jit_emit_frame(tac_jit_emitter_t* e) {
+    static const uint8_t prologue[] = {
+        0x55,                               // push rbp
+        0x53,                               // push rbx
+        0x41, 0x54, 0x41, 0x55,             // push r12; push r13
+        0x41, 0x56, 0x41, 0x57,             // push r14; push r15
+        0x48, 0x83, 0xEC, 0x08,             // sub rsp, 8 (16-byte alignment)
+        0x49, 0x89, 0xFF,                   // mov r15, rdi
+    };
+    static const uint8_t epilogue[] = {
+        0x48, 0x83, 0xC4, 0x08,             // add rsp, 8
+        0x41, 0x5F, 0x41, 0x5E,             // pop r15; pop r14
+        0x41, 0x5D, 0x41, 0x5C,             // pop r13; pop r12
+        0x5B, 0x5D, 0xC3,                   // pop rbx; pop rbp; ret
+    };
+    static const uint8_t jmp[] = { 0xE9 };
+
+    size_t entry = e->size;
+    tac_jit_bytes(e, prologue, sizeof(prologue));
+
+    // mov rbx/r12/r13/r14, [r15 + field]
+    tac_jit_byte(e, 0x49); tac_jit_byte(e, 0x8B); tac_jit_byte(e, 0x5F);
+    tac_jit_byte(e, (uint8_t)offsetof(tac_jit_state_t, variables));
+    tac_jit_byte(e, 0x4D); tac_jit_byte(e, 0x8B); tac_jit_byte(e, 0x67);
+    tac_jit_byte(e, (uint8_t)offsetof(tac_jit_state_t, temporaries));
+    tac_jit_byte(e, 0x4D); tac_jit_byte(e, 0x8B); tac_jit_byte(e, 0x6F);
+    tac_jit_byte(e, (uint8_t)offsetof(tac_jit_state_t, native));
+    tac_jit_byte(e, 0x4D); tac_jit_byte(e, 0x8B); tac_jit_byte(e, 0x77);
+    tac_jit_byte(e, (uint8_t)offsetof(tac_jit_state_t, budget));
+    tac_jit_byte(e, 0xFF); tac_jit_byte(e, 0xE6);       // jmp rsi
+
+    // Fell off the end: eax = count was loaded by the end stub
+    e->end_exit = e->size;
+    tac_jit_byte(e, 0xBA);                              // mov edx, END
+    tac_jit_u32(e, TAC_JIT_EXIT_END);
+    size_t to_common_end = e->size;
+    tac_jit_bytes(e, jmp, sizeof(jmp));
+    tac_jit_u32(e, 0);
+
+    e->steps_exit = e->size;
+    tac_jit_byte(e, 0xBA);                              // mov edx, STEPS
+    tac_jit_u32(e, TAC_JIT_EXIT_STEPS);
+
+    // Common exit: record pc and reason
+    tac_jit_patch(e, to_common_end + 1, e->size);
+    tac_jit_byte(e, 0x41); tac_jit_byte(e, 0x89); tac_jit_byte(e, 0x47);
+    tac_jit_byte(e, (uint8_t)offsetof(tac_jit_state_t, exit_pc));
+    tac_jit_byte(e, 0x41); tac_jit_byte(e, 0x89); tac_jit_byte(e, 0x57);
+    tac_jit_byte(e, (uint8_t)offsetof(tac_jit_state_t, reason));
+    size_t to_budget = e->size;
+    tac_jit_bytes(e, jmp, sizeof(jmp));
+    tac_jit_u32(e, 0);
+
+    // Helper exit: the helper already recorded why
+    e->helper_exit = e->size;
+    tac_jit_byte(e, 0x41); tac_jit_byte(e, 0xC7); tac_jit_byte(e, 0x47);
+    tac_jit_byte(e, (uint8_t)offsetof(tac_jit_state_t, reason));
+    tac_jit_u32(e, TAC_JIT_EXIT_HELPER);
+
+    tac_jit_patch(e, to_budget + 1, e->size);
+    tac_jit_byte(e, 0x4D); tac_jit_byte(e, 0x89); tac_jit_byte(e, 0x77);
+    tac_jit_byte(e, (uint8_t)offsetof(tac_jit_state_t, budget));
+    tac_jit_bytes(e, epilogue, sizeof(epilogue));
+
+    return entry;
+}
+
+tac_engine_error_t tac_jit_compile(tac_engine_t* engine) {
+    if (!engine || !engine->instructions) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_jit_release(engine);
+
+    // Templates hard-code the value layout
+    if (sizeof(tac_value_t) != 16 || offsetof(tac_value_t, data) != 8 ||
+        sizeof(tac_value_type_t) != 4 ||
+        (uint64_t)engine->config.max_variables * sizeof(tac_value_t) > INT32_MAX ||
+        (uint64_t)engine->config.max_temporaries * sizeof(tac_value_t) > INT32_MAX) {
+        return TAC_ENGINE_ERR_UNSUPPORTED;
+    }
+
+    uint32_t count = engine->instruction_count;
+    tac_jit_code_t* jit = calloc(1, sizeof(tac_jit_code_t));
+    tac_jit_emitter_t e;
+    memset(&e, 0, sizeof(e));
+
+    // Worst case per instruction: template + helper stub (about 150 bytes)
+    e.capacity = 256 + (size_t)count * 256;
+    e.fixup_capacity = count * 4 + 4;
+    e.jumps = malloc(e.fixup_capacity * sizeof(tac_jit_fixup_t));
+    e.slow = malloc(e.fixup_capacity * sizeof(tac_jit_fixup_t));
+    if (jit) {
+        jit->native = malloc(((size_t)count + 1) * sizeof(void*));
+    }
+
+    void* map = mmap(NULL, e.capacity, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (!jit || !jit->native || !e.jumps || !e.slow || map == MAP_FAILED) {
+        if (map != MAP_FAILED) {
+            munmap(map, e.capacity);
+        }
+        if (jit) {
+            free(jit->native);
+        }
+        free(jit);
+        free(e.jumps);
+        free(e.slow);
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+    e.code = map;
+
+    size_t entry = tac_jit_emit_frame(&e);
+    size_t* offsets = (size_t*)jit->native;     // Offsets until the code is final
+
+    for (uint32_t i = 0; i < count; i++) {
+        offsets[i] = e.size;
+        if (tac_jit_emit_insn(&e, engine, i)) {
+            jit->inline_count++;
+        } else {
+            tac_jit_emit_helper_call(&e, i);
+        }
+    }
+
+    // End of code
+    offsets[count] = e.size;
+    tac_jit_byte(&e, 0xB8);
+    tac_jit_u32(&e, count);
+    tac_jit_branch_to(&e, (const uint8_t[]){ 0xE9 }, 1, e.end_exit);
+
+    // Slow paths, one helper stub per instruction that needs one
+    uint32_t stub_index = TAC_NO_TARGET;
+    size_t stub = 0;
+    for (uint32_t f = 0; f < e.slow_count; f++) {
+        if (e.slow[f].index != stub_index) {
+            stub_index = e.slow[f].index;
+            stub = e.size;
+            tac_jit_emit_helper_call(&e, stub_index);
+        }
+        tac_jit_patch(&e, e.slow[f].pos, stub);
+    }
+    for (uint32_t f = 0; f < e.jump_count; f++) {
+        tac_jit_patch(&e, e.jumps[f].pos, offsets[e.jumps[f].index]);
+    }
+
+    free(e.jumps);
+    free(e.slow);
+
+    if (e.overflow || mprotect(map, e.capacity, PROT_READ | PROT_EXEC) != 0) {
+        munmap(map, e.capacity);
+        free(jit->native);
+        free(jit);
+        return e.overflow ? TAC_ENGINE_ERR_UNSUPPORTED : TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    for (uint32_t i = 0; i <= count; i++) {
+        jit->native[i] = e.code + offsets[i];
+    }
+    jit->code = map;
+    jit->capacity = e.capacity;
+    jit->count = count;
+    engine->jit = jit;
+    engine->jit_entry = e.code + entry;
+
+    TAC_LOG_INFO(engine, TAC_LOG_CAT_DISPATCH,
+                 "JIT: %u of %u instructions native, %zu bytes of code",
+                 jit->inline_count, count, e.size);
+    return TAC_ENGINE_OK;
+}
+
+void tac_jit_release(tac_engine_t* engine) {
+    if (!engine || !engine->jit) {
+        return;
+    }
+
+    munmap(engine->jit->code, engine->jit->capacity);
+    free(engine->jit->native);
+    free(engine->jit);
+    engine->jit = NULL;
+    engine->jit_entry = NULL;
+}
+
+// =============================================================================
+// RUNNER
+// =============================================================================
+
+tac_engine_error_t tac_run_jit(tac_engine_t* engine) {
+    if (!engine || !engine->jit || engine->jit->count != engine->instruction_count) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    tac_jit_entry_t entry = (tac_jit_entry_t)(uintptr_t)engine->jit_entry;
+    engine->state = TAC_ENGINE_RUNNING;
+
+    // A zero budget would wrap: leave that edge to the interpreter
+    if (engine->step_count >= engine->config.max_steps) {
+        return TAC_ENGINE_ERR_UNSUPPORTED;
+    }
+    if (engine->pc >= engine->instruction_count) {
+        engine->state = TAC_ENGINE_FINISHED;
+        return TAC_ENGINE_OK;
+    }
+
+    tac_jit_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.engine = engine;
+    state.variables = engine->variables;
+    state.temporaries = engine->temporaries;
+    state.native = engine->jit->native;
+    state.budget = engine->config.max_steps - engine->step_count;
+
+    entry(&state, engine->jit->native[engine->pc]);
+
+    engine->step_count = engine->config.max_steps - (uint32_t)state.budget;
+
+    switch ((tac_jit_exit_t)state.reason) {
+        case TAC_JIT_EXIT_END:
+            engine->pc = state.exit_pc;
+            engine->state = TAC_ENGINE_FINISHED;
+            return TAC_ENGINE_OK;
+
+        case TAC_JIT_EXIT_STEPS:
+            engine->pc = state.exit_pc;
+            break;
+
+        case TAC_JIT_EXIT_HELPER:
+        default:
+            if (state.error != TAC_ENGINE_OK) {
+                engine->state = TAC_ENGINE_ERROR;
+                return state.error;
+            }
+            // The finishing instruction still counts, as in tac_engine_run()
+            engine->step_count++;
+            if (engine->step_count < engine->config.max_steps) {
+                engine->state = TAC_ENGINE_FINISHED;
+                return TAC_ENGINE_OK;
+            }
+            break;
+    }
+
+    tac_set_error(engine, TAC_ENGINE_ERR_MAX_STEPS,
+                 "Execution exceeded maximum steps: %u", engine->config.max_steps);
+    engine->state = TAC_ENGINE_STOPPED;
+    return TAC_ENGINE_ERR_MAX_STEPS;
+}
+
+#else  // !TAC_JIT_SUPPORTED
+
+tac_engine_error_t tac_jit_compile(tac_engine_t* engine) {
+    (void)engine;
+    return TAC_ENGINE_ERR_UNSUPPORTED;
+}
+
+void tac_jit_release(tac_engine_t* engine) {
+    (void)engine;
+}
+
+tac_engine_error_t tac_run_jit(tac_engine_t* engine) {
+    (void)engine;
+    return TAC_ENGINE_ERR_UNSUPPORTED;
+}
+
+#endif  // TAC_JIT_SUPPORTED
@@ -0,0 +1,92 @@
+/**
+ * @file tac_engine_log.c
+ * @brief TAC Engine diagnostic sink and filtering
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ */
+
+#include "tac_engine_log.h"
+#include "tac_engine_internal.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+static const char* tac_log_level_name(tac_log_level_t level) {
+    switch (level) {
+        case TAC_LOG_LEVEL_ERROR: return "error";
+        case TAC_LOG_LEVEL_WARN:  return "warn";
+        case TAC_LOG_LEVEL_INFO:  return "info";
+        case TAC_LOG_LEVEL_DEBUG: return "debug";
+        case TAC_LOG_LEVEL_TRACE: return "trace";
+        default:                  return "log";
+    }
+}
+
+static const char* tac_log_category_name(tac_log_category_t category) {
+    switch (category) {
+        case TAC_LOG_CAT_DISPATCH: return "dispatch";
+        case TAC_LOG_CAT_CALLS:    return "calls";
+        case TAC_LOG_CAT_LABELS:   return "labels";
+        case TAC_LOG_CAT_SYMBOLS:  return "symbols";
+        default:                   return "engine";
+    }
+}
+
+static void tac_log_default_sink(void* user_data,
+                                 tac_log_level_t level,
+                                 tac_log_category_t category,
+                                 const char* message) {
+    (void)user_data;
+    fprintf(stderr, "tac_engine[%s/%s]: %s\n",
+            tac_log_level_name(level), tac_log_category_name(category), message);
+}
+
+bool tac_log_enabled(const tac_engine_t* engine,
+                     tac_log_level_t level,
+                     tac_log_category_t category) {
+    if (level <= TAC_LOG_LEVEL_WARN) {
+        return true;
+    }
+    return engine && (engine->config.log_categories & (uint32_t)category) != 0;
+}
+
+void tac_log_write(const tac_engine_t* engine,
+                   tac_log_level_t level,
+                   tac_log_category_t category,
+                   const char* format, ...) {
+    char message[256];
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+
+    if (engine && engine->log_sink) {
+        engine->log_sink(engine->log_user_data, level, category, message);
+    } else {
+        tac_log_default_sink(NULL, level, category, message);
+    }
+}
+
+tac_engine_error_t tac_engine_set_log_sink(tac_engine_t* engine,
+                                           tac_engine_log_sink_t sink,
+                                           void* user_data) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    engine->log_sink = sink;
+    engine->log_user_data = user_data;
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_engine_set_log_categories(tac_engine_t* engine,
+                                                 uint32_t categories) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    engine->config.log_categories = categories;
+    return TAC_ENGINE_OK;
+}
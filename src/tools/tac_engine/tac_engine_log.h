@@ -0,0 +1,76 @@
+/**
+ * @file tac_engine_log.h
+ * @brief Leveled, categorized diagnostics for the TAC Engine
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * Messages above TAC_LOG_LEVEL are removed at compile time: the level test
+ * is a constant expression, so the call and its argument evaluation are
+ * dead code, yet the arguments are still type-checked. Messages that pass
+ * the level test are filtered at runtime by the engine's category mask
+ * (config.log_categories) and written to the engine's sink.
+ *
+ * Build with -DTAC_LOG_LEVEL=TAC_LOG_LEVEL_TRACE to enable everything.
+ */
+
+#ifndef SRC_TOOLS_TAC_ENGINE_TAC_ENGINE_LOG_H_
+#define SRC_TOOLS_TAC_ENGINE_TAC_ENGINE_LOG_H_
+
+#include "tac_engine.h"
+
+#ifndef TAC_LOG_LEVEL
+#define TAC_LOG_LEVEL TAC_LOG_LEVEL_WARN
+#endif
+
+/**
+ * @brief Format a message and deliver it to the engine's sink
+ * @param engine Engine instance (NULL uses the default sink)
+ * @param level Message level
+ * @param category Message category
+ * @param format printf-style format
+ */
+void tac_log_write(const tac_engine_t* engine,
+                   tac_log_level_t level,
+                   tac_log_category_t category,
+                   const char* format, ...)
+#if defined(__GNUC__)
+    __attribute__((format(printf, 4, 5)))
+#endif
+    ;
+
+/**
+ * @brief Runtime filter (level must already have passed the compile-time test)
+ */
+bool tac_log_enabled(const tac_engine_t* engine,
+                     tac_log_level_t level,
+                     tac_log_category_t category);
+
+/**
+ * @brief True if a message at this level/category would be emitted
+ *
+ * Use to guard expensive preparation (e.g. symbol lookups) for a message.
+ */
+#define TAC_LOG_ACTIVE(engine, level, category) \
+    ((level) <= TAC_LOG_LEVEL && tac_log_enabled((engine), (level), (category)))
+
+#define TAC_LOG(engine, level, category, ...) \
+    do { \
+        if (TAC_LOG_ACTIVE(engine, level, category)) { \
+            tac_log_write((engine), (level), (category), __VA_ARGS__); \
+        } \
+    } while (0)
+
+#define TAC_LOG_ERROR(engine, category, ...) \
+    TAC_LOG(engine, TAC_LOG_LEVEL_ERROR, category, __VA_ARGS__)
+#define TAC_LOG_WARN(engine, category, ...) \
+    TAC_LOG(engine, TAC_LOG_LEVEL_WARN, category, __VA_ARGS__)
+#define TAC_LOG_INFO(engine, category, ...) \
+    TAC_LOG(engine, TAC_LOG_LEVEL_INFO, category, __VA_ARGS__)
+#define TAC_LOG_DEBUG(engine, category, ...) \
+    TAC_LOG(engine, TAC_LOG_LEVEL_DEBUG, category, __VA_ARGS__)
+#define TAC_LOG_TRACE(engine, category, ...) \
+    TAC_LOG(engine, TAC_LOG_LEVEL_TRACE, category, __VA_ARGS__)
+
+#endif  // SRC_TOOLS_TAC_ENGINE_TAC_ENGINE_LOG_H_
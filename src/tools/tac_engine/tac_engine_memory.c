@@ -0,0 +1,525 @@
+/**
+ * @file tac_engine_memory.c
+ * @brief TAC Engine paged virtual memory and heap allocator
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * The engine's address space is a flat 32-bit range translated through a
+ * single-level page table: address >> TAC_PAGE_SHIFT indexes the table and
+ * the low bits index the page, so translation is O(1). Host pages are only
+ * allocated when first written.
+ *
+ * Every heap block carries an 8-byte header (payload size + state tag) just
+ * below its payload. Blocks up to TAC_SIZE_CLASS_MAX are rounded to a power
+ * of two size class and recycled through per-class free lists whose links
+ * live in the freed payloads; larger blocks are recycled first-fit from a
+ * host-side list. Nothing is coalesced.
+ *
+ * Host pages are reference counted so snapshots and forked engines can
+ * share them (see tac_engine_snapshot.c). A shared page is copied on its
+ * first write; pages nobody writes stay shared indefinitely.
+ */
+
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TAC_BLOCK_HEADER_SIZE   8u      // [payload size][state tag][payload...]
+#define TAC_BLOCK_SIZE_OFFSET   8u      // Payload size, below the payload
+#define TAC_BLOCK_TAG_OFFSET    4u      // State tag, below the payload
+#define TAC_BLOCK_TAG_ALLOC     0xA110CA7Eu
+#define TAC_BLOCK_TAG_FREE      0xF4EEB10Cu
+
+#define TAC_PAGE_HEADER_SIZE    16u     // [reference count][page...]
+
+// =============================================================================
+// PAGE TABLE
+// =============================================================================
+
+/**
+ * @brief Reference count of a host page, stored just below it
+ */
+static uint32_t* tac_page_refs(uint8_t* page) {
+    return (uint32_t*)(void*)(page - TAC_PAGE_HEADER_SIZE);
+}
+
+/**
+ * @brief Allocate a host page with one reference
+ * @param source Contents to copy, or NULL for a zeroed page
+ */
+static uint8_t* tac_page_new(const uint8_t* source) {
+    uint8_t* block = source ? malloc(TAC_PAGE_HEADER_SIZE + TAC_PAGE_SIZE)
+                            : calloc(1, TAC_PAGE_HEADER_SIZE + TAC_PAGE_SIZE);
+    if (!block) {
+        return NULL;
+    }
+
+    uint8_t* page = block + TAC_PAGE_HEADER_SIZE;
+    *tac_page_refs(page) = 1;
+    if (source) {
+        memcpy(page, source, TAC_PAGE_SIZE);
+    }
+    return page;
+}
+
+static void tac_page_retain(uint8_t* page) {
+    __atomic_add_fetch(tac_page_refs(page), 1, __ATOMIC_RELAXED);
+}
+
+static void tac_page_release(uint8_t* page) {
+    if (page && __atomic_sub_fetch(tac_page_refs(page), 1, __ATOMIC_ACQ_REL) == 0) {
+        free(page - TAC_PAGE_HEADER_SIZE);
+    }
+}
+
+/**
+ * @brief Return the host page for an address, allocating it if requested
+ * @return Page pointer, or NULL if untouched (and !allocate) or out of memory
+ *
+ * With allocate set the caller is about to write, so a page still shared
+ * with a snapshot or another engine is replaced by a private copy first.
+ */
+static uint8_t* tac_memory_page(tac_memory_manager_t* memory,
+                                uint32_t address, bool allocate) {
+    uint32_t index = address >> TAC_PAGE_SHIFT;
+    uint8_t* page = memory->pages[index];
+
+    if (!allocate) {
+        return page;
+    }
+
+    if (!page) {
+        page = tac_page_new(NULL);
+        if (page) {
+            memory->pages[index] = page;
+            memory->pages_touched++;
+        }
+    } else if (__atomic_load_n(tac_page_refs(page), __ATOMIC_ACQUIRE) > 1) {
+        uint8_t* copy = tac_page_new(page);
+        if (!copy) {
+            return NULL;
+        }
+        tac_page_release(page);
+        memory->pages[index] = page = copy;
+        memory->pages_copied++;
+    }
+    return page;
+}
+
+/**
+ * @brief Validate an access range
+ */
+static tac_engine_error_t tac_memory_check(const tac_memory_manager_t* memory,
+                                           uint32_t address, uint32_t size) {
+    // Always keep translation inside the page table
+    if (address > memory->limit || size > memory->limit - address) {
+        return TAC_ENGINE_ERR_INVALID_MEMORY;
+    }
+
+    // Optional: only the carved heap is addressable
+    if (memory->bounds_check &&
+        (address < TAC_MEMORY_BASE || address + size > memory->brk)) {
+        return TAC_ENGINE_ERR_INVALID_MEMORY;
+    }
+    return TAC_ENGINE_OK;
+}
+
+static uint32_t tac_memory_read_u32(tac_memory_manager_t* memory, uint32_t address) {
+    uint32_t value = 0;
+    tac_memory_read(memory, address, &value, sizeof(value));
+    return value;
+}
+
+static tac_engine_error_t tac_memory_write_u32(tac_memory_manager_t* memory,
+                                               uint32_t address, uint32_t value) {
+    return tac_memory_write(memory, address, &value, sizeof(value));
+}
+
+// =============================================================================
+// MEMORY MANAGER
+// =============================================================================
+
+tac_engine_error_t tac_memory_init(tac_memory_manager_t* memory, uint32_t max_size) {
+    if (!memory) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    memset(memory, 0, sizeof(*memory));
+
+    // Address space: NULL guard page followed by the heap, page aligned and
+    // ending below the TAC_ADDR range
+    uint64_t limit = (uint64_t)TAC_MEMORY_BASE + max_size;
+    limit = (limit + TAC_PAGE_MASK) & ~(uint64_t)TAC_PAGE_MASK;
+    if (limit > TAC_ADDR_RESERVED_BASE) {
+        limit = TAC_ADDR_RESERVED_BASE;
+    }
+
+    memory->limit = (uint32_t)limit;
+    memory->page_count = memory->limit >> TAC_PAGE_SHIFT;
+    memory->pages = calloc(memory->page_count, sizeof(uint8_t*));
+    if (!memory->pages) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    memory->brk = TAC_MEMORY_BASE;
+    memory->max_size = max_size;
+    memory->bounds_check = true;
+
+    return TAC_ENGINE_OK;
+}
+
+void tac_memory_cleanup(tac_memory_manager_t* memory) {
+    if (!memory) {
+        return;
+    }
+
+    if (memory->pages) {
+        for (uint32_t i = 0; i < memory->page_count; i++) {
+            tac_page_release(memory->pages[i]);
+        }
+        free(memory->pages);
+    }
+
+    tac_memory_block_t* block = memory->large_free;
+    while (block) {
+        tac_memory_block_t* next = block->next;
+        free(block);
+        block = next;
+    }
+
+    memory->pages = NULL;
+    memory->page_count = 0;
+    memory->large_free = NULL;
+    memory->total_allocated = 0;
+    memory->pages_touched = 0;
+}
+
+/**
+ * @brief Copy the free list of large blocks
+ */
+static tac_engine_error_t tac_memory_copy_large_free(tac_memory_block_t** out,
+                                                     const tac_memory_block_t* block) {
+    *out = NULL;
+    for (; block; block = block->next) {
+        tac_memory_block_t* copy = malloc(sizeof(tac_memory_block_t));
+        if (!copy) {
+            return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        }
+        *copy = *block;
+        copy->next = NULL;
+        *out = copy;
+        out = &copy->next;
+    }
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_memory_clone(tac_memory_manager_t* memory,
+                                    const tac_memory_manager_t* source) {
+    if (!memory || !source) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    *memory = *source;
+    memory->large_free = NULL;
+    memory->pages_copied = 0;
+    memory->pages = malloc((size_t)source->page_count * sizeof(uint8_t*));
+    if (!memory->pages) {
+        memory->page_count = 0;
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    memcpy(memory->pages, source->pages, (size_t)source->page_count * sizeof(uint8_t*));
+    for (uint32_t i = 0; i < memory->page_count; i++) {
+        if (memory->pages[i]) {
+            tac_page_retain(memory->pages[i]);
+        }
+    }
+    return tac_memory_copy_large_free(&memory->large_free, source->large_free);
+}
+
+tac_engine_error_t tac_memory_assign(tac_memory_manager_t* memory,
+                                     const tac_memory_manager_t* source) {
+    if (!memory || !source) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    if (memory->page_count != source->page_count) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    // Allocate first so a failure leaves the memory untouched
+    tac_memory_block_t* large_free = NULL;
+    if (tac_memory_copy_large_free(&large_free, source->large_free) != TAC_ENGINE_OK) {
+        while (large_free) {
+            tac_memory_block_t* next = large_free->next;
+            free(large_free);
+            large_free = next;
+        }
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    // Only entries that diverged since the snapshot change hands
+    for (uint32_t i = 0; i < memory->page_count; i++) {
+        if (memory->pages[i] != source->pages[i]) {
+            if (source->pages[i]) {
+                tac_page_retain(source->pages[i]);
+            }
+            tac_page_release(memory->pages[i]);
+            memory->pages[i] = source->pages[i];
+        }
+    }
+
+    while (memory->large_free) {
+        tac_memory_block_t* next = memory->large_free->next;
+        free(memory->large_free);
+        memory->large_free = next;
+    }
+    memory->large_free = large_free;
+
+    memory->brk = source->brk;
+    memcpy(memory->free_lists, source->free_lists, sizeof(memory->free_lists));
+    memory->total_allocated = source->total_allocated;
+    memory->pages_touched = source->pages_touched;
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_memory_read(tac_memory_manager_t* memory,
+                                   uint32_t address,
+                                   void* buffer,
+                                   uint32_t size) {
+    if (!memory || !buffer) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_engine_error_t err = tac_memory_check(memory, address, size);
+    if (err != TAC_ENGINE_OK) {
+        return err;
+    }
+
+    uint8_t* out = buffer;
+    while (size > 0) {
+        uint32_t offset = address & TAC_PAGE_MASK;
+        uint32_t chunk = TAC_PAGE_SIZE - offset;
+        if (chunk > size) {
+            chunk = size;
+        }
+
+        const uint8_t* page = tac_memory_page(memory, address, false);
+        if (page) {
+            memcpy(out, page + offset, chunk);
+        } else {
+            memset(out, 0, chunk);
+        }
+
+        out += chunk;
+        address += chunk;
+        size -= chunk;
+    }
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_memory_write(tac_memory_manager_t* memory,
+                                    uint32_t address,
+                                    const void* buffer,
+                                    uint32_t size) {
+    if (!memory || !buffer) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_engine_error_t err = tac_memory_check(memory, address, size);
+    if (err != TAC_ENGINE_OK) {
+        return err;
+    }
+
+    const uint8_t* in = buffer;
+    while (size > 0) {
+        uint32_t offset = address & TAC_PAGE_MASK;
+        uint32_t chunk = TAC_PAGE_SIZE - offset;
+        if (chunk > size) {
+            chunk = size;
+        }
+
+        uint8_t* page = tac_memory_page(memory, address, true);
+        if (!page) {
+            return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        }
+        memcpy(page + offset, in, chunk);
+
+        in += chunk;
+        address += chunk;
+        size -= chunk;
+    }
+    return TAC_ENGINE_OK;
+}
+
+// =============================================================================
+// HEAP ALLOCATOR
+// =============================================================================
+
+/**
+ * @brief Size class index for a request, or -1 for a large block
+ */
+static int tac_size_class(uint32_t size) {
+    uint32_t class_size = 16;
+    for (int i = 0; i < TAC_SIZE_CLASS_COUNT; i++, class_size <<= 1) {
+        if (size <= class_size) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Carve a new block from the top of the heap
+ * @return Payload address or 0 if the heap limit is reached
+ */
+static uint32_t tac_memory_carve(tac_memory_manager_t* memory, uint32_t payload) {
+    uint64_t header = memory->brk;
+    uint64_t end = header + TAC_BLOCK_HEADER_SIZE + payload;
+
+    if (end - TAC_MEMORY_BASE > memory->max_size || end > memory->limit) {
+        return 0;
+    }
+
+    memory->brk = (uint32_t)end;
+    uint32_t address = (uint32_t)header + TAC_BLOCK_HEADER_SIZE;
+    if (tac_memory_write_u32(memory, address - TAC_BLOCK_SIZE_OFFSET, payload) != TAC_ENGINE_OK) {
+        memory->brk = (uint32_t)header;
+        return 0;
+    }
+    return address;
+}
+
+uint32_t tac_memory_alloc(tac_memory_manager_t* memory, uint32_t size) {
+    if (!memory || size == 0 || size > memory->max_size) {
+        return 0;
+    }
+
+    int size_class = tac_size_class(size);
+    uint32_t payload;
+    uint32_t address = 0;
+
+    if (size_class >= 0) {
+        payload = 16u << size_class;
+        address = memory->free_lists[size_class];
+        if (address) {
+            memory->free_lists[size_class] = tac_memory_read_u32(memory, address);
+        }
+    } else {
+        payload = (size + 15u) & ~15u;
+
+        // First fit among recycled large blocks
+        tac_memory_block_t** link = &memory->large_free;
+        while (*link) {
+            tac_memory_block_t* block = *link;
+            if (block->size >= payload) {
+                address = block->address;
+                payload = block->size;
+                *link = block->next;
+                free(block);
+                break;
+            }
+            link = &block->next;
+        }
+    }
+
+    if (!address) {
+        address = tac_memory_carve(memory, payload);
+        if (!address) {
+            return 0;
+        }
+    }
+
+    tac_memory_write_u32(memory, address - TAC_BLOCK_TAG_OFFSET, TAC_BLOCK_TAG_ALLOC);
+    memory->total_allocated += payload;
+    return address;
+}
+
+tac_engine_error_t tac_memory_free(tac_memory_manager_t* memory, uint32_t address) {
+    if (!memory) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    // free(NULL) is a no-op, as in C
+    if (address == 0) {
+        return TAC_ENGINE_OK;
+    }
+
+    if (address < TAC_MEMORY_BASE + TAC_BLOCK_HEADER_SIZE || address >= memory->brk ||
+        tac_memory_read_u32(memory, address - TAC_BLOCK_TAG_OFFSET) != TAC_BLOCK_TAG_ALLOC) {
+        return TAC_ENGINE_ERR_INVALID_MEMORY;   // Not a live block (or double free)
+    }
+
+    uint32_t payload = tac_memory_read_u32(memory, address - TAC_BLOCK_SIZE_OFFSET);
+    int size_class = tac_size_class(payload);
+
+    if (size_class >= 0 && payload == (16u << size_class)) {
+        tac_memory_write_u32(memory, address, memory->free_lists[size_class]);
+        memory->free_lists[size_class] = address;
+    } else {
+        tac_memory_block_t* block = malloc(sizeof(tac_memory_block_t));
+        if (!block) {
+            return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        }
+        block->address = address;
+        block->size = payload;
+        block->next = memory->large_free;
+        memory->large_free = block;
+    }
+
+    tac_memory_write_u32(memory, address - TAC_BLOCK_TAG_OFFSET, TAC_BLOCK_TAG_FREE);
+    memory->total_allocated -= payload;
+    return TAC_ENGINE_OK;
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+uint32_t tac_engine_malloc(tac_engine_t* engine, uint32_t size) {
+    if (!engine) {
+        return 0;
+    }
+    uint32_t address = tac_memory_alloc(&engine->memory, size);
+    if (engine->recorder) {
+        tac_record_memory(engine, TAC_RECORD_MALLOC, address, size, NULL);
+    }
+    return address;
+}
+
+tac_engine_error_t tac_engine_free(tac_engine_t* engine, uint32_t address) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    tac_engine_error_t err = tac_memory_free(&engine->memory, address);
+    if (err == TAC_ENGINE_OK && engine->recorder) {
+        tac_record_memory(engine, TAC_RECORD_FREE, address, 0, NULL);
+    }
+    return err;
+}
+
+tac_engine_error_t tac_engine_mem_read(tac_engine_t* engine,
+                                       uint32_t address,
+                                       void* buffer,
+                                       uint32_t size) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    return tac_memory_read(&engine->memory, address, buffer, size);
+}
+
+tac_engine_error_t tac_engine_mem_write(tac_engine_t* engine,
+                                        uint32_t address,
+                                        const void* buffer,
+                                        uint32_t size) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    tac_engine_error_t err = tac_memory_write(&engine->memory, address, buffer, size);
+    if (err == TAC_ENGINE_OK && engine->recorder) {
+        tac_record_memory(engine, TAC_RECORD_MEM_WRITE, address, size, buffer);
+    }
+    return err;
+}
@@ -0,0 +1,319 @@
+/**
+ * @file tac_engine_profile.c
+ * @brief TAC Engine execution profiler
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * With config.enable_profile the interpreter counts every executed
+ * instruction and every taken conditional branch in flat arrays indexed by
+ * instruction address. Calls are attributed through a calling context
+ * tree: one node per distinct call path, each holding the steps executed
+ * directly in it and how often it was entered. The tree is a flat array
+ * too (children link by index), so a step costs two increments and a
+ * depth comparison.
+ *
+ * Per-function figures are derived from the tree on demand, and the tree
+ * itself is what tac_engine_write_folded_stacks() prints, one line per
+ * call path in the folded format read by flamegraph.pl and speedscope.
+ */
+
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TAC_PROFILE_ROOT        0u      // Node for code outside any function
+#define TAC_PROFILE_NODES_MIN   64u
+
+// =============================================================================
+// CALLING CONTEXT TREE
+// =============================================================================
+
+/**
+ * @brief Find or add the child of a node for a callee
+ * @return Node index, or TAC_NO_TARGET if out of memory
+ */
+static uint32_t tac_profile_child(tac_profile_data_t* profile, uint32_t parent,
+                                  uint32_t function) {
+    for (uint32_t child = profile->nodes[parent].first_child; child != TAC_NO_TARGET;
+         child = profile->nodes[child].next_sibling) {
+        if (profile->nodes[child].function == function) {
+            return child;
+        }
+    }
+
+    if (profile->node_count == profile->node_capacity) {
+        uint32_t capacity = profile->node_capacity * 2;
+        tac_profile_node_t* nodes = realloc(profile->nodes, capacity * sizeof(tac_profile_node_t));
+        if (!nodes) {
+            return TAC_NO_TARGET;
+        }
+        profile->nodes = nodes;
+        profile->node_capacity = capacity;
+    }
+
+    uint32_t index = profile->node_count++;
+    tac_profile_node_t* node = &profile->nodes[index];
+    node->function = function;
+    node->parent = parent;
+    node->first_child = TAC_NO_TARGET;
+    node->next_sibling = profile->nodes[parent].first_child;
+    node->depth = profile->nodes[parent].depth + 1;
+    node->steps = 0;
+    node->calls = 0;
+    profile->nodes[parent].first_child = index;
+    return index;
+}
+
+/**
+ * @brief Move the current node to match the engine's call stack
+ * @param entered True if the last instruction was a call that pushed a frame
+ */
+static void tac_profile_sync(tac_engine_t* engine, bool entered) {
+    tac_profile_data_t* profile = engine->profile;
+    const tac_profile_node_t* node = &profile->nodes[profile->current];
+    uint32_t depth = engine->call_depth;
+
+    if (depth == node->depth + 1) {
+        uint32_t child = tac_profile_child(profile, profile->current,
+                                           engine->frames[depth - 1].function);
+        if (child != TAC_NO_TARGET) {
+            profile->current = child;
+            profile->nodes[child].calls += entered;
+            return;
+        }
+    } else if (depth + 1 == node->depth) {
+        profile->current = node->parent;
+        return;
+    }
+
+    // Anything else (reset, restore, out of memory): rebuild from the frames
+    profile->current = TAC_PROFILE_ROOT;
+    for (uint32_t d = 0; d < depth; d++) {
+        uint32_t child = tac_profile_child(profile, profile->current, engine->frames[d].function);
+        if (child == TAC_NO_TARGET) {
+            break;
+        }
+        profile->current = child;
+    }
+}
+
+// =============================================================================
+// RECORDING
+// =============================================================================
+
+void tac_profile_before(tac_engine_t* engine, uint32_t index) {
+    tac_profile_data_t* profile = engine->profile;
+
+    if (profile->nodes[profile->current].depth != engine->call_depth) {
+        tac_profile_sync(engine, false);
+    }
+    profile->executed[index]++;
+    profile->nodes[profile->current].steps++;
+}
+
+void tac_profile_after(tac_engine_t* engine, uint32_t index) {
+    tac_profile_data_t* profile = engine->profile;
+    TACOpcode opcode = engine->instructions[index].opcode;
+
+    if (opcode == TAC_IF_TRUE || opcode == TAC_IF_FALSE) {
+        profile->taken[index] += engine->pc != index + 1;
+    }
+    if (profile->nodes[profile->current].depth != engine->call_depth) {
+        tac_profile_sync(engine, opcode == TAC_CALL);
+    } else if (opcode == TAC_CALL && engine->call_depth > 0) {
+        // A tail call replaced the frame: the callee sits beside the caller
+        uint32_t child = tac_profile_child(profile, profile->nodes[profile->current].parent,
+                                           engine->frames[engine->call_depth - 1].function);
+        if (child != TAC_NO_TARGET) {
+            profile->current = child;
+            profile->nodes[child].calls++;
+        }
+    }
+}
+
+void tac_profile_cleanup(tac_engine_t* engine) {
+    tac_profile_data_t* profile = engine->profile;
+    if (!profile) {
+        return;
+    }
+
+    free(profile->executed);
+    free(profile->taken);
+    free(profile->nodes);
+    free(profile->functions);
+    free(profile);
+    engine->profile = NULL;
+}
+
+tac_engine_error_t tac_profile_reset(tac_engine_t* engine) {
+    tac_profile_cleanup(engine);
+    if (!engine->config.enable_profile) {
+        return TAC_ENGINE_OK;
+    }
+
+    tac_profile_data_t* profile = calloc(1, sizeof(tac_profile_data_t));
+    if (!profile) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+    engine->profile = profile;
+
+    uint32_t count = engine->instruction_count;
+    profile->executed = calloc((size_t)count + 1, sizeof(uint64_t));
+    profile->taken = calloc((size_t)count + 1, sizeof(uint64_t));
+    profile->nodes = malloc(TAC_PROFILE_NODES_MIN * sizeof(tac_profile_node_t));
+    profile->functions = calloc((size_t)engine->function_count + 1,
+                                sizeof(tac_function_profile_t));
+    if (!profile->executed || !profile->taken || !profile->nodes || !profile->functions) {
+        tac_profile_cleanup(engine);
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    profile->node_capacity = TAC_PROFILE_NODES_MIN;
+    profile->node_count = 1;
+    profile->current = TAC_PROFILE_ROOT;
+    profile->nodes[TAC_PROFILE_ROOT] = (tac_profile_node_t){
+        TAC_NO_TARGET, TAC_NO_TARGET, TAC_NO_TARGET, TAC_NO_TARGET, 0, 0, 0
+    };
+    return TAC_ENGINE_OK;
+}
+
+// =============================================================================
+// REPORTING
+// =============================================================================
+
+/**
+ * @brief Slot in the per-function arrays: callees first, top level last
+ */
+static uint32_t tac_profile_slot(const tac_engine_t* engine, uint32_t function) {
+    return function < engine->function_count ? function : engine->function_count;
+}
+
+/**
+ * @brief Derive per-function calls, self and inclusive steps from the tree
+ */
+static tac_engine_error_t tac_profile_summarize(tac_engine_t* engine) {
+    tac_profile_data_t* profile = engine->profile;
+    uint32_t slots = engine->function_count + 1;
+
+    uint64_t* subtree = malloc((size_t)profile->node_count * sizeof(uint64_t));
+    if (!subtree) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    for (uint32_t f = 0; f < slots; f++) {
+        tac_function_profile_t* info = &profile->functions[f];
+        memset(info, 0, sizeof(*info));
+        info->entry = f < engine->function_count ? engine->functions[f].entry : TAC_NO_TARGET;
+    }
+
+    // Children are always created after their parent, so a reverse sweep
+    // sees every subtree complete before adding it to the parent
+    for (uint32_t n = 0; n < profile->node_count; n++) {
+        subtree[n] = profile->nodes[n].steps;
+    }
+    for (uint32_t n = profile->node_count; n-- > 1;) {
+        subtree[profile->nodes[n].parent] += subtree[n];
+    }
+
+    for (uint32_t n = 0; n < profile->node_count; n++) {
+        const tac_profile_node_t* node = &profile->nodes[n];
+        tac_function_profile_t* info = &profile->functions[tac_profile_slot(engine, node->function)];
+        info->calls += node->calls;
+        info->self_steps += node->steps;
+
+        // Recursive activations are already inside the outermost one
+        bool outermost = true;
+        for (uint32_t a = node->parent; a != TAC_NO_TARGET && outermost;
+             a = profile->nodes[a].parent) {
+            outermost = profile->nodes[a].function != node->function;
+        }
+        if (outermost) {
+            info->total_steps += subtree[n];
+        }
+    }
+
+    free(subtree);
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_engine_get_profile(tac_engine_t* engine, tac_profile_t* profile) {
+    if (!engine || !profile) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    if (!engine->profile) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    tac_engine_error_t err = tac_profile_summarize(engine);
+    if (err != TAC_ENGINE_OK) {
+        return err;
+    }
+
+    profile->executed = engine->profile->executed;
+    profile->taken = engine->profile->taken;
+    profile->instruction_count = engine->instruction_count;
+    profile->functions = engine->profile->functions;
+    profile->function_count = engine->function_count;
+    return TAC_ENGINE_OK;
+}
+
+/**
+ * @brief Print a function's frame name: its entry label, or its address
+ */
+static int tac_profile_frame_name(FILE* out, const tac_engine_t* engine, uint32_t function) {
+    if (function == TAC_NO_TARGET) {
+        return fputs("program", out);
+    }
+
+    uint32_t entry = engine->functions[function].entry;
+    const TACInstruction* insn = &engine->instructions[entry];
+    if (insn->opcode == TAC_LABEL && insn->result.type == TAC_OP_LABEL) {
+        return fprintf(out, "L%u", (unsigned)insn->result.data.label.offset);
+    }
+    return fprintf(out, "@%u", entry);
+}
+
+tac_engine_error_t tac_engine_write_folded_stacks(tac_engine_t* engine, FILE* out) {
+    if (!engine || !out) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    if (!engine->profile) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    const tac_profile_data_t* profile = engine->profile;
+    uint32_t deepest = 0;
+    for (uint32_t n = 0; n < profile->node_count; n++) {
+        if (profile->nodes[n].depth > deepest) {
+            deepest = profile->nodes[n].depth;
+        }
+    }
+    uint32_t* path = malloc(((size_t)deepest + 1) * sizeof(uint32_t));
+    if (!path) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    bool ok = true;
+    for (uint32_t n = 0; n < profile->node_count && ok; n++) {
+        if (profile->nodes[n].steps == 0) {
+            continue;
+        }
+
+        // Collect root..node, then print outermost first
+        uint32_t length = 0;
+        for (uint32_t a = n; a != TAC_NO_TARGET; a = profile->nodes[a].parent) {
+            path[length++] = a;
+        }
+        while (length-- > 0 && ok) {
+            ok = tac_profile_frame_name(out, engine, profile->nodes[path[length]].function) >= 0 &&
+                 (length == 0 || fputc(';', out) != EOF);
+        }
+        ok = ok && fprintf(out, " %llu\n", (unsigned long long)profile->nodes[n].steps) >= 0;
+    }
+
+    free(path);
+    return ok ? TAC_ENGINE_OK : TAC_ENGINE_ERR_INVALID_OPERAND;
+}
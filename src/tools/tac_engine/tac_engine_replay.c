@@ -0,0 +1,737 @@
+/**
+ * @file tac_engine_replay.c
+ * @brief TAC Engine input recording and deterministic replay
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * Execution is deterministic given the loaded code, the starting state and
+ * whatever the host changes through the API. tac_engine_record_to_file()
+ * therefore logs only those host inputs, each stamped with the step it
+ * happened at and its phase within that step (see tac_input_phase_t), and
+ * a replay re-applies them at the same points. Inputs are rare, so logs
+ * stay small however long the execution runs, and recording costs nothing
+ * per step: it happens in the API functions, and a recorded engine keeps
+ * its execution mode.
+ *
+ * A replay runs interpreted, with TAC_INSTR_REPLAY in the instrumentation
+ * mask so tac_execute_observed() and the memory access paths call back
+ * into this file. Every snapshot_interval steps it keeps a snapshot;
+ * tac_replay_seek() restores the nearest one at or before the wanted step
+ * and replays forward from there, which gives cheap time-travel debugging.
+ *
+ * File format: the 8-byte magic "TACREC1\n", a header of varints
+ * (instruction count, code hash, start step, start PC, state hash), then
+ * one record per input:
+ *
+ *   varint head   kind << 2 | phase (tac_record_kind_t, tac_input_phase_t)
+ *   varint delta  step - step of the previous record
+ *   payload       SET_VAR/SET_TEMP: varint id, uint8 type, varint value
+ *                 (as in trace files); MEM_WRITE: varint address, varint
+ *                 size, size bytes; MALLOC: varint size, varint address
+ *                 returned; FREE: varint address; RESUME: varint PC;
+ *                 END: nothing
+ */
+
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TAC_RECORD_MAGIC        "TACREC1\n"
+#define TAC_RECORD_MAGIC_SIZE   8u
+#define TAC_RECORD_HEADER_MAX   64u     // Header or fixed part of a record, worst case
+
+/**
+ * @brief Input log writer (one per recording engine)
+ */
+struct tac_recorder {
+    FILE* file;
+    uint32_t step;                  // Step of the previous record
+    bool failed;                    // A write failed
+};
+
+/**
+ * @brief Decoded input log record
+ */
+typedef struct tac_replay_entry {
+    uint32_t step;
+    uint8_t kind;                   // tac_record_kind_t
+    uint8_t phase;                  // tac_input_phase_t
+    uint16_t id;                    // SET_VAR/SET_TEMP slot
+    uint32_t address;               // MEM_WRITE/MALLOC/FREE address, RESUME PC
+    uint32_t size;                  // MEM_WRITE bytes, MALLOC size
+    uint32_t data;                  // MEM_WRITE offset in tac_replay.bytes
+    tac_value_t value;              // SET_VAR/SET_TEMP value
+} tac_replay_entry_t;
+
+/**
+ * @brief Snapshot kept for seeking, with the first record not applied in it
+ */
+typedef struct tac_replay_mark {
+    uint32_t step;
+    uint32_t cursor;
+    tac_snapshot_t* snapshot;
+} tac_replay_mark_t;
+
+struct tac_replay {
+    tac_engine_t* engine;
+    tac_replay_entry_t* entries;
+    uint32_t entry_count;
+    uint32_t cursor;                // Next record to apply
+    uint8_t* bytes;                 // MEM_WRITE payloads
+    uint32_t end_step;              // Step of the END record, UINT32_MAX if none
+
+    uint32_t target;                // Step to stop before (seeking), or TAC_NO_TARGET
+    bool stopped;                   // The last pause was the replay's own
+
+    tac_replay_mark_t* marks;       // Ascending by step, marks[0] = start
+    uint32_t mark_count;
+    uint32_t mark_capacity;
+    uint32_t interval;
+    uint32_t next_mark;             // Step of the next snapshot
+};
+
+// =============================================================================
+// PROGRAM AND STATE IDENTITY
+// =============================================================================
+
+static uint32_t tac_fnv_u32(uint32_t hash, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        hash = (hash ^ ((value >> (8 * i)) & 0xffu)) * TAC_FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief Hash of the control flow of the loaded code
+ */
+static uint32_t tac_code_hash(const tac_engine_t* engine) {
+    uint32_t hash = TAC_FNV_OFFSET;
+    for (uint32_t i = 0; i < engine->instruction_count; i++) {
+        hash = tac_fnv_u32(hash, engine->instructions[i].opcode);
+        hash = tac_fnv_u32(hash, engine->jump_targets ? engine->jump_targets[i] : 0);
+    }
+    return hash;
+}
+
+/**
+ * @brief Hash of the registers and call depth
+ */
+static uint32_t tac_state_hash(const tac_engine_t* engine) {
+    uint32_t hash = tac_fnv_u32(TAC_FNV_OFFSET, engine->call_depth);
+    uint32_t count = engine->config.max_variables + engine->config.max_temporaries;
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t bits = tac_trace_value_bits(&engine->registers[i]);
+        hash = tac_fnv_u32(hash, engine->registers[i].type);
+        hash = tac_fnv_u32(hash, (uint32_t)bits);
+        hash = tac_fnv_u32(hash, (uint32_t)(bits >> 32));
+    }
+    return hash;
+}
+
+// =============================================================================
+// RECORDING
+// =============================================================================
+
+/**
+ * @brief Write a record head and the fixed part of its payload
+ */
+static void tac_record_write(tac_recorder_t* recorder, const uint8_t* start,
+                             const uint8_t* end) {
+    if (fwrite(start, 1, (size_t)(end - start), recorder->file) != (size_t)(end - start)) {
+        recorder->failed = true;
+    }
+}
+
+static uint8_t* tac_record_head(tac_engine_t* engine, uint8_t* out, tac_record_kind_t kind) {
+    tac_recorder_t* recorder = engine->recorder;
+
+    // After a failed instruction the host acts after the step that failed,
+    // which a replay has to reach first
+    uint8_t phase = engine->input_phase;
+    if (phase == TAC_INPUT_BEFORE && engine->state == TAC_ENGINE_ERROR) {
+        phase = TAC_INPUT_AFTER;
+    }
+    out = tac_trace_put_varint(out, ((uint64_t)kind << 2) | phase);
+    out = tac_trace_put_varint(out, engine->step_count - recorder->step);
+    recorder->step = engine->step_count;
+    return out;
+}
+
+void tac_record_value(tac_engine_t* engine, tac_record_kind_t kind, uint16_t id,
+                      const tac_value_t* value) {
+    uint8_t buffer[TAC_RECORD_HEADER_MAX];
+    uint8_t* out = tac_record_head(engine, buffer, kind);
+    out = tac_trace_put_varint(out, id);
+    *out++ = (uint8_t)value->type;
+    out = tac_trace_put_varint(out, tac_trace_value_bits(value));
+    tac_record_write(engine->recorder, buffer, out);
+}
+
+void tac_record_memory(tac_engine_t* engine, tac_record_kind_t kind, uint32_t address,
+                       uint32_t size, const void* data) {
+    uint8_t buffer[TAC_RECORD_HEADER_MAX];
+    uint8_t* out = tac_record_head(engine, buffer, kind);
+    switch (kind) {
+        case TAC_RECORD_MEM_WRITE:
+            out = tac_trace_put_varint(out, address);
+            out = tac_trace_put_varint(out, size);
+            break;
+        case TAC_RECORD_MALLOC:
+            out = tac_trace_put_varint(out, size);
+            out = tac_trace_put_varint(out, address);
+            break;
+        default:
+            out = tac_trace_put_varint(out, address);
+            break;
+    }
+    tac_record_write(engine->recorder, buffer, out);
+    if (kind == TAC_RECORD_MEM_WRITE && size > 0) {
+        tac_record_write(engine->recorder, data, (const uint8_t*)data + size);
+    }
+}
+
+void tac_record_resume(tac_engine_t* engine) {
+    uint8_t buffer[TAC_RECORD_HEADER_MAX];
+    uint8_t* out = tac_record_head(engine, buffer, TAC_RECORD_RESUME);
+    out = tac_trace_put_varint(out, engine->pc);
+    tac_record_write(engine->recorder, buffer, out);
+}
+
+tac_engine_error_t tac_engine_record_to_file(tac_engine_t* engine, const char* path) {
+    if (!engine || !path) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    if (!engine->instructions || engine->replay) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    tac_engine_error_t err = tac_engine_record_stop(engine);
+    if (err != TAC_ENGINE_OK) {
+        return err;
+    }
+
+    tac_recorder_t* recorder = calloc(1, sizeof(tac_recorder_t));
+    if (!recorder) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+    recorder->file = fopen(path, "wb");
+    if (!recorder->file) {
+        tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND, "Cannot create input log %s", path);
+        free(recorder);
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+    recorder->step = engine->step_count;
+
+    uint8_t header[TAC_RECORD_MAGIC_SIZE + TAC_RECORD_HEADER_MAX];
+    uint8_t* out = header;
+    memcpy(out, TAC_RECORD_MAGIC, TAC_RECORD_MAGIC_SIZE);
+    out += TAC_RECORD_MAGIC_SIZE;
+    out = tac_trace_put_varint(out, engine->instruction_count);
+    out = tac_trace_put_varint(out, tac_code_hash(engine));
+    out = tac_trace_put_varint(out, engine->step_count);
+    out = tac_trace_put_varint(out, engine->pc);
+    out = tac_trace_put_varint(out, tac_state_hash(engine));
+    tac_record_write(recorder, header, out);
+
+    engine->recorder = recorder;
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_engine_record_stop(tac_engine_t* engine) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_recorder_t* recorder = engine->recorder;
+    if (!recorder) {
+        return TAC_ENGINE_OK;
+    }
+
+    uint8_t buffer[TAC_RECORD_HEADER_MAX];
+    tac_record_write(recorder, buffer, tac_record_head(engine, buffer, TAC_RECORD_END));
+    engine->recorder = NULL;
+
+    bool ok = !recorder->failed;
+    ok &= fclose(recorder->file) == 0;
+    free(recorder);
+
+    if (!ok) {
+        tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND, "Input log write failed");
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+    return TAC_ENGINE_OK;
+}
+
+// =============================================================================
+// LOG PARSING
+// =============================================================================
+
+/**
+ * @brief Read a varint from a buffer
+ * @return false if truncated or oversized
+ */
+static bool tac_replay_get_varint(const uint8_t** in, const uint8_t* end, uint64_t* value) {
+    *value = 0;
+    for (unsigned shift = 0; shift < 64 && *in < end; shift += 7) {
+        uint8_t byte = *(*in)++;
+        *value |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool tac_replay_get_u32(const uint8_t** in, const uint8_t* end, uint32_t* value) {
+    uint64_t wide;
+    if (!tac_replay_get_varint(in, end, &wide) || wide > UINT32_MAX) {
+        return false;
+    }
+    *value = (uint32_t)wide;
+    return true;
+}
+
+/**
+ * @brief Read a whole file
+ * @return Contents (caller frees), or NULL
+ */
+static uint8_t* tac_replay_read_file(const char* path, size_t* size) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+
+    size_t capacity = 4096;
+    size_t used = 0;
+    uint8_t* data = malloc(capacity);
+    while (data) {
+        used += fread(data + used, 1, capacity - used, file);
+        if (used < capacity) {
+            break;
+        }
+        uint8_t* grown = realloc(data, capacity * 2);
+        if (!grown) {
+            free(data);
+            data = NULL;
+            break;
+        }
+        data = grown;
+        capacity *= 2;
+    }
+
+    if (data && ferror(file)) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    *size = used;
+    return data;
+}
+
+/**
+ * @brief Decode the records of a log; MEM_WRITE payloads stay in the file image
+ */
+static tac_engine_error_t tac_replay_parse(tac_replay_t* replay, const uint8_t* in,
+                                           const uint8_t* end, uint32_t step) {
+    const uint8_t* base = replay->bytes;
+    uint32_t capacity = 0;
+
+    while (in < end) {
+        if (replay->entry_count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            tac_replay_entry_t* grown = realloc(replay->entries,
+                                                capacity * sizeof(tac_replay_entry_t));
+            if (!grown) {
+                return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+            }
+            replay->entries = grown;
+        }
+
+        tac_replay_entry_t* entry = &replay->entries[replay->entry_count];
+        memset(entry, 0, sizeof(*entry));
+
+        uint64_t head;
+        uint32_t delta;
+        if (!tac_replay_get_varint(&in, end, &head) ||
+            !tac_replay_get_u32(&in, end, &delta) || delta > UINT32_MAX - step ||
+            (head & 3) > TAC_INPUT_AFTER || (head >> 2) > TAC_RECORD_RESUME) {
+            return TAC_ENGINE_ERR_INVALID_OPERAND;
+        }
+        step += delta;
+        entry->step = step;
+        entry->kind = (uint8_t)(head >> 2);
+        entry->phase = (uint8_t)(head & 3);
+
+        bool ok = true;
+        uint32_t id;
+        uint64_t bits;
+        switch (entry->kind) {
+            case TAC_RECORD_SET_VAR:
+            case TAC_RECORD_SET_TEMP:
+                ok = tac_replay_get_u32(&in, end, &id) && id <= UINT16_MAX && in < end &&
+                     *in <= TAC_VALUE_BOOL;
+                if (ok) {
+                    tac_value_type_t type = (tac_value_type_t)*in++;
+                    ok = tac_replay_get_varint(&in, end, &bits);
+                    entry->id = (uint16_t)id;
+                    entry->value = tac_trace_value_from_bits(type, bits);
+                }
+                break;
+
+            case TAC_RECORD_MEM_WRITE:
+                ok = tac_replay_get_u32(&in, end, &entry->address) &&
+                     tac_replay_get_u32(&in, end, &entry->size) &&
+                     entry->size <= (size_t)(end - in);
+                if (ok) {
+                    entry->data = (uint32_t)(in - base);
+                    in += entry->size;
+                }
+                break;
+
+            case TAC_RECORD_MALLOC:
+                ok = tac_replay_get_u32(&in, end, &entry->size) &&
+                     tac_replay_get_u32(&in, end, &entry->address);
+                break;
+
+            case TAC_RECORD_FREE:
+            case TAC_RECORD_RESUME:
+                ok = tac_replay_get_u32(&in, end, &entry->address);
+                break;
+
+            default:
+                break;
+        }
+        if (!ok) {
+            return TAC_ENGINE_ERR_INVALID_OPERAND;
+        }
+
+        replay->entry_count++;
+        if (entry->kind == TAC_RECORD_END) {
+            replay->end_step = step;
+            break;
+        }
+    }
+    return TAC_ENGINE_OK;
+}
+
+// =============================================================================
+// REPLAY
+// =============================================================================
+
+/**
+ * @brief Re-apply one recorded input through the API
+ */
+static tac_engine_error_t tac_replay_input(tac_replay_t* replay, const tac_replay_entry_t* entry) {
+    tac_engine_t* engine = replay->engine;
+    tac_engine_error_t err = TAC_ENGINE_OK;
+
+    switch (entry->kind) {
+        case TAC_RECORD_SET_VAR:
+            err = tac_engine_set_var(engine, entry->id, &entry->value);
+            break;
+        case TAC_RECORD_SET_TEMP:
+            err = tac_engine_set_temp(engine, entry->id, &entry->value);
+            break;
+        case TAC_RECORD_MEM_WRITE:
+            err = tac_engine_mem_write(engine, entry->address, replay->bytes + entry->data,
+                                       entry->size);
+            break;
+        case TAC_RECORD_MALLOC:
+            if (tac_engine_malloc(engine, entry->size) != entry->address) {
+                err = TAC_ENGINE_ERR_INVALID_MEMORY;
+            }
+            break;
+        case TAC_RECORD_FREE:
+            err = tac_engine_free(engine, entry->address);
+            break;
+        case TAC_RECORD_RESUME:
+            if (entry->address < engine->instruction_count) {
+                engine->pc = entry->address;
+            } else {
+                err = TAC_ENGINE_ERR_INVALID_OPERAND;
+            }
+            break;
+        default:
+            break;
+    }
+
+    // The recording succeeded here, so a failure means the runs diverged
+    if (err != TAC_ENGINE_OK) {
+        tac_set_error(engine, err, "Replay diverged at step %u (input kind %u)",
+                     entry->step, entry->kind);
+    }
+    return err;
+}
+
+/**
+ * @brief Keep a snapshot of the state before the current step
+ */
+static tac_engine_error_t tac_replay_mark(tac_replay_t* replay) {
+    tac_engine_t* engine = replay->engine;
+    if (replay->mark_count == replay->mark_capacity) {
+        uint32_t capacity = replay->mark_capacity ? replay->mark_capacity * 2 : 16;
+        tac_replay_mark_t* grown = realloc(replay->marks, capacity * sizeof(tac_replay_mark_t));
+        if (!grown) {
+            return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        }
+        replay->marks = grown;
+        replay->mark_capacity = capacity;
+    }
+
+    // Between two steps a running engine is consistent; its snapshot
+    // restores as paused there
+    tac_replay_mark_t* mark = &replay->marks[replay->mark_count];
+    tac_engine_state_t state = engine->state;
+    engine->state = TAC_ENGINE_PAUSED;
+    tac_engine_error_t err = tac_engine_snapshot(engine, &mark->snapshot);
+    engine->state = state;
+    if (err != TAC_ENGINE_OK) {
+        return err;
+    }
+    mark->step = engine->step_count;
+    mark->cursor = replay->cursor;
+    replay->mark_count++;
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_replay_before(tac_engine_t* engine) {
+    tac_replay_t* replay = engine->replay;
+    uint32_t step = engine->step_count;
+
+    if (replay->interval && step >= replay->next_mark) {
+        if (step > replay->marks[replay->mark_count - 1].step) {
+            tac_engine_error_t err = tac_replay_mark(replay);
+            if (err != TAC_ENGINE_OK) {
+                return err;
+            }
+        }
+        replay->next_mark = step - step % replay->interval + replay->interval;
+    }
+
+    if (replay->target == step) {
+        replay->target = TAC_NO_TARGET;
+        replay->stopped = true;
+        return TAC_ENGINE_ERR_BREAKPOINT;
+    }
+
+    // Inputs of earlier steps still pending were made at a point this run
+    // did not reach; apply them late rather than drop them
+    while (replay->cursor < replay->entry_count) {
+        const tac_replay_entry_t* entry = &replay->entries[replay->cursor];
+        if (entry->step > step ||
+            (entry->step == step && entry->phase != TAC_INPUT_BEFORE)) {
+            break;
+        }
+        replay->cursor++;
+        if (entry->kind == TAC_RECORD_END) {
+            replay->stopped = true;
+            return TAC_ENGINE_ERR_BREAKPOINT;
+        }
+        tac_engine_error_t err = tac_replay_input(replay, entry);
+        if (err != TAC_ENGINE_OK) {
+            return err;
+        }
+    }
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_replay_apply(tac_engine_t* engine, tac_input_phase_t phase) {
+    tac_replay_t* replay = engine->replay;
+    while (replay->cursor < replay->entry_count) {
+        const tac_replay_entry_t* entry = &replay->entries[replay->cursor];
+        if (entry->step != engine->step_count || entry->phase != phase ||
+            entry->kind == TAC_RECORD_END) {
+            break;
+        }
+        replay->cursor++;
+        tac_engine_error_t err = tac_replay_input(replay, entry);
+        if (err != TAC_ENGINE_OK) {
+            return err;
+        }
+    }
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_replay_open(tac_engine_t* engine, const char* path,
+                                   uint32_t snapshot_interval, tac_replay_t** replay) {
+    if (!engine || !path || !replay) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    *replay = NULL;
+    if (!engine->instructions || engine->replay || engine->recorder) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    tac_replay_t* result = calloc(1, sizeof(tac_replay_t));
+    if (!result) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+    result->engine = engine;
+    result->end_step = UINT32_MAX;
+    result->target = TAC_NO_TARGET;
+    result->interval = snapshot_interval;
+
+    size_t size = 0;
+    result->bytes = tac_replay_read_file(path, &size);
+    if (!result->bytes) {
+        tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND, "Cannot read input log %s", path);
+        tac_replay_close(result);
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    // The log must describe this program, from the state the engine is in
+    const uint8_t* in = result->bytes + TAC_RECORD_MAGIC_SIZE;
+    const uint8_t* end = result->bytes + size;
+    uint32_t header[5];
+    bool ok = size >= TAC_RECORD_MAGIC_SIZE &&
+              memcmp(result->bytes, TAC_RECORD_MAGIC, TAC_RECORD_MAGIC_SIZE) == 0;
+    for (int i = 0; ok && i < 5; i++) {
+        ok = tac_replay_get_u32(&in, end, &header[i]);
+    }
+    if (!ok || header[0] != engine->instruction_count || header[1] != tac_code_hash(engine)) {
+        tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND,
+                     "%s is not an input log of the loaded program", path);
+        tac_replay_close(result);
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+    if (header[2] != engine->step_count || header[3] != engine->pc ||
+        header[4] != tac_state_hash(engine)) {
+        tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND,
+                     "Engine state differs from the start of %s (step %u, pc %u)",
+                     path, header[2], header[3]);
+        tac_replay_close(result);
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    tac_engine_error_t err = tac_replay_parse(result, in, end, header[2]);
+    if (err == TAC_ENGINE_ERR_INVALID_OPERAND) {
+        tac_set_error(engine, err, "Input log %s is corrupt", path);
+    }
+    if (err == TAC_ENGINE_OK) {
+        err = tac_replay_mark(result);
+    }
+    if (err != TAC_ENGINE_OK) {
+        tac_replay_close(result);
+        return err;
+    }
+    if (snapshot_interval) {
+        result->next_mark = engine->step_count - engine->step_count % snapshot_interval +
+                            snapshot_interval;
+    }
+
+    engine->replay = result;
+    engine->paused_at = TAC_NO_TARGET;
+    tac_update_instrumentation(engine);
+    *replay = result;
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_replay_run(tac_replay_t* replay) {
+    if (!replay || !replay->engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    tac_engine_t* engine = replay->engine;
+
+    for (;;) {
+        replay->stopped = false;
+        tac_engine_error_t err = tac_engine_run(engine);
+        if (replay->stopped) {
+            return TAC_ENGINE_OK;
+        }
+        if (err == TAC_ENGINE_ERR_BREAKPOINT) {
+            return err;
+        }
+
+        // Finished or failed: replay what the host did next, up to the
+        // run or step it resumed with
+        if (replay->target == engine->step_count) {
+            replay->target = TAC_NO_TARGET;
+            return TAC_ENGINE_OK;
+        }
+        bool resumed = false;
+        while (!resumed && replay->cursor < replay->entry_count &&
+               replay->entries[replay->cursor].step <= engine->step_count) {
+            const tac_replay_entry_t* entry = &replay->entries[replay->cursor++];
+            if (entry->kind == TAC_RECORD_END) {
+                return err;
+            }
+            tac_engine_error_t input_err = tac_replay_input(replay, entry);
+            if (input_err != TAC_ENGINE_OK) {
+                return input_err;
+            }
+            resumed = entry->kind == TAC_RECORD_RESUME;
+        }
+        if (!resumed) {
+            return err;
+        }
+    }
+}
+
+tac_engine_error_t tac_replay_seek(tac_replay_t* replay, uint32_t step) {
+    if (!replay || !replay->engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    tac_engine_t* engine = replay->engine;
+    if (step < replay->marks[0].step || step > replay->end_step) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    // Latest snapshot at or before the step
+    uint32_t lo = 0;
+    uint32_t hi = replay->mark_count;
+    while (hi - lo > 1) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (replay->marks[mid].step <= step) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    const tac_replay_mark_t* mark = &replay->marks[lo];
+
+    // Going forward from the current state is cheaper when it lies between
+    if (engine->step_count < mark->step || engine->step_count >= step) {
+        tac_engine_error_t err = tac_engine_restore(engine, mark->snapshot);
+        if (err != TAC_ENGINE_OK) {
+            return err;
+        }
+        replay->cursor = mark->cursor;
+        if (replay->interval) {
+            replay->next_mark = mark->step - mark->step % replay->interval + replay->interval;
+        }
+    }
+
+    replay->target = step;
+    tac_engine_error_t err = tac_replay_run(replay);
+    replay->target = TAC_NO_TARGET;
+    if (err == TAC_ENGINE_OK && engine->step_count != step) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+    return err;
+}
+
+uint32_t tac_replay_end_step(const tac_replay_t* replay) {
+    return replay ? replay->end_step : UINT32_MAX;
+}
+
+void tac_replay_close(tac_replay_t* replay) {
+    if (!replay) {
+        return;
+    }
+
+    tac_engine_t* engine = replay->engine;
+    if (engine && engine->replay == replay) {
+        engine->replay = NULL;
+        tac_update_instrumentation(engine);
+    }
+    for (uint32_t i = 0; i < replay->mark_count; i++) {
+        tac_engine_snapshot_free(replay->marks[i].snapshot);
+    }
+    free(replay->marks);
+    free(replay->entries);
+    free(replay->bytes);
+    free(replay);
+}
@@ -0,0 +1,327 @@
+/**
+ * @file tac_engine_snapshot.c
+ * @brief TAC Engine snapshots, restore and fork
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * A snapshot holds the execution state of an engine: registers, call stack,
+ * staged parameters and the heap. Registers and the call stack are small
+ * and copied outright; virtual memory is shared page by page with the
+ * engine and copied lazily by whichever side writes a page first (see
+ * tac_engine_memory.c). Restoring therefore costs the pages written since
+ * the snapshot was taken, not the size of the heap. The inferred slot types
+ * are saved with the registers they describe, so a restore does not re-run
+ * the inference over the program either.
+ *
+ * Snapshots are immutable once taken, so one snapshot can seed any number
+ * of engines, on any thread.
+ */
+
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+struct tac_snapshot {
+    // Program and shape of the engine the snapshot was taken from
+    uint32_t instruction_count;
+    uint32_t code_hash;
+    uint32_t function_count;
+    uint32_t register_count;
+    uint32_t max_call_depth;
+
+    // Execution state
+    tac_engine_state_t state;
+    tac_engine_error_t last_error;
+    uint32_t pc;
+    uint32_t step_count;
+    uint32_t temp_count;
+    uint32_t var_count;
+    char error_message[256];
+    uint32_t error_address;
+
+    // Storage
+    tac_value_t* registers;         // register_count slots
+    tac_memory_manager_t memory;    // Shares pages with the engine
+    uint32_t* dynamic_slots;        // Slot types valid for registers (NULL: no code)
+    uint32_t* int32_ops;
+
+    // Call stack
+    tac_stack_frame_t* frames;      // call_depth frames
+    uint32_t call_depth;
+    tac_value_t* value_stack;       // value_sp saved slots
+    uint32_t value_sp;
+    uint32_t param_counter;
+    tac_value_t param_stack[TAC_MAX_CALL_PARAMS];
+    uint32_t* active;               // Live activations per function
+};
+
+// =============================================================================
+// SNAPSHOT AND RESTORE
+// =============================================================================
+
+static uint32_t tac_register_count(const tac_engine_t* engine) {
+    return engine->config.max_variables + engine->config.max_temporaries;
+}
+
+void tac_engine_snapshot_free(tac_snapshot_t* snapshot) {
+    if (!snapshot) {
+        return;
+    }
+
+    tac_memory_cleanup(&snapshot->memory);
+    free(snapshot->registers);
+    free(snapshot->frames);
+    free(snapshot->value_stack);
+    free(snapshot->active);
+    free(snapshot->dynamic_slots);
+    free(snapshot->int32_ops);
+    free(snapshot);
+}
+
+tac_engine_error_t tac_engine_snapshot(tac_engine_t* engine, tac_snapshot_t** snapshot) {
+    if (!engine || !snapshot) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    *snapshot = NULL;
+
+    // Mid-instruction state (hooks, callbacks) is not capturable
+    if (engine->state == TAC_ENGINE_RUNNING) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    tac_snapshot_t* snap = calloc(1, sizeof(tac_snapshot_t));
+    if (!snap) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    snap->instruction_count = engine->instruction_count;
+    snap->code_hash = engine->code_hash;
+    snap->function_count = engine->function_count;
+    snap->register_count = tac_register_count(engine);
+    snap->max_call_depth = engine->config.max_call_depth;
+
+    snap->registers = malloc((size_t)snap->register_count * sizeof(tac_value_t));
+    if (engine->call_depth > 0) {
+        snap->frames = malloc((size_t)engine->call_depth * sizeof(tac_stack_frame_t));
+    }
+    if (engine->value_sp > 0) {
+        snap->value_stack = malloc((size_t)engine->value_sp * sizeof(tac_value_t));
+    }
+    if (engine->function_count > 0) {
+        snap->active = malloc((size_t)engine->function_count * sizeof(uint32_t));
+    }
+    if (engine->dynamic_slots) {
+        snap->dynamic_slots = malloc(tac_types_slot_words(engine) * sizeof(uint32_t));
+        snap->int32_ops = malloc(tac_types_op_words(engine) * sizeof(uint32_t));
+    }
+    tac_engine_error_t err = tac_memory_clone(&snap->memory, &engine->memory);
+
+    if (err != TAC_ENGINE_OK || !snap->registers ||
+        (engine->call_depth > 0 && !snap->frames) ||
+        (engine->value_sp > 0 && !snap->value_stack) ||
+        (engine->function_count > 0 && !snap->active) ||
+        (engine->dynamic_slots && (!snap->dynamic_slots || !snap->int32_ops))) {
+        tac_engine_snapshot_free(snap);
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    snap->state = engine->state;
+    snap->last_error = engine->last_error;
+    snap->pc = engine->pc;
+    snap->step_count = engine->step_count;
+    snap->temp_count = engine->temp_count;
+    snap->var_count = engine->var_count;
+    memcpy(snap->error_message, engine->error_message, sizeof(snap->error_message));
+    snap->error_address = engine->error_address;
+
+    memcpy(snap->registers, engine->registers, (size_t)snap->register_count * sizeof(tac_value_t));
+
+    snap->call_depth = engine->call_depth;
+    if (snap->frames) {
+        memcpy(snap->frames, engine->frames, (size_t)engine->call_depth * sizeof(tac_stack_frame_t));
+    }
+    snap->value_sp = engine->value_sp;
+    if (snap->value_stack) {
+        memcpy(snap->value_stack, engine->value_stack, (size_t)engine->value_sp * sizeof(tac_value_t));
+    }
+    snap->param_counter = engine->param_counter;
+    memcpy(snap->param_stack, engine->param_stack, sizeof(snap->param_stack));
+    for (uint32_t i = 0; i < engine->function_count; i++) {
+        snap->active[i] = engine->functions[i].active;
+    }
+    if (snap->dynamic_slots) {
+        memcpy(snap->dynamic_slots, engine->dynamic_slots,
+               tac_types_slot_words(engine) * sizeof(uint32_t));
+        memcpy(snap->int32_ops, engine->int32_ops, tac_types_op_words(engine) * sizeof(uint32_t));
+    }
+
+    *snapshot = snap;
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_engine_restore(tac_engine_t* engine, const tac_snapshot_t* snapshot) {
+    if (!engine || !snapshot) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    // Slots, frames and function indices are only meaningful for the same
+    // program loaded into an engine of the same shape
+    if (engine->state == TAC_ENGINE_RUNNING ||
+        snapshot->instruction_count != engine->instruction_count ||
+        snapshot->code_hash != engine->code_hash ||
+        !snapshot->dynamic_slots != !engine->dynamic_slots ||
+        snapshot->function_count != engine->function_count ||
+        snapshot->register_count != tac_register_count(engine) ||
+        snapshot->max_call_depth != engine->config.max_call_depth) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    // An input log cannot express the jump to another state
+    tac_engine_record_stop(engine);
+
+    tac_engine_error_t err = tac_reserve_call_stack(engine, snapshot->call_depth,
+                                                    snapshot->value_sp);
+    if (err == TAC_ENGINE_OK) {
+        err = tac_memory_assign(&engine->memory, &snapshot->memory);
+    }
+    if (err != TAC_ENGINE_OK) {
+        return err;
+    }
+
+    engine->state = snapshot->state;
+    engine->last_error = snapshot->last_error;
+    engine->pc = snapshot->pc;
+    engine->step_count = snapshot->step_count;
+    engine->running = false;
+    engine->pair_prev = TAC_NO_TARGET;
+    engine->paused_at = TAC_NO_TARGET;
+    engine->hook_stop = false;
+    engine->temp_count = snapshot->temp_count;
+    engine->var_count = snapshot->var_count;
+    memcpy(engine->error_message, snapshot->error_message, sizeof(engine->error_message));
+    engine->error_address = snapshot->error_address;
+
+    memcpy(engine->registers, snapshot->registers,
+           (size_t)snapshot->register_count * sizeof(tac_value_t));
+
+    engine->call_depth = snapshot->call_depth;
+    if (snapshot->frames) {
+        memcpy(engine->frames, snapshot->frames,
+               (size_t)snapshot->call_depth * sizeof(tac_stack_frame_t));
+    }
+    engine->value_sp = snapshot->value_sp;
+    if (snapshot->value_stack) {
+        memcpy(engine->value_stack, snapshot->value_stack,
+               (size_t)snapshot->value_sp * sizeof(tac_value_t));
+    }
+    engine->param_counter = snapshot->param_counter;
+    memcpy(engine->param_stack, snapshot->param_stack, sizeof(engine->param_stack));
+    for (uint32_t i = 0; i < engine->function_count; i++) {
+        engine->functions[i].active = snapshot->active[i];
+    }
+
+    // Slot types as inferred for these registers
+    if (snapshot->dynamic_slots) {
+        memcpy(engine->dynamic_slots, snapshot->dynamic_slots,
+               tac_types_slot_words(engine) * sizeof(uint32_t));
+        memcpy(engine->int32_ops, snapshot->int32_ops,
+               tac_types_op_words(engine) * sizeof(uint32_t));
+    }
+
+    tac_update_instrumentation(engine);
+    return TAC_ENGINE_OK;
+}
+
+// =============================================================================
+// FORK
+// =============================================================================
+
+/**
+ * @brief Give a forked engine its own copy of the parent's symbol images
+ */
+static tac_engine_error_t tac_fork_symbols(tac_engine_t* child, const tac_engine_t* parent) {
+    const tac_symbol_context_t* from = &parent->symbols;
+    tac_symbol_context_t* to = &child->symbols;
+
+    // The child was created without symtab_file, so it owns no buffers yet
+    *to = *from;
+    to->entries = NULL;
+    to->strings = NULL;
+    to->cache_hits = 0;
+    to->cache_misses = 0;
+
+    if (from->entries && from->entry_count > 0) {
+        to->entries = malloc((size_t)from->entry_count * sizeof(SymTabEntry));
+        if (!to->entries) {
+            return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        }
+        memcpy(to->entries, from->entries, (size_t)from->entry_count * sizeof(SymTabEntry));
+    }
+    if (from->strings && from->strings_size > 0) {
+        to->strings = malloc(from->strings_size);
+        if (!to->strings) {
+            return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+        }
+        memcpy(to->strings, from->strings, from->strings_size);
+    }
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_t* tac_engine_fork(tac_engine_t* engine) {
+    if (!engine || engine->state == TAC_ENGINE_RUNNING) {
+        return NULL;
+    }
+
+    // Symbol images are copied from memory rather than reloaded from disk
+    tac_engine_config_t config = engine->config;
+    config.symtab_file = NULL;
+    config.sstore_file = NULL;
+
+    tac_engine_t* child = tac_engine_create(&config);
+    if (!child) {
+        return NULL;
+    }
+    child->config = engine->config;
+    child->log_sink = engine->log_sink;
+    child->log_user_data = engine->log_user_data;
+
+    tac_snapshot_t* snapshot = NULL;
+    tac_engine_error_t err = tac_fork_symbols(child, engine);
+    if (err == TAC_ENGINE_OK && engine->instructions) {
+        err = tac_engine_load_program(child, engine->instructions, engine->instruction_count,
+                                      engine->function_records, engine->function_record_count);
+    }
+    if (err == TAC_ENGINE_OK) {
+        err = tac_engine_snapshot(engine, &snapshot);
+    }
+    if (err == TAC_ENGINE_OK) {
+        err = tac_engine_restore(child, snapshot);
+    }
+    tac_engine_snapshot_free(snapshot);
+
+    if (err != TAC_ENGINE_OK) {
+        tac_engine_destroy(child);
+        return NULL;
+    }
+    return child;
+}
+
+tac_engine_error_t tac_engine_get_page_stats(tac_engine_t* engine,
+                                             uint32_t* pages_touched,
+                                             uint32_t* pages_copied) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    if (pages_touched) {
+        *pages_touched = engine->memory.pages_touched;
+    }
+    if (pages_copied) {
+        *pages_copied = engine->memory.pages_copied;
+    }
+    return TAC_ENGINE_OK;
+}
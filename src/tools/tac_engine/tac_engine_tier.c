@@ -0,0 +1,197 @@
+/**
+ * @file tac_engine_tier.c
+ * @brief TAC Engine tiered execution (TAC_EXEC_TIERED)
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * Tiered mode starts every program in the interpreter, which needs no
+ * preparation, and counts how often each function is entered and how many
+ * backward jumps (loop iterations) it takes. A function reaching
+ * tier_call_threshold entries or tier_loop_threshold back-edges is
+ * promoted: the program is pre-decoded (with superinstructions, if
+ * enabled) the first time that happens, and from then on the promoted
+ * function runs in tac_run_predecoded().
+ *
+ * Both tiers work on the same registers, memory and call stack, so the
+ * switch needs no state transfer. It happens at the next call boundary
+ * (a CALL into, or RETURN to, a promoted function) or, for a function
+ * promoted by its loops, at the next back-edge, i.e. at the loop header.
+ * The pre-decoded loop hands control back at the first call boundary that
+ * lands in code still interpreted. Top-level code counts as one more
+ * function, so a long loop in a script without calls is promoted too.
+ */
+
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+#include "tac_engine_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+// =============================================================================
+// COUNTERS
+// =============================================================================
+
+tac_engine_error_t tac_tier_reset(tac_engine_t* engine) {
+    tac_tier_cleanup(engine);
+    if (engine->config.exec_mode != TAC_EXEC_TIERED) {
+        return TAC_ENGINE_OK;
+    }
+
+    engine->tier = calloc((size_t)engine->function_count + 1, sizeof(tac_tier_counter_t));
+    return engine->tier ? TAC_ENGINE_OK : TAC_ENGINE_ERR_OUT_OF_MEMORY;
+}
+
+void tac_tier_cleanup(tac_engine_t* engine) {
+    free(engine->tier);
+    engine->tier = NULL;
+    engine->tier_promotions = 0;
+    engine->tier_switches = 0;
+}
+
+/**
+ * @brief Counters of the function the innermost frame is running
+ */
+static tac_tier_counter_t* tac_tier_current(const tac_engine_t* engine) {
+    uint32_t function = engine->call_depth > 0
+        ? engine->frames[engine->call_depth - 1].function : TAC_NO_TARGET;
+    return &engine->tier[function < engine->function_count ? function : engine->function_count];
+}
+
+/**
+ * @brief Promote a function whose counter just reached its threshold
+ */
+static void tac_tier_promote(tac_engine_t* engine, tac_tier_counter_t* counter,
+                             uint32_t count, const char* reason) {
+    counter->promoted = true;
+    engine->tier_promotions++;
+
+    uint32_t function = (uint32_t)(counter - engine->tier);
+    if (function < engine->function_count) {
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_DISPATCH, "Promoting function @%u after %u %s",
+                      engine->functions[function].entry, count, reason);
+    } else {
+        TAC_LOG_DEBUG(engine, TAC_LOG_CAT_DISPATCH, "Promoting top-level code after %u %s",
+                      count, reason);
+    }
+}
+
+bool tac_tier_call_boundary(tac_engine_t* engine, TACOpcode opcode) {
+    tac_tier_counter_t* counter = tac_tier_current(engine);
+    if (opcode == TAC_CALL && !counter->promoted &&
+        ++counter->entries == engine->config.tier_call_threshold) {
+        tac_tier_promote(engine, counter, counter->entries, "calls");
+    }
+    return counter->promoted;
+}
+
+/**
+ * @brief Count a backward jump in the current function
+ * @return True if the function runs in the pre-decoded tier
+ */
+static bool tac_tier_back_edge(tac_engine_t* engine) {
+    tac_tier_counter_t* counter = tac_tier_current(engine);
+    if (!counter->promoted &&
+        ++counter->back_edges == engine->config.tier_loop_threshold) {
+        tac_tier_promote(engine, counter, counter->back_edges, "back-edges");
+    }
+    return counter->promoted;
+}
+
+// =============================================================================
+// EXECUTION
+// =============================================================================
+
+/**
+ * @brief Run promoted code in the pre-decoded tier until it leaves it
+ * @return TAC_ENGINE_OK with state RUNNING when back in interpreted code
+ */
+static tac_engine_error_t tac_tier_enter(tac_engine_t* engine) {
+    if (!engine->decoded.insns) {
+        tac_engine_error_t err = tac_decode_program(engine);
+        if (err != TAC_ENGINE_OK) {
+            tac_set_error(engine, err, "Cannot pre-decode the program for tier-up");
+            engine->state = TAC_ENGINE_ERROR;
+            return err;
+        }
+    }
+    engine->tier_switches++;
+    return tac_run_predecoded(engine);
+}
+
+tac_engine_error_t tac_run_tiered(tac_engine_t* engine) {
+    engine->state = TAC_ENGINE_RUNNING;
+
+    // Execution may resume inside code promoted by an earlier run
+    if (engine->pc < engine->instruction_count && tac_tier_current(engine)->promoted) {
+        tac_engine_error_t err = tac_tier_enter(engine);
+        if (err != TAC_ENGINE_OK || engine->state != TAC_ENGINE_RUNNING) {
+            return err;
+        }
+    }
+
+    while (engine->pc < engine->instruction_count) {
+        uint32_t pc = engine->pc;
+        const TACInstruction* instruction = &engine->instructions[pc];
+
+        tac_engine_error_t err = tac_execute_instruction(engine, instruction);
+        if (err != TAC_ENGINE_OK) {
+            engine->state = TAC_ENGINE_ERROR;
+            return err;
+        }
+
+        if (++engine->step_count >= engine->config.max_steps) {
+            tac_set_error(engine, TAC_ENGINE_ERR_MAX_STEPS,
+                         "Execution exceeded maximum steps: %u", engine->config.max_steps);
+            engine->state = TAC_ENGINE_STOPPED;
+            return TAC_ENGINE_ERR_MAX_STEPS;
+        }
+
+        bool promoted;
+        switch (instruction->opcode) {
+            case TAC_CALL:
+            case TAC_RETURN:
+            case TAC_RETURN_VOID:
+                promoted = tac_tier_call_boundary(engine, instruction->opcode);
+                break;
+            case TAC_GOTO:
+            case TAC_IF_TRUE:
+            case TAC_IF_FALSE:
+                promoted = engine->pc <= pc && tac_tier_back_edge(engine);
+                break;
+            default:
+                promoted = false;
+                break;
+        }
+
+        if (promoted && engine->pc < engine->instruction_count) {
+            err = tac_tier_enter(engine);
+            if (err != TAC_ENGINE_OK || engine->state != TAC_ENGINE_RUNNING) {
+                return err;
+            }
+        }
+    }
+
+    engine->state = TAC_ENGINE_FINISHED;
+    return TAC_ENGINE_OK;
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+tac_engine_error_t tac_engine_get_tier_stats(tac_engine_t* engine, tac_tier_stats_t* stats) {
+    if (!engine || !stats) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+    if (!engine->tier) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    stats->promoted = engine->tier_promotions;
+    stats->switches = engine->tier_switches;
+    stats->decoded = engine->decoded.insns != NULL;
+    return TAC_ENGINE_OK;
+}
@@ -0,0 +1,412 @@
+/**
+ * @file tac_engine_trace.c
+ * @brief TAC Engine binary trace streaming and reading
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * tac_engine_trace_to_file() records one entry per interpreted step. The
+ * engine encodes entries into one of two buffers while a background thread
+ * writes the other to the file, so execution only waits if the disk falls
+ * a whole buffer behind, and nothing is ever dropped.
+ *
+ * File format: the 8-byte magic "TACTRC1\n", then one record per step:
+ *
+ *   varint head   zigzag(address - (previous address + 1)) << 2
+ *                 | 2 if a step number follows (first record, or a gap)
+ *                 | 1 if the result operand changed
+ *   varint step   absolute step number (only with bit 1); otherwise the
+ *                 step is the previous one plus 1
+ *   uint8 type    tac_value_type_t of the new result (only with bit 0)
+ *   varint value  the new result: zigzag for signed types, raw bits for
+ *                 the others (only with bit 0)
+ *
+ * Straight-line code that leaves its result unchanged costs one byte per
+ * step; a typical arithmetic step costs three.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TAC_TRACE_MAGIC         "TACTRC1\n"
+#define TAC_TRACE_MAGIC_SIZE    8u
+#define TAC_TRACE_BUFFER_SIZE   (1u << 20)
+#define TAC_TRACE_RECORD_MAX    32u     // head + step + type + value, worst case
+
+#define TAC_TRACE_CHANGED       1u
+#define TAC_TRACE_SYNC          2u
+
+/**
+ * @brief Streaming trace writer (one per tracing engine)
+ */
+struct tac_trace_stream {
+    FILE* file;
+    uint8_t* buffers[2];
+    uint32_t fill;                  // Bytes used in buffers[active]
+    uint32_t active;                // Buffer the engine encodes into
+
+    // Hand-off to the writer thread, guarded by lock
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int32_t pending;                // Buffer waiting to be written, or -1
+    uint32_t pending_size;
+    bool stop;
+    bool failed;                    // A write failed
+
+    // Delta state
+    uint64_t next_step;             // Step expected without a sync
+    uint32_t next_address;          // Address expected without a jump
+    bool synced;
+
+    // Result of the step being traced
+    const tac_value_t* slot;
+    tac_value_t before;
+};
+
+// =============================================================================
+// ENCODING
+// =============================================================================
+
+uint8_t* tac_trace_put_varint(uint8_t* out, uint64_t value) {
+    while (value >= 0x80) {
+        *out++ = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = (uint8_t)value;
+    return out;
+}
+
+static uint64_t tac_trace_zigzag(int64_t value) {
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t tac_trace_unzigzag(uint64_t value) {
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+uint64_t tac_trace_value_bits(const tac_value_t* value) {
+    switch (value->type) {
+        case TAC_VALUE_INT32:   return tac_trace_zigzag(value->data.i32);
+        case TAC_VALUE_INT64:   return tac_trace_zigzag(value->data.i64);
+        case TAC_VALUE_UINT32:  return value->data.u32;
+        case TAC_VALUE_FLOAT:   return value->data.u32;
+        case TAC_VALUE_BOOL:    return value->data.boolean;
+        default:                return value->data.u64;
+    }
+}
+
+tac_value_t tac_trace_value_from_bits(tac_value_type_t type, uint64_t bits) {
+    tac_value_t value;
+    memset(&value, 0, sizeof(value));
+    value.type = type;
+    switch (type) {
+        case TAC_VALUE_INT32:   value.data.i32 = (int32_t)tac_trace_unzigzag(bits); break;
+        case TAC_VALUE_INT64:   value.data.i64 = tac_trace_unzigzag(bits); break;
+        case TAC_VALUE_UINT32:  value.data.u32 = (uint32_t)bits; break;
+        case TAC_VALUE_FLOAT:   value.data.u32 = (uint32_t)bits; break;
+        case TAC_VALUE_BOOL:    value.data.boolean = bits != 0; break;
+        default:                value.data.u64 = bits; break;
+    }
+    return value;
+}
+
+static bool tac_trace_value_equal(const tac_value_t* a, const tac_value_t* b) {
+    return a->type == b->type && tac_trace_value_bits(a) == tac_trace_value_bits(b);
+}
+
+// =============================================================================
+// BACKGROUND WRITER
+// =============================================================================
+
+static void* tac_trace_writer(void* arg) {
+    tac_trace_stream_t* stream = arg;
+
+    pthread_mutex_lock(&stream->lock);
+    for (;;) {
+        while (stream->pending < 0 && !stream->stop) {
+            pthread_cond_wait(&stream->cond, &stream->lock);
+        }
+        if (stream->pending < 0) {
+            break;
+        }
+
+        // Write without the lock; the engine keeps filling the other buffer
+        const uint8_t* data = stream->buffers[stream->pending];
+        uint32_t size = stream->pending_size;
+        pthread_mutex_unlock(&stream->lock);
+        bool ok = fwrite(data, 1, size, stream->file) == size;
+        pthread_mutex_lock(&stream->lock);
+
+        stream->failed |= !ok;
+        stream->pending = -1;
+        pthread_cond_broadcast(&stream->cond);
+    }
+    pthread_mutex_unlock(&stream->lock);
+    return NULL;
+}
+
+/**
+ * @brief Hand the active buffer to the writer and switch to the other one
+ */
+static void tac_trace_flip(tac_trace_stream_t* stream) {
+    if (stream->fill == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&stream->lock);
+    while (stream->pending >= 0) {
+        pthread_cond_wait(&stream->cond, &stream->lock);   // Disk is a buffer behind
+    }
+    stream->pending = (int32_t)stream->active;
+    stream->pending_size = stream->fill;
+    pthread_cond_broadcast(&stream->cond);
+    pthread_mutex_unlock(&stream->lock);
+
+    stream->active ^= 1;
+    stream->fill = 0;
+}
+
+static void tac_trace_stream_free(tac_trace_stream_t* stream) {
+    free(stream->buffers[0]);
+    free(stream->buffers[1]);
+    free(stream);
+}
+
+// =============================================================================
+// ENGINE HOOKS
+// =============================================================================
+
+void tac_trace_before(tac_engine_t* engine, uint32_t index) {
+    tac_trace_stream_t* stream = engine->trace_stream;
+    const TACOperand* result = &engine->instructions[index].result;
+
+    stream->slot = NULL;
+    if (result->type == TAC_OP_TEMP && result->data.variable.id < engine->config.max_temporaries) {
+        stream->slot = &engine->temporaries[result->data.variable.id];
+    } else if (result->type == TAC_OP_VAR && result->data.variable.id < engine->config.max_variables) {
+        stream->slot = &engine->variables[result->data.variable.id];
+    }
+    if (stream->slot) {
+        stream->before = *stream->slot;
+    }
+}
+
+void tac_trace_after(tac_engine_t* engine, uint32_t index) {
+    tac_trace_stream_t* stream = engine->trace_stream;
+
+    if (stream->fill + TAC_TRACE_RECORD_MAX > TAC_TRACE_BUFFER_SIZE) {
+        tac_trace_flip(stream);
+    }
+
+    // step_count is incremented after this hook runs
+    uint64_t step = engine->step_count;
+    bool sync = !stream->synced || step != stream->next_step;
+    bool changed = stream->slot && !tac_trace_value_equal(stream->slot, &stream->before);
+    int64_t jump = (int64_t)index - (int64_t)stream->next_address;
+
+    uint8_t* out = stream->buffers[stream->active] + stream->fill;
+    uint8_t* start = out;
+    out = tac_trace_put_varint(out, (tac_trace_zigzag(jump) << 2) |
+                                    (sync ? TAC_TRACE_SYNC : 0) |
+                                    (changed ? TAC_TRACE_CHANGED : 0));
+    if (sync) {
+        out = tac_trace_put_varint(out, step);
+    }
+    if (changed) {
+        *out++ = (uint8_t)stream->slot->type;
+        out = tac_trace_put_varint(out, tac_trace_value_bits(stream->slot));
+    }
+    stream->fill += (uint32_t)(out - start);
+
+    stream->synced = true;
+    stream->next_step = step + 1;
+    stream->next_address = index + 1;
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+tac_engine_error_t tac_engine_trace_to_file(tac_engine_t* engine, const char* path) {
+    if (!engine || !path) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_engine_error_t err = tac_engine_trace_stop(engine);
+    if (err != TAC_ENGINE_OK) {
+        return err;
+    }
+
+    tac_trace_stream_t* stream = calloc(1, sizeof(tac_trace_stream_t));
+    if (!stream) {
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+    stream->buffers[0] = malloc(TAC_TRACE_BUFFER_SIZE);
+    stream->buffers[1] = malloc(TAC_TRACE_BUFFER_SIZE);
+    if (!stream->buffers[0] || !stream->buffers[1]) {
+        tac_trace_stream_free(stream);
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    stream->file = fopen(path, "wb");
+    if (!stream->file) {
+        tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND, "Cannot create trace file %s", path);
+        tac_trace_stream_free(stream);
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    memcpy(stream->buffers[0], TAC_TRACE_MAGIC, TAC_TRACE_MAGIC_SIZE);
+    stream->fill = TAC_TRACE_MAGIC_SIZE;
+    stream->pending = -1;
+    pthread_mutex_init(&stream->lock, NULL);
+    pthread_cond_init(&stream->cond, NULL);
+
+    if (pthread_create(&stream->thread, NULL, tac_trace_writer, stream) != 0) {
+        pthread_cond_destroy(&stream->cond);
+        pthread_mutex_destroy(&stream->lock);
+        fclose(stream->file);
+        tac_trace_stream_free(stream);
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    engine->trace_stream = stream;
+    tac_update_instrumentation(engine);
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_engine_trace_stop(tac_engine_t* engine) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_trace_stream_t* stream = engine->trace_stream;
+    if (!stream) {
+        return TAC_ENGINE_OK;
+    }
+    engine->trace_stream = NULL;
+    tac_update_instrumentation(engine);
+
+    tac_trace_flip(stream);
+    pthread_mutex_lock(&stream->lock);
+    stream->stop = true;
+    pthread_cond_broadcast(&stream->cond);
+    pthread_mutex_unlock(&stream->lock);
+    pthread_join(stream->thread, NULL);
+
+    bool ok = !stream->failed;
+    ok &= fclose(stream->file) == 0;
+    pthread_cond_destroy(&stream->cond);
+    pthread_mutex_destroy(&stream->lock);
+    tac_trace_stream_free(stream);
+
+    if (!ok) {
+        tac_set_error(engine, TAC_ENGINE_ERR_INVALID_OPERAND, "Trace file write failed");
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+    return TAC_ENGINE_OK;
+}
+
+// =============================================================================
+// READER
+// =============================================================================
+
+struct tac_trace_reader {
+    FILE* file;
+    uint64_t next_step;
+    uint32_t next_address;
+};
+
+/**
+ * @brief Read a varint
+ * @return 1 on success, 0 at a clean end of file, -1 if truncated or oversized
+ */
+static int tac_trace_get_varint(FILE* file, uint64_t* value, bool first) {
+    *value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        int c = getc(file);
+        if (c == EOF) {
+            return (first && shift == 0) ? 0 : -1;
+        }
+        *value |= (uint64_t)(c & 0x7f) << shift;
+        if (!(c & 0x80)) {
+            return 1;
+        }
+    }
+    return -1;
+}
+
+tac_trace_reader_t* tac_trace_reader_open(const char* path) {
+    if (!path) {
+        return NULL;
+    }
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+
+    char magic[TAC_TRACE_MAGIC_SIZE];
+    tac_trace_reader_t* reader = calloc(1, sizeof(tac_trace_reader_t));
+    if (!reader || fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+        memcmp(magic, TAC_TRACE_MAGIC, sizeof(magic)) != 0) {
+        free(reader);
+        fclose(file);
+        return NULL;
+    }
+
+    reader->file = file;
+    return reader;
+}
+
+tac_engine_error_t tac_trace_reader_next(tac_trace_reader_t* reader, tac_trace_record_t* record) {
+    if (!reader || !record) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    uint64_t head;
+    int got = tac_trace_get_varint(reader->file, &head, true);
+    if (got == 0) {
+        return TAC_ENGINE_ERR_NOT_FOUND;
+    }
+    if (got < 0) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    record->step = reader->next_step;
+    if ((head & TAC_TRACE_SYNC) &&
+        tac_trace_get_varint(reader->file, &record->step, false) != 1) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+    record->address = (uint32_t)((int64_t)reader->next_address + tac_trace_unzigzag(head >> 2));
+
+    record->changed = (head & TAC_TRACE_CHANGED) != 0;
+    memset(&record->value, 0, sizeof(record->value));
+    if (record->changed) {
+        int type = getc(reader->file);
+        uint64_t bits;
+        if (type == EOF || type > TAC_VALUE_BOOL ||
+            tac_trace_get_varint(reader->file, &bits, false) != 1) {
+            return TAC_ENGINE_ERR_INVALID_OPERAND;
+        }
+        record->value = tac_trace_value_from_bits((tac_value_type_t)type, bits);
+    }
+
+    reader->next_step = record->step + 1;
+    reader->next_address = record->address + 1;
+    return TAC_ENGINE_OK;
+}
+
+void tac_trace_reader_close(tac_trace_reader_t* reader) {
+    if (!reader) {
+        return;
+    }
+    fclose(reader->file);
+    free(reader);
+}
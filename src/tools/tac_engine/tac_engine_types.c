@@ -0,0 +1,237 @@
+/**
+ * @file tac_engine_types.c
+ * @brief Static slot types for the TAC Engine interpreter
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * TAC operands carry no types, so they are inferred when code is loaded. A
+ * register slot is dynamic if a value other than an int32 can ever reach
+ * it: the values already in the registers seed the set, and every
+ * instruction that writes a slot propagates it until nothing changes.
+ * Binary operations reading only immediates and int32 slots are then
+ * flagged for tac_execute_binary_i32(), which needs neither operand copies
+ * nor type checks. Values stored from outside the program
+ * (tac_engine_set_var(), tac_engine_set_temp()) re-run the inference; a
+ * restore brings back the types saved with the snapshot.
+ */
+
+#include "tac_engine_internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+static inline bool tac_types_bit(const uint32_t* map, uint32_t index) {
+    return (map[index >> 5] & (1u << (index & 31))) != 0;
+}
+
+/**
+ * @brief Register slot of an in-range variable or temporary operand
+ */
+static bool tac_types_slot(const tac_engine_t* engine, const TACOperand* operand,
+                           uint32_t* slot) {
+    uint16_t id = operand->data.variable.id;
+    if (operand->type == TAC_OP_VAR && id < engine->config.max_variables) {
+        *slot = id;
+        return true;
+    }
+    if (operand->type == TAC_OP_TEMP && id < engine->config.max_temporaries) {
+        *slot = engine->config.max_variables + id;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Whether an operand may evaluate to something other than an int32
+ */
+static bool tac_types_dynamic(const tac_engine_t* engine, const TACOperand* operand) {
+    uint32_t slot;
+    switch (operand->type) {
+        case TAC_OP_NONE:
+        case TAC_OP_IMMEDIATE:
+        case TAC_OP_LABEL:
+            return false;
+        default:
+            return !tac_types_slot(engine, operand, &slot) ||
+                   tac_types_bit(engine->dynamic_slots, slot);
+    }
+}
+
+/**
+ * @brief Whether an operand is an immediate or a slot always holding an int32
+ */
+static bool tac_types_int32(const tac_engine_t* engine, const TACOperand* operand) {
+    uint32_t slot;
+    if (operand->type == TAC_OP_IMMEDIATE || operand->type == TAC_OP_LABEL) {
+        return true;
+    }
+    return tac_types_slot(engine, operand, &slot) &&
+           !tac_types_bit(engine->dynamic_slots, slot);
+}
+
+/**
+ * @brief Mark a slot dynamic
+ * @return True if it was not already
+ */
+static bool tac_types_mark(tac_engine_t* engine, uint32_t slot) {
+    if (tac_types_bit(engine->dynamic_slots, slot)) {
+        return false;
+    }
+    engine->dynamic_slots[slot >> 5] |= 1u << (slot & 31);
+    return true;
+}
+
+/**
+ * @brief Mark every function parameter dynamic (a dynamic argument was staged)
+ */
+static bool tac_types_mark_params(tac_engine_t* engine) {
+    bool changed = false;
+    for (uint32_t f = 0; f < engine->function_count; f++) {
+        const tac_function_info_t* info = &engine->functions[f];
+        for (uint32_t i = 0; i < info->param_count; i++) {
+            uint32_t slot = (uint32_t)(engine->function_slots[info->slot_base + i] -
+                                       engine->registers);
+            changed |= tac_types_mark(engine, slot);
+        }
+    }
+    return changed;
+}
+
+/**
+ * @brief Whether an instruction may write something other than an int32 to its result
+ * @param returns_dynamic Some RETURN may hand a CALL a non-int32 value
+ */
+static bool tac_types_result_dynamic(const tac_engine_t* engine,
+                                     const TACInstruction* instruction,
+                                     bool returns_dynamic) {
+    switch (instruction->opcode) {
+        // Float arithmetic keeps its type
+        case TAC_ADD:
+        case TAC_SUB:
+        case TAC_MUL:
+        case TAC_DIV:
+            return tac_types_dynamic(engine, &instruction->operand1) ||
+                   tac_types_dynamic(engine, &instruction->operand2);
+
+        // Copies, and unary operations that leave non-int32 results untyped
+        case TAC_ASSIGN:
+        case TAC_NEG:
+        case TAC_NOT:
+        case TAC_BITWISE_NOT:
+        case TAC_CAST:
+        case TAC_MEMBER:
+        case TAC_MEMBER_PTR:
+        case TAC_PHI:
+            return tac_types_dynamic(engine, &instruction->operand1);
+
+        case TAC_CALL:
+            return returns_dynamic;
+
+        // Comparisons, integer-only operations and memory reads produce an
+        // int32; the rest write no slot
+        default:
+            return false;
+    }
+}
+
+static bool tac_types_is_binary(uint8_t opcode) {
+    switch (opcode) {
+        case TAC_ADD: case TAC_SUB: case TAC_MUL: case TAC_DIV: case TAC_MOD:
+        case TAC_GT: case TAC_LT: case TAC_EQ: case TAC_NE: case TAC_LE: case TAC_GE:
+        case TAC_AND: case TAC_OR: case TAC_XOR: case TAC_SHL: case TAC_SHR:
+        case TAC_LOGICAL_AND: case TAC_LOGICAL_OR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+tac_engine_error_t tac_types_infer(tac_engine_t* engine) {
+    uint32_t slot_count = engine->config.max_variables + engine->config.max_temporaries;
+    uint32_t* dynamic_slots = calloc(tac_types_slot_words(engine), sizeof(uint32_t));
+    uint32_t* int32_ops = calloc(tac_types_op_words(engine), sizeof(uint32_t));
+    if (!dynamic_slots || !int32_ops) {
+        free(dynamic_slots);
+        free(int32_ops);
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+    tac_types_cleanup(engine);
+    engine->dynamic_slots = dynamic_slots;
+    engine->int32_ops = int32_ops;
+
+    // Seed with whatever the registers and call state hold now
+    for (uint32_t slot = 0; slot < slot_count; slot++) {
+        if (engine->registers[slot].type != TAC_VALUE_INT32) {
+            tac_types_mark(engine, slot);
+        }
+    }
+    for (uint32_t i = 0; i < engine->value_sp; i++) {
+        if (engine->value_stack[i].type != TAC_VALUE_INT32) {
+            memset(dynamic_slots, 0xff, (((size_t)slot_count + 31) / 32) * sizeof(uint32_t));
+            break;
+        }
+    }
+    bool params_dynamic = false;
+    for (uint32_t i = 0; i < engine->param_counter && i < TAC_MAX_CALL_PARAMS; i++) {
+        params_dynamic |= engine->param_stack[i].type != TAC_VALUE_INT32;
+    }
+    if (params_dynamic) {
+        tac_types_mark_params(engine);
+    }
+
+    // Propagate to a fixed point; each pass can only add slots
+    bool returns_dynamic = false;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (uint32_t i = 0; i < engine->instruction_count; i++) {
+            const TACInstruction* instruction = &engine->instructions[i];
+            uint32_t slot;
+
+            if (instruction->opcode == TAC_RETURN && !returns_dynamic &&
+                tac_types_dynamic(engine, &instruction->operand1)) {
+                // The value also lands in t0
+                returns_dynamic = true;
+                changed = true;
+                if (engine->config.max_temporaries > 0) {
+                    tac_types_mark(engine, engine->config.max_variables);
+                }
+            } else if (instruction->opcode == TAC_PARAM && !params_dynamic &&
+                       tac_types_dynamic(engine, &instruction->operand1)) {
+                params_dynamic = true;
+                changed |= tac_types_mark_params(engine);
+            } else if (tac_types_result_dynamic(engine, instruction, returns_dynamic) &&
+                       tac_types_slot(engine, &instruction->result, &slot)) {
+                changed |= tac_types_mark(engine, slot);
+            }
+        }
+    }
+
+    // Binary operations whose operands are int32 wherever they execute
+    for (uint32_t i = 0; i < engine->instruction_count; i++) {
+        const TACInstruction* instruction = &engine->instructions[i];
+        uint32_t slot;
+        if (tac_types_is_binary(instruction->opcode) &&
+            tac_types_int32(engine, &instruction->operand1) &&
+            tac_types_int32(engine, &instruction->operand2) &&
+            tac_types_slot(engine, &instruction->result, &slot)) {
+            int32_ops[i >> 5] |= 1u << (i & 31);
+        }
+    }
+    return TAC_ENGINE_OK;
+}
+
+tac_engine_error_t tac_types_widen(tac_engine_t* engine, uint32_t slot) {
+    if (!engine->dynamic_slots || tac_types_bit(engine->dynamic_slots, slot)) {
+        return TAC_ENGINE_OK;
+    }
+    return tac_types_infer(engine);
+}
+
+void tac_types_cleanup(tac_engine_t* engine) {
+    free(engine->dynamic_slots);
+    free(engine->int32_ops);
+    engine->dynamic_slots = NULL;
+    engine->int32_ops = NULL;
+}
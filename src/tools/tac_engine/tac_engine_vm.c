@@ -0,0 +1,574 @@
+/**
+ * @file tac_engine_vm.c
+ * @brief TAC Engine register bytecode compiler and VM
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * tac_compile_bytecode() lowers the loaded program into a dense stream of
+ * 32-bit words. Every TAC operand is resolved at compile time: variables
+ * and temporaries become byte offsets into the engine's register file
+ * (variables first, then temporaries, the same numbering the call
+ * machinery uses for frame slots), immediates are inlined, and branch
+ * targets become word offsets. The operand kinds select the opcode
+ * variant (_rr, _ri, _ir), so the VM never inspects a TACOperand.
+ *
+ * Each TAC instruction becomes exactly one bytecode instruction, which
+ * keeps step counting identical to the interpreter. Instructions without
+ * a specialized form (calls, returns, memory access, all-immediate
+ * arithmetic) are encoded as GENERIC and run through
+ * tac_execute_instruction(), as are int32 fast paths whose guard fails.
+ */
+
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+#include "tac_engine_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && !defined(TAC_ENGINE_NO_THREADED_DISPATCH)
+#define TAC_BC_THREADED 1
+#else
+#define TAC_BC_THREADED 0
+#endif
+
+// Binary operations with an int32 fast path: X(name, opcode, expression)
+#define TAC_BC_BINARY_OPS(X) \
+    X(add, TAC_ADD, TAC_BC_WRAP(a, +, b)) \
+    X(sub, TAC_SUB, TAC_BC_WRAP(a, -, b)) \
+    X(mul, TAC_MUL, TAC_BC_WRAP(a, *, b)) \
+    X(and, TAC_AND, a & b) \
+    X(or, TAC_OR, a | b) \
+    X(xor, TAC_XOR, a ^ b) \
+    X(shl, TAC_SHL, tac_shl_i32(a, b)) \
+    X(shr, TAC_SHR, tac_shr_i32(a, b)) \
+    X(eq, TAC_EQ, (a == b) ? 1 : 0) \
+    X(ne, TAC_NE, (a != b) ? 1 : 0) \
+    X(lt, TAC_LT, (a < b) ? 1 : 0) \
+    X(le, TAC_LE, (a <= b) ? 1 : 0) \
+    X(gt, TAC_GT, (a > b) ? 1 : 0) \
+    X(ge, TAC_GE, (a >= b) ? 1 : 0) \
+    X(logical_and, TAC_LOGICAL_AND, (a && b) ? 1 : 0) \
+    X(logical_or, TAC_LOGICAL_OR, (a || b) ? 1 : 0) \
+    X(div, TAC_DIV, tac_div_i32(a, b)) \
+    X(mod, TAC_MOD, tac_mod_i32(a, b))
+
+// Unary operations: X(name, opcode, expression)
+#define TAC_BC_UNARY_OPS(X) \
+    X(neg, TAC_NEG, TAC_BC_WRAP(0, -, a)) \
+    X(not, TAC_NOT, !a ? 1 : 0) \
+    X(bitwise_not, TAC_BITWISE_NOT, ~a)
+
+/**
+ * @brief Bytecode opcodes
+ *
+ * Layouts, one word each:
+ *   generic [op][tac index]      nop   [op]
+ *   mov_rr  [op][dst][src]       mov_ri [op][dst][imm]
+ *   X_rr    [op][dst][a][b]      X_ri  [op][dst][a][imm]   X_ir [op][dst][imm][b]
+ *   X_r     [op][dst][a]         (unary)
+ *   jmp     [op][target]         jt/jf [op][cond][target]
+ *   param_r [op][src]            param_i [op][imm]         halt [op]
+ */
+typedef enum tac_bc_op {
+    TAC_BC_GENERIC = 0,
+    TAC_BC_NOP,
+    TAC_BC_MOV_RR,
+    TAC_BC_MOV_RI,
+#define TAC_BC_BINARY_ENUM(name, opcode, expr) \
+    TAC_BC_##name##_rr, TAC_BC_##name##_ri, TAC_BC_##name##_ir,
+    TAC_BC_BINARY_OPS(TAC_BC_BINARY_ENUM)
+#undef TAC_BC_BINARY_ENUM
+#define TAC_BC_UNARY_ENUM(name, opcode, expr) TAC_BC_##name##_r,
+    TAC_BC_UNARY_OPS(TAC_BC_UNARY_ENUM)
+#undef TAC_BC_UNARY_ENUM
+    TAC_BC_JMP,
+    TAC_BC_JT,
+    TAC_BC_JF,
+    TAC_BC_PARAM_R,
+    TAC_BC_PARAM_I,
+    TAC_BC_HALT,
+    TAC_BC_COUNT
+} tac_bc_op_t;
+
+// Wrapping 32-bit arithmetic without signed-overflow UB
+#define TAC_BC_WRAP(a, op, b) \
+    ((int32_t)((uint32_t)(a) op (uint32_t)(b)))
+
+// =============================================================================
+// COMPILER
+// =============================================================================
+
+/**
+ * @brief Resolve a variable or temporary to its register file byte offset
+ */
+static bool tac_bc_register(const tac_engine_t* engine, const TACOperand* operand,
+                            uint32_t* reg) {
+    switch (operand->type) {
+        case TAC_OP_VAR:
+            if (operand->data.variable.id >= engine->config.max_variables) {
+                return false;
+            }
+            *reg = operand->data.variable.id * (uint32_t)sizeof(tac_value_t);
+            return true;
+
+        case TAC_OP_TEMP:
+            if (operand->data.variable.id >= engine->config.max_temporaries) {
+                return false;
+            }
+            *reg = (engine->config.max_variables + operand->data.variable.id) *
+                   (uint32_t)sizeof(tac_value_t);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Resolve an operand whose value is known at compile time
+ */
+static bool tac_bc_immediate(const TACOperand* operand, int32_t* value) {
+    switch (operand->type) {
+        case TAC_OP_IMMEDIATE:
+            *value = operand->data.immediate.value;
+            return true;
+
+        case TAC_OP_LABEL:
+            *value = (int32_t)operand->data.label.offset;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Map a TAC opcode to its _rr variant (_ri and _ir follow it)
+ */
+static tac_bc_op_t tac_bc_binary_base(TACOpcode opcode) {
+    switch (opcode) {
+#define TAC_BC_BINARY_CASE(name, tac, expr) case tac: return TAC_BC_##name##_rr;
+        TAC_BC_BINARY_OPS(TAC_BC_BINARY_CASE)
+#undef TAC_BC_BINARY_CASE
+        default:
+            return TAC_BC_GENERIC;
+    }
+}
+
+static tac_bc_op_t tac_bc_unary_op(TACOpcode opcode) {
+    switch (opcode) {
+#define TAC_BC_UNARY_CASE(name, tac, expr) case tac: return TAC_BC_##name##_r;
+        TAC_BC_UNARY_OPS(TAC_BC_UNARY_CASE)
+#undef TAC_BC_UNARY_CASE
+        default:
+            return TAC_BC_GENERIC;
+    }
+}
+
+/**
+ * @brief Encode one instruction
+ * @return Number of words written (at most 4)
+ */
+static uint32_t tac_bc_encode(const tac_engine_t* engine, uint32_t index, uint32_t* out) {
+    const TACInstruction* inst = &engine->instructions[index];
+    const uint32_t target = engine->jump_targets ? engine->jump_targets[index] : TAC_NO_TARGET;
+    uint32_t dst, a, b;
+    int32_t ia, ib;
+
+    switch (inst->opcode) {
+        case TAC_NOP:
+        case TAC_LABEL:
+            out[0] = TAC_BC_NOP;
+            return 1;
+
+        case TAC_ASSIGN:
+            if (!tac_bc_register(engine, &inst->result, &dst)) {
+                break;
+            }
+            if (tac_bc_register(engine, &inst->operand1, &a)) {
+                out[0] = TAC_BC_MOV_RR;
+                out[1] = dst;
+                out[2] = a;
+                return 3;
+            }
+            if (tac_bc_immediate(&inst->operand1, &ia)) {
+                out[0] = TAC_BC_MOV_RI;
+                out[1] = dst;
+                out[2] = (uint32_t)ia;
+                return 3;
+            }
+            break;
+
+        case TAC_NEG:
+        case TAC_NOT:
+        case TAC_BITWISE_NOT:
+            if (tac_bc_register(engine, &inst->result, &dst) &&
+                tac_bc_register(engine, &inst->operand1, &a)) {
+                out[0] = tac_bc_unary_op(inst->opcode);
+                out[1] = dst;
+                out[2] = a;
+                return 3;
+            }
+            break;
+
+        case TAC_GOTO:
+            if (target != TAC_NO_TARGET) {
+                out[0] = TAC_BC_JMP;
+                out[1] = target;        // Instruction index until relocation
+                return 2;
+            }
+            break;
+
+        case TAC_IF_TRUE:
+        case TAC_IF_FALSE:
+            if (target != TAC_NO_TARGET && tac_bc_register(engine, &inst->operand1, &a)) {
+                out[0] = (inst->opcode == TAC_IF_TRUE) ? TAC_BC_JT : TAC_BC_JF;
+                out[1] = a;
+                out[2] = target;
+                return 3;
+            }
+            break;
+
+        case TAC_PARAM:
+            if (tac_bc_register(engine, &inst->operand1, &a)) {
+                out[0] = TAC_BC_PARAM_R;
+                out[1] = a;
+                return 2;
+            }
+            if (tac_bc_immediate(&inst->operand1, &ia)) {
+                out[0] = TAC_BC_PARAM_I;
+                out[1] = (uint32_t)ia;
+                return 2;
+            }
+            break;
+
+        default: {
+            tac_bc_op_t base = tac_bc_binary_base(inst->opcode);
+            if (base == TAC_BC_GENERIC || !tac_bc_register(engine, &inst->result, &dst)) {
+                break;
+            }
+            bool ra = tac_bc_register(engine, &inst->operand1, &a);
+            bool rb = tac_bc_register(engine, &inst->operand2, &b);
+            if (ra && rb) {
+                out[0] = base;
+                out[2] = a;
+                out[3] = b;
+            } else if (ra && tac_bc_immediate(&inst->operand2, &ib)) {
+                out[0] = base + 1;
+                out[2] = a;
+                out[3] = (uint32_t)ib;
+            } else if (rb && tac_bc_immediate(&inst->operand1, &ia)) {
+                out[0] = base + 2;
+                out[2] = (uint32_t)ia;
+                out[3] = b;
+            } else {
+                break;
+            }
+            out[1] = dst;
+            return 4;
+        }
+    }
+
+    out[0] = TAC_BC_GENERIC;
+    out[1] = index;
+    return 2;
+}
+
+tac_engine_error_t tac_compile_bytecode(tac_engine_t* engine) {
+    if (!engine || !engine->instructions) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    tac_bytecode_t* program = &engine->bytecode;
+    tac_bytecode_cleanup(program);
+
+    // Register operands are 32-bit byte offsets
+    if (((uint64_t)engine->config.max_variables + engine->config.max_temporaries) *
+        sizeof(tac_value_t) > UINT32_MAX) {
+        return TAC_ENGINE_ERR_UNSUPPORTED;
+    }
+
+    uint32_t count = engine->instruction_count;
+    program->code = malloc(((size_t)count * 4 + 1) * sizeof(uint32_t));
+    program->offsets = malloc(((size_t)count + 1) * sizeof(uint32_t));
+    if (!program->code || !program->offsets) {
+        tac_bytecode_cleanup(program);
+        return TAC_ENGINE_ERR_OUT_OF_MEMORY;
+    }
+
+    uint32_t size = 0;
+    uint32_t generic = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        program->offsets[i] = size;
+        size += tac_bc_encode(engine, i, &program->code[size]);
+        generic += (program->code[program->offsets[i]] == TAC_BC_GENERIC);
+    }
+    program->offsets[count] = size;
+    program->code[size++] = TAC_BC_HALT;
+
+    // Relocate branch targets from instruction indices to word offsets
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t* insn = &program->code[program->offsets[i]];
+        if (insn[0] == TAC_BC_JMP) {
+            insn[1] = program->offsets[insn[1]];
+        } else if (insn[0] == TAC_BC_JT || insn[0] == TAC_BC_JF) {
+            insn[2] = program->offsets[insn[2]];
+        }
+    }
+
+    program->size = size;
+    program->count = count;
+
+    TAC_LOG_DEBUG(engine, TAC_LOG_CAT_DISPATCH,
+                  "Bytecode: %u words for %u instructions, %u generic",
+                  size, count, generic);
+    return TAC_ENGINE_OK;
+}
+
+void tac_bytecode_cleanup(tac_bytecode_t* program) {
+    if (!program) {
+        return;
+    }
+
+    free(program->code);
+    free(program->offsets);
+    program->code = NULL;
+    program->offsets = NULL;
+    program->size = 0;
+    program->count = 0;
+}
+
+/**
+ * @brief Map a word offset back to its TAC instruction index
+ */
+static uint32_t tac_bc_index(const tac_bytecode_t* program, uint32_t offset) {
+    uint32_t lo = 0;
+    uint32_t hi = program->count;
+
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (program->offsets[mid] < offset) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// =============================================================================
+// VM
+// =============================================================================
+
+// Result write: the whole value is replaced, as in tac_execute_binary_op()
+#define TAC_BC_SET_I32(slot, expr) \
+    do { \
+        tac_value_t result_ = {TAC_VALUE_INT32, {.i64 = 0}}; \
+        result_.data.i32 = (expr); \
+        *(slot) = result_; \
+    } while (0)
+
+tac_engine_error_t tac_run_bytecode(tac_engine_t* engine) {
+    if (!engine) {
+        return TAC_ENGINE_ERR_NULL_POINTER;
+    }
+
+    const tac_bytecode_t* program = &engine->bytecode;
+    if (!program->code || program->count != engine->instruction_count) {
+        return TAC_ENGINE_ERR_INVALID_OPERAND;
+    }
+
+    const uint32_t* const code = program->code;
+    char* const regs = (char*)engine->registers;
+    const uint32_t max_steps = engine->config.max_steps;
+    uint32_t steps = engine->step_count;
+    const uint32_t* ip = code + program->offsets[engine->pc < program->count ?
+                                                 engine->pc : program->count];
+    tac_engine_error_t err = TAC_ENGINE_OK;
+
+    engine->state = TAC_ENGINE_RUNNING;
+
+#define TAC_BC_REG(n) ((tac_value_t*)(regs + ip[n]))
+#define TAC_BC_IMM(n) ((int32_t)ip[n])
+
+#if TAC_BC_THREADED
+    static const void* const dispatch_table[TAC_BC_COUNT] = {
+        [TAC_BC_GENERIC] = &&bc_generic,
+        [TAC_BC_NOP]     = &&bc_nop,
+        [TAC_BC_MOV_RR]  = &&bc_mov_rr,
+        [TAC_BC_MOV_RI]  = &&bc_mov_ri,
+#define TAC_BC_BINARY_LABELS(name, opcode, expr) \
+        [TAC_BC_##name##_rr] = &&bc_##name##_rr, \
+        [TAC_BC_##name##_ri] = &&bc_##name##_ri, \
+        [TAC_BC_##name##_ir] = &&bc_##name##_ir,
+        TAC_BC_BINARY_OPS(TAC_BC_BINARY_LABELS)
+#undef TAC_BC_BINARY_LABELS
+#define TAC_BC_UNARY_LABELS(name, opcode, expr) [TAC_BC_##name##_r] = &&bc_##name##_r,
+        TAC_BC_UNARY_OPS(TAC_BC_UNARY_LABELS)
+#undef TAC_BC_UNARY_LABELS
+        [TAC_BC_JMP]     = &&bc_jmp,
+        [TAC_BC_JT]      = &&bc_jt,
+        [TAC_BC_JF]      = &&bc_jf,
+        [TAC_BC_PARAM_R] = &&bc_param_r,
+        [TAC_BC_PARAM_I] = &&bc_param_i,
+        [TAC_BC_HALT]    = &&bc_halt,
+    };
+
+#define TAC_BC_DISPATCH() goto *dispatch_table[*ip]
+#else
+#define TAC_BC_DISPATCH() goto dispatch
+#endif
+
+#define TAC_BC_NEXT(words) \
+    do { \
+        ip += (words); \
+        if (++steps >= max_steps) goto out_of_steps; \
+        TAC_BC_DISPATCH(); \
+    } while (0)
+
+#if TAC_BC_THREADED
+    TAC_BC_DISPATCH();
+#else
+dispatch:
+    switch ((tac_bc_op_t)*ip) {
+        case TAC_BC_GENERIC: goto bc_generic;
+        case TAC_BC_NOP:     goto bc_nop;
+        case TAC_BC_MOV_RR:  goto bc_mov_rr;
+        case TAC_BC_MOV_RI:  goto bc_mov_ri;
+#define TAC_BC_BINARY_SWITCH(name, opcode, expr) \
+        case TAC_BC_##name##_rr: goto bc_##name##_rr; \
+        case TAC_BC_##name##_ri: goto bc_##name##_ri; \
+        case TAC_BC_##name##_ir: goto bc_##name##_ir;
+        TAC_BC_BINARY_OPS(TAC_BC_BINARY_SWITCH)
+#undef TAC_BC_BINARY_SWITCH
+#define TAC_BC_UNARY_SWITCH(name, opcode, expr) case TAC_BC_##name##_r: goto bc_##name##_r;
+        TAC_BC_UNARY_OPS(TAC_BC_UNARY_SWITCH)
+#undef TAC_BC_UNARY_SWITCH
+        case TAC_BC_JMP:     goto bc_jmp;
+        case TAC_BC_JT:      goto bc_jt;
+        case TAC_BC_JF:      goto bc_jf;
+        case TAC_BC_PARAM_R: goto bc_param_r;
+        case TAC_BC_PARAM_I: goto bc_param_i;
+        case TAC_BC_HALT:    goto bc_halt;
+        default:             goto bc_generic;
+    }
+#endif
+
+    bc_generic: {
+        // Synchronize engine state and defer to the interpreter
+        uint32_t index = (*ip == TAC_BC_GENERIC) ? ip[1]
+                                                 : tac_bc_index(program, (uint32_t)(ip - code));
+        engine->pc = index;
+        engine->step_count = steps;
+        err = tac_execute_instruction(engine, &engine->instructions[index]);
+        if (err != TAC_ENGINE_OK) {
+            engine->state = TAC_ENGINE_ERROR;
+            return err;
+        }
+        ip = code + program->offsets[engine->pc < program->count ? engine->pc : program->count];
+        TAC_BC_NEXT(0);
+    }
+
+    bc_nop:
+        TAC_BC_NEXT(1);
+
+    bc_mov_rr:
+        *TAC_BC_REG(1) = *TAC_BC_REG(2);
+        TAC_BC_NEXT(3);
+
+    bc_mov_ri:
+        TAC_BC_SET_I32(TAC_BC_REG(1), TAC_BC_IMM(2));
+        TAC_BC_NEXT(3);
+
+    // Only the left operand's type selects the int32 path, as in the
+    // interpreter; a zero divisor takes the generic path for the error report
+#define TAC_BC_BINARY_HANDLERS(name, opcode, expr) \
+    bc_##name##_rr: { \
+        const tac_value_t* left = TAC_BC_REG(2); \
+        if (left->type != TAC_VALUE_INT32) goto bc_generic; \
+        const int32_t a = left->data.i32; \
+        const int32_t b = TAC_BC_REG(3)->data.i32; \
+        if ((opcode == TAC_DIV || opcode == TAC_MOD) && b == 0) goto bc_generic; \
+        TAC_BC_SET_I32(TAC_BC_REG(1), (expr)); \
+        TAC_BC_NEXT(4); \
+    } \
+    bc_##name##_ri: { \
+        const tac_value_t* left = TAC_BC_REG(2); \
+        if (left->type != TAC_VALUE_INT32) goto bc_generic; \
+        const int32_t a = left->data.i32; \
+        const int32_t b = TAC_BC_IMM(3); \
+        if ((opcode == TAC_DIV || opcode == TAC_MOD) && b == 0) goto bc_generic; \
+        TAC_BC_SET_I32(TAC_BC_REG(1), (expr)); \
+        TAC_BC_NEXT(4); \
+    } \
+    bc_##name##_ir: { \
+        const int32_t a = TAC_BC_IMM(2); \
+        const int32_t b = TAC_BC_REG(3)->data.i32; \
+        if ((opcode == TAC_DIV || opcode == TAC_MOD) && b == 0) goto bc_generic; \
+        TAC_BC_SET_I32(TAC_BC_REG(1), (expr)); \
+        TAC_BC_NEXT(4); \
+    }
+    TAC_BC_BINARY_OPS(TAC_BC_BINARY_HANDLERS)
+#undef TAC_BC_BINARY_HANDLERS
+
+#define TAC_BC_UNARY_HANDLERS(name, opcode, expr) \
+    bc_##name##_r: { \
+        const tac_value_t* src = TAC_BC_REG(2); \
+        if (src->type != TAC_VALUE_INT32) goto bc_generic; \
+        const int32_t a = src->data.i32; \
+        TAC_BC_SET_I32(TAC_BC_REG(1), (expr)); \
+        TAC_BC_NEXT(3); \
+    }
+    TAC_BC_UNARY_OPS(TAC_BC_UNARY_HANDLERS)
+#undef TAC_BC_UNARY_HANDLERS
+
+    bc_jmp:
+        ip = code + ip[1];
+        TAC_BC_NEXT(0);
+
+    bc_jt: {
+        const tac_value_t* cond = TAC_BC_REG(1);
+        if (cond->type != TAC_VALUE_INT32) goto bc_generic;
+        ip = cond->data.i32 != 0 ? code + ip[2] : ip + 3;
+        TAC_BC_NEXT(0);
+    }
+
+    bc_jf: {
+        const tac_value_t* cond = TAC_BC_REG(1);
+        if (cond->type != TAC_VALUE_INT32) goto bc_generic;
+        ip = cond->data.i32 == 0 ? code + ip[2] : ip + 3;
+        TAC_BC_NEXT(0);
+    }
+
+    bc_param_r:
+        // Overflow of the parameter stack is reported by the interpreter
+        if (engine->param_counter >= TAC_MAX_CALL_PARAMS) goto bc_generic;
+        engine->param_stack[engine->param_counter++] = *TAC_BC_REG(1);
+        TAC_BC_NEXT(2);
+
+    bc_param_i:
+        if (engine->param_counter >= TAC_MAX_CALL_PARAMS) goto bc_generic;
+        engine->param_stack[engine->param_counter++] = tac_value_int32(TAC_BC_IMM(1));
+        TAC_BC_NEXT(2);
+
+    bc_halt:
+        engine->pc = program->count;
+        engine->step_count = steps;
+        engine->state = TAC_ENGINE_FINISHED;
+        return TAC_ENGINE_OK;
+
+out_of_steps:
+    engine->pc = tac_bc_index(program, (uint32_t)(ip - code));
+    engine->step_count = steps;
+    tac_set_error(engine, TAC_ENGINE_ERR_MAX_STEPS,
+                 "Execution exceeded maximum steps: %u", max_steps);
+    engine->state = TAC_ENGINE_STOPPED;
+    return TAC_ENGINE_ERR_MAX_STEPS;
+
+#undef TAC_BC_NEXT
+#undef TAC_BC_DISPATCH
+#undef TAC_BC_IMM
+#undef TAC_BC_REG
+}
@@ -0,0 +1,166 @@
+/**
+ * @file tac_trace_dump.c
+ * @brief Reader for TAC Engine binary trace files
+ * @author STCC1 Project
+ * @version 1.0
+ * @date 2025-08-04
+ * @copyright Copyright (c) 2025
+ *
+ * Prints the steps of a trace written by tac_engine_trace_to_file(), one
+ * per line as "<step> @<address>" followed by "= <value>" when the step
+ * changed its result, or with -s only a summary: step range, value
+ * changes, bytes per step and the most executed addresses.
+ *
+ * Usage: tac_trace_dump [-s] <tracefile>
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "tac_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define TRACE_DUMP_TOP 5
+
+static void show_usage(const char* program_name) {
+    printf("Usage: %s [-s] <tracefile>\n", program_name);
+    printf("\n");
+    printf("Options:\n");
+    printf("  -s  Print a summary instead of every step\n");
+}
+
+static void print_value(const tac_value_t* value) {
+    switch (value->type) {
+        case TAC_VALUE_INT32:   printf("%d", value->data.i32); break;
+        case TAC_VALUE_UINT32:  printf("%uu", value->data.u32); break;
+        case TAC_VALUE_INT64:   printf("%lld", (long long)value->data.i64); break;
+        case TAC_VALUE_UINT64:  printf("%lluu", (unsigned long long)value->data.u64); break;
+        case TAC_VALUE_FLOAT:   printf("%gf", (double)value->data.f32); break;
+        case TAC_VALUE_DOUBLE:  printf("%g", value->data.f64); break;
+        case TAC_VALUE_BOOL:    printf("%s", value->data.boolean ? "true" : "false"); break;
+        default:                printf("0x%llx", (unsigned long long)value->data.u64); break;
+    }
+}
+
+/**
+ * @brief Count executions per address, growing the table as needed
+ */
+static int count_address(uint64_t** counts, uint32_t* size, uint32_t address) {
+    if (address >= *size) {
+        uint32_t grown = *size ? *size : 256;
+        while (grown <= address) {
+            grown *= 2;
+        }
+        uint64_t* table = realloc(*counts, (size_t)grown * sizeof(uint64_t));
+        if (!table) {
+            return -1;
+        }
+        memset(table + *size, 0, (size_t)(grown - *size) * sizeof(uint64_t));
+        *counts = table;
+        *size = grown;
+    }
+    (*counts)[address]++;
+    return 0;
+}
+
+static void print_summary(const char* path, uint64_t records, uint64_t changes,
+                          uint64_t first_step, uint64_t last_step,
+                          const uint64_t* counts, uint32_t size) {
+    struct stat st;
+    long long bytes = stat(path, &st) == 0 ? (long long)st.st_size : -1;
+
+    printf("steps:         %llu", (unsigned long long)records);
+    if (records > 0) {
+        printf(" (%llu..%llu)", (unsigned long long)first_step, (unsigned long long)last_step);
+    }
+    printf("\n");
+    printf("value changes: %llu\n", (unsigned long long)changes);
+    if (bytes >= 0) {
+        printf("file size:     %lld bytes (%.2f bytes/step)\n", bytes,
+               records ? (double)bytes / (double)records : 0.0);
+    }
+
+    // Repeated selection is fine for a handful of entries
+    bool* shown = calloc(size ? size : 1, sizeof(bool));
+    if (!shown) {
+        return;
+    }
+    printf("hottest addresses:\n");
+    for (int n = 0; n < TRACE_DUMP_TOP; n++) {
+        uint32_t best = UINT32_MAX;
+        for (uint32_t a = 0; a < size; a++) {
+            if (!shown[a] && counts[a] > 0 && (best == UINT32_MAX || counts[a] > counts[best])) {
+                best = a;
+            }
+        }
+        if (best == UINT32_MAX) {
+            break;
+        }
+        shown[best] = true;
+        printf("  @%-6u %12llu  %5.1f%%\n", best, (unsigned long long)counts[best],
+               100.0 * (double)counts[best] / (double)records);
+    }
+    free(shown);
+}
+
+int main(int argc, char* argv[]) {
+    bool summary = argc == 3 && strcmp(argv[1], "-s") == 0;
+    if (argc != 2 + summary) {
+        show_usage(argv[0]);
+        return 1;
+    }
+
+    const char* path = argv[argc - 1];
+    tac_trace_reader_t* reader = tac_trace_reader_open(path);
+    if (!reader) {
+        fprintf(stderr, "Error: %s is not a TAC trace file\n", path);
+        return 1;
+    }
+
+    tac_trace_record_t record;
+    tac_engine_error_t err;
+    uint64_t records = 0;
+    uint64_t changes = 0;
+    uint64_t first_step = 0;
+    uint64_t last_step = 0;
+    uint64_t* counts = NULL;
+    uint32_t size = 0;
+
+    while ((err = tac_trace_reader_next(reader, &record)) == TAC_ENGINE_OK) {
+        if (records++ == 0) {
+            first_step = record.step;
+        }
+        last_step = record.step;
+        changes += record.changed;
+
+        if (summary) {
+            if (count_address(&counts, &size, record.address) != 0) {
+                err = TAC_ENGINE_ERR_OUT_OF_MEMORY;
+                break;
+            }
+            continue;
+        }
+
+        printf("%llu @%u", (unsigned long long)record.step, record.address);
+        if (record.changed) {
+            printf(" = ");
+            print_value(&record.value);
+        }
+        printf("\n");
+    }
+    tac_trace_reader_close(reader);
+
+    if (summary && err == TAC_ENGINE_ERR_NOT_FOUND) {
+        print_summary(path, records, changes, first_step, last_step, counts, size);
+    }
+    free(counts);
+
+    if (err != TAC_ENGINE_ERR_NOT_FOUND) {
+        fprintf(stderr, "Error: %s after %llu steps: %s\n", path,
+                (unsigned long long)records, tac_engine_error_string(err));
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,317 @@
+//============================================================================//
+// test_integration_stcc.c - Integration tests for the stcc driver
+//
+// Runs bin/stcc next to the cc0 → cc1 → cc2 pipeline and checks that it
+// writes byte-identical stores and TAC, and that its compilation cache
+// (--cache) replays those artifacts on a hit, counts hits and misses, and
+// evicts the least recently used entries once the size cap is exceeded.
+//============================================================================//
+
+#include "../test_common.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <utime.h>
+
+//============================================================================//
+// TEST FUNCTION PROTOTYPES
+//============================================================================//
+
+void test_integration_stcc_matches_pipeline(void);
+void test_integration_stcc_cache_hit(void);
+void test_integration_stcc_cache_eviction(void);
+void run_integration_stcc_tests(void);
+
+//============================================================================//
+// HELPERS
+//============================================================================//
+
+#define STCC_OUT   TEMP_PATH "stcc_out"
+#define STCC_CACHE TEMP_PATH "stcc_cache"
+#define STCC_STATS TEMP_PATH "test_temp_stcc_stats.txt"
+#define KEY_LEN    32
+
+static const char* artifact_suffixes[] = {
+    ".sstore", ".tokens", ".ast", ".sym", ".tacbin", ".tac"
+};
+
+#define ARTIFACT_COUNT (sizeof(artifact_suffixes) / sizeof(artifact_suffixes[0]))
+
+static const char* call_program =
+    "int wrap(int p) {\n"
+    "    while (p > 3) {\n"
+    "        p = p - 3;\n"
+    "    }\n"
+    "    return p;\n"
+    "}\n"
+    "\n"
+    "int main() {\n"
+    "    int s = 5;\n"
+    "    int i = 0;\n"
+    "    while (i < 10) {\n"
+    "        s = s + wrap(i);\n"
+    "        i = i + 1;\n"
+    "    }\n"
+    "    return s;\n"
+    "}\n";
+
+static void write_source(const char* path, const char* content) {
+    FILE* fp = fopen(path, "w");
+    TEST_ASSERT_NOT_NULL(fp);
+    fputs(content, fp);
+    fclose(fp);
+}
+
+// A program large enough (about 400 KB of stores) to fill a 1 MB cache fast
+static void write_large_source(const char* path, int seed) {
+    FILE* fp = fopen(path, "w");
+    TEST_ASSERT_NOT_NULL(fp);
+    fprintf(fp, "int main() {\n    int a;\n    a = %d;\n", seed);
+    for (int i = 0; i < 1500; i++) {
+        fprintf(fp, "    a = a + %d;\n", i);
+    }
+    fprintf(fp, "    return a;\n}\n");
+    fclose(fp);
+}
+
+static int run_stcc(const char* arguments) {
+    char command[1024];
+    snprintf(command, sizeof(command), "timeout 10s ./bin/stcc %s", arguments);
+    return system(command);
+}
+
+static bool files_identical(const char* path1, const char* path2) {
+    FILE* fp1 = fopen(path1, "rb");
+    FILE* fp2 = fopen(path2, "rb");
+    bool same = fp1 && fp2;
+    while (same) {
+        int c1 = fgetc(fp1);
+        int c2 = fgetc(fp2);
+        same = (c1 == c2);
+        if (c1 == EOF) {
+            break;
+        }
+    }
+    if (fp1) fclose(fp1);
+    if (fp2) fclose(fp2);
+    return same;
+}
+
+/**
+ * @brief Check the artifacts stcc wrote to STCC_OUT against expected files
+ * @param stem Output stem of the source
+ * @param expected Paths in the order of artifact_suffixes
+ */
+static void expect_outputs_match(const char* stem, char* const expected[ARTIFACT_COUNT]) {
+    for (size_t a = 0; a < ARTIFACT_COUNT; a++) {
+        char path[256];
+        snprintf(path, sizeof(path), STCC_OUT "/%s%s", stem, artifact_suffixes[a]);
+        TEST_ASSERT_TRUE_MESSAGE(files_identical(expected[a], path), path);
+    }
+}
+
+/**
+ * @brief Read the counters printed by --cache-stats
+ */
+static void read_cache_stats(unsigned long* hits, unsigned long* misses, unsigned long* entries) {
+    TEST_ASSERT_EQUAL(0, run_stcc("--cache " STCC_CACHE " --cache-stats 2> " STCC_STATS));
+    char* report = read_file_content(STCC_STATS);
+    TEST_ASSERT_NOT_NULL(report);
+    const char* hit_line = strstr(report, "hits:");
+    const char* miss_line = strstr(report, "misses:");
+    const char* entry_line = strstr(report, "entries:");
+    TEST_ASSERT_TRUE(hit_line && miss_line && entry_line);
+    TEST_ASSERT_EQUAL(1, sscanf(hit_line, "hits: %lu", hits));
+    TEST_ASSERT_EQUAL(1, sscanf(miss_line, "misses: %lu", misses));
+    TEST_ASSERT_EQUAL(1, sscanf(entry_line, "entries: %lu", entries));
+    free(report);
+}
+
+/**
+ * @brief Find the one cache entry not listed in known
+ * @return Its directory name (static buffer), or NULL if none or several
+ */
+static const char* find_new_entry(const char* const known[], int known_count) {
+    static char found[KEY_LEN + 1];
+    int matches = 0;
+    DIR* dir = opendir(STCC_CACHE);
+    TEST_ASSERT_NOT_NULL(dir);
+    struct dirent* ent;
+    while ((ent = readdir(dir)) != NULL) {
+        if (strlen(ent->d_name) != KEY_LEN || strspn(ent->d_name, "0123456789abcdef") != KEY_LEN) {
+            continue;
+        }
+        bool seen = false;
+        for (int k = 0; k < known_count; k++) {
+            seen = seen || strcmp(known[k], ent->d_name) == 0;
+        }
+        if (!seen) {
+            memcpy(found, ent->d_name, sizeof(found));
+            matches++;
+        }
+    }
+    closedir(dir);
+    return matches == 1 ? found : NULL;
+}
+
+// Mark a cache entry as last used the given number of seconds ago
+static void age_entry(const char* key, time_t seconds) {
+    char path[256];
+    snprintf(path, sizeof(path), STCC_CACHE "/%s", key);
+    struct utimbuf times;
+    times.actime = times.modtime = time(NULL) - seconds;
+    TEST_ASSERT_EQUAL(0, utime(path, &times));
+}
+
+static void reset_directories(void) {
+    int result = system("rm -rf " STCC_OUT " " STCC_CACHE " && mkdir -p " STCC_OUT);
+    TEST_ASSERT_EQUAL(0, result);
+}
+
+//============================================================================//
+// INTEGRATION TESTS
+//============================================================================//
+
+void test_integration_stcc_matches_pipeline(void) {
+    reset_directories();
+    char source[] = TEMP_PATH "test_temp_stcc_calls.i";
+    write_source(source, call_program);
+
+    char sstore_file[] = TEMP_PATH "test_temp_stcc_sstore.out";
+    char tokens_file[] = TEMP_PATH "test_temp_stcc_tokens.out";
+    char ast_file[] = TEMP_PATH "test_temp_stcc_ast.out";
+    char sym_file[] = TEMP_PATH "test_temp_stcc_sym.out";
+    char tac_file[] = TEMP_PATH "test_temp_stcc_tac.out";
+    char listing_file[] = TEMP_PATH "test_temp_stcc_tac.tac";
+    char* outputs[] = {sstore_file, tokens_file, ast_file, sym_file, tac_file, listing_file};
+    TEST_ASSERT_EQUAL(0, run_compiler_stage("cc0", source, outputs));
+    TEST_ASSERT_EQUAL(0, run_compiler_stage("cc1", NULL, outputs));
+    TEST_ASSERT_EQUAL(0, run_compiler_stage("cc2", NULL, outputs));
+
+    // One process, same bytes
+    TEST_ASSERT_EQUAL(0, run_stcc("--save-temps -d " STCC_OUT " " TEMP_PATH "test_temp_stcc_calls.i"));
+    expect_outputs_match("test_temp_stcc_calls", outputs);
+
+    // -o names the listing, and without --save-temps no stores are left
+    TEST_ASSERT_EQUAL(0, run_stcc("-o " STCC_OUT "/named.tac " TEMP_PATH "test_temp_stcc_calls.i"));
+    TEST_ASSERT_TRUE(files_identical(listing_file, STCC_OUT "/named.tac"));
+    struct stat st;
+    TEST_ASSERT_TRUE(stat(STCC_OUT "/named.sstore", &st) != 0);
+
+    // A source the parser rejects fails
+    write_source(TEMP_PATH "test_temp_stcc_bad.i", "int main( { return 0; }\n");
+    TEST_ASSERT_TRUE(run_stcc("-d " STCC_OUT " " TEMP_PATH "test_temp_stcc_bad.i 2>/dev/null") != 0);
+
+    int result = system("rm -rf " STCC_OUT);
+    (void)result;
+}
+
+void test_integration_stcc_cache_hit(void) {
+    reset_directories();
+    char source[] = TEMP_PATH "test_temp_stcc_calls.i";
+    write_source(source, call_program);
+
+    // Reference artifacts, compiled without a cache
+    TEST_ASSERT_EQUAL(0, run_stcc("--save-temps -d " STCC_OUT " " TEMP_PATH "test_temp_stcc_calls.i"));
+    char* expected[ARTIFACT_COUNT];
+    char moved[ARTIFACT_COUNT][256];
+    for (size_t a = 0; a < ARTIFACT_COUNT; a++) {
+        char path[256];
+        snprintf(path, sizeof(path), STCC_OUT "/test_temp_stcc_calls%s", artifact_suffixes[a]);
+        snprintf(moved[a], sizeof(moved[a]), TEMP_PATH "test_temp_stcc_ref%s", artifact_suffixes[a]);
+        TEST_ASSERT_EQUAL(0, rename(path, moved[a]));
+        expected[a] = moved[a];
+    }
+
+    // Miss, then hit; both leave the same artifacts
+    unsigned long hits = 0, misses = 0, entries = 0;
+    for (int round = 0; round < 2; round++) {
+        TEST_ASSERT_EQUAL(0, run_stcc("--cache " STCC_CACHE " --save-temps -d " STCC_OUT
+                                      " " TEMP_PATH "test_temp_stcc_calls.i"));
+        expect_outputs_match("test_temp_stcc_calls", expected);
+        read_cache_stats(&hits, &misses, &entries);
+        TEST_ASSERT_EQUAL(round, hits);
+        TEST_ASSERT_EQUAL(1, misses);
+        TEST_ASSERT_EQUAL(1, entries);
+    }
+
+    // An edited source misses
+    write_source(source, "int main() { return 7; }\n");
+    TEST_ASSERT_EQUAL(0, run_stcc("--cache " STCC_CACHE " -d " STCC_OUT
+                                  " " TEMP_PATH "test_temp_stcc_calls.i"));
+    read_cache_stats(&hits, &misses, &entries);
+    TEST_ASSERT_EQUAL(1, hits);
+    TEST_ASSERT_EQUAL(2, misses);
+    TEST_ASSERT_EQUAL(2, entries);
+    TEST_ASSERT_TRUE(!files_identical(expected[ARTIFACT_COUNT - 1],
+                                      STCC_OUT "/test_temp_stcc_calls.tac"));
+}
+
+void test_integration_stcc_cache_eviction(void) {
+    reset_directories();
+    const char* keys[3];
+    char saved[3][KEY_LEN + 1];
+    char sources[3][64];
+    char arguments[256];
+
+    for (int s = 0; s < 3; s++) {
+        snprintf(sources[s], sizeof(sources[s]), TEMP_PATH "test_temp_stcc_large%d.i", s);
+        write_large_source(sources[s], s);
+    }
+
+    // Two entries fit under a 1 MB cap; a is older than b
+    for (int s = 0; s < 2; s++) {
+        snprintf(arguments, sizeof(arguments), "--cache " STCC_CACHE " --cache-size 1 -d "
+                 STCC_OUT " %s", sources[s]);
+        TEST_ASSERT_EQUAL(0, run_stcc(arguments));
+        const char* key = find_new_entry(keys, s);
+        TEST_ASSERT_NOT_NULL(key);
+        memcpy(saved[s], key, sizeof(saved[s]));
+        keys[s] = saved[s];
+    }
+    age_entry(keys[0], 200);
+    age_entry(keys[1], 100);
+
+    // A hit makes a the most recently used entry
+    snprintf(arguments, sizeof(arguments), "--cache " STCC_CACHE " -d " STCC_OUT " %s",
+             sources[0]);
+    TEST_ASSERT_EQUAL(0, run_stcc(arguments));
+
+    // A third entry exceeds the (remembered) cap and evicts b
+    snprintf(arguments, sizeof(arguments), "--cache " STCC_CACHE " -d " STCC_OUT " %s",
+             sources[2]);
+    TEST_ASSERT_EQUAL(0, run_stcc(arguments));
+    unsigned long hits = 0, misses = 0, entries = 0;
+    read_cache_stats(&hits, &misses, &entries);
+    TEST_ASSERT_EQUAL(1, hits);
+    TEST_ASSERT_EQUAL(3, misses);
+    TEST_ASSERT_EQUAL(2, entries);
+
+    struct stat st;
+    char path[256];
+    snprintf(path, sizeof(path), STCC_CACHE "/%s", keys[1]);
+    TEST_ASSERT_TRUE(stat(path, &st) != 0);
+    snprintf(path, sizeof(path), STCC_CACHE "/%s", keys[0]);
+    TEST_ASSERT_EQUAL(0, stat(path, &st));
+
+    // a still hits, b compiles again
+    snprintf(arguments, sizeof(arguments), "--cache " STCC_CACHE " -d " STCC_OUT " %s %s",
+             sources[0], sources[1]);
+    TEST_ASSERT_EQUAL(0, run_stcc(arguments));
+    read_cache_stats(&hits, &misses, &entries);
+    TEST_ASSERT_EQUAL(2, hits);
+    TEST_ASSERT_EQUAL(4, misses);
+
+    int result = system("rm -rf " STCC_OUT " " STCC_CACHE);
+    (void)result;
+}
+
+//============================================================================//
+// TEST RUNNER
+//============================================================================//
+
+void run_integration_stcc_tests(void) {
+    RUN_TEST(test_integration_stcc_matches_pipeline);
+    RUN_TEST(test_integration_stcc_cache_hit);
+    RUN_TEST(test_integration_stcc_cache_eviction);
+}
@@ -0,0 +1,42 @@
+/**
+ * @file tac_test_builders.h
+ * @brief Builders for hand-written TAC programs and TAC engine fixtures
+ *
+ * Only for tests that build TAC by hand: the one-letter macros would
+ * collide with identifiers elsewhere, so test_common.h does not include
+ * this header.
+ */
+
+#ifndef TAC_TEST_BUILDERS_H
+#define TAC_TEST_BUILDERS_H
+
+#include "../src/ir/tac_types.h"
+#include "../src/tools/tac_engine/tac_engine.h"
+
+// One instruction and its operands
+#define I(op, r, a, b) ((TACInstruction){(op), TAC_FLAG_NONE, (r), (a), (b)})
+#define NONE TAC_OPERAND_NONE
+#define T(id) TAC_MAKE_TEMP(id)
+#define V(id) TAC_MAKE_VAR(id)
+#define K(value) TAC_MAKE_IMMEDIATE(value)
+#define L(id) TAC_MAKE_LABEL(id)
+
+// Function record: label at instruction index `at`, parameters v<first>...
+#define FUNC(at, first, params) \
+    ((TACFunction){0, (TACIdx_t)((at) + 1), 0, 0, (params), 0, 0, (first)})
+
+// Every TAC engine execution mode, the interpreter first
+#define TEST_EXEC_MODE_COUNT 5
+extern const tac_engine_exec_mode_t test_exec_modes[TEST_EXEC_MODE_COUNT];
+
+// TAC engine fixtures for hand-written programs (test_common.c)
+tac_engine_t* create_test_engine(const tac_engine_config_t* config,
+                                 const TACInstruction* code, uint32_t count,
+                                 uint16_t entry_label);
+tac_engine_t* create_test_program(const tac_engine_config_t* config,
+                                  const TACInstruction* code, uint32_t count,
+                                  const TACFunction* functions, uint32_t function_count,
+                                  uint16_t entry_label);
+tac_engine_error_t run_test_engine(tac_engine_t* engine, int32_t* result);
+
+#endif // TAC_TEST_BUILDERS_H
@@ -0,0 +1,10 @@
+123abc
+_valid
+var$invalid
+a@b
+very_long_identifier_that_exceeds_normal_limits_and_should_be_handled_gracefully
+αβγ
+____
+_123
+a
+
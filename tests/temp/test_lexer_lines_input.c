@@ -0,0 +1,12 @@
+int x;
+
+      
+int very_long_identifier_on_line_four_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long;
+int a; int b; int c;
+/* multi
+   line
+   comment
+   spanning
+   lines */
+char* str = "line\nwith\nnewlines";
+int final
\ No newline at end of file
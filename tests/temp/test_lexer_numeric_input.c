@@ -0,0 +1,21 @@
+0
+2147483647
+2147483648
+9999999999999999999
+0x0
+0xFFFFFFFF
+0x123456789ABCDEF
+0777
+0888
+123.456
+1.23e10
+1.23e-10
+1e999
+.123
+123.
+123.456.789
+0x
+0b1010
+123abc
+123L
+123.0f
@@ -0,0 +1,17 @@
+"hello"
+"unterminated string
+""
+"\n\t\r"
+"\invalid"
+"\x41"
+"\101"
+"\777"
+"string with
+newline"
+'c'
+'ab'
+'\n'
+'unterminated
+"very long string that exceeds normal buffer limits and should test memory allocation"
+"unicode: αβγδε"
+"\0"
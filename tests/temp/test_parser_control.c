@@ -0,0 +1,75 @@
+int main() {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+if (1) {
+int x = 1;
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+while (1) {
+break;
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+return 0;
+}
@@ -0,0 +1,16 @@
+int main() {
+int x = (1 + 2;
+int y = 1 + 2);
+int z = [1 + 2];
+if (x > 0 {
+return 1;
+}
+if x > 0) {
+return 2;
+}
+while (1 {
+break;
+}
+{
+int a = 1;
+
@@ -0,0 +1,23 @@
+int main(
+return 0;
+}
+int func() {
+return 1;
+int func2() {
+int x = 1
+return x;
+}
+void func3() {
+return 5;
+}
+int func4() {
+
+}
+func5() {
+return 0;
+}
+int (func6)() {
+return 0;
+}
+int main() { }
+int main() { return 0; }
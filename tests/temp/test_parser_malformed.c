@@ -0,0 +1,19 @@
+int;
+x;
+int int x;
+int x y;
+int x = ;
+int x = = 5;
+int x = 5 5;
+int x[;
+int x[][];
+int x = y = z;
+typedef;
+struct;
+int main() {
+int;
+return;
+}
+int main() {
+return 0;
+}
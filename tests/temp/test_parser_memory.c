@@ -0,0 +1,504 @@
+int main() {
+int x0 = 0 + 1 + 2 + 3;
+int x1 = 1 + 2 + 3 + 4;
+int x2 = 2 + 3 + 4 + 5;
+int x3 = 3 + 4 + 5 + 6;
+int x4 = 4 + 5 + 6 + 7;
+int x5 = 5 + 6 + 7 + 8;
+int x6 = 6 + 7 + 8 + 9;
+int x7 = 7 + 8 + 9 + 10;
+int x8 = 8 + 9 + 10 + 11;
+int x9 = 9 + 10 + 11 + 12;
+int x10 = 10 + 11 + 12 + 13;
+int x11 = 11 + 12 + 13 + 14;
+int x12 = 12 + 13 + 14 + 15;
+int x13 = 13 + 14 + 15 + 16;
+int x14 = 14 + 15 + 16 + 17;
+int x15 = 15 + 16 + 17 + 18;
+int x16 = 16 + 17 + 18 + 19;
+int x17 = 17 + 18 + 19 + 20;
+int x18 = 18 + 19 + 20 + 21;
+int x19 = 19 + 20 + 21 + 22;
+int x20 = 20 + 21 + 22 + 23;
+int x21 = 21 + 22 + 23 + 24;
+int x22 = 22 + 23 + 24 + 25;
+int x23 = 23 + 24 + 25 + 26;
+int x24 = 24 + 25 + 26 + 27;
+int x25 = 25 + 26 + 27 + 28;
+int x26 = 26 + 27 + 28 + 29;
+int x27 = 27 + 28 + 29 + 30;
+int x28 = 28 + 29 + 30 + 31;
+int x29 = 29 + 30 + 31 + 32;
+int x30 = 30 + 31 + 32 + 33;
+int x31 = 31 + 32 + 33 + 34;
+int x32 = 32 + 33 + 34 + 35;
+int x33 = 33 + 34 + 35 + 36;
+int x34 = 34 + 35 + 36 + 37;
+int x35 = 35 + 36 + 37 + 38;
+int x36 = 36 + 37 + 38 + 39;
+int x37 = 37 + 38 + 39 + 40;
+int x38 = 38 + 39 + 40 + 41;
+int x39 = 39 + 40 + 41 + 42;
+int x40 = 40 + 41 + 42 + 43;
+int x41 = 41 + 42 + 43 + 44;
+int x42 = 42 + 43 + 44 + 45;
+int x43 = 43 + 44 + 45 + 46;
+int x44 = 44 + 45 + 46 + 47;
+int x45 = 45 + 46 + 47 + 48;
+int x46 = 46 + 47 + 48 + 49;
+int x47 = 47 + 48 + 49 + 50;
+int x48 = 48 + 49 + 50 + 51;
+int x49 = 49 + 50 + 51 + 52;
+int x50 = 50 + 51 + 52 + 53;
+int x51 = 51 + 52 + 53 + 54;
+int x52 = 52 + 53 + 54 + 55;
+int x53 = 53 + 54 + 55 + 56;
+int x54 = 54 + 55 + 56 + 57;
+int x55 = 55 + 56 + 57 + 58;
+int x56 = 56 + 57 + 58 + 59;
+int x57 = 57 + 58 + 59 + 60;
+int x58 = 58 + 59 + 60 + 61;
+int x59 = 59 + 60 + 61 + 62;
+int x60 = 60 + 61 + 62 + 63;
+int x61 = 61 + 62 + 63 + 64;
+int x62 = 62 + 63 + 64 + 65;
+int x63 = 63 + 64 + 65 + 66;
+int x64 = 64 + 65 + 66 + 67;
+int x65 = 65 + 66 + 67 + 68;
+int x66 = 66 + 67 + 68 + 69;
+int x67 = 67 + 68 + 69 + 70;
+int x68 = 68 + 69 + 70 + 71;
+int x69 = 69 + 70 + 71 + 72;
+int x70 = 70 + 71 + 72 + 73;
+int x71 = 71 + 72 + 73 + 74;
+int x72 = 72 + 73 + 74 + 75;
+int x73 = 73 + 74 + 75 + 76;
+int x74 = 74 + 75 + 76 + 77;
+int x75 = 75 + 76 + 77 + 78;
+int x76 = 76 + 77 + 78 + 79;
+int x77 = 77 + 78 + 79 + 80;
+int x78 = 78 + 79 + 80 + 81;
+int x79 = 79 + 80 + 81 + 82;
+int x80 = 80 + 81 + 82 + 83;
+int x81 = 81 + 82 + 83 + 84;
+int x82 = 82 + 83 + 84 + 85;
+int x83 = 83 + 84 + 85 + 86;
+int x84 = 84 + 85 + 86 + 87;
+int x85 = 85 + 86 + 87 + 88;
+int x86 = 86 + 87 + 88 + 89;
+int x87 = 87 + 88 + 89 + 90;
+int x88 = 88 + 89 + 90 + 91;
+int x89 = 89 + 90 + 91 + 92;
+int x90 = 90 + 91 + 92 + 93;
+int x91 = 91 + 92 + 93 + 94;
+int x92 = 92 + 93 + 94 + 95;
+int x93 = 93 + 94 + 95 + 96;
+int x94 = 94 + 95 + 96 + 97;
+int x95 = 95 + 96 + 97 + 98;
+int x96 = 96 + 97 + 98 + 99;
+int x97 = 97 + 98 + 99 + 100;
+int x98 = 98 + 99 + 100 + 101;
+int x99 = 99 + 100 + 101 + 102;
+int x100 = 100 + 101 + 102 + 103;
+int x101 = 101 + 102 + 103 + 104;
+int x102 = 102 + 103 + 104 + 105;
+int x103 = 103 + 104 + 105 + 106;
+int x104 = 104 + 105 + 106 + 107;
+int x105 = 105 + 106 + 107 + 108;
+int x106 = 106 + 107 + 108 + 109;
+int x107 = 107 + 108 + 109 + 110;
+int x108 = 108 + 109 + 110 + 111;
+int x109 = 109 + 110 + 111 + 112;
+int x110 = 110 + 111 + 112 + 113;
+int x111 = 111 + 112 + 113 + 114;
+int x112 = 112 + 113 + 114 + 115;
+int x113 = 113 + 114 + 115 + 116;
+int x114 = 114 + 115 + 116 + 117;
+int x115 = 115 + 116 + 117 + 118;
+int x116 = 116 + 117 + 118 + 119;
+int x117 = 117 + 118 + 119 + 120;
+int x118 = 118 + 119 + 120 + 121;
+int x119 = 119 + 120 + 121 + 122;
+int x120 = 120 + 121 + 122 + 123;
+int x121 = 121 + 122 + 123 + 124;
+int x122 = 122 + 123 + 124 + 125;
+int x123 = 123 + 124 + 125 + 126;
+int x124 = 124 + 125 + 126 + 127;
+int x125 = 125 + 126 + 127 + 128;
+int x126 = 126 + 127 + 128 + 129;
+int x127 = 127 + 128 + 129 + 130;
+int x128 = 128 + 129 + 130 + 131;
+int x129 = 129 + 130 + 131 + 132;
+int x130 = 130 + 131 + 132 + 133;
+int x131 = 131 + 132 + 133 + 134;
+int x132 = 132 + 133 + 134 + 135;
+int x133 = 133 + 134 + 135 + 136;
+int x134 = 134 + 135 + 136 + 137;
+int x135 = 135 + 136 + 137 + 138;
+int x136 = 136 + 137 + 138 + 139;
+int x137 = 137 + 138 + 139 + 140;
+int x138 = 138 + 139 + 140 + 141;
+int x139 = 139 + 140 + 141 + 142;
+int x140 = 140 + 141 + 142 + 143;
+int x141 = 141 + 142 + 143 + 144;
+int x142 = 142 + 143 + 144 + 145;
+int x143 = 143 + 144 + 145 + 146;
+int x144 = 144 + 145 + 146 + 147;
+int x145 = 145 + 146 + 147 + 148;
+int x146 = 146 + 147 + 148 + 149;
+int x147 = 147 + 148 + 149 + 150;
+int x148 = 148 + 149 + 150 + 151;
+int x149 = 149 + 150 + 151 + 152;
+int x150 = 150 + 151 + 152 + 153;
+int x151 = 151 + 152 + 153 + 154;
+int x152 = 152 + 153 + 154 + 155;
+int x153 = 153 + 154 + 155 + 156;
+int x154 = 154 + 155 + 156 + 157;
+int x155 = 155 + 156 + 157 + 158;
+int x156 = 156 + 157 + 158 + 159;
+int x157 = 157 + 158 + 159 + 160;
+int x158 = 158 + 159 + 160 + 161;
+int x159 = 159 + 160 + 161 + 162;
+int x160 = 160 + 161 + 162 + 163;
+int x161 = 161 + 162 + 163 + 164;
+int x162 = 162 + 163 + 164 + 165;
+int x163 = 163 + 164 + 165 + 166;
+int x164 = 164 + 165 + 166 + 167;
+int x165 = 165 + 166 + 167 + 168;
+int x166 = 166 + 167 + 168 + 169;
+int x167 = 167 + 168 + 169 + 170;
+int x168 = 168 + 169 + 170 + 171;
+int x169 = 169 + 170 + 171 + 172;
+int x170 = 170 + 171 + 172 + 173;
+int x171 = 171 + 172 + 173 + 174;
+int x172 = 172 + 173 + 174 + 175;
+int x173 = 173 + 174 + 175 + 176;
+int x174 = 174 + 175 + 176 + 177;
+int x175 = 175 + 176 + 177 + 178;
+int x176 = 176 + 177 + 178 + 179;
+int x177 = 177 + 178 + 179 + 180;
+int x178 = 178 + 179 + 180 + 181;
+int x179 = 179 + 180 + 181 + 182;
+int x180 = 180 + 181 + 182 + 183;
+int x181 = 181 + 182 + 183 + 184;
+int x182 = 182 + 183 + 184 + 185;
+int x183 = 183 + 184 + 185 + 186;
+int x184 = 184 + 185 + 186 + 187;
+int x185 = 185 + 186 + 187 + 188;
+int x186 = 186 + 187 + 188 + 189;
+int x187 = 187 + 188 + 189 + 190;
+int x188 = 188 + 189 + 190 + 191;
+int x189 = 189 + 190 + 191 + 192;
+int x190 = 190 + 191 + 192 + 193;
+int x191 = 191 + 192 + 193 + 194;
+int x192 = 192 + 193 + 194 + 195;
+int x193 = 193 + 194 + 195 + 196;
+int x194 = 194 + 195 + 196 + 197;
+int x195 = 195 + 196 + 197 + 198;
+int x196 = 196 + 197 + 198 + 199;
+int x197 = 197 + 198 + 199 + 200;
+int x198 = 198 + 199 + 200 + 201;
+int x199 = 199 + 200 + 201 + 202;
+int x200 = 200 + 201 + 202 + 203;
+int x201 = 201 + 202 + 203 + 204;
+int x202 = 202 + 203 + 204 + 205;
+int x203 = 203 + 204 + 205 + 206;
+int x204 = 204 + 205 + 206 + 207;
+int x205 = 205 + 206 + 207 + 208;
+int x206 = 206 + 207 + 208 + 209;
+int x207 = 207 + 208 + 209 + 210;
+int x208 = 208 + 209 + 210 + 211;
+int x209 = 209 + 210 + 211 + 212;
+int x210 = 210 + 211 + 212 + 213;
+int x211 = 211 + 212 + 213 + 214;
+int x212 = 212 + 213 + 214 + 215;
+int x213 = 213 + 214 + 215 + 216;
+int x214 = 214 + 215 + 216 + 217;
+int x215 = 215 + 216 + 217 + 218;
+int x216 = 216 + 217 + 218 + 219;
+int x217 = 217 + 218 + 219 + 220;
+int x218 = 218 + 219 + 220 + 221;
+int x219 = 219 + 220 + 221 + 222;
+int x220 = 220 + 221 + 222 + 223;
+int x221 = 221 + 222 + 223 + 224;
+int x222 = 222 + 223 + 224 + 225;
+int x223 = 223 + 224 + 225 + 226;
+int x224 = 224 + 225 + 226 + 227;
+int x225 = 225 + 226 + 227 + 228;
+int x226 = 226 + 227 + 228 + 229;
+int x227 = 227 + 228 + 229 + 230;
+int x228 = 228 + 229 + 230 + 231;
+int x229 = 229 + 230 + 231 + 232;
+int x230 = 230 + 231 + 232 + 233;
+int x231 = 231 + 232 + 233 + 234;
+int x232 = 232 + 233 + 234 + 235;
+int x233 = 233 + 234 + 235 + 236;
+int x234 = 234 + 235 + 236 + 237;
+int x235 = 235 + 236 + 237 + 238;
+int x236 = 236 + 237 + 238 + 239;
+int x237 = 237 + 238 + 239 + 240;
+int x238 = 238 + 239 + 240 + 241;
+int x239 = 239 + 240 + 241 + 242;
+int x240 = 240 + 241 + 242 + 243;
+int x241 = 241 + 242 + 243 + 244;
+int x242 = 242 + 243 + 244 + 245;
+int x243 = 243 + 244 + 245 + 246;
+int x244 = 244 + 245 + 246 + 247;
+int x245 = 245 + 246 + 247 + 248;
+int x246 = 246 + 247 + 248 + 249;
+int x247 = 247 + 248 + 249 + 250;
+int x248 = 248 + 249 + 250 + 251;
+int x249 = 249 + 250 + 251 + 252;
+int x250 = 250 + 251 + 252 + 253;
+int x251 = 251 + 252 + 253 + 254;
+int x252 = 252 + 253 + 254 + 255;
+int x253 = 253 + 254 + 255 + 256;
+int x254 = 254 + 255 + 256 + 257;
+int x255 = 255 + 256 + 257 + 258;
+int x256 = 256 + 257 + 258 + 259;
+int x257 = 257 + 258 + 259 + 260;
+int x258 = 258 + 259 + 260 + 261;
+int x259 = 259 + 260 + 261 + 262;
+int x260 = 260 + 261 + 262 + 263;
+int x261 = 261 + 262 + 263 + 264;
+int x262 = 262 + 263 + 264 + 265;
+int x263 = 263 + 264 + 265 + 266;
+int x264 = 264 + 265 + 266 + 267;
+int x265 = 265 + 266 + 267 + 268;
+int x266 = 266 + 267 + 268 + 269;
+int x267 = 267 + 268 + 269 + 270;
+int x268 = 268 + 269 + 270 + 271;
+int x269 = 269 + 270 + 271 + 272;
+int x270 = 270 + 271 + 272 + 273;
+int x271 = 271 + 272 + 273 + 274;
+int x272 = 272 + 273 + 274 + 275;
+int x273 = 273 + 274 + 275 + 276;
+int x274 = 274 + 275 + 276 + 277;
+int x275 = 275 + 276 + 277 + 278;
+int x276 = 276 + 277 + 278 + 279;
+int x277 = 277 + 278 + 279 + 280;
+int x278 = 278 + 279 + 280 + 281;
+int x279 = 279 + 280 + 281 + 282;
+int x280 = 280 + 281 + 282 + 283;
+int x281 = 281 + 282 + 283 + 284;
+int x282 = 282 + 283 + 284 + 285;
+int x283 = 283 + 284 + 285 + 286;
+int x284 = 284 + 285 + 286 + 287;
+int x285 = 285 + 286 + 287 + 288;
+int x286 = 286 + 287 + 288 + 289;
+int x287 = 287 + 288 + 289 + 290;
+int x288 = 288 + 289 + 290 + 291;
+int x289 = 289 + 290 + 291 + 292;
+int x290 = 290 + 291 + 292 + 293;
+int x291 = 291 + 292 + 293 + 294;
+int x292 = 292 + 293 + 294 + 295;
+int x293 = 293 + 294 + 295 + 296;
+int x294 = 294 + 295 + 296 + 297;
+int x295 = 295 + 296 + 297 + 298;
+int x296 = 296 + 297 + 298 + 299;
+int x297 = 297 + 298 + 299 + 300;
+int x298 = 298 + 299 + 300 + 301;
+int x299 = 299 + 300 + 301 + 302;
+int x300 = 300 + 301 + 302 + 303;
+int x301 = 301 + 302 + 303 + 304;
+int x302 = 302 + 303 + 304 + 305;
+int x303 = 303 + 304 + 305 + 306;
+int x304 = 304 + 305 + 306 + 307;
+int x305 = 305 + 306 + 307 + 308;
+int x306 = 306 + 307 + 308 + 309;
+int x307 = 307 + 308 + 309 + 310;
+int x308 = 308 + 309 + 310 + 311;
+int x309 = 309 + 310 + 311 + 312;
+int x310 = 310 + 311 + 312 + 313;
+int x311 = 311 + 312 + 313 + 314;
+int x312 = 312 + 313 + 314 + 315;
+int x313 = 313 + 314 + 315 + 316;
+int x314 = 314 + 315 + 316 + 317;
+int x315 = 315 + 316 + 317 + 318;
+int x316 = 316 + 317 + 318 + 319;
+int x317 = 317 + 318 + 319 + 320;
+int x318 = 318 + 319 + 320 + 321;
+int x319 = 319 + 320 + 321 + 322;
+int x320 = 320 + 321 + 322 + 323;
+int x321 = 321 + 322 + 323 + 324;
+int x322 = 322 + 323 + 324 + 325;
+int x323 = 323 + 324 + 325 + 326;
+int x324 = 324 + 325 + 326 + 327;
+int x325 = 325 + 326 + 327 + 328;
+int x326 = 326 + 327 + 328 + 329;
+int x327 = 327 + 328 + 329 + 330;
+int x328 = 328 + 329 + 330 + 331;
+int x329 = 329 + 330 + 331 + 332;
+int x330 = 330 + 331 + 332 + 333;
+int x331 = 331 + 332 + 333 + 334;
+int x332 = 332 + 333 + 334 + 335;
+int x333 = 333 + 334 + 335 + 336;
+int x334 = 334 + 335 + 336 + 337;
+int x335 = 335 + 336 + 337 + 338;
+int x336 = 336 + 337 + 338 + 339;
+int x337 = 337 + 338 + 339 + 340;
+int x338 = 338 + 339 + 340 + 341;
+int x339 = 339 + 340 + 341 + 342;
+int x340 = 340 + 341 + 342 + 343;
+int x341 = 341 + 342 + 343 + 344;
+int x342 = 342 + 343 + 344 + 345;
+int x343 = 343 + 344 + 345 + 346;
+int x344 = 344 + 345 + 346 + 347;
+int x345 = 345 + 346 + 347 + 348;
+int x346 = 346 + 347 + 348 + 349;
+int x347 = 347 + 348 + 349 + 350;
+int x348 = 348 + 349 + 350 + 351;
+int x349 = 349 + 350 + 351 + 352;
+int x350 = 350 + 351 + 352 + 353;
+int x351 = 351 + 352 + 353 + 354;
+int x352 = 352 + 353 + 354 + 355;
+int x353 = 353 + 354 + 355 + 356;
+int x354 = 354 + 355 + 356 + 357;
+int x355 = 355 + 356 + 357 + 358;
+int x356 = 356 + 357 + 358 + 359;
+int x357 = 357 + 358 + 359 + 360;
+int x358 = 358 + 359 + 360 + 361;
+int x359 = 359 + 360 + 361 + 362;
+int x360 = 360 + 361 + 362 + 363;
+int x361 = 361 + 362 + 363 + 364;
+int x362 = 362 + 363 + 364 + 365;
+int x363 = 363 + 364 + 365 + 366;
+int x364 = 364 + 365 + 366 + 367;
+int x365 = 365 + 366 + 367 + 368;
+int x366 = 366 + 367 + 368 + 369;
+int x367 = 367 + 368 + 369 + 370;
+int x368 = 368 + 369 + 370 + 371;
+int x369 = 369 + 370 + 371 + 372;
+int x370 = 370 + 371 + 372 + 373;
+int x371 = 371 + 372 + 373 + 374;
+int x372 = 372 + 373 + 374 + 375;
+int x373 = 373 + 374 + 375 + 376;
+int x374 = 374 + 375 + 376 + 377;
+int x375 = 375 + 376 + 377 + 378;
+int x376 = 376 + 377 + 378 + 379;
+int x377 = 377 + 378 + 379 + 380;
+int x378 = 378 + 379 + 380 + 381;
+int x379 = 379 + 380 + 381 + 382;
+int x380 = 380 + 381 + 382 + 383;
+int x381 = 381 + 382 + 383 + 384;
+int x382 = 382 + 383 + 384 + 385;
+int x383 = 383 + 384 + 385 + 386;
+int x384 = 384 + 385 + 386 + 387;
+int x385 = 385 + 386 + 387 + 388;
+int x386 = 386 + 387 + 388 + 389;
+int x387 = 387 + 388 + 389 + 390;
+int x388 = 388 + 389 + 390 + 391;
+int x389 = 389 + 390 + 391 + 392;
+int x390 = 390 + 391 + 392 + 393;
+int x391 = 391 + 392 + 393 + 394;
+int x392 = 392 + 393 + 394 + 395;
+int x393 = 393 + 394 + 395 + 396;
+int x394 = 394 + 395 + 396 + 397;
+int x395 = 395 + 396 + 397 + 398;
+int x396 = 396 + 397 + 398 + 399;
+int x397 = 397 + 398 + 399 + 400;
+int x398 = 398 + 399 + 400 + 401;
+int x399 = 399 + 400 + 401 + 402;
+int x400 = 400 + 401 + 402 + 403;
+int x401 = 401 + 402 + 403 + 404;
+int x402 = 402 + 403 + 404 + 405;
+int x403 = 403 + 404 + 405 + 406;
+int x404 = 404 + 405 + 406 + 407;
+int x405 = 405 + 406 + 407 + 408;
+int x406 = 406 + 407 + 408 + 409;
+int x407 = 407 + 408 + 409 + 410;
+int x408 = 408 + 409 + 410 + 411;
+int x409 = 409 + 410 + 411 + 412;
+int x410 = 410 + 411 + 412 + 413;
+int x411 = 411 + 412 + 413 + 414;
+int x412 = 412 + 413 + 414 + 415;
+int x413 = 413 + 414 + 415 + 416;
+int x414 = 414 + 415 + 416 + 417;
+int x415 = 415 + 416 + 417 + 418;
+int x416 = 416 + 417 + 418 + 419;
+int x417 = 417 + 418 + 419 + 420;
+int x418 = 418 + 419 + 420 + 421;
+int x419 = 419 + 420 + 421 + 422;
+int x420 = 420 + 421 + 422 + 423;
+int x421 = 421 + 422 + 423 + 424;
+int x422 = 422 + 423 + 424 + 425;
+int x423 = 423 + 424 + 425 + 426;
+int x424 = 424 + 425 + 426 + 427;
+int x425 = 425 + 426 + 427 + 428;
+int x426 = 426 + 427 + 428 + 429;
+int x427 = 427 + 428 + 429 + 430;
+int x428 = 428 + 429 + 430 + 431;
+int x429 = 429 + 430 + 431 + 432;
+int x430 = 430 + 431 + 432 + 433;
+int x431 = 431 + 432 + 433 + 434;
+int x432 = 432 + 433 + 434 + 435;
+int x433 = 433 + 434 + 435 + 436;
+int x434 = 434 + 435 + 436 + 437;
+int x435 = 435 + 436 + 437 + 438;
+int x436 = 436 + 437 + 438 + 439;
+int x437 = 437 + 438 + 439 + 440;
+int x438 = 438 + 439 + 440 + 441;
+int x439 = 439 + 440 + 441 + 442;
+int x440 = 440 + 441 + 442 + 443;
+int x441 = 441 + 442 + 443 + 444;
+int x442 = 442 + 443 + 444 + 445;
+int x443 = 443 + 444 + 445 + 446;
+int x444 = 444 + 445 + 446 + 447;
+int x445 = 445 + 446 + 447 + 448;
+int x446 = 446 + 447 + 448 + 449;
+int x447 = 447 + 448 + 449 + 450;
+int x448 = 448 + 449 + 450 + 451;
+int x449 = 449 + 450 + 451 + 452;
+int x450 = 450 + 451 + 452 + 453;
+int x451 = 451 + 452 + 453 + 454;
+int x452 = 452 + 453 + 454 + 455;
+int x453 = 453 + 454 + 455 + 456;
+int x454 = 454 + 455 + 456 + 457;
+int x455 = 455 + 456 + 457 + 458;
+int x456 = 456 + 457 + 458 + 459;
+int x457 = 457 + 458 + 459 + 460;
+int x458 = 458 + 459 + 460 + 461;
+int x459 = 459 + 460 + 461 + 462;
+int x460 = 460 + 461 + 462 + 463;
+int x461 = 461 + 462 + 463 + 464;
+int x462 = 462 + 463 + 464 + 465;
+int x463 = 463 + 464 + 465 + 466;
+int x464 = 464 + 465 + 466 + 467;
+int x465 = 465 + 466 + 467 + 468;
+int x466 = 466 + 467 + 468 + 469;
+int x467 = 467 + 468 + 469 + 470;
+int x468 = 468 + 469 + 470 + 471;
+int x469 = 469 + 470 + 471 + 472;
+int x470 = 470 + 471 + 472 + 473;
+int x471 = 471 + 472 + 473 + 474;
+int x472 = 472 + 473 + 474 + 475;
+int x473 = 473 + 474 + 475 + 476;
+int x474 = 474 + 475 + 476 + 477;
+int x475 = 475 + 476 + 477 + 478;
+int x476 = 476 + 477 + 478 + 479;
+int x477 = 477 + 478 + 479 + 480;
+int x478 = 478 + 479 + 480 + 481;
+int x479 = 479 + 480 + 481 + 482;
+int x480 = 480 + 481 + 482 + 483;
+int x481 = 481 + 482 + 483 + 484;
+int x482 = 482 + 483 + 484 + 485;
+int x483 = 483 + 484 + 485 + 486;
+int x484 = 484 + 485 + 486 + 487;
+int x485 = 485 + 486 + 487 + 488;
+int x486 = 486 + 487 + 488 + 489;
+int x487 = 487 + 488 + 489 + 490;
+int x488 = 488 + 489 + 490 + 491;
+int x489 = 489 + 490 + 491 + 492;
+int x490 = 490 + 491 + 492 + 493;
+int x491 = 491 + 492 + 493 + 494;
+int x492 = 492 + 493 + 494 + 495;
+int x493 = 493 + 494 + 495 + 496;
+int x494 = 494 + 495 + 496 + 497;
+int x495 = 495 + 496 + 497 + 498;
+int x496 = 496 + 497 + 498 + 499;
+int x497 = 497 + 498 + 499 + 500;
+int x498 = 498 + 499 + 500 + 501;
+int x499 = 499 + 500 + 501 + 502;
+int result = x0 + x1 + x2 + x3 + x4 + x5 + x6 + x7 + x8 + x9 + x10 + x11 + x12 + x13 + x14 + x15 + x16 + x17 + x18 + x19 + x20 + x21 + x22 + x23 + x24 + x25 + x26 + x27 + x28 + x29 + x30 + x31 + x32 + x33 + x34 + x35 + x36 + x37 + x38 + x39 + x40 + x41 + x42 + x43 + x44 + x45 + x46 + x47 + x48 + x49 + x50 + x51 + x52 + x53 + x54 + x55 + x56 + x57 + x58 + x59 + x60 + x61 + x62 + x63 + x64 + x65 + x66 + x67 + x68 + x69 + x70 + x71 + x72 + x73 + x74 + x75 + x76 + x77 + x78 + x79 + x80 + x81 + x82 + x83 + x84 + x85 + x86 + x87 + x88 + x89 + x90 + x91 + x92 + x93 + x94 + x95 + x96 + x97 + x98 + x99 + x100 + x101 + x102 + x103 + x104 + x105 + x106 + x107 + x108 + x109 + x110 + x111 + x112 + x113 + x114 + x115 + x116 + x117 + x118 + x119 + x120 + x121 + x122 + x123 + x124 + x125 + x126 + x127 + x128 + x129 + x130 + x131 + x132 + x133 + x134 + x135 + x136 + x137 + x138 + x139 + x140 + x141 + x142 + x143 + x144 + x145 + x146 + x147 + x148 + x149 + x150 + x151 + x152 + x153 + x154 + x155 + x156 + x157 + x158 + x159 + x160 + x161 + x162 + x163 + x164 + x165 + x166 + x167 + x168 + x169 + x170 + x171 + x172 + x173 + x174 + x175 + x176 + x177 + x178 + x179 + x180 + x181 + x182 + x183 + x184 + x185 + x186 + x187 + x188 + x189 + x190 + x191 + x192 + x193 + x194 + x195 + x196 + x197 + x198 + x199 + 0;
+return result;
+}
@@ -0,0 +1,13 @@
+int main() {
+int a = 1 + 2 * 3 + 4;
+int b = 1 * 2 + 3 * 4;
+int c = (1 + 2) * (3 + 4);
+int d = 1 + 2 + 3 + 4;
+int e = a = b = c;
+int f = -+-+1;
+int g = !!1;
+int h = 1 == 2 == 0;
+int i = 1 < 2 < 3;
+int j = a ? b : c ? d : e;
+return 0;
+}
@@ -0,0 +1,10 @@
+int main() {
+int x = 1 + ;
+int y = 2;
+invalid syntax here!
+int z = 3;
+if (x > y {
+return 1;
+}
+return 0;
+}
@@ -0,0 +1,115 @@
+int main() {
+int var0 = 0;
+int var1 = 1;
+int var2 = 2;
+int var3 = 3;
+int var4 = 4;
+int var5 = 5;
+int var6 = 6;
+int var7 = 7;
+int var8 = 8;
+int var9 = 9;
+int var10 = 10;
+int var11 = 11;
+int var12 = 12;
+int var13 = 13;
+int var14 = 14;
+int var15 = 15;
+int var16 = 16;
+int var17 = 17;
+int var18 = 18;
+int var19 = 19;
+int var20 = 20;
+int var21 = 21;
+int var22 = 22;
+int var23 = 23;
+int var24 = 24;
+int var25 = 25;
+int var26 = 26;
+int var27 = 27;
+int var28 = 28;
+int var29 = 29;
+int var30 = 30;
+int var31 = 31;
+int var32 = 32;
+int var33 = 33;
+int var34 = 34;
+int var35 = 35;
+int var36 = 36;
+int var37 = 37;
+int var38 = 38;
+int var39 = 39;
+int var40 = 40;
+int var41 = 41;
+int var42 = 42;
+int var43 = 43;
+int var44 = 44;
+int var45 = 45;
+int var46 = 46;
+int var47 = 47;
+int var48 = 48;
+int var49 = 49;
+int var50 = 50;
+int var51 = 51;
+int var52 = 52;
+int var53 = 53;
+int var54 = 54;
+int var55 = 55;
+int var56 = 56;
+int var57 = 57;
+int var58 = 58;
+int var59 = 59;
+int var60 = 60;
+int var61 = 61;
+int var62 = 62;
+int var63 = 63;
+int var64 = 64;
+int var65 = 65;
+int var66 = 66;
+int var67 = 67;
+int var68 = 68;
+int var69 = 69;
+int var70 = 70;
+int var71 = 71;
+int var72 = 72;
+int var73 = 73;
+int var74 = 74;
+int var75 = 75;
+int var76 = 76;
+int var77 = 77;
+int var78 = 78;
+int var79 = 79;
+int var80 = 80;
+int var81 = 81;
+int var82 = 82;
+int var83 = 83;
+int var84 = 84;
+int var85 = 85;
+int var86 = 86;
+int var87 = 87;
+int var88 = 88;
+int var89 = 89;
+int var90 = 90;
+int var91 = 91;
+int var92 = 92;
+int var93 = 93;
+int var94 = 94;
+int var95 = 95;
+int var96 = 96;
+int var97 = 97;
+int var98 = 98;
+int var99 = 99;
+int var0 = 999;
+int x = undeclared_var;
+int very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_very_long_variable_name_final = 1;
+{
+int x = 1;
+{
+int x = 2;
+{
+int x = 3;
+}
+}
+}
+return 0;
+}
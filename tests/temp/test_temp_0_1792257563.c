@@ -0,0 +1 @@
+test content
\ No newline at end of file
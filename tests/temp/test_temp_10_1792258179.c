@@ -0,0 +1,8 @@
+int add(int a, int b) {
+    return a + b;
+}
+
+int main() {
+    int result = add(5, 10);
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+int main() {
+    int i = 0;
+    int sum = 0;
+    while (i < 10) {
+        sum = sum + i;
+        i = i + 1;
+    }
+    return sum;
+}
\ No newline at end of file
@@ -0,0 +1 @@
+int main() { x = ; }
\ No newline at end of file
@@ -0,0 +1,10 @@
+int main() {
+    int n = 6;
+    int a = 1;
+    int b = 1;
+    int c = a + b;
+    int d = b + c;
+    int e = c + d;
+    int result = d + e;
+    return result;
+}
\ No newline at end of file
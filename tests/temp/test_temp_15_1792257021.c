@@ -0,0 +1,14 @@
+typedef int number;
+typedef number* number_ptr;
+
+number calculate(number x, number y) {
+    number result = x * y + x - y;
+    return result;
+}
+
+int main() {
+    number a = 7;
+    number b = 3;
+    number result = calculate(a, b);
+    return result;
+}
\ No newline at end of file
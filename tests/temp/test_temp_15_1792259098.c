@@ -0,0 +1,19 @@
+int multiply(int a, int b) {
+    int result = a * b;
+    return result;
+}
+
+int add_three(int x, int y, int z) {
+    int temp1 = x + y;
+    int temp2 = temp1 + z;
+    return temp2;
+}
+
+int main() {
+    int a = 3;
+    int b = 4;
+    int c = 5;
+    int prod = multiply(a, b);
+    int sum = add_three(prod, c, 2);
+    return sum;
+}
\ No newline at end of file
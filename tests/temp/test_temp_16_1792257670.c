@@ -0,0 +1,12 @@
+int square(int x) {
+    return x * x;
+}
+
+int double_value(int x) {
+    return x * 2;
+}
+
+int main() {
+    int result = square(3) + double_value(4) * 2 - square(2);
+    return result;
+}
\ No newline at end of file
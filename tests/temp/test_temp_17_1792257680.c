@@ -0,0 +1,14 @@
+int factorial(int n) {
+    int result = 1;
+    int i = 1;
+    while (i <= n) {
+        result = result * i;
+        i = i + 1;
+    }
+    return result;
+}
+
+int main() {
+    int f5 = factorial(5);
+    return f5;
+}
\ No newline at end of file
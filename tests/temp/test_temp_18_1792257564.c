@@ -0,0 +1,20 @@
+typedef int coordinate;
+typedef coordinate point[2];
+
+int distance_squared(coordinate x1, coordinate y1, coordinate x2, coordinate y2);
+
+int main() {
+    coordinate x1 = 0;
+    coordinate y1 = 0;
+    coordinate x2 = 3;
+    coordinate y2 = 4;
+    int dist_sq = distance_squared(x1, y1, x2, y2);
+    return dist_sq;
+}
+
+int distance_squared(coordinate x1, coordinate y1, coordinate x2, coordinate y2) {
+    coordinate dx = x2 - x1;
+    coordinate dy = y2 - y1;
+    int result = dx * dx + dy * dy;
+    return result;
+}
\ No newline at end of file
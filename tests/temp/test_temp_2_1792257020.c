@@ -0,0 +1,20 @@
+int is_odd(int p) {
+    if (p < 1) {
+        return 0;
+    }
+    int d = p;
+    while (d > 1) {
+        d = d - 2;
+    }
+    return d;
+}
+
+int main() {
+    int n = 0;
+    int count = 0;
+    while (n < 10) {
+        count = count + is_odd(n);
+        n = n + 1;
+    }
+    return count;
+}
\ No newline at end of file
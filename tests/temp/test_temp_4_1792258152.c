@@ -0,0 +1,16 @@
+int wrap(int p) {
+    while (p > 3) {
+        p = p - 3;
+    }
+    return p;
+}
+
+int main() {
+    int s = 5;
+    int i = 0;
+    while (i < 10) {
+        s = s + wrap(i);
+        i = i + 1;
+    }
+    return s;
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+int second(int u, int v) {
+    return v;
+}
+
+int pick(int a, int b) {
+    a = 1;
+    return b;
+}
+
+int square(int x) {
+    return x * x;
+}
+
+int add_one(int x) {
+    return x + 1;
+}
+
+int main() {
+    return second(3, 7) + pick(10, 20) + square(add_one(4));
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+int main() {
+    int x = 10;
+    int y = 20;
+    int z = x + y;
+    return z;
+}
\ No newline at end of file
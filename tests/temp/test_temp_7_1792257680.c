@@ -0,0 +1,4 @@
+int main() {
+    int x = 1 + 2 * 3 - 4 / 2;
+    return x;
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+int main() {
+    int x = 10;
+    if (x > 5) {
+        x = x + 1;
+    } else {
+        x = x - 1;
+    }
+    return x;
+}
\ No newline at end of file
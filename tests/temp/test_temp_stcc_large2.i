@@ -0,0 +1,1505 @@
+int main() {
+    int a;
+    a = 2;
+    a = a + 0;
+    a = a + 1;
+    a = a + 2;
+    a = a + 3;
+    a = a + 4;
+    a = a + 5;
+    a = a + 6;
+    a = a + 7;
+    a = a + 8;
+    a = a + 9;
+    a = a + 10;
+    a = a + 11;
+    a = a + 12;
+    a = a + 13;
+    a = a + 14;
+    a = a + 15;
+    a = a + 16;
+    a = a + 17;
+    a = a + 18;
+    a = a + 19;
+    a = a + 20;
+    a = a + 21;
+    a = a + 22;
+    a = a + 23;
+    a = a + 24;
+    a = a + 25;
+    a = a + 26;
+    a = a + 27;
+    a = a + 28;
+    a = a + 29;
+    a = a + 30;
+    a = a + 31;
+    a = a + 32;
+    a = a + 33;
+    a = a + 34;
+    a = a + 35;
+    a = a + 36;
+    a = a + 37;
+    a = a + 38;
+    a = a + 39;
+    a = a + 40;
+    a = a + 41;
+    a = a + 42;
+    a = a + 43;
+    a = a + 44;
+    a = a + 45;
+    a = a + 46;
+    a = a + 47;
+    a = a + 48;
+    a = a + 49;
+    a = a + 50;
+    a = a + 51;
+    a = a + 52;
+    a = a + 53;
+    a = a + 54;
+    a = a + 55;
+    a = a + 56;
+    a = a + 57;
+    a = a + 58;
+    a = a + 59;
+    a = a + 60;
+    a = a + 61;
+    a = a + 62;
+    a = a + 63;
+    a = a + 64;
+    a = a + 65;
+    a = a + 66;
+    a = a + 67;
+    a = a + 68;
+    a = a + 69;
+    a = a + 70;
+    a = a + 71;
+    a = a + 72;
+    a = a + 73;
+    a = a + 74;
+    a = a + 75;
+    a = a + 76;
+    a = a + 77;
+    a = a + 78;
+    a = a + 79;
+    a = a + 80;
+    a = a + 81;
+    a = a + 82;
+    a = a + 83;
+    a = a + 84;
+    a = a + 85;
+    a = a + 86;
+    a = a + 87;
+    a = a + 88;
+    a = a + 89;
+    a = a + 90;
+    a = a + 91;
+    a = a + 92;
+    a = a + 93;
+    a = a + 94;
+    a = a + 95;
+    a = a + 96;
+    a = a + 97;
+    a = a + 98;
+    a = a + 99;
+    a = a + 100;
+    a = a + 101;
+    a = a + 102;
+    a = a + 103;
+    a = a + 104;
+    a = a + 105;
+    a = a + 106;
+    a = a + 107;
+    a = a + 108;
+    a = a + 109;
+    a = a + 110;
+    a = a + 111;
+    a = a + 112;
+    a = a + 113;
+    a = a + 114;
+    a = a + 115;
+    a = a + 116;
+    a = a + 117;
+    a = a + 118;
+    a = a + 119;
+    a = a + 120;
+    a = a + 121;
+    a = a + 122;
+    a = a + 123;
+    a = a + 124;
+    a = a + 125;
+    a = a + 126;
+    a = a + 127;
+    a = a + 128;
+    a = a + 129;
+    a = a + 130;
+    a = a + 131;
+    a = a + 132;
+    a = a + 133;
+    a = a + 134;
+    a = a + 135;
+    a = a + 136;
+    a = a + 137;
+    a = a + 138;
+    a = a + 139;
+    a = a + 140;
+    a = a + 141;
+    a = a + 142;
+    a = a + 143;
+    a = a + 144;
+    a = a + 145;
+    a = a + 146;
+    a = a + 147;
+    a = a + 148;
+    a = a + 149;
+    a = a + 150;
+    a = a + 151;
+    a = a + 152;
+    a = a + 153;
+    a = a + 154;
+    a = a + 155;
+    a = a + 156;
+    a = a + 157;
+    a = a + 158;
+    a = a + 159;
+    a = a + 160;
+    a = a + 161;
+    a = a + 162;
+    a = a + 163;
+    a = a + 164;
+    a = a + 165;
+    a = a + 166;
+    a = a + 167;
+    a = a + 168;
+    a = a + 169;
+    a = a + 170;
+    a = a + 171;
+    a = a + 172;
+    a = a + 173;
+    a = a + 174;
+    a = a + 175;
+    a = a + 176;
+    a = a + 177;
+    a = a + 178;
+    a = a + 179;
+    a = a + 180;
+    a = a + 181;
+    a = a + 182;
+    a = a + 183;
+    a = a + 184;
+    a = a + 185;
+    a = a + 186;
+    a = a + 187;
+    a = a + 188;
+    a = a + 189;
+    a = a + 190;
+    a = a + 191;
+    a = a + 192;
+    a = a + 193;
+    a = a + 194;
+    a = a + 195;
+    a = a + 196;
+    a = a + 197;
+    a = a + 198;
+    a = a + 199;
+    a = a + 200;
+    a = a + 201;
+    a = a + 202;
+    a = a + 203;
+    a = a + 204;
+    a = a + 205;
+    a = a + 206;
+    a = a + 207;
+    a = a + 208;
+    a = a + 209;
+    a = a + 210;
+    a = a + 211;
+    a = a + 212;
+    a = a + 213;
+    a = a + 214;
+    a = a + 215;
+    a = a + 216;
+    a = a + 217;
+    a = a + 218;
+    a = a + 219;
+    a = a + 220;
+    a = a + 221;
+    a = a + 222;
+    a = a + 223;
+    a = a + 224;
+    a = a + 225;
+    a = a + 226;
+    a = a + 227;
+    a = a + 228;
+    a = a + 229;
+    a = a + 230;
+    a = a + 231;
+    a = a + 232;
+    a = a + 233;
+    a = a + 234;
+    a = a + 235;
+    a = a + 236;
+    a = a + 237;
+    a = a + 238;
+    a = a + 239;
+    a = a + 240;
+    a = a + 241;
+    a = a + 242;
+    a = a + 243;
+    a = a + 244;
+    a = a + 245;
+    a = a + 246;
+    a = a + 247;
+    a = a + 248;
+    a = a + 249;
+    a = a + 250;
+    a = a + 251;
+    a = a + 252;
+    a = a + 253;
+    a = a + 254;
+    a = a + 255;
+    a = a + 256;
+    a = a + 257;
+    a = a + 258;
+    a = a + 259;
+    a = a + 260;
+    a = a + 261;
+    a = a + 262;
+    a = a + 263;
+    a = a + 264;
+    a = a + 265;
+    a = a + 266;
+    a = a + 267;
+    a = a + 268;
+    a = a + 269;
+    a = a + 270;
+    a = a + 271;
+    a = a + 272;
+    a = a + 273;
+    a = a + 274;
+    a = a + 275;
+    a = a + 276;
+    a = a + 277;
+    a = a + 278;
+    a = a + 279;
+    a = a + 280;
+    a = a + 281;
+    a = a + 282;
+    a = a + 283;
+    a = a + 284;
+    a = a + 285;
+    a = a + 286;
+    a = a + 287;
+    a = a + 288;
+    a = a + 289;
+    a = a + 290;
+    a = a + 291;
+    a = a + 292;
+    a = a + 293;
+    a = a + 294;
+    a = a + 295;
+    a = a + 296;
+    a = a + 297;
+    a = a + 298;
+    a = a + 299;
+    a = a + 300;
+    a = a + 301;
+    a = a + 302;
+    a = a + 303;
+    a = a + 304;
+    a = a + 305;
+    a = a + 306;
+    a = a + 307;
+    a = a + 308;
+    a = a + 309;
+    a = a + 310;
+    a = a + 311;
+    a = a + 312;
+    a = a + 313;
+    a = a + 314;
+    a = a + 315;
+    a = a + 316;
+    a = a + 317;
+    a = a + 318;
+    a = a + 319;
+    a = a + 320;
+    a = a + 321;
+    a = a + 322;
+    a = a + 323;
+    a = a + 324;
+    a = a + 325;
+    a = a + 326;
+    a = a + 327;
+    a = a + 328;
+    a = a + 329;
+    a = a + 330;
+    a = a + 331;
+    a = a + 332;
+    a = a + 333;
+    a = a + 334;
+    a = a + 335;
+    a = a + 336;
+    a = a + 337;
+    a = a + 338;
+    a = a + 339;
+    a = a + 340;
+    a = a + 341;
+    a = a + 342;
+    a = a + 343;
+    a = a + 344;
+    a = a + 345;
+    a = a + 346;
+    a = a + 347;
+    a = a + 348;
+    a = a + 349;
+    a = a + 350;
+    a = a + 351;
+    a = a + 352;
+    a = a + 353;
+    a = a + 354;
+    a = a + 355;
+    a = a + 356;
+    a = a + 357;
+    a = a + 358;
+    a = a + 359;
+    a = a + 360;
+    a = a + 361;
+    a = a + 362;
+    a = a + 363;
+    a = a + 364;
+    a = a + 365;
+    a = a + 366;
+    a = a + 367;
+    a = a + 368;
+    a = a + 369;
+    a = a + 370;
+    a = a + 371;
+    a = a + 372;
+    a = a + 373;
+    a = a + 374;
+    a = a + 375;
+    a = a + 376;
+    a = a + 377;
+    a = a + 378;
+    a = a + 379;
+    a = a + 380;
+    a = a + 381;
+    a = a + 382;
+    a = a + 383;
+    a = a + 384;
+    a = a + 385;
+    a = a + 386;
+    a = a + 387;
+    a = a + 388;
+    a = a + 389;
+    a = a + 390;
+    a = a + 391;
+    a = a + 392;
+    a = a + 393;
+    a = a + 394;
+    a = a + 395;
+    a = a + 396;
+    a = a + 397;
+    a = a + 398;
+    a = a + 399;
+    a = a + 400;
+    a = a + 401;
+    a = a + 402;
+    a = a + 403;
+    a = a + 404;
+    a = a + 405;
+    a = a + 406;
+    a = a + 407;
+    a = a + 408;
+    a = a + 409;
+    a = a + 410;
+    a = a + 411;
+    a = a + 412;
+    a = a + 413;
+    a = a + 414;
+    a = a + 415;
+    a = a + 416;
+    a = a + 417;
+    a = a + 418;
+    a = a + 419;
+    a = a + 420;
+    a = a + 421;
+    a = a + 422;
+    a = a + 423;
+    a = a + 424;
+    a = a + 425;
+    a = a + 426;
+    a = a + 427;
+    a = a + 428;
+    a = a + 429;
+    a = a + 430;
+    a = a + 431;
+    a = a + 432;
+    a = a + 433;
+    a = a + 434;
+    a = a + 435;
+    a = a + 436;
+    a = a + 437;
+    a = a + 438;
+    a = a + 439;
+    a = a + 440;
+    a = a + 441;
+    a = a + 442;
+    a = a + 443;
+    a = a + 444;
+    a = a + 445;
+    a = a + 446;
+    a = a + 447;
+    a = a + 448;
+    a = a + 449;
+    a = a + 450;
+    a = a + 451;
+    a = a + 452;
+    a = a + 453;
+    a = a + 454;
+    a = a + 455;
+    a = a + 456;
+    a = a + 457;
+    a = a + 458;
+    a = a + 459;
+    a = a + 460;
+    a = a + 461;
+    a = a + 462;
+    a = a + 463;
+    a = a + 464;
+    a = a + 465;
+    a = a + 466;
+    a = a + 467;
+    a = a + 468;
+    a = a + 469;
+    a = a + 470;
+    a = a + 471;
+    a = a + 472;
+    a = a + 473;
+    a = a + 474;
+    a = a + 475;
+    a = a + 476;
+    a = a + 477;
+    a = a + 478;
+    a = a + 479;
+    a = a + 480;
+    a = a + 481;
+    a = a + 482;
+    a = a + 483;
+    a = a + 484;
+    a = a + 485;
+    a = a + 486;
+    a = a + 487;
+    a = a + 488;
+    a = a + 489;
+    a = a + 490;
+    a = a + 491;
+    a = a + 492;
+    a = a + 493;
+    a = a + 494;
+    a = a + 495;
+    a = a + 496;
+    a = a + 497;
+    a = a + 498;
+    a = a + 499;
+    a = a + 500;
+    a = a + 501;
+    a = a + 502;
+    a = a + 503;
+    a = a + 504;
+    a = a + 505;
+    a = a + 506;
+    a = a + 507;
+    a = a + 508;
+    a = a + 509;
+    a = a + 510;
+    a = a + 511;
+    a = a + 512;
+    a = a + 513;
+    a = a + 514;
+    a = a + 515;
+    a = a + 516;
+    a = a + 517;
+    a = a + 518;
+    a = a + 519;
+    a = a + 520;
+    a = a + 521;
+    a = a + 522;
+    a = a + 523;
+    a = a + 524;
+    a = a + 525;
+    a = a + 526;
+    a = a + 527;
+    a = a + 528;
+    a = a + 529;
+    a = a + 530;
+    a = a + 531;
+    a = a + 532;
+    a = a + 533;
+    a = a + 534;
+    a = a + 535;
+    a = a + 536;
+    a = a + 537;
+    a = a + 538;
+    a = a + 539;
+    a = a + 540;
+    a = a + 541;
+    a = a + 542;
+    a = a + 543;
+    a = a + 544;
+    a = a + 545;
+    a = a + 546;
+    a = a + 547;
+    a = a + 548;
+    a = a + 549;
+    a = a + 550;
+    a = a + 551;
+    a = a + 552;
+    a = a + 553;
+    a = a + 554;
+    a = a + 555;
+    a = a + 556;
+    a = a + 557;
+    a = a + 558;
+    a = a + 559;
+    a = a + 560;
+    a = a + 561;
+    a = a + 562;
+    a = a + 563;
+    a = a + 564;
+    a = a + 565;
+    a = a + 566;
+    a = a + 567;
+    a = a + 568;
+    a = a + 569;
+    a = a + 570;
+    a = a + 571;
+    a = a + 572;
+    a = a + 573;
+    a = a + 574;
+    a = a + 575;
+    a = a + 576;
+    a = a + 577;
+    a = a + 578;
+    a = a + 579;
+    a = a + 580;
+    a = a + 581;
+    a = a + 582;
+    a = a + 583;
+    a = a + 584;
+    a = a + 585;
+    a = a + 586;
+    a = a + 587;
+    a = a + 588;
+    a = a + 589;
+    a = a + 590;
+    a = a + 591;
+    a = a + 592;
+    a = a + 593;
+    a = a + 594;
+    a = a + 595;
+    a = a + 596;
+    a = a + 597;
+    a = a + 598;
+    a = a + 599;
+    a = a + 600;
+    a = a + 601;
+    a = a + 602;
+    a = a + 603;
+    a = a + 604;
+    a = a + 605;
+    a = a + 606;
+    a = a + 607;
+    a = a + 608;
+    a = a + 609;
+    a = a + 610;
+    a = a + 611;
+    a = a + 612;
+    a = a + 613;
+    a = a + 614;
+    a = a + 615;
+    a = a + 616;
+    a = a + 617;
+    a = a + 618;
+    a = a + 619;
+    a = a + 620;
+    a = a + 621;
+    a = a + 622;
+    a = a + 623;
+    a = a + 624;
+    a = a + 625;
+    a = a + 626;
+    a = a + 627;
+    a = a + 628;
+    a = a + 629;
+    a = a + 630;
+    a = a + 631;
+    a = a + 632;
+    a = a + 633;
+    a = a + 634;
+    a = a + 635;
+    a = a + 636;
+    a = a + 637;
+    a = a + 638;
+    a = a + 639;
+    a = a + 640;
+    a = a + 641;
+    a = a + 642;
+    a = a + 643;
+    a = a + 644;
+    a = a + 645;
+    a = a + 646;
+    a = a + 647;
+    a = a + 648;
+    a = a + 649;
+    a = a + 650;
+    a = a + 651;
+    a = a + 652;
+    a = a + 653;
+    a = a + 654;
+    a = a + 655;
+    a = a + 656;
+    a = a + 657;
+    a = a + 658;
+    a = a + 659;
+    a = a + 660;
+    a = a + 661;
+    a = a + 662;
+    a = a + 663;
+    a = a + 664;
+    a = a + 665;
+    a = a + 666;
+    a = a + 667;
+    a = a + 668;
+    a = a + 669;
+    a = a + 670;
+    a = a + 671;
+    a = a + 672;
+    a = a + 673;
+    a = a + 674;
+    a = a + 675;
+    a = a + 676;
+    a = a + 677;
+    a = a + 678;
+    a = a + 679;
+    a = a + 680;
+    a = a + 681;
+    a = a + 682;
+    a = a + 683;
+    a = a + 684;
+    a = a + 685;
+    a = a + 686;
+    a = a + 687;
+    a = a + 688;
+    a = a + 689;
+    a = a + 690;
+    a = a + 691;
+    a = a + 692;
+    a = a + 693;
+    a = a + 694;
+    a = a + 695;
+    a = a + 696;
+    a = a + 697;
+    a = a + 698;
+    a = a + 699;
+    a = a + 700;
+    a = a + 701;
+    a = a + 702;
+    a = a + 703;
+    a = a + 704;
+    a = a + 705;
+    a = a + 706;
+    a = a + 707;
+    a = a + 708;
+    a = a + 709;
+    a = a + 710;
+    a = a + 711;
+    a = a + 712;
+    a = a + 713;
+    a = a + 714;
+    a = a + 715;
+    a = a + 716;
+    a = a + 717;
+    a = a + 718;
+    a = a + 719;
+    a = a + 720;
+    a = a + 721;
+    a = a + 722;
+    a = a + 723;
+    a = a + 724;
+    a = a + 725;
+    a = a + 726;
+    a = a + 727;
+    a = a + 728;
+    a = a + 729;
+    a = a + 730;
+    a = a + 731;
+    a = a + 732;
+    a = a + 733;
+    a = a + 734;
+    a = a + 735;
+    a = a + 736;
+    a = a + 737;
+    a = a + 738;
+    a = a + 739;
+    a = a + 740;
+    a = a + 741;
+    a = a + 742;
+    a = a + 743;
+    a = a + 744;
+    a = a + 745;
+    a = a + 746;
+    a = a + 747;
+    a = a + 748;
+    a = a + 749;
+    a = a + 750;
+    a = a + 751;
+    a = a + 752;
+    a = a + 753;
+    a = a + 754;
+    a = a + 755;
+    a = a + 756;
+    a = a + 757;
+    a = a + 758;
+    a = a + 759;
+    a = a + 760;
+    a = a + 761;
+    a = a + 762;
+    a = a + 763;
+    a = a + 764;
+    a = a + 765;
+    a = a + 766;
+    a = a + 767;
+    a = a + 768;
+    a = a + 769;
+    a = a + 770;
+    a = a + 771;
+    a = a + 772;
+    a = a + 773;
+    a = a + 774;
+    a = a + 775;
+    a = a + 776;
+    a = a + 777;
+    a = a + 778;
+    a = a + 779;
+    a = a + 780;
+    a = a + 781;
+    a = a + 782;
+    a = a + 783;
+    a = a + 784;
+    a = a + 785;
+    a = a + 786;
+    a = a + 787;
+    a = a + 788;
+    a = a + 789;
+    a = a + 790;
+    a = a + 791;
+    a = a + 792;
+    a = a + 793;
+    a = a + 794;
+    a = a + 795;
+    a = a + 796;
+    a = a + 797;
+    a = a + 798;
+    a = a + 799;
+    a = a + 800;
+    a = a + 801;
+    a = a + 802;
+    a = a + 803;
+    a = a + 804;
+    a = a + 805;
+    a = a + 806;
+    a = a + 807;
+    a = a + 808;
+    a = a + 809;
+    a = a + 810;
+    a = a + 811;
+    a = a + 812;
+    a = a + 813;
+    a = a + 814;
+    a = a + 815;
+    a = a + 816;
+    a = a + 817;
+    a = a + 818;
+    a = a + 819;
+    a = a + 820;
+    a = a + 821;
+    a = a + 822;
+    a = a + 823;
+    a = a + 824;
+    a = a + 825;
+    a = a + 826;
+    a = a + 827;
+    a = a + 828;
+    a = a + 829;
+    a = a + 830;
+    a = a + 831;
+    a = a + 832;
+    a = a + 833;
+    a = a + 834;
+    a = a + 835;
+    a = a + 836;
+    a = a + 837;
+    a = a + 838;
+    a = a + 839;
+    a = a + 840;
+    a = a + 841;
+    a = a + 842;
+    a = a + 843;
+    a = a + 844;
+    a = a + 845;
+    a = a + 846;
+    a = a + 847;
+    a = a + 848;
+    a = a + 849;
+    a = a + 850;
+    a = a + 851;
+    a = a + 852;
+    a = a + 853;
+    a = a + 854;
+    a = a + 855;
+    a = a + 856;
+    a = a + 857;
+    a = a + 858;
+    a = a + 859;
+    a = a + 860;
+    a = a + 861;
+    a = a + 862;
+    a = a + 863;
+    a = a + 864;
+    a = a + 865;
+    a = a + 866;
+    a = a + 867;
+    a = a + 868;
+    a = a + 869;
+    a = a + 870;
+    a = a + 871;
+    a = a + 872;
+    a = a + 873;
+    a = a + 874;
+    a = a + 875;
+    a = a + 876;
+    a = a + 877;
+    a = a + 878;
+    a = a + 879;
+    a = a + 880;
+    a = a + 881;
+    a = a + 882;
+    a = a + 883;
+    a = a + 884;
+    a = a + 885;
+    a = a + 886;
+    a = a + 887;
+    a = a + 888;
+    a = a + 889;
+    a = a + 890;
+    a = a + 891;
+    a = a + 892;
+    a = a + 893;
+    a = a + 894;
+    a = a + 895;
+    a = a + 896;
+    a = a + 897;
+    a = a + 898;
+    a = a + 899;
+    a = a + 900;
+    a = a + 901;
+    a = a + 902;
+    a = a + 903;
+    a = a + 904;
+    a = a + 905;
+    a = a + 906;
+    a = a + 907;
+    a = a + 908;
+    a = a + 909;
+    a = a + 910;
+    a = a + 911;
+    a = a + 912;
+    a = a + 913;
+    a = a + 914;
+    a = a + 915;
+    a = a + 916;
+    a = a + 917;
+    a = a + 918;
+    a = a + 919;
+    a = a + 920;
+    a = a + 921;
+    a = a + 922;
+    a = a + 923;
+    a = a + 924;
+    a = a + 925;
+    a = a + 926;
+    a = a + 927;
+    a = a + 928;
+    a = a + 929;
+    a = a + 930;
+    a = a + 931;
+    a = a + 932;
+    a = a + 933;
+    a = a + 934;
+    a = a + 935;
+    a = a + 936;
+    a = a + 937;
+    a = a + 938;
+    a = a + 939;
+    a = a + 940;
+    a = a + 941;
+    a = a + 942;
+    a = a + 943;
+    a = a + 944;
+    a = a + 945;
+    a = a + 946;
+    a = a + 947;
+    a = a + 948;
+    a = a + 949;
+    a = a + 950;
+    a = a + 951;
+    a = a + 952;
+    a = a + 953;
+    a = a + 954;
+    a = a + 955;
+    a = a + 956;
+    a = a + 957;
+    a = a + 958;
+    a = a + 959;
+    a = a + 960;
+    a = a + 961;
+    a = a + 962;
+    a = a + 963;
+    a = a + 964;
+    a = a + 965;
+    a = a + 966;
+    a = a + 967;
+    a = a + 968;
+    a = a + 969;
+    a = a + 970;
+    a = a + 971;
+    a = a + 972;
+    a = a + 973;
+    a = a + 974;
+    a = a + 975;
+    a = a + 976;
+    a = a + 977;
+    a = a + 978;
+    a = a + 979;
+    a = a + 980;
+    a = a + 981;
+    a = a + 982;
+    a = a + 983;
+    a = a + 984;
+    a = a + 985;
+    a = a + 986;
+    a = a + 987;
+    a = a + 988;
+    a = a + 989;
+    a = a + 990;
+    a = a + 991;
+    a = a + 992;
+    a = a + 993;
+    a = a + 994;
+    a = a + 995;
+    a = a + 996;
+    a = a + 997;
+    a = a + 998;
+    a = a + 999;
+    a = a + 1000;
+    a = a + 1001;
+    a = a + 1002;
+    a = a + 1003;
+    a = a + 1004;
+    a = a + 1005;
+    a = a + 1006;
+    a = a + 1007;
+    a = a + 1008;
+    a = a + 1009;
+    a = a + 1010;
+    a = a + 1011;
+    a = a + 1012;
+    a = a + 1013;
+    a = a + 1014;
+    a = a + 1015;
+    a = a + 1016;
+    a = a + 1017;
+    a = a + 1018;
+    a = a + 1019;
+    a = a + 1020;
+    a = a + 1021;
+    a = a + 1022;
+    a = a + 1023;
+    a = a + 1024;
+    a = a + 1025;
+    a = a + 1026;
+    a = a + 1027;
+    a = a + 1028;
+    a = a + 1029;
+    a = a + 1030;
+    a = a + 1031;
+    a = a + 1032;
+    a = a + 1033;
+    a = a + 1034;
+    a = a + 1035;
+    a = a + 1036;
+    a = a + 1037;
+    a = a + 1038;
+    a = a + 1039;
+    a = a + 1040;
+    a = a + 1041;
+    a = a + 1042;
+    a = a + 1043;
+    a = a + 1044;
+    a = a + 1045;
+    a = a + 1046;
+    a = a + 1047;
+    a = a + 1048;
+    a = a + 1049;
+    a = a + 1050;
+    a = a + 1051;
+    a = a + 1052;
+    a = a + 1053;
+    a = a + 1054;
+    a = a + 1055;
+    a = a + 1056;
+    a = a + 1057;
+    a = a + 1058;
+    a = a + 1059;
+    a = a + 1060;
+    a = a + 1061;
+    a = a + 1062;
+    a = a + 1063;
+    a = a + 1064;
+    a = a + 1065;
+    a = a + 1066;
+    a = a + 1067;
+    a = a + 1068;
+    a = a + 1069;
+    a = a + 1070;
+    a = a + 1071;
+    a = a + 1072;
+    a = a + 1073;
+    a = a + 1074;
+    a = a + 1075;
+    a = a + 1076;
+    a = a + 1077;
+    a = a + 1078;
+    a = a + 1079;
+    a = a + 1080;
+    a = a + 1081;
+    a = a + 1082;
+    a = a + 1083;
+    a = a + 1084;
+    a = a + 1085;
+    a = a + 1086;
+    a = a + 1087;
+    a = a + 1088;
+    a = a + 1089;
+    a = a + 1090;
+    a = a + 1091;
+    a = a + 1092;
+    a = a + 1093;
+    a = a + 1094;
+    a = a + 1095;
+    a = a + 1096;
+    a = a + 1097;
+    a = a + 1098;
+    a = a + 1099;
+    a = a + 1100;
+    a = a + 1101;
+    a = a + 1102;
+    a = a + 1103;
+    a = a + 1104;
+    a = a + 1105;
+    a = a + 1106;
+    a = a + 1107;
+    a = a + 1108;
+    a = a + 1109;
+    a = a + 1110;
+    a = a + 1111;
+    a = a + 1112;
+    a = a + 1113;
+    a = a + 1114;
+    a = a + 1115;
+    a = a + 1116;
+    a = a + 1117;
+    a = a + 1118;
+    a = a + 1119;
+    a = a + 1120;
+    a = a + 1121;
+    a = a + 1122;
+    a = a + 1123;
+    a = a + 1124;
+    a = a + 1125;
+    a = a + 1126;
+    a = a + 1127;
+    a = a + 1128;
+    a = a + 1129;
+    a = a + 1130;
+    a = a + 1131;
+    a = a + 1132;
+    a = a + 1133;
+    a = a + 1134;
+    a = a + 1135;
+    a = a + 1136;
+    a = a + 1137;
+    a = a + 1138;
+    a = a + 1139;
+    a = a + 1140;
+    a = a + 1141;
+    a = a + 1142;
+    a = a + 1143;
+    a = a + 1144;
+    a = a + 1145;
+    a = a + 1146;
+    a = a + 1147;
+    a = a + 1148;
+    a = a + 1149;
+    a = a + 1150;
+    a = a + 1151;
+    a = a + 1152;
+    a = a + 1153;
+    a = a + 1154;
+    a = a + 1155;
+    a = a + 1156;
+    a = a + 1157;
+    a = a + 1158;
+    a = a + 1159;
+    a = a + 1160;
+    a = a + 1161;
+    a = a + 1162;
+    a = a + 1163;
+    a = a + 1164;
+    a = a + 1165;
+    a = a + 1166;
+    a = a + 1167;
+    a = a + 1168;
+    a = a + 1169;
+    a = a + 1170;
+    a = a + 1171;
+    a = a + 1172;
+    a = a + 1173;
+    a = a + 1174;
+    a = a + 1175;
+    a = a + 1176;
+    a = a + 1177;
+    a = a + 1178;
+    a = a + 1179;
+    a = a + 1180;
+    a = a + 1181;
+    a = a + 1182;
+    a = a + 1183;
+    a = a + 1184;
+    a = a + 1185;
+    a = a + 1186;
+    a = a + 1187;
+    a = a + 1188;
+    a = a + 1189;
+    a = a + 1190;
+    a = a + 1191;
+    a = a + 1192;
+    a = a + 1193;
+    a = a + 1194;
+    a = a + 1195;
+    a = a + 1196;
+    a = a + 1197;
+    a = a + 1198;
+    a = a + 1199;
+    a = a + 1200;
+    a = a + 1201;
+    a = a + 1202;
+    a = a + 1203;
+    a = a + 1204;
+    a = a + 1205;
+    a = a + 1206;
+    a = a + 1207;
+    a = a + 1208;
+    a = a + 1209;
+    a = a + 1210;
+    a = a + 1211;
+    a = a + 1212;
+    a = a + 1213;
+    a = a + 1214;
+    a = a + 1215;
+    a = a + 1216;
+    a = a + 1217;
+    a = a + 1218;
+    a = a + 1219;
+    a = a + 1220;
+    a = a + 1221;
+    a = a + 1222;
+    a = a + 1223;
+    a = a + 1224;
+    a = a + 1225;
+    a = a + 1226;
+    a = a + 1227;
+    a = a + 1228;
+    a = a + 1229;
+    a = a + 1230;
+    a = a + 1231;
+    a = a + 1232;
+    a = a + 1233;
+    a = a + 1234;
+    a = a + 1235;
+    a = a + 1236;
+    a = a + 1237;
+    a = a + 1238;
+    a = a + 1239;
+    a = a + 1240;
+    a = a + 1241;
+    a = a + 1242;
+    a = a + 1243;
+    a = a + 1244;
+    a = a + 1245;
+    a = a + 1246;
+    a = a + 1247;
+    a = a + 1248;
+    a = a + 1249;
+    a = a + 1250;
+    a = a + 1251;
+    a = a + 1252;
+    a = a + 1253;
+    a = a + 1254;
+    a = a + 1255;
+    a = a + 1256;
+    a = a + 1257;
+    a = a + 1258;
+    a = a + 1259;
+    a = a + 1260;
+    a = a + 1261;
+    a = a + 1262;
+    a = a + 1263;
+    a = a + 1264;
+    a = a + 1265;
+    a = a + 1266;
+    a = a + 1267;
+    a = a + 1268;
+    a = a + 1269;
+    a = a + 1270;
+    a = a + 1271;
+    a = a + 1272;
+    a = a + 1273;
+    a = a + 1274;
+    a = a + 1275;
+    a = a + 1276;
+    a = a + 1277;
+    a = a + 1278;
+    a = a + 1279;
+    a = a + 1280;
+    a = a + 1281;
+    a = a + 1282;
+    a = a + 1283;
+    a = a + 1284;
+    a = a + 1285;
+    a = a + 1286;
+    a = a + 1287;
+    a = a + 1288;
+    a = a + 1289;
+    a = a + 1290;
+    a = a + 1291;
+    a = a + 1292;
+    a = a + 1293;
+    a = a + 1294;
+    a = a + 1295;
+    a = a + 1296;
+    a = a + 1297;
+    a = a + 1298;
+    a = a + 1299;
+    a = a + 1300;
+    a = a + 1301;
+    a = a + 1302;
+    a = a + 1303;
+    a = a + 1304;
+    a = a + 1305;
+    a = a + 1306;
+    a = a + 1307;
+    a = a + 1308;
+    a = a + 1309;
+    a = a + 1310;
+    a = a + 1311;
+    a = a + 1312;
+    a = a + 1313;
+    a = a + 1314;
+    a = a + 1315;
+    a = a + 1316;
+    a = a + 1317;
+    a = a + 1318;
+    a = a + 1319;
+    a = a + 1320;
+    a = a + 1321;
+    a = a + 1322;
+    a = a + 1323;
+    a = a + 1324;
+    a = a + 1325;
+    a = a + 1326;
+    a = a + 1327;
+    a = a + 1328;
+    a = a + 1329;
+    a = a + 1330;
+    a = a + 1331;
+    a = a + 1332;
+    a = a + 1333;
+    a = a + 1334;
+    a = a + 1335;
+    a = a + 1336;
+    a = a + 1337;
+    a = a + 1338;
+    a = a + 1339;
+    a = a + 1340;
+    a = a + 1341;
+    a = a + 1342;
+    a = a + 1343;
+    a = a + 1344;
+    a = a + 1345;
+    a = a + 1346;
+    a = a + 1347;
+    a = a + 1348;
+    a = a + 1349;
+    a = a + 1350;
+    a = a + 1351;
+    a = a + 1352;
+    a = a + 1353;
+    a = a + 1354;
+    a = a + 1355;
+    a = a + 1356;
+    a = a + 1357;
+    a = a + 1358;
+    a = a + 1359;
+    a = a + 1360;
+    a = a + 1361;
+    a = a + 1362;
+    a = a + 1363;
+    a = a + 1364;
+    a = a + 1365;
+    a = a + 1366;
+    a = a + 1367;
+    a = a + 1368;
+    a = a + 1369;
+    a = a + 1370;
+    a = a + 1371;
+    a = a + 1372;
+    a = a + 1373;
+    a = a + 1374;
+    a = a + 1375;
+    a = a + 1376;
+    a = a + 1377;
+    a = a + 1378;
+    a = a + 1379;
+    a = a + 1380;
+    a = a + 1381;
+    a = a + 1382;
+    a = a + 1383;
+    a = a + 1384;
+    a = a + 1385;
+    a = a + 1386;
+    a = a + 1387;
+    a = a + 1388;
+    a = a + 1389;
+    a = a + 1390;
+    a = a + 1391;
+    a = a + 1392;
+    a = a + 1393;
+    a = a + 1394;
+    a = a + 1395;
+    a = a + 1396;
+    a = a + 1397;
+    a = a + 1398;
+    a = a + 1399;
+    a = a + 1400;
+    a = a + 1401;
+    a = a + 1402;
+    a = a + 1403;
+    a = a + 1404;
+    a = a + 1405;
+    a = a + 1406;
+    a = a + 1407;
+    a = a + 1408;
+    a = a + 1409;
+    a = a + 1410;
+    a = a + 1411;
+    a = a + 1412;
+    a = a + 1413;
+    a = a + 1414;
+    a = a + 1415;
+    a = a + 1416;
+    a = a + 1417;
+    a = a + 1418;
+    a = a + 1419;
+    a = a + 1420;
+    a = a + 1421;
+    a = a + 1422;
+    a = a + 1423;
+    a = a + 1424;
+    a = a + 1425;
+    a = a + 1426;
+    a = a + 1427;
+    a = a + 1428;
+    a = a + 1429;
+    a = a + 1430;
+    a = a + 1431;
+    a = a + 1432;
+    a = a + 1433;
+    a = a + 1434;
+    a = a + 1435;
+    a = a + 1436;
+    a = a + 1437;
+    a = a + 1438;
+    a = a + 1439;
+    a = a + 1440;
+    a = a + 1441;
+    a = a + 1442;
+    a = a + 1443;
+    a = a + 1444;
+    a = a + 1445;
+    a = a + 1446;
+    a = a + 1447;
+    a = a + 1448;
+    a = a + 1449;
+    a = a + 1450;
+    a = a + 1451;
+    a = a + 1452;
+    a = a + 1453;
+    a = a + 1454;
+    a = a + 1455;
+    a = a + 1456;
+    a = a + 1457;
+    a = a + 1458;
+    a = a + 1459;
+    a = a + 1460;
+    a = a + 1461;
+    a = a + 1462;
+    a = a + 1463;
+    a = a + 1464;
+    a = a + 1465;
+    a = a + 1466;
+    a = a + 1467;
+    a = a + 1468;
+    a = a + 1469;
+    a = a + 1470;
+    a = a + 1471;
+    a = a + 1472;
+    a = a + 1473;
+    a = a + 1474;
+    a = a + 1475;
+    a = a + 1476;
+    a = a + 1477;
+    a = a + 1478;
+    a = a + 1479;
+    a = a + 1480;
+    a = a + 1481;
+    a = a + 1482;
+    a = a + 1483;
+    a = a + 1484;
+    a = a + 1485;
+    a = a + 1486;
+    a = a + 1487;
+    a = a + 1488;
+    a = a + 1489;
+    a = a + 1490;
+    a = a + 1491;
+    a = a + 1492;
+    a = a + 1493;
+    a = a + 1494;
+    a = a + 1495;
+    a = a + 1496;
+    a = a + 1497;
+    a = a + 1498;
+    a = a + 1499;
+    return a;
+}
@@ -11,10 +11,16 @@
 #include <time.h>
 #include "../src/ir/tac_store.h"
 #include "../src/tools/tac_engine/tac_engine.h"
+#include "tac_test_builders.h"
 
 static char temp_filename[256];
 static int temp_file_counter = 0;
 
+const tac_engine_exec_mode_t test_exec_modes[TEST_EXEC_MODE_COUNT] = {
+    TAC_EXEC_INTERPRET, TAC_EXEC_PREDECODED, TAC_EXEC_BYTECODE,
+    TAC_EXEC_JIT, TAC_EXEC_TIERED
+};
+
 /**
  * @brief Create a temporary file with given content
  */
@@ -121,9 +127,14 @@ int compare_files(const char* file1, const char* file2) {
 }
 
 /**
- * @brief Load TAC instructions from binary file using tacstore
+ * @brief Load TAC instructions and function records from binary file using tacstore
+ * @param functions Receives the function section (free()), NULL if there is none
  */
-int load_tac_from_file(const char* filename, TACInstruction** instructions, uint32_t* count) {
+int load_tac_from_file(const char* filename, TACInstruction** instructions, uint32_t* count,
+                       TACFunction** functions, uint32_t* function_count) {
+    *functions = NULL;
+    *function_count = 0;
+
     printf("DEBUG: Opening TAC store file: %s\n", filename);
     fflush(stdout);
     
@@ -171,6 +182,19 @@ int load_tac_from_file(const char* filename, TACInstruction** instructions, uint
     
     printf("DEBUG: All instructions loaded\n");
     fflush(stdout);
+
+    uint32_t records = tacstore_function_count();
+    if (records > 0) {
+        *functions = malloc(sizeof(TACFunction) * records);
+        if (!(*functions) || tacstore_read_functions(*functions, records) != records) {
+            free(*functions);
+            free(*instructions);
+            *functions = NULL;
+            tacstore_close();
+            return -4;
+        }
+        *function_count = records;
+    }
     
     *count = instruction_count;
     tacstore_close();
@@ -225,8 +249,11 @@ TACValidationResult validate_tac_execution(const char* tac_file, int expected_re
     // Load TAC instructions from file
     TACInstruction* instructions = NULL;
     uint32_t instruction_count = 0;
+    TACFunction* functions = NULL;
+    uint32_t function_count = 0;
     
-    int load_result = load_tac_from_file(tac_file, &instructions, &instruction_count);
+    int load_result = load_tac_from_file(tac_file, &instructions, &instruction_count,
+                                         &functions, &function_count);
     if (load_result != 0) {
         // Handle special case of empty TAC files (no instructions generated)
         if (load_result == -1 || load_result == -3) {
@@ -252,16 +279,19 @@ TACValidationResult validate_tac_execution(const char* tac_file, int expected_re
         snprintf(result.error_message, sizeof(result.error_message),
                 "Failed to create TAC engine");
         free(instructions);
+        free(functions);
         return result;
     }
     
     // Load code into engine
-    tac_engine_error_t engine_result = tac_engine_load_code(engine, instructions, instruction_count);
+    tac_engine_error_t engine_result = tac_engine_load_program(engine, instructions, instruction_count,
+                                                                functions, function_count);
     if (engine_result != TAC_ENGINE_OK) {
         snprintf(result.error_message, sizeof(result.error_message),
                 "Failed to load code: %s", tac_engine_error_string(engine_result));
         tac_engine_destroy(engine);
         free(instructions);
+        free(functions);
         return result;
     }
     
@@ -360,6 +390,7 @@ TACValidationResult validate_tac_execution(const char* tac_file, int expected_re
     // Clean up
     tac_engine_destroy(engine);
     free(instructions);
+    free(functions);
     
     return result;
 }
@@ -373,8 +404,11 @@ TACValidationResult validate_tac_execution_with_label(const char* tac_file, uint
     // Load TAC instructions from file
     TACInstruction* instructions = NULL;
     uint32_t instruction_count = 0;
+    TACFunction* functions = NULL;
+    uint32_t function_count = 0;
     
-    int load_result = load_tac_from_file(tac_file, &instructions, &instruction_count);
+    int load_result = load_tac_from_file(tac_file, &instructions, &instruction_count,
+                                         &functions, &function_count);
     if (load_result != 0) {
         // Handle special case of empty TAC files (no instructions generated)
         if (load_result == -1 || load_result == -3) {
@@ -400,16 +434,19 @@ TACValidationResult validate_tac_execution_with_label(const char* tac_file, uint
         snprintf(result.error_message, sizeof(result.error_message),
                 "Failed to create TAC engine");
         free(instructions);
+        free(functions);
         return result;
     }
     
     // Load code into engine
-    tac_engine_error_t engine_result = tac_engine_load_code(engine, instructions, instruction_count);
+    tac_engine_error_t engine_result = tac_engine_load_program(engine, instructions, instruction_count,
+                                                                functions, function_count);
     if (engine_result != TAC_ENGINE_OK) {
         snprintf(result.error_message, sizeof(result.error_message),
                 "Failed to load code: %s", tac_engine_error_string(engine_result));
         tac_engine_destroy(engine);
         free(instructions);
+        free(functions);
         return result;
     }
     
@@ -420,6 +457,7 @@ TACValidationResult validate_tac_execution_with_label(const char* tac_file, uint
                 "Failed to set entry label %u: %s", entry_label_id, tac_engine_error_string(engine_result));
         tac_engine_destroy(engine);
         free(instructions);
+        free(functions);
         return result;
     }
     
@@ -480,6 +518,7 @@ TACValidationResult validate_tac_execution_with_label(const char* tac_file, uint
     // Clean up
     tac_engine_destroy(engine);
     free(instructions);
+    free(functions);
     
     return result;
 }
@@ -534,8 +573,11 @@ TACValidationResult validate_tac_execution_with_symbols(const char* tac_file,
     // Load TAC instructions from file
     TACInstruction* instructions = NULL;
     uint32_t instruction_count = 0;
+    TACFunction* functions = NULL;
+    uint32_t function_count = 0;
     
-    int load_result = load_tac_from_file(tac_file, &instructions, &instruction_count);
+    int load_result = load_tac_from_file(tac_file, &instructions, &instruction_count,
+                                         &functions, &function_count);
     if (load_result != 0) {
         // Handle special case of empty TAC files (no instructions generated)
         if (load_result == -1 || load_result == -3) {
@@ -573,16 +615,19 @@ TACValidationResult validate_tac_execution_with_symbols(const char* tac_file,
         snprintf(result.error_message, sizeof(result.error_message),
                 "Failed to create TAC engine");
         free(instructions);
+        free(functions);
         return result;
     }
     
     // Load code into engine
-    tac_engine_error_t engine_result = tac_engine_load_code(engine, instructions, instruction_count);
+    tac_engine_error_t engine_result = tac_engine_load_program(engine, instructions, instruction_count,
+                                                                functions, function_count);
     if (engine_result != TAC_ENGINE_OK) {
         snprintf(result.error_message, sizeof(result.error_message),
                 "Failed to load code: %s", tac_engine_error_string(engine_result));
         tac_engine_destroy(engine);
         free(instructions);
+        free(functions);
         return result;
     }
     
@@ -677,6 +722,7 @@ TACValidationResult validate_tac_execution_with_symbols(const char* tac_file,
     // Clean up
     tac_engine_destroy(engine);
     free(instructions);
+    free(functions);
     
     return result;
 }
@@ -774,3 +820,46 @@ bool detect_symbol_files(const char* base_filename,
     
     return found_any;
 }
+
+/**
+ * @brief Create an engine with a hand-written program loaded
+ * @return Engine positioned at entry_label, owned by the caller
+ */
+tac_engine_t* create_test_engine(const tac_engine_config_t* config,
+                                 const TACInstruction* code, uint32_t count,
+                                 uint16_t entry_label) {
+    return create_test_program(config, code, count, NULL, 0, entry_label);
+}
+
+/**
+ * @brief Create an engine with a hand-written program and its function records
+ * @return Engine positioned at entry_label, owned by the caller
+ */
+tac_engine_t* create_test_program(const tac_engine_config_t* config,
+                                  const TACInstruction* code, uint32_t count,
+                                  const TACFunction* functions, uint32_t function_count,
+                                  uint16_t entry_label) {
+    tac_engine_t* engine = tac_engine_create(config);
+    TEST_ASSERT_NOT_NULL(engine);
+
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK,
+                      tac_engine_load_program(engine, code, count, functions, function_count));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_set_entry_label(engine, entry_label));
+    return engine;
+}
+
+/**
+ * @brief Run an engine to the end of its program
+ * @param result Receives t0 if the program finishes
+ * @return Error of tac_engine_run()
+ */
+tac_engine_error_t run_test_engine(tac_engine_t* engine, int32_t* result) {
+    tac_engine_error_t error = tac_engine_run(engine);
+    if (error == TAC_ENGINE_OK) {
+        TEST_ASSERT_EQUAL(TAC_ENGINE_FINISHED, tac_engine_get_state(engine));
+        tac_value_t value;
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_temp(engine, 0, &value));
+        *result = value.data.i32;
+    }
+    return error;
+}
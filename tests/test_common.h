@@ -96,6 +96,8 @@ bool detect_symbol_files(const char* base_filename,
                         size_t path_size);
 int load_tac_from_file(const char* filename, 
                       TACInstruction** instructions, 
-                      uint32_t* count);
+                      uint32_t* count,
+                      TACFunction** functions,
+                      uint32_t* function_count);
 
 #endif // TEST_COMMON_H
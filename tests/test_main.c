@@ -27,7 +27,15 @@
 extern void run_tac_tests(void);
 extern void run_stas_tac_generator_tests(void);
 extern void run_tac_builder_c99_tests(void);
+extern void run_tac_stats_tests(void);
+extern void run_tac_engine_call_tests(void);
+extern void run_tac_engine_mode_tests(void);
+extern void run_tac_engine_memory_tests(void);
+extern void run_tac_engine_snapshot_tests(void);
+extern void run_tac_engine_trace_tests(void);
+extern void run_tac_engine_replay_tests(void);
 extern void run_integration_c99_scoping_tests(void);
+extern void run_integration_stcc_tests(void);
 
 // Forward declarations for test suites
 void run_simple_tests(void);
@@ -70,6 +78,27 @@ int main(void) {
     printf("\nRunning TAC Builder C99 tests...\n");
     run_tac_builder_c99_tests();
     
+    printf("\nRunning TAC statistics tests...\n");
+    run_tac_stats_tests();
+    
+    printf("\nRunning TAC engine call tests...\n");
+    run_tac_engine_call_tests();
+    
+    printf("\nRunning TAC engine execution mode tests...\n");
+    run_tac_engine_mode_tests();
+    
+    printf("\nRunning TAC engine memory tests...\n");
+    run_tac_engine_memory_tests();
+    
+    printf("\nRunning TAC engine snapshot tests...\n");
+    run_tac_engine_snapshot_tests();
+    
+    printf("\nRunning TAC engine trace tests...\n");
+    run_tac_engine_trace_tests();
+    
+    printf("\nRunning TAC engine record and replay tests...\n");
+    run_tac_engine_replay_tests();
+    
     // Edge Case Tests - Designed to break weak code
     printf("\n--- Edge Case Tests (Aggressive) ---\n");
     printf("Testing storage components with extreme conditions...\n");
@@ -97,6 +126,9 @@ int main(void) {
     printf("\nRunning C99 scoping integration tests...\n");
     run_integration_c99_scoping_tests();
     
+    printf("\nRunning stcc driver integration tests...\n");
+    run_integration_stcc_tests();
+    
     printf("\n=== Test Summary ===\n");
     return UNITY_END();
 }
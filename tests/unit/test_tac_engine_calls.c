@@ -0,0 +1,373 @@
+//============================================================================//
+// test_tac_engine_calls.c - Unit tests for TAC engine calls and frames
+//
+// Runs hand-built TAC programs with their function records through every
+// execution mode of the TAC engine: argument binding in declaration order,
+// parameters shared by several functions, recursion and tail calls. Also
+// binds the function section cc2 writes, or the symbol table without it,
+// and finds main() of a compiled program through its symbol table.
+//============================================================================//
+
+#include "../test_common.h"
+#include "../tac_test_builders.h"
+#include "tac_engine.h"
+
+//============================================================================//
+// TEST FUNCTION PROTOTYPES
+//============================================================================//
+
+void test_tac_engine_calls_shared_param_id(void);
+void test_tac_engine_calls_shared_param_nested(void);
+void test_tac_engine_calls_global_read_not_param(void);
+void test_tac_engine_calls_unread_first_param(void);
+void test_tac_engine_calls_overwritten_first_param(void);
+void test_tac_engine_calls_compiled_params(void);
+void test_tac_engine_calls_recursion(void);
+void test_tac_engine_calls_tail_call_depth(void);
+void test_tac_engine_calls_entry_function(void);
+void run_tac_engine_call_tests(void);
+
+//============================================================================//
+// HELPERS
+//============================================================================//
+
+/**
+ * @brief Run a program from an entry label in one mode
+ * @return Value left in t0 by the final RETURN
+ */
+static int32_t run_program(const TACInstruction* code, uint32_t count,
+                           const TACFunction* functions, uint32_t function_count,
+                           uint16_t entry_label, tac_engine_exec_mode_t mode,
+                           uint32_t max_call_depth) {
+    tac_engine_config_t config = tac_engine_default_config();
+    config.exec_mode = mode;
+    config.max_call_depth = max_call_depth;
+    config.tier_call_threshold = 2;   // Tiered: promote during the test
+    tac_engine_t* engine = create_test_program(&config, code, count, functions, function_count,
+                                               entry_label);
+
+    int32_t result = 0;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, run_test_engine(engine, &result));
+    tac_engine_destroy(engine);
+    return result;
+}
+
+static void expect_in_all_modes(const TACInstruction* code, uint32_t count,
+                                const TACFunction* functions, uint32_t function_count,
+                                uint16_t entry_label, int32_t expected) {
+    for (size_t m = 0; m < TEST_EXEC_MODE_COUNT; m++) {
+        char message[64];
+        snprintf(message, sizeof(message), "execution mode %d", (int)test_exec_modes[m]);
+        TEST_ASSERT_EQUAL_MESSAGE(expected, run_program(code, count, functions, function_count,
+                                                        entry_label, test_exec_modes[m], 64),
+                                  message);
+    }
+}
+
+/**
+ * @brief Compile a source file with cc0, cc1 and cc2
+ * @param name Prefix of the output files in TEMP_PATH
+ * @param sym_file Receives the symbol table path
+ * @param sstore_file Receives the string store path
+ * @param tac_file Receives the TAC file path
+ */
+static void compile_program(const char* source, const char* name,
+                            char* sym_file, char* sstore_file, char* tac_file, size_t size) {
+    char tokens_file[256];
+    char ast_file[256];
+    char tac_listing[256];
+    snprintf(sstore_file, size, TEMP_PATH "%s_sstore.out", name);
+    snprintf(tokens_file, sizeof(tokens_file), TEMP_PATH "%s_tokens.out", name);
+    snprintf(ast_file, sizeof(ast_file), TEMP_PATH "%s_ast.out", name);
+    snprintf(sym_file, size, TEMP_PATH "%s_sym.out", name);
+    snprintf(tac_file, size, TEMP_PATH "%s_tac.out", name);
+    snprintf(tac_listing, sizeof(tac_listing), TEMP_PATH "%s.tac", name);
+
+    char* input_file = create_temp_file(source);
+    char* lexer_outputs[] = {sstore_file, tokens_file};
+    TEST_ASSERT_EQUAL(0, run_compiler_stage("cc0", input_file, lexer_outputs));
+    char* parser_outputs[] = {sstore_file, tokens_file, ast_file, sym_file};
+    TEST_ASSERT_EQUAL(0, run_compiler_stage("cc1", NULL, parser_outputs));
+    char* tac_outputs[] = {sstore_file, tokens_file, ast_file, sym_file, tac_file, tac_listing};
+    TEST_ASSERT_EQUAL(0, run_compiler_stage("cc2", NULL, tac_outputs));
+}
+
+/**
+ * @brief Run main() of a compiled program
+ * @param functions Function records, or NULL to take them from the symbol table
+ * @return Value main() returns
+ */
+static int32_t run_compiled(const char* sym_file, const char* sstore_file,
+                            const TACInstruction* code, uint32_t count,
+                            const TACFunction* functions, uint32_t function_count) {
+    tac_engine_config_t config = tac_engine_default_config();
+    config.symtab_file = sym_file;
+    config.sstore_file = sstore_file;
+    tac_engine_t* engine = tac_engine_create(&config);
+    TEST_ASSERT_NOT_NULL(engine);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK,
+                      tac_engine_load_program(engine, code, count, functions, function_count));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_set_entry_function(engine, "main"));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_run(engine));
+
+    tac_value_t result;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_temp(engine, 0, &result));
+    tac_engine_destroy(engine);
+    return result.data.i32;
+}
+
+//============================================================================//
+// ARGUMENT BINDING TESTS
+//============================================================================//
+
+void test_tac_engine_calls_shared_param_id(void) {
+    // square(int x) and double_value(int x) both use v1 for x, as cc1 emits
+    // them: square(3) + double_value(4) * 2 - square(2) = 21
+    const TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),              // square
+        I(TAC_MUL, T(1), V(1), V(1)),
+        I(TAC_RETURN, NONE, T(1), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),              // double_value
+        I(TAC_MUL, T(2), V(1), K(2)),
+        I(TAC_RETURN, NONE, T(2), NONE),
+        I(TAC_LABEL, L(3), NONE, NONE),              // main
+        I(TAC_PARAM, NONE, K(3), NONE),
+        I(TAC_CALL, T(4), L(1), NONE),
+        I(TAC_PARAM, NONE, K(4), NONE),
+        I(TAC_CALL, T(5), L(2), NONE),
+        I(TAC_MUL, T(6), T(5), K(2)),
+        I(TAC_ADD, T(7), T(4), T(6)),
+        I(TAC_PARAM, NONE, K(2), NONE),
+        I(TAC_CALL, T(8), L(1), NONE),
+        I(TAC_SUB, T(9), T(7), T(8)),
+        I(TAC_ASSIGN, V(2), T(9), NONE),
+        I(TAC_RETURN, NONE, V(2), NONE),
+    };
+    const TACFunction functions[] = { FUNC(0, 1, 1), FUNC(3, 1, 1) };
+    expect_in_all_modes(code, sizeof(code) / sizeof(code[0]), functions, 2, 3, 21);
+}
+
+void test_tac_engine_calls_shared_param_nested(void) {
+    // outer(int x) { return inner(x + 1) + x; }  inner(int x) { return x * 10; }
+    // x is v1 in both, so the call to inner must not clobber outer's x
+    const TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),              // outer
+        I(TAC_ADD, T(1), V(1), K(1)),
+        I(TAC_PARAM, NONE, T(1), NONE),
+        I(TAC_CALL, T(2), L(2), NONE),
+        I(TAC_ADD, T(3), T(2), V(1)),
+        I(TAC_RETURN, NONE, T(3), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),              // inner
+        I(TAC_MUL, T(4), V(1), K(10)),
+        I(TAC_RETURN, NONE, T(4), NONE),
+        I(TAC_LABEL, L(3), NONE, NONE),              // main
+        I(TAC_PARAM, NONE, K(5), NONE),
+        I(TAC_CALL, T(5), L(1), NONE),
+        I(TAC_RETURN, NONE, T(5), NONE),
+    };
+    const TACFunction functions[] = { FUNC(0, 1, 1), FUNC(6, 1, 1) };
+    expect_in_all_modes(code, sizeof(code) / sizeof(code[0]), functions, 2, 3, 65);
+}
+
+void test_tac_engine_calls_global_read_not_param(void) {
+    // int g; int add_g(int x) { return x + g; }  g = 100; return add_g(7)
+    // g (v1) is read before being written too, but is not a parameter
+    const TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),              // add_g
+        I(TAC_ADD, T(1), V(2), V(1)),
+        I(TAC_RETURN, NONE, T(1), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),              // main
+        I(TAC_ASSIGN, V(1), K(100), NONE),
+        I(TAC_PARAM, NONE, K(7), NONE),
+        I(TAC_CALL, T(2), L(1), NONE),
+        I(TAC_RETURN, NONE, T(2), NONE),
+    };
+    const TACFunction functions[] = { FUNC(0, 2, 1) };
+    expect_in_all_modes(code, sizeof(code) / sizeof(code[0]), functions, 1, 2, 107);
+}
+
+void test_tac_engine_calls_unread_first_param(void) {
+    // second(int u, int v) { return v; }  second(3, 7): only v is read,
+    // yet it is the second parameter
+    const TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),              // second
+        I(TAC_RETURN, NONE, V(2), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),              // main
+        I(TAC_PARAM, NONE, K(3), NONE),
+        I(TAC_PARAM, NONE, K(7), NONE),
+        I(TAC_CALL, T(1), L(1), NONE),
+        I(TAC_RETURN, NONE, T(1), NONE),
+    };
+    const TACFunction functions[] = { FUNC(0, 1, 2) };
+    expect_in_all_modes(code, sizeof(code) / sizeof(code[0]), functions, 1, 2, 7);
+}
+
+void test_tac_engine_calls_overwritten_first_param(void) {
+    // pick(int a, int b) { a = 1; return b; }  pick(10, 20): a is written
+    // before it is read, and is still bound
+    const TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),              // pick
+        I(TAC_ASSIGN, V(1), K(1), NONE),
+        I(TAC_RETURN, NONE, V(2), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),              // main
+        I(TAC_PARAM, NONE, K(10), NONE),
+        I(TAC_PARAM, NONE, K(20), NONE),
+        I(TAC_CALL, T(1), L(1), NONE),
+        I(TAC_RETURN, NONE, T(1), NONE),
+    };
+    const TACFunction functions[] = { FUNC(0, 1, 2) };
+    expect_in_all_modes(code, sizeof(code) / sizeof(code[0]), functions, 1, 2, 20);
+}
+
+void test_tac_engine_calls_compiled_params(void) {
+    // Both cases through cc2, with its function section and, without it,
+    // with the parameters cc1 records on each function symbol:
+    // 7 + 20 + 25 (x is declared twice)
+    char sym_file[256];
+    char sstore_file[256];
+    char tac_file[256];
+    compile_program(
+        "int second(int u, int v) {\n"
+        "    return v;\n"
+        "}\n"
+        "\n"
+        "int pick(int a, int b) {\n"
+        "    a = 1;\n"
+        "    return b;\n"
+        "}\n"
+        "\n"
+        "int square(int x) {\n"
+        "    return x * x;\n"
+        "}\n"
+        "\n"
+        "int add_one(int x) {\n"
+        "    return x + 1;\n"
+        "}\n"
+        "\n"
+        "int main() {\n"
+        "    return second(3, 7) + pick(10, 20) + square(add_one(4));\n"
+        "}",
+        "test_params", sym_file, sstore_file, tac_file, sizeof(tac_file));
+
+    TACInstruction* code = NULL;
+    uint32_t count = 0;
+    TACFunction* functions = NULL;
+    uint32_t function_count = 0;
+    TEST_ASSERT_EQUAL(0, load_tac_from_file(tac_file, &code, &count, &functions, &function_count));
+    TEST_ASSERT_EQUAL(5, function_count);
+
+    TEST_ASSERT_EQUAL(52, run_compiled(sym_file, sstore_file, code, count,
+                                       functions, function_count));
+    TEST_ASSERT_EQUAL(52, run_compiled(sym_file, sstore_file, code, count, NULL, 0));
+    free(code);
+    free(functions);
+}
+
+//============================================================================//
+// FRAME TESTS
+//============================================================================//
+
+void test_tac_engine_calls_recursion(void) {
+    // fact(int n) { if (n < 2) return 1; return n * fact(n - 1); }  fact(6)
+    const TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),              // fact
+        I(TAC_LT, T(1), V(1), K(2)),
+        I(TAC_IF_FALSE, NONE, T(1), L(2)),
+        I(TAC_RETURN, NONE, K(1), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),
+        I(TAC_SUB, T(2), V(1), K(1)),
+        I(TAC_PARAM, NONE, T(2), NONE),
+        I(TAC_CALL, T(3), L(1), NONE),
+        I(TAC_MUL, T(4), V(1), T(3)),
+        I(TAC_RETURN, NONE, T(4), NONE),
+        I(TAC_LABEL, L(3), NONE, NONE),              // main
+        I(TAC_PARAM, NONE, K(6), NONE),
+        I(TAC_CALL, T(5), L(1), NONE),
+        I(TAC_RETURN, NONE, T(5), NONE),
+    };
+    const TACFunction functions[] = { FUNC(0, 1, 1) };
+    expect_in_all_modes(code, sizeof(code) / sizeof(code[0]), functions, 1, 3, 720);
+}
+
+void test_tac_engine_calls_tail_call_depth(void) {
+    // count(int n) { if (n < 1) return 0; return count(n - 1); }  count(500)
+    // runs in one frame, so a call depth limit of 4 is enough
+    const TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),              // count
+        I(TAC_LT, T(1), V(1), K(1)),
+        I(TAC_IF_FALSE, NONE, T(1), L(2)),
+        I(TAC_RETURN, NONE, K(0), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),
+        I(TAC_SUB, T(2), V(1), K(1)),
+        I(TAC_PARAM, NONE, T(2), NONE),
+        I(TAC_CALL, T(3), L(1), NONE),
+        I(TAC_RETURN, NONE, T(3), NONE),
+        I(TAC_LABEL, L(3), NONE, NONE),              // main
+        I(TAC_PARAM, NONE, K(500), NONE),
+        I(TAC_CALL, T(4), L(1), NONE),
+        I(TAC_ADD, T(5), T(4), K(42)),
+        I(TAC_RETURN, NONE, T(5), NONE),
+    };
+    const TACFunction functions[] = { FUNC(0, 1, 1) };
+    for (size_t m = 0; m < TEST_EXEC_MODE_COUNT; m++) {
+        TEST_ASSERT_EQUAL(42, run_program(code, sizeof(code) / sizeof(code[0]), functions, 1, 3,
+                                          test_exec_modes[m], 4));
+    }
+}
+
+//============================================================================//
+// ENTRY TESTS
+//============================================================================//
+
+void test_tac_engine_calls_entry_function(void) {
+    // A helper with a loop before main, and a main whose loop head is a
+    // label too: only main's own label gives 5 + 18
+    char sym_file[256];
+    char sstore_file[256];
+    char tac_file[256];
+    compile_program(
+        "int wrap(int p) {\n"
+        "    while (p > 3) {\n"
+        "        p = p - 3;\n"
+        "    }\n"
+        "    return p;\n"
+        "}\n"
+        "\n"
+        "int main() {\n"
+        "    int s = 5;\n"
+        "    int i = 0;\n"
+        "    while (i < 10) {\n"
+        "        s = s + wrap(i);\n"
+        "        i = i + 1;\n"
+        "    }\n"
+        "    return s;\n"
+        "}",
+        "test_entry", sym_file, sstore_file, tac_file, sizeof(tac_file));
+
+    TACInstruction* code = NULL;
+    uint32_t count = 0;
+    TACFunction* functions = NULL;
+    uint32_t function_count = 0;
+    TEST_ASSERT_EQUAL(0, load_tac_from_file(tac_file, &code, &count, &functions, &function_count));
+
+    TEST_ASSERT_EQUAL(23, run_compiled(sym_file, sstore_file, code, count,
+                                       functions, function_count));
+    free(code);
+    free(functions);
+}
+
+//============================================================================//
+// TEST RUNNER
+//============================================================================//
+
+void run_tac_engine_call_tests(void) {
+    RUN_TEST(test_tac_engine_calls_shared_param_id);
+    RUN_TEST(test_tac_engine_calls_shared_param_nested);
+    RUN_TEST(test_tac_engine_calls_global_read_not_param);
+    RUN_TEST(test_tac_engine_calls_unread_first_param);
+    RUN_TEST(test_tac_engine_calls_overwritten_first_param);
+    RUN_TEST(test_tac_engine_calls_compiled_params);
+    RUN_TEST(test_tac_engine_calls_recursion);
+    RUN_TEST(test_tac_engine_calls_tail_call_depth);
+    RUN_TEST(test_tac_engine_calls_entry_function);
+}
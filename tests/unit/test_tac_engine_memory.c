@@ -0,0 +1,238 @@
+//============================================================================//
+// test_tac_engine_memory.c - Unit tests for TAC engine virtual memory
+//
+// Tests the paged memory manager of the TAC engine: the size-class heap
+// allocator, the NULL guard page and bounds checks, and copy-on-write
+// sharing of pages between memory managers (tac_memory_clone() and
+// tac_memory_assign(), which snapshots and forks are built on), and that
+// addresses from TAC_ADDR never reach heap blocks.
+//============================================================================//
+
+#include "../test_common.h"
+#include "../tac_test_builders.h"
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+
+//============================================================================//
+// TEST FUNCTION PROTOTYPES
+//============================================================================//
+
+void test_tac_engine_memory_alloc_reuse(void);
+void test_tac_engine_memory_invalid_access(void);
+void test_tac_engine_memory_clone_copy_on_write(void);
+void test_tac_engine_memory_assign(void);
+void test_tac_engine_memory_addr_outside_heap(void);
+void run_tac_engine_memory_tests(void);
+
+//============================================================================//
+// HELPERS
+//============================================================================//
+
+#define MEMORY_SIZE (1u << 20)
+
+static uint32_t read_u32(tac_memory_manager_t* memory, uint32_t address) {
+    uint32_t value = 0;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_read(memory, address, &value, sizeof(value)));
+    return value;
+}
+
+static void write_u32(tac_memory_manager_t* memory, uint32_t address, uint32_t value) {
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_write(memory, address, &value, sizeof(value)));
+}
+
+//============================================================================//
+// ALLOCATOR TESTS
+//============================================================================//
+
+void test_tac_engine_memory_alloc_reuse(void) {
+    tac_memory_manager_t memory;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_init(&memory, MEMORY_SIZE));
+
+    // Blocks start above the guard page and do not overlap
+    uint32_t a = tac_memory_alloc(&memory, 12);
+    uint32_t b = tac_memory_alloc(&memory, 12);
+    TEST_ASSERT_TRUE(a >= TAC_MEMORY_BASE);
+    TEST_ASSERT_TRUE(b >= a + 16);
+    write_u32(&memory, a, 0x11111111u);
+    write_u32(&memory, b, 0x22222222u);
+    TEST_ASSERT_EQUAL(0x11111111u, read_u32(&memory, a));
+    TEST_ASSERT_EQUAL(0x22222222u, read_u32(&memory, b));
+    TEST_ASSERT_EQUAL(32, memory.total_allocated);
+
+    // A freed block is recycled by its size class, a double free is refused
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_free(&memory, a));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_MEMORY, tac_memory_free(&memory, a));
+    TEST_ASSERT_EQUAL(a, tac_memory_alloc(&memory, 16));
+    TEST_ASSERT_TRUE(tac_memory_alloc(&memory, 17) > b);
+
+    // Large blocks are recycled first-fit
+    uint32_t large = tac_memory_alloc(&memory, 3 * TAC_PAGE_SIZE);
+    TEST_ASSERT_TRUE(large != 0);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_free(&memory, large));
+    TEST_ASSERT_EQUAL(large, tac_memory_alloc(&memory, 2 * TAC_PAGE_SIZE + 1));
+
+    // free(NULL) is a no-op, a request beyond the heap fails
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_free(&memory, 0));
+    TEST_ASSERT_EQUAL(0, tac_memory_alloc(&memory, MEMORY_SIZE));
+
+    tac_memory_cleanup(&memory);
+}
+
+void test_tac_engine_memory_invalid_access(void) {
+    tac_memory_manager_t memory;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_init(&memory, MEMORY_SIZE));
+    uint32_t block = tac_memory_alloc(&memory, 64);
+    uint32_t value = 0;
+
+    // NULL page and addresses past the carved heap
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_MEMORY, tac_memory_read(&memory, 0, &value, 4));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_MEMORY,
+                      tac_memory_write(&memory, block + 64, &value, 4));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_MEMORY,
+                      tac_memory_read(&memory, UINT32_MAX - 1, &value, 4));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_MEMORY, tac_memory_free(&memory, block + 4));
+
+    // Untouched heap reads as zero without backing pages
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_read(&memory, block + 32, &value, 4));
+    TEST_ASSERT_EQUAL(0, value);
+    TEST_ASSERT_EQUAL(1, memory.pages_touched);
+
+    tac_memory_cleanup(&memory);
+}
+
+//============================================================================//
+// COPY-ON-WRITE TESTS
+//============================================================================//
+
+void test_tac_engine_memory_clone_copy_on_write(void) {
+    tac_memory_manager_t source;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_init(&source, MEMORY_SIZE));
+    uint32_t first = tac_memory_alloc(&source, 16);
+    uint32_t far = tac_memory_alloc(&source, 2 * TAC_PAGE_SIZE);
+    write_u32(&source, first, 100);
+    write_u32(&source, far + TAC_PAGE_SIZE, 200);
+
+    tac_memory_manager_t clone;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_clone(&clone, &source));
+    TEST_ASSERT_EQUAL(100, read_u32(&clone, first));
+    TEST_ASSERT_EQUAL(200, read_u32(&clone, far + TAC_PAGE_SIZE));
+    TEST_ASSERT_EQUAL(0, clone.pages_copied);
+
+    // A write to the clone copies only the page written
+    write_u32(&clone, first, 101);
+    TEST_ASSERT_EQUAL(1, clone.pages_copied);
+    TEST_ASSERT_EQUAL(100, read_u32(&source, first));
+    TEST_ASSERT_EQUAL(101, read_u32(&clone, first));
+
+    // The other page is still shared; the source writing it copies it too
+    write_u32(&source, far + TAC_PAGE_SIZE, 201);
+    TEST_ASSERT_EQUAL(200, read_u32(&clone, far + TAC_PAGE_SIZE));
+    TEST_ASSERT_EQUAL(201, read_u32(&source, far + TAC_PAGE_SIZE));
+
+    // The heaps are independent as well
+    TEST_ASSERT_EQUAL(tac_memory_alloc(&source, 16), tac_memory_alloc(&clone, 16));
+
+    // Pages outlive the manager that created them
+    tac_memory_cleanup(&source);
+    TEST_ASSERT_EQUAL(200, read_u32(&clone, far + TAC_PAGE_SIZE));
+    tac_memory_cleanup(&clone);
+}
+
+void test_tac_engine_memory_assign(void) {
+    tac_memory_manager_t memory;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_init(&memory, MEMORY_SIZE));
+    uint32_t block = tac_memory_alloc(&memory, 16);
+    uint32_t large = tac_memory_alloc(&memory, 4096);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_free(&memory, large));
+    write_u32(&memory, block, 7);
+
+    tac_memory_manager_t saved;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_clone(&saved, &memory));
+
+    // Diverge: new data, new blocks, the recycled large block taken
+    write_u32(&memory, block, 8);
+    uint32_t extra = tac_memory_alloc(&memory, 64);
+    write_u32(&memory, extra, 9);
+    TEST_ASSERT_EQUAL(large, tac_memory_alloc(&memory, 4000));
+
+    // Back to the saved state, any number of times
+    for (int round = 0; round < 2; round++) {
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_assign(&memory, &saved));
+        TEST_ASSERT_EQUAL(7, read_u32(&memory, block));
+        TEST_ASSERT_EQUAL(saved.brk, memory.brk);
+        TEST_ASSERT_EQUAL(saved.total_allocated, memory.total_allocated);
+        TEST_ASSERT_EQUAL(large, tac_memory_alloc(&memory, 4000));
+        TEST_ASSERT_EQUAL(extra, tac_memory_alloc(&memory, 64));
+        write_u32(&memory, block, 10);
+    }
+    TEST_ASSERT_EQUAL(7, read_u32(&saved, block));
+
+    // Managers of another size cannot be assigned
+    tac_memory_manager_t other;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_memory_init(&other, 2 * MEMORY_SIZE));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_OPERAND, tac_memory_assign(&other, &saved));
+
+    tac_memory_cleanup(&other);
+    tac_memory_cleanup(&saved);
+    tac_memory_cleanup(&memory);
+}
+
+//============================================================================//
+// ADDRESS-OF TESTS
+//============================================================================//
+
+void test_tac_engine_memory_addr_outside_heap(void) {
+    // v4 = 0; t1 = &v4; *t1 = 12345, next to two live heap blocks
+    const TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),
+        I(TAC_ASSIGN, V(4), K(0), NONE),
+        I(TAC_ADDR, T(1), V(4), NONE),
+        I(TAC_STORE, T(1), K(12345), NONE),
+        I(TAC_RETURN, NONE, V(4), NONE),
+    };
+
+    for (int checked = 0; checked < 2; checked++) {
+        for (size_t m = 0; m < TEST_EXEC_MODE_COUNT; m++) {
+            tac_engine_config_t config = tac_engine_default_config();
+            config.exec_mode = test_exec_modes[m];
+            config.enable_bounds_check = checked != 0;
+            tac_engine_t* engine = create_test_engine(&config, code,
+                                                      sizeof(code) / sizeof(code[0]), 1);
+
+            uint32_t a = tac_engine_malloc(engine, 8);
+            uint32_t b = tac_engine_malloc(engine, 8);
+            TEST_ASSERT_TRUE(a != 0 && b != 0);
+            int32_t word = 77;
+            TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_mem_write(engine, a, &word, sizeof(word)));
+
+            // The store faults instead of landing in the heap or in v4
+            int32_t result = 0;
+            TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_MEMORY, run_test_engine(engine, &result));
+            tac_value_t value;
+            TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_temp(engine, 1, &value));
+            TEST_ASSERT_TRUE(value.data.u32 >= TAC_ADDR_RESERVED_BASE);
+            TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_var(engine, 4, &value));
+            TEST_ASSERT_EQUAL(0, value.data.i32);
+
+            // Both blocks are intact and can still be freed
+            word = 0;
+            TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_mem_read(engine, a, &word, sizeof(word)));
+            TEST_ASSERT_EQUAL(77, word);
+            TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_free(engine, a));
+            TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_free(engine, b));
+            tac_engine_destroy(engine);
+        }
+    }
+}
+
+//============================================================================//
+// TEST RUNNER
+//============================================================================//
+
+void run_tac_engine_memory_tests(void) {
+    RUN_TEST(test_tac_engine_memory_alloc_reuse);
+    RUN_TEST(test_tac_engine_memory_invalid_access);
+    RUN_TEST(test_tac_engine_memory_clone_copy_on_write);
+    RUN_TEST(test_tac_engine_memory_assign);
+    RUN_TEST(test_tac_engine_memory_addr_outside_heap);
+}
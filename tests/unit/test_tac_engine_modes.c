@@ -0,0 +1,310 @@
+//============================================================================//
+// test_tac_engine_modes.c - Unit tests for TAC engine execution modes
+//
+// Runs the same hand-built TAC programs through every execution mode of the
+// TAC engine and checks that they agree with the interpreter: results, step
+// counts and step limits, values the JIT cannot handle natively, and the
+// int32 corner cases every mode has to handle without help from the host
+// (INT32_MIN / -1, shift counts outside 0..31).
+//============================================================================//
+
+#include "../test_common.h"
+#include "../tac_test_builders.h"
+#include "tac_engine.h"
+
+//============================================================================//
+// TEST FUNCTION PROTOTYPES
+//============================================================================//
+
+void test_tac_engine_modes_division(void);
+void test_tac_engine_modes_division_overflow(void);
+void test_tac_engine_modes_division_by_zero(void);
+void test_tac_engine_modes_shifts(void);
+void test_tac_engine_modes_agree_on_loop(void);
+void test_tac_engine_modes_agree_on_step_limit(void);
+void test_tac_engine_modes_agree_on_float_operands(void);
+void run_tac_engine_mode_tests(void);
+
+//============================================================================//
+// HELPERS
+//============================================================================//
+
+/**
+ * @brief Run a program from an entry label in one mode
+ * @param function Record of its only function, or NULL
+ * @param result Receives t0 if the program finishes
+ * @return Error of tac_engine_run()
+ */
+static tac_engine_error_t run_program(const TACInstruction* code, uint32_t count,
+                                      const TACFunction* function, uint16_t entry_label,
+                                      tac_engine_exec_mode_t mode, int32_t* result) {
+    tac_engine_config_t config = tac_engine_default_config();
+    config.exec_mode = mode;
+    config.tier_call_threshold = 2;   // Tiered: promote during the test
+    tac_engine_t* engine = create_test_program(&config, code, count, function, function ? 1 : 0,
+                                               entry_label);
+    tac_engine_error_t error = run_test_engine(engine, result);
+    tac_engine_destroy(engine);
+    return error;
+}
+
+/**
+ * @brief Evaluate a op b in every mode, with b in a register and as an immediate
+ *
+ * op sits in a function called three times, so the tiered mode also runs it
+ * promoted; each call returns the same value.
+ */
+static void expect_binary(TACOpcode op, int32_t a, int32_t b, int32_t expected) {
+    const TACInstruction by_register[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),              // f(x, y)
+        I(op, T(1), V(1), V(2)),
+        I(TAC_RETURN, NONE, T(1), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),              // main
+        I(TAC_PARAM, NONE, K(a), NONE),
+        I(TAC_PARAM, NONE, K(b), NONE),
+        I(TAC_CALL, T(2), L(1), NONE),
+        I(TAC_PARAM, NONE, K(a), NONE),
+        I(TAC_PARAM, NONE, K(b), NONE),
+        I(TAC_CALL, T(3), L(1), NONE),
+        I(TAC_PARAM, NONE, K(a), NONE),
+        I(TAC_PARAM, NONE, K(b), NONE),
+        I(TAC_CALL, T(4), L(1), NONE),
+        I(TAC_RETURN, NONE, T(4), NONE),
+    };
+    const TACInstruction by_immediate[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),              // f(x)
+        I(op, T(1), V(1), K(b)),
+        I(TAC_RETURN, NONE, T(1), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),              // main
+        I(TAC_PARAM, NONE, K(a), NONE),
+        I(TAC_CALL, T(2), L(1), NONE),
+        I(TAC_PARAM, NONE, K(a), NONE),
+        I(TAC_CALL, T(3), L(1), NONE),
+        I(TAC_PARAM, NONE, K(a), NONE),
+        I(TAC_CALL, T(4), L(1), NONE),
+        I(TAC_RETURN, NONE, T(4), NONE),
+    };
+    const TACFunction binary = FUNC(0, 1, 2);
+    const TACFunction unary = FUNC(0, 1, 1);
+
+    for (size_t m = 0; m < TEST_EXEC_MODE_COUNT; m++) {
+        char message[96];
+        int32_t result = 0;
+        snprintf(message, sizeof(message), "%d op %d, execution mode %d (register)",
+                 (int)a, (int)b, (int)test_exec_modes[m]);
+        TEST_ASSERT_EQUAL_MESSAGE(TAC_ENGINE_OK,
+                                  run_program(by_register, sizeof(by_register) / sizeof(by_register[0]),
+                                              &binary, 2, test_exec_modes[m], &result), message);
+        TEST_ASSERT_EQUAL_MESSAGE(expected, result, message);
+
+        result = 0;
+        snprintf(message, sizeof(message), "%d op %d, execution mode %d (immediate)",
+                 (int)a, (int)b, (int)test_exec_modes[m]);
+        TEST_ASSERT_EQUAL_MESSAGE(TAC_ENGINE_OK,
+                                  run_program(by_immediate, sizeof(by_immediate) / sizeof(by_immediate[0]),
+                                              &unary, 2, test_exec_modes[m], &result), message);
+        TEST_ASSERT_EQUAL_MESSAGE(expected, result, message);
+    }
+}
+
+/**
+ * @brief Observable state after a run
+ */
+typedef struct mode_run {
+    tac_engine_error_t error;
+    uint32_t steps;
+    tac_value_t t0;
+    tac_value_t v1;
+    tac_value_t v2;
+} mode_run_t;
+
+/**
+ * @brief Run a program from label 1 in one mode and record its state
+ * @param v1 Initial value of v1, or NULL
+ */
+static mode_run_t run_observed(const TACInstruction* code, uint32_t count,
+                               tac_engine_exec_mode_t mode, uint32_t max_steps,
+                               const tac_value_t* v1) {
+    tac_engine_config_t config = tac_engine_default_config();
+    config.exec_mode = mode;
+    config.max_steps = max_steps;
+    tac_engine_t* engine = create_test_engine(&config, code, count, 1);
+    if (v1) {
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_set_var(engine, 1, v1));
+    }
+
+    mode_run_t run;
+    memset(&run, 0, sizeof(run));
+    run.error = tac_engine_run(engine);
+    run.steps = tac_engine_get_step_count(engine);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_temp(engine, 0, &run.t0));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_var(engine, 1, &run.v1));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_var(engine, 2, &run.v2));
+    tac_engine_destroy(engine);
+    return run;
+}
+
+static void expect_same_value(const tac_value_t* expected, const tac_value_t* actual,
+                              const char* message) {
+    TEST_ASSERT_EQUAL_MESSAGE(expected->type, actual->type, message);
+    TEST_ASSERT_EQUAL_MESSAGE(expected->data.u32, actual->data.u32, message);
+}
+
+/**
+ * @brief Run a program in every mode and compare each run with the interpreter
+ * @return The interpreter's run
+ */
+static mode_run_t expect_modes_agree(const TACInstruction* code, uint32_t count,
+                                     uint32_t max_steps, const tac_value_t* v1) {
+    mode_run_t reference = run_observed(code, count, TAC_EXEC_INTERPRET, max_steps, v1);
+    for (size_t m = 1; m < TEST_EXEC_MODE_COUNT; m++) {
+        char message[64];
+        snprintf(message, sizeof(message), "execution mode %d", (int)test_exec_modes[m]);
+        mode_run_t run = run_observed(code, count, test_exec_modes[m], max_steps, v1);
+        TEST_ASSERT_EQUAL_MESSAGE(reference.error, run.error, message);
+        TEST_ASSERT_EQUAL_MESSAGE(reference.steps, run.steps, message);
+        expect_same_value(&reference.t0, &run.t0, message);
+        expect_same_value(&reference.v1, &run.v1, message);
+        expect_same_value(&reference.v2, &run.v2, message);
+    }
+    return reference;
+}
+
+/**
+ * @brief Run a loop over most integer opcodes in every mode
+ *
+ * for (i = 0; i < 100; i++) { x = (i * i ^ i << 3) >> 1; acc += i % 3 ? x : -x; }
+ */
+static mode_run_t expect_modes_agree_on_loop(uint32_t max_steps) {
+    const TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),
+        I(TAC_ASSIGN, V(1), K(0), NONE),
+        I(TAC_ASSIGN, V(2), K(0), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),
+        I(TAC_LT, T(1), V(1), K(100)),
+        I(TAC_IF_FALSE, NONE, T(1), L(3)),
+        I(TAC_MUL, T(2), V(1), V(1)),
+        I(TAC_SHL, T(3), V(1), K(3)),
+        I(TAC_XOR, T(4), T(2), T(3)),
+        I(TAC_SHR, T(5), T(4), K(1)),
+        I(TAC_MOD, T(6), V(1), K(3)),
+        I(TAC_IF_TRUE, NONE, T(6), L(4)),
+        I(TAC_NEG, T(5), T(5), NONE),
+        I(TAC_LABEL, L(4), NONE, NONE),
+        I(TAC_ADD, V(2), V(2), T(5)),
+        I(TAC_ADD, V(1), V(1), K(1)),
+        I(TAC_GOTO, NONE, L(2), NONE),
+        I(TAC_LABEL, L(3), NONE, NONE),
+        I(TAC_AND, T(7), V(2), K(0xFFFF)),
+        I(TAC_SUB, T(0), V(2), T(7)),
+        I(TAC_RETURN, NONE, V(2), NONE),
+    };
+    return expect_modes_agree(code, sizeof(code) / sizeof(code[0]), max_steps, NULL);
+}
+
+//============================================================================//
+// AGREEMENT TESTS
+//============================================================================//
+
+void test_tac_engine_modes_agree_on_loop(void) {
+    int32_t expected = 0;
+    for (int32_t i = 0; i < 100; i++) {
+        int32_t x = ((i * i) ^ (i << 3)) >> 1;
+        expected += (i % 3) ? x : -x;
+    }
+
+    mode_run_t run = expect_modes_agree_on_loop(1000000);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, run.error);
+    TEST_ASSERT_EQUAL(expected, run.t0.data.i32);
+    TEST_ASSERT_EQUAL(100, run.v1.data.i32);
+}
+
+void test_tac_engine_modes_agree_on_step_limit(void) {
+    // Stops part way through an iteration; every mode stops at the same place
+    for (uint32_t max_steps = 40; max_steps < 60; max_steps += 7) {
+        mode_run_t run = expect_modes_agree_on_loop(max_steps);
+        TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_MAX_STEPS, run.error);
+    }
+}
+
+void test_tac_engine_modes_agree_on_float_operands(void) {
+    // v1 holds a float, so the JIT's int32 guards leave the native code
+    const TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),
+        I(TAC_ADD, T(1), V(1), V(1)),
+        I(TAC_MUL, T(2), K(6), K(7)),
+        I(TAC_SUB, V(2), T(2), K(2)),
+        I(TAC_RETURN, NONE, T(1), NONE),
+    };
+    tac_value_t v1 = {TAC_VALUE_FLOAT, {.f32 = 1.25f}};
+    mode_run_t run = expect_modes_agree(code, sizeof(code) / sizeof(code[0]), 1000000, &v1);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, run.error);
+    TEST_ASSERT_EQUAL(TAC_VALUE_FLOAT, run.t0.type);
+    TEST_ASSERT_TRUE(run.t0.data.f32 > 2.49f && run.t0.data.f32 < 2.51f);
+    TEST_ASSERT_EQUAL(40, run.v2.data.i32);
+}
+
+//============================================================================//
+// DIVISION TESTS
+//============================================================================//
+
+void test_tac_engine_modes_division(void) {
+    // C99 truncates towards zero, the remainder takes the dividend's sign
+    expect_binary(TAC_DIV, 7, 2, 3);
+    expect_binary(TAC_DIV, -7, 2, -3);
+    expect_binary(TAC_MOD, 7, -2, 1);
+    expect_binary(TAC_MOD, -7, 2, -1);
+    expect_binary(TAC_DIV, 7, -1, -7);
+    expect_binary(TAC_MOD, 7, -1, 0);
+}
+
+void test_tac_engine_modes_division_overflow(void) {
+    // The one quotient that does not fit wraps like ADD/SUB/MUL do
+    expect_binary(TAC_DIV, INT32_MIN, -1, INT32_MIN);
+    expect_binary(TAC_MOD, INT32_MIN, -1, 0);
+    expect_binary(TAC_DIV, INT32_MIN, 1, INT32_MIN);
+    expect_binary(TAC_DIV, INT32_MIN, 2, INT32_MIN / 2);
+    expect_binary(TAC_DIV, INT32_MAX, -1, -INT32_MAX);
+}
+
+void test_tac_engine_modes_shifts(void) {
+    // Counts are masked to 5 bits and right shifts are arithmetic
+    expect_binary(TAC_SHL, 1, 31, INT32_MIN);
+    expect_binary(TAC_SHL, 3, 32, 3);
+    expect_binary(TAC_SHL, 3, 33, 6);
+    expect_binary(TAC_SHL, -1, 4, -16);
+    expect_binary(TAC_SHL, INT32_MIN, 1, 0);
+    expect_binary(TAC_SHL, 1, -1, INT32_MIN);
+    expect_binary(TAC_SHR, -16, 2, -4);
+    expect_binary(TAC_SHR, -1, 31, -1);
+    expect_binary(TAC_SHR, INT32_MIN, 40, -8388608);
+    expect_binary(TAC_SHR, 256, 36, 16);
+}
+
+void test_tac_engine_modes_division_by_zero(void) {
+    const TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),
+        I(TAC_ASSIGN, V(1), K(0), NONE),
+        I(TAC_DIV, T(1), K(INT32_MIN), V(1)),
+        I(TAC_RETURN, NONE, T(1), NONE),
+    };
+    for (size_t m = 0; m < TEST_EXEC_MODE_COUNT; m++) {
+        int32_t result = 0;
+        TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_DIVISION_BY_ZERO,
+                          run_program(code, sizeof(code) / sizeof(code[0]), NULL, 1, test_exec_modes[m], &result));
+    }
+}
+
+//============================================================================//
+// TEST RUNNER
+//============================================================================//
+
+void run_tac_engine_mode_tests(void) {
+    RUN_TEST(test_tac_engine_modes_division);
+    RUN_TEST(test_tac_engine_modes_division_overflow);
+    RUN_TEST(test_tac_engine_modes_division_by_zero);
+    RUN_TEST(test_tac_engine_modes_shifts);
+    RUN_TEST(test_tac_engine_modes_agree_on_loop);
+    RUN_TEST(test_tac_engine_modes_agree_on_step_limit);
+    RUN_TEST(test_tac_engine_modes_agree_on_float_operands);
+}
@@ -0,0 +1,215 @@
+//============================================================================//
+// test_tac_engine_replay.c - Unit tests for TAC engine record and replay
+//
+// Records runs whose result depends on inputs from the host: values and
+// memory written from an instruction hook, between steps, and before the
+// run. Replaying the input log on a fresh engine, without the hook, must
+// reproduce the result and step count, and seeking must reach any step
+// with the state a straight replay has there.
+//============================================================================//
+
+#include "../test_common.h"
+#include "../tac_test_builders.h"
+#include "tac_engine.h"
+
+//============================================================================//
+// TEST FUNCTION PROTOTYPES
+//============================================================================//
+
+void test_tac_engine_replay_reproduces_run(void);
+void test_tac_engine_replay_seek(void);
+void test_tac_engine_replay_invalid_logs(void);
+void run_tac_engine_replay_tests(void);
+
+//============================================================================//
+// HELPERS
+//============================================================================//
+
+#define REPLAY_FILE TEMP_PATH "test_temp_replay.rec"
+#define PROGRAM_SIZE 11
+
+/**
+ * @brief Create an engine running: for (i = 0; i < 200; i++) v2 += *v3 + v4
+ * @param program_size Instructions to load; fewer loads a different program
+ */
+static tac_engine_t* create_engine(uint32_t program_size) {
+    const TACInstruction code[PROGRAM_SIZE] = {
+        I(TAC_LABEL, L(1), NONE, NONE),
+        I(TAC_ASSIGN, V(1), K(0), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),
+        I(TAC_LT, T(1), V(1), K(200)),
+        I(TAC_IF_FALSE, NONE, T(1), L(3)),
+        I(TAC_LOAD, T(2), V(3), NONE),
+        I(TAC_ADD, T(3), T(2), V(4)),
+        I(TAC_ADD, V(2), V(2), T(3)),
+        I(TAC_ADD, V(1), V(1), K(1)),
+        I(TAC_GOTO, NONE, L(2), NONE),
+        I(TAC_LABEL, L(3), NONE, NONE),
+    };
+
+    tac_engine_config_t config = tac_engine_default_config();
+    config.exec_mode = TAC_EXEC_PREDECODED;
+    return create_test_engine(&config, code, program_size, 1);
+}
+
+static int32_t read_var(tac_engine_t* engine, uint16_t id) {
+    tac_value_t value;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_var(engine, id, &value));
+    return value.data.i32;
+}
+
+// Every 37th instruction, change v4 and the word v3 points at
+static bool inject_inputs(tac_engine_t* engine, tac_hook_type_t type, uint32_t address,
+                          void* user_data) {
+    (void)type;
+    (void)address;
+    uint32_t* calls = user_data;
+    if (++*calls % 37 == 0) {
+        tac_value_t value = tac_value_int32((int32_t)(*calls * 7919u % 1000u));
+        int32_t word = (int32_t)(*calls % 13u);
+        tac_engine_set_var(engine, 4, &value);
+        tac_engine_mem_write(engine, (uint32_t)read_var(engine, 3), &word, sizeof(word));
+    }
+    return true;
+}
+
+/**
+ * @brief Record a run whose inputs come from the host and a hook
+ * @param steps Receives the step count of the run
+ * @return The result (v2)
+ */
+static int32_t record_run(uint32_t* steps) {
+    tac_engine_t* engine = create_engine(PROGRAM_SIZE);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_record_to_file(engine, REPLAY_FILE));
+
+    uint32_t address = tac_engine_malloc(engine, 4);
+    TEST_ASSERT_TRUE(address != 0);
+    tac_value_t value = tac_value_int32((int32_t)address);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_set_var(engine, 3, &value));
+    int32_t word = 5;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_mem_write(engine, address, &word, sizeof(word)));
+
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_step(engine));
+    }
+    value = tac_value_int32(3);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_set_var(engine, 4, &value));
+
+    uint32_t calls = 0;
+    TEST_ASSERT_TRUE(tac_engine_add_hook(engine, TAC_HOOK_INSTRUCTION, inject_inputs, &calls) != 0);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_run(engine));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_record_stop(engine));
+    TEST_ASSERT_TRUE(calls > 37);
+
+    *steps = tac_engine_get_step_count(engine);
+    int32_t result = read_var(engine, 2);
+    tac_engine_destroy(engine);
+    return result;
+}
+
+//============================================================================//
+// REPLAY TESTS
+//============================================================================//
+
+void test_tac_engine_replay_reproduces_run(void) {
+    uint32_t steps = 0;
+    int32_t recorded = record_run(&steps);
+
+    // Without its inputs the program computes something else
+    tac_engine_t* engine = create_engine(PROGRAM_SIZE);
+    uint32_t address = tac_engine_malloc(engine, 4);
+    tac_value_t value = tac_value_int32((int32_t)address);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_set_var(engine, 3, &value));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_run(engine));
+    TEST_ASSERT_TRUE(read_var(engine, 2) != recorded);
+    tac_engine_destroy(engine);
+
+    // With the log, a fresh engine gets the same result in the same steps
+    engine = create_engine(PROGRAM_SIZE);
+    tac_replay_t* replay = NULL;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_replay_open(engine, REPLAY_FILE, 0, &replay));
+    TEST_ASSERT_EQUAL(steps, tac_replay_end_step(replay));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_replay_run(replay));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_FINISHED, tac_engine_get_state(engine));
+    TEST_ASSERT_EQUAL(steps, tac_engine_get_step_count(engine));
+    TEST_ASSERT_EQUAL(recorded, read_var(engine, 2));
+    TEST_ASSERT_EQUAL(200, read_var(engine, 1));
+
+    tac_replay_close(replay);
+    tac_engine_destroy(engine);
+    remove(REPLAY_FILE);
+}
+
+void test_tac_engine_replay_seek(void) {
+    uint32_t steps = 0;
+    int32_t recorded = record_run(&steps);
+
+    // State at the middle, reached by replaying straight there
+    tac_engine_t* engine = create_engine(PROGRAM_SIZE);
+    tac_replay_t* replay = NULL;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_replay_open(engine, REPLAY_FILE, 0, &replay));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_replay_seek(replay, steps / 2));
+    int32_t middle_i = read_var(engine, 1);
+    int32_t middle_sum = read_var(engine, 2);
+    tac_replay_close(replay);
+    tac_engine_destroy(engine);
+
+    // With snapshots, seek forward, back and forward again
+    engine = create_engine(PROGRAM_SIZE);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_replay_open(engine, REPLAY_FILE, 64, &replay));
+    const uint32_t targets[] = { steps / 2, steps - 1, steps / 3, steps / 2, 0, steps / 2 };
+    for (size_t t = 0; t < sizeof(targets) / sizeof(targets[0]); t++) {
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_replay_seek(replay, targets[t]));
+        TEST_ASSERT_EQUAL(targets[t], tac_engine_get_step_count(engine));
+    }
+    TEST_ASSERT_EQUAL(middle_i, read_var(engine, 1));
+    TEST_ASSERT_EQUAL(middle_sum, read_var(engine, 2));
+
+    // The rest of the run is unchanged; seeking past the end is refused
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_replay_run(replay));
+    TEST_ASSERT_EQUAL(recorded, read_var(engine, 2));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_OPERAND, tac_replay_seek(replay, steps + 1));
+
+    tac_replay_close(replay);
+    tac_engine_destroy(engine);
+    remove(REPLAY_FILE);
+}
+
+void test_tac_engine_replay_invalid_logs(void) {
+    uint32_t steps = 0;
+    record_run(&steps);
+    tac_replay_t* replay = NULL;
+
+    // The log pins the program and the state it started from
+    tac_engine_t* engine = create_engine(PROGRAM_SIZE - 1);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_OPERAND,
+                      tac_replay_open(engine, REPLAY_FILE, 0, &replay));
+    tac_engine_destroy(engine);
+    engine = create_engine(PROGRAM_SIZE);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_step(engine));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_OPERAND,
+                      tac_replay_open(engine, REPLAY_FILE, 0, &replay));
+    tac_engine_destroy(engine);
+
+    // Files that are not input logs
+    FILE* file = fopen(REPLAY_FILE, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    fputs("not an input log", file);
+    fclose(file);
+    engine = create_engine(PROGRAM_SIZE);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_OPERAND,
+                      tac_replay_open(engine, REPLAY_FILE, 0, &replay));
+    remove(REPLAY_FILE);
+    TEST_ASSERT_TRUE(tac_replay_open(engine, REPLAY_FILE, 0, &replay) != TAC_ENGINE_OK);
+    tac_engine_destroy(engine);
+}
+
+//============================================================================//
+// TEST RUNNER
+//============================================================================//
+
+void run_tac_engine_replay_tests(void) {
+    RUN_TEST(test_tac_engine_replay_reproduces_run);
+    RUN_TEST(test_tac_engine_replay_seek);
+    RUN_TEST(test_tac_engine_replay_invalid_logs);
+}
@@ -0,0 +1,265 @@
+//============================================================================//
+// test_tac_engine_snapshot.c - Unit tests for TAC engine snapshots
+//
+// Tests tac_engine_snapshot(), tac_engine_restore() and tac_engine_fork():
+// a restored or forked engine must continue exactly like the original
+// (same results, step counts and memory contents), state written after a
+// snapshot must not leak into it, slot types must come back with the
+// registers, memory pages must be shared until one side writes them, and
+// only the same program may restore a snapshot.
+//============================================================================//
+
+#include "../test_common.h"
+#include "../tac_test_builders.h"
+#include "tac_engine.h"
+#include "tac_engine_internal.h"
+
+//============================================================================//
+// TEST FUNCTION PROTOTYPES
+//============================================================================//
+
+void test_tac_engine_snapshot_restore(void);
+void test_tac_engine_snapshot_shares_pages(void);
+void test_tac_engine_snapshot_fork(void);
+void test_tac_engine_snapshot_slot_types(void);
+void test_tac_engine_snapshot_mismatch(void);
+void run_tac_engine_snapshot_tests(void);
+
+//============================================================================//
+// HELPERS
+//============================================================================//
+
+#define WORDS 2048              // Two pages of results
+#define PAUSE_STEPS 200         // Part way through the first page
+
+#define FILL_SIZE 13
+
+// v3[i] = i * i for i < WORDS, with v1 = i
+static void fill_program(TACInstruction code[FILL_SIZE]) {
+    const TACInstruction program[FILL_SIZE] = {
+        I(TAC_LABEL, L(1), NONE, NONE),
+        I(TAC_ASSIGN, V(1), K(0), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),
+        I(TAC_LT, T(1), V(1), K(WORDS)),
+        I(TAC_IF_FALSE, NONE, T(1), L(3)),
+        I(TAC_MUL, T(2), V(1), V(1)),
+        I(TAC_SHL, T(3), V(1), K(2)),
+        I(TAC_ADD, T(4), V(3), T(3)),
+        I(TAC_STORE, T(4), T(2), NONE),
+        I(TAC_ADD, V(1), V(1), K(1)),
+        I(TAC_GOTO, NONE, L(2), NONE),
+        I(TAC_LABEL, L(3), NONE, NONE),
+        I(TAC_RETURN, NONE, V(1), NONE),
+    };
+    memcpy(code, program, sizeof(program));
+}
+
+/**
+ * @brief Create an engine running fill_program()
+ *
+ * The array is allocated on the engine heap.
+ */
+static tac_engine_t* create_engine(uint32_t* base) {
+    TACInstruction code[FILL_SIZE];
+    fill_program(code);
+    tac_engine_config_t config = tac_engine_default_config();
+    tac_engine_t* engine = create_test_engine(&config, code, FILL_SIZE, 1);
+
+    *base = tac_engine_malloc(engine, WORDS * sizeof(int32_t));
+    TEST_ASSERT_TRUE(*base != 0);
+    tac_value_t array = tac_value_int32((int32_t)*base);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_set_var(engine, 3, &array));
+    return engine;
+}
+
+static void step_to_pause(tac_engine_t* engine) {
+    for (uint32_t i = 0; i < PAUSE_STEPS; i++) {
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_step(engine));
+    }
+    TEST_ASSERT_EQUAL(PAUSE_STEPS, tac_engine_get_step_count(engine));
+}
+
+static int32_t read_word(tac_engine_t* engine, uint32_t base, uint32_t index) {
+    int32_t value = -1;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK,
+                      tac_engine_mem_read(engine, base + index * 4, &value, sizeof(value)));
+    return value;
+}
+
+static int32_t read_var(tac_engine_t* engine, uint16_t id) {
+    tac_value_t value;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_var(engine, id, &value));
+    return value.data.i32;
+}
+
+/**
+ * @brief Run to the end and check the program finished with a full array
+ * @return Steps executed from the start of the program
+ */
+static uint32_t run_to_end(tac_engine_t* engine, uint32_t base) {
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_run(engine));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_FINISHED, tac_engine_get_state(engine));
+    TEST_ASSERT_EQUAL(WORDS, read_var(engine, 1));
+    TEST_ASSERT_EQUAL(0, read_word(engine, base, 0));
+    TEST_ASSERT_EQUAL(1000 * 1000, read_word(engine, base, 1000));
+    TEST_ASSERT_EQUAL((WORDS - 1) * (WORDS - 1), read_word(engine, base, WORDS - 1));
+    return tac_engine_get_step_count(engine);
+}
+
+//============================================================================//
+// SNAPSHOT TESTS
+//============================================================================//
+
+void test_tac_engine_snapshot_restore(void) {
+    uint32_t base = 0;
+    tac_engine_t* engine = create_engine(&base);
+    step_to_pause(engine);
+    int32_t paused_i = read_var(engine, 1);
+    TEST_ASSERT_TRUE(paused_i > 1 && paused_i < 1000);
+
+    tac_snapshot_t* snapshot = NULL;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_snapshot(engine, &snapshot));
+    TEST_ASSERT_NOT_NULL(snapshot);
+    uint32_t steps = run_to_end(engine, base);
+
+    // Every restore continues from the pause, with none of the later writes
+    for (int round = 0; round < 2; round++) {
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_restore(engine, snapshot));
+        TEST_ASSERT_EQUAL(PAUSE_STEPS, tac_engine_get_step_count(engine));
+        TEST_ASSERT_EQUAL(paused_i, read_var(engine, 1));
+        TEST_ASSERT_EQUAL(1, read_word(engine, base, 1));
+        TEST_ASSERT_EQUAL(0, read_word(engine, base, 1000));
+        TEST_ASSERT_EQUAL(steps, run_to_end(engine, base));
+    }
+
+    // Host writes after the snapshot are undone as well
+    int32_t marker = 12345;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_mem_write(engine, base, &marker, sizeof(marker)));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_restore(engine, snapshot));
+    TEST_ASSERT_EQUAL(0, read_word(engine, base, 0));
+
+    tac_engine_snapshot_free(snapshot);
+    tac_engine_destroy(engine);
+}
+
+void test_tac_engine_snapshot_shares_pages(void) {
+    uint32_t base = 0;
+    tac_engine_t* engine = create_engine(&base);
+    step_to_pause(engine);
+
+    uint32_t touched = 0;
+    uint32_t copied = 0;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_page_stats(engine, &touched, &copied));
+    TEST_ASSERT_EQUAL(1, touched);
+    TEST_ASSERT_EQUAL(0, copied);
+
+    // Taking a snapshot copies no pages; writing the shared page copies it once
+    tac_snapshot_t* snapshot = NULL;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_snapshot(engine, &snapshot));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_page_stats(engine, NULL, &copied));
+    TEST_ASSERT_EQUAL(0, copied);
+    run_to_end(engine, base);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_page_stats(engine, &touched, &copied));
+    TEST_ASSERT_EQUAL(1, copied);
+    TEST_ASSERT_TRUE(touched >= (WORDS * 4) / TAC_PAGE_SIZE);
+
+    // Restoring shares the snapshot's page again
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_restore(engine, snapshot));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_get_page_stats(engine, &touched, NULL));
+    TEST_ASSERT_EQUAL(1, touched);
+
+    tac_engine_snapshot_free(snapshot);
+    tac_engine_destroy(engine);
+}
+
+void test_tac_engine_snapshot_fork(void) {
+    uint32_t base = 0;
+    tac_engine_t* parent = create_engine(&base);
+    step_to_pause(parent);
+
+    tac_engine_t* child = tac_engine_fork(parent);
+    TEST_ASSERT_NOT_NULL(child);
+    TEST_ASSERT_EQUAL(PAUSE_STEPS, tac_engine_get_step_count(child));
+    TEST_ASSERT_EQUAL(read_var(parent, 1), read_var(child, 1));
+
+    // Writes on either side stay on that side
+    int32_t marker = 777;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK,
+                      tac_engine_mem_write(child, base + 4 * (WORDS - 1), &marker, sizeof(marker)));
+    uint32_t steps = run_to_end(parent, base);
+    TEST_ASSERT_EQUAL(777, read_word(child, base, WORDS - 1));
+    TEST_ASSERT_EQUAL(0, read_word(child, base, 1000));
+
+    // Destroying the parent leaves the child's memory intact
+    tac_engine_destroy(parent);
+    TEST_ASSERT_EQUAL(1, read_word(child, base, 1));
+    TEST_ASSERT_EQUAL(steps, run_to_end(child, base));
+    tac_engine_destroy(child);
+}
+
+void test_tac_engine_snapshot_slot_types(void) {
+    uint32_t base = 0;
+    tac_engine_t* engine = create_engine(&base);
+    step_to_pause(engine);
+    tac_snapshot_t* snapshot = NULL;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_snapshot(engine, &snapshot));
+    TEST_ASSERT_EQUAL(0, engine->dynamic_slots[0] & (1u << 5));
+
+    // A float widens v5; the restore brings back the int32 types in place
+    tac_value_t value = { .type = TAC_VALUE_FLOAT, .data.f32 = 1.5f };
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_set_var(engine, 5, &value));
+    TEST_ASSERT_TRUE((engine->dynamic_slots[0] & (1u << 5)) != 0);
+    const uint32_t* dynamic_slots = engine->dynamic_slots;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_restore(engine, snapshot));
+    TEST_ASSERT_TRUE(engine->dynamic_slots == dynamic_slots);
+    TEST_ASSERT_EQUAL(0, engine->dynamic_slots[0] & (1u << 5));
+    run_to_end(engine, base);
+
+    tac_engine_snapshot_free(snapshot);
+    tac_engine_destroy(engine);
+}
+
+void test_tac_engine_snapshot_mismatch(void) {
+    uint32_t base = 0;
+    tac_engine_t* engine = create_engine(&base);
+    tac_snapshot_t* snapshot = NULL;
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_snapshot(engine, &snapshot));
+
+    // An engine running another program cannot take the snapshot
+    const TACInstruction other[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),
+        I(TAC_RETURN, NONE, K(0), NONE),
+    };
+    tac_engine_config_t config = tac_engine_default_config();
+    tac_engine_t* stranger = tac_engine_create(&config);
+    TEST_ASSERT_NOT_NULL(stranger);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_load_code(stranger, other, 2));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_OPERAND, tac_engine_restore(stranger, snapshot));
+
+    // Nor can one whose program has the same size but another loop bound
+    TACInstruction twin_code[FILL_SIZE];
+    fill_program(twin_code);
+    twin_code[3].operand2 = K(WORDS - 1);
+    tac_engine_t* twin = create_test_engine(&config, twin_code, FILL_SIZE, 1);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_OPERAND, tac_engine_restore(twin, snapshot));
+    tac_engine_destroy(twin);
+
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_NULL_POINTER, tac_engine_restore(engine, NULL));
+    tac_engine_snapshot_free(NULL);
+
+    tac_engine_destroy(stranger);
+    tac_engine_snapshot_free(snapshot);
+    tac_engine_destroy(engine);
+}
+
+//============================================================================//
+// TEST RUNNER
+//============================================================================//
+
+void run_tac_engine_snapshot_tests(void) {
+    RUN_TEST(test_tac_engine_snapshot_restore);
+    RUN_TEST(test_tac_engine_snapshot_shares_pages);
+    RUN_TEST(test_tac_engine_snapshot_fork);
+    RUN_TEST(test_tac_engine_snapshot_slot_types);
+    RUN_TEST(test_tac_engine_snapshot_mismatch);
+}
@@ -0,0 +1,202 @@
+//============================================================================//
+// test_tac_engine_trace.c - Unit tests for TAC engine binary traces
+//
+// Writes traces with tac_engine_trace_to_file() and reads them back with
+// tac_trace_reader_next(). Every record must match what single-stepping a
+// second engine through the same program shows: one record per step, the
+// address executed, and the result value exactly when the step changed it.
+//============================================================================//
+
+#include "../test_common.h"
+#include "../tac_test_builders.h"
+#include "tac_engine.h"
+#include <unistd.h>
+
+//============================================================================//
+// TEST FUNCTION PROTOTYPES
+//============================================================================//
+
+void test_tac_engine_trace_round_trip(void);
+void test_tac_engine_trace_gap(void);
+void test_tac_engine_trace_invalid_files(void);
+void run_tac_engine_trace_tests(void);
+
+//============================================================================//
+// HELPERS
+//============================================================================//
+
+#define TRACE_FILE TEMP_PATH "test_temp_trace.bin"
+#define PROGRAM_SIZE 14
+
+// v2 = sum of i * 37 - 1000 over i < 50, with v1 = i; t3 repeats its value
+static void trace_program(TACInstruction code[PROGRAM_SIZE]) {
+    const TACInstruction program[PROGRAM_SIZE] = {
+        I(TAC_LABEL, L(1), NONE, NONE),
+        I(TAC_ASSIGN, V(1), K(0), NONE),
+        I(TAC_ASSIGN, V(2), K(0), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),
+        I(TAC_LT, T(1), V(1), K(50)),
+        I(TAC_IF_FALSE, NONE, T(1), L(3)),
+        I(TAC_MUL, T(2), V(1), K(37)),
+        I(TAC_SUB, T(2), T(2), K(1000)),
+        I(TAC_ASSIGN, T(3), K(5), NONE),
+        I(TAC_ADD, V(2), V(2), T(2)),
+        I(TAC_ADD, V(1), V(1), K(1)),
+        I(TAC_GOTO, NONE, L(2), NONE),
+        I(TAC_LABEL, L(3), NONE, NONE),
+        I(TAC_RETURN, NONE, V(2), NONE),
+    };
+    memcpy(code, program, sizeof(program));
+}
+
+static tac_engine_t* create_engine(tac_engine_exec_mode_t mode) {
+    TACInstruction code[PROGRAM_SIZE];
+    trace_program(code);
+    tac_engine_config_t config = tac_engine_default_config();
+    config.exec_mode = mode;
+    return create_test_engine(&config, code, PROGRAM_SIZE, 1);
+}
+
+// Value of the slot an instruction writes, or false if it writes none
+static bool result_slot(tac_engine_t* engine, const TACInstruction* inst, tac_value_t* value) {
+    if (inst->result.type == TAC_OP_TEMP) {
+        return tac_engine_get_temp(engine, inst->result.data.variable.id, value) == TAC_ENGINE_OK;
+    }
+    if (inst->result.type == TAC_OP_VAR) {
+        return tac_engine_get_var(engine, inst->result.data.variable.id, value) == TAC_ENGINE_OK;
+    }
+    return false;
+}
+
+static bool same_value(const tac_value_t* a, const tac_value_t* b) {
+    return a->type == b->type && a->data.u32 == b->data.u32;
+}
+
+/**
+ * @brief Check a trace against single-stepping a fresh engine
+ * @param first_step Step the trace started at; the reference steps there silently
+ * @return Records read
+ */
+static uint32_t expect_trace_matches(uint32_t first_step) {
+    TACInstruction code[PROGRAM_SIZE];
+    trace_program(code);
+    tac_engine_t* reference = create_engine(TAC_EXEC_INTERPRET);
+    for (uint32_t i = 0; i < first_step; i++) {
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_step(reference));
+    }
+
+    tac_trace_reader_t* reader = tac_trace_reader_open(TRACE_FILE);
+    TEST_ASSERT_NOT_NULL(reader);
+
+    uint32_t records = 0;
+    tac_trace_record_t record;
+    tac_engine_error_t err;
+    while ((err = tac_trace_reader_next(reader, &record)) == TAC_ENGINE_OK) {
+        uint32_t pc = tac_engine_get_pc(reference);
+        TEST_ASSERT_TRUE(pc < PROGRAM_SIZE);
+        TEST_ASSERT_EQUAL(first_step + records, record.step);
+        TEST_ASSERT_EQUAL(pc, record.address);
+
+        tac_value_t before;
+        tac_value_t after;
+        bool writes = result_slot(reference, &code[pc], &before);
+        tac_engine_step(reference);
+        if (writes) {
+            TEST_ASSERT_TRUE(result_slot(reference, &code[pc], &after));
+            TEST_ASSERT_EQUAL(!same_value(&before, &after), record.changed);
+            if (record.changed) {
+                TEST_ASSERT_TRUE(same_value(&after, &record.value));
+            }
+        } else {
+            TEST_ASSERT_TRUE(!record.changed);
+        }
+        records++;
+    }
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_NOT_FOUND, err);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_FINISHED, tac_engine_get_state(reference));
+
+    tac_trace_reader_close(reader);
+    tac_engine_destroy(reference);
+    return records;
+}
+
+//============================================================================//
+// TRACE TESTS
+//============================================================================//
+
+void test_tac_engine_trace_round_trip(void) {
+    // Tracing takes over from every mode, the JIT included
+    const tac_engine_exec_mode_t modes[] = { TAC_EXEC_INTERPRET, TAC_EXEC_JIT };
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        tac_engine_t* engine = create_engine(modes[m]);
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_trace_to_file(engine, TRACE_FILE));
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_run(engine));
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_trace_stop(engine));
+
+        uint32_t steps = tac_engine_get_step_count(engine);
+        TEST_ASSERT_TRUE(steps > 400);
+        TEST_ASSERT_EQUAL(steps, expect_trace_matches(0));
+        tac_engine_destroy(engine);
+    }
+}
+
+void test_tac_engine_trace_gap(void) {
+    // A trace opened part way starts with the absolute step number
+    tac_engine_t* engine = create_engine(TAC_EXEC_INTERPRET);
+    for (int i = 0; i < 17; i++) {
+        TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_step(engine));
+    }
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_trace_to_file(engine, TRACE_FILE));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_run(engine));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_trace_stop(engine));
+    TEST_ASSERT_EQUAL(tac_engine_get_step_count(engine) - 17, expect_trace_matches(17));
+
+    // Stopping twice is harmless
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_trace_stop(engine));
+    tac_engine_destroy(engine);
+}
+
+void test_tac_engine_trace_invalid_files(void) {
+    tac_trace_record_t record;
+
+    // Missing file and foreign content
+    remove(TRACE_FILE);
+    TEST_ASSERT_TRUE(tac_trace_reader_open(TRACE_FILE) == NULL);
+    FILE* file = fopen(TRACE_FILE, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    fputs("not a trace file", file);
+    fclose(file);
+    TEST_ASSERT_TRUE(tac_trace_reader_open(TRACE_FILE) == NULL);
+
+    // An empty trace has no records
+    tac_engine_t* engine = create_engine(TAC_EXEC_INTERPRET);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_trace_to_file(engine, TRACE_FILE));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_trace_stop(engine));
+    tac_trace_reader_t* reader = tac_trace_reader_open(TRACE_FILE);
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_NOT_FOUND, tac_trace_reader_next(reader, &record));
+    tac_trace_reader_close(reader);
+
+    // A record cut after its head (the first carries a step number) is corrupt
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_trace_to_file(engine, TRACE_FILE));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_run(engine));
+    TEST_ASSERT_EQUAL(TAC_ENGINE_OK, tac_engine_trace_stop(engine));
+    TEST_ASSERT_EQUAL(0, truncate(TRACE_FILE, 9));
+    reader = tac_trace_reader_open(TRACE_FILE);
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT_EQUAL(TAC_ENGINE_ERR_INVALID_OPERAND, tac_trace_reader_next(reader, &record));
+    tac_trace_reader_close(reader);
+
+    tac_engine_destroy(engine);
+    remove(TRACE_FILE);
+}
+
+//============================================================================//
+// TEST RUNNER
+//============================================================================//
+
+void run_tac_engine_trace_tests(void) {
+    RUN_TEST(test_tac_engine_trace_round_trip);
+    RUN_TEST(test_tac_engine_trace_gap);
+    RUN_TEST(test_tac_engine_trace_invalid_files);
+}
@@ -0,0 +1,164 @@
+//============================================================================//
+// test_tac_stats.c - Unit tests for TAC program statistics
+//
+// Tests the single-pass statistics of tac_stats (function detection in
+// particular) on hand-built instruction arrays and on cc2 output, and the
+// JSON report of cc2t --json.
+//============================================================================//
+
+#include "../test_common.h"
+#include "../tac_test_builders.h"
+#include "../../src/ir/tac_stats.h"
+#include "../../src/ir/tac_types.h"
+
+//============================================================================//
+// TEST FUNCTION PROTOTYPES
+//============================================================================//
+
+void test_tac_stats_functions_with_branches(void);
+void test_tac_stats_functions_of_compiled_program(void);
+void test_tac_stats_cc2t_json(void);
+void run_tac_stats_tests(void);
+
+//============================================================================//
+// HELPERS
+//============================================================================//
+
+// Program with if and while whose inner labels no branch jumps to
+static const char* branchy_program =
+    "int is_odd(int p) {\n"
+    "    if (p < 1) {\n"
+    "        return 0;\n"
+    "    }\n"
+    "    int d = p;\n"
+    "    while (d > 1) {\n"
+    "        d = d - 2;\n"
+    "    }\n"
+    "    return d;\n"
+    "}\n"
+    "\n"
+    "int main() {\n"
+    "    int n = 0;\n"
+    "    int count = 0;\n"
+    "    while (n < 10) {\n"
+    "        count = count + is_odd(n);\n"
+    "        n = n + 1;\n"
+    "    }\n"
+    "    return count;\n"
+    "}";
+
+/**
+ * @brief Compile a program with cc0, cc1 and cc2 into TEMP_PATH "test_stats_tac.out"
+ */
+static void compile_branchy_program(void) {
+    char* input_file = create_temp_file(branchy_program);
+    char sstore_file[] = TEMP_PATH "test_stats_sstore.out";
+    char tokens_file[] = TEMP_PATH "test_stats_tokens.out";
+    char ast_file[] = TEMP_PATH "test_stats_ast.out";
+    char sym_file[] = TEMP_PATH "test_stats_sym.out";
+    char tac_file[] = TEMP_PATH "test_stats_tac.out";
+    char tac_listing[] = TEMP_PATH "test_stats.tac";
+
+    char* lexer_outputs[] = {sstore_file, tokens_file};
+    TEST_ASSERT_EQUAL(0, run_compiler_stage("cc0", input_file, lexer_outputs));
+    char* parser_outputs[] = {sstore_file, tokens_file, ast_file, sym_file};
+    TEST_ASSERT_EQUAL(0, run_compiler_stage("cc1", NULL, parser_outputs));
+    char* tac_outputs[] = {sstore_file, tokens_file, ast_file, sym_file, tac_file, tac_listing};
+    TEST_ASSERT_EQUAL(0, run_compiler_stage("cc2", NULL, tac_outputs));
+    TEST_ASSERT_FILE_EXISTS(tac_file);
+}
+
+//============================================================================//
+// FUNCTION DETECTION TESTS
+//============================================================================//
+
+void test_tac_stats_functions_with_branches(void) {
+    // L1: f(p)  if_false t1 goto L2; return 0; L2: L3: (loop head, never jumped)
+    //           ... return p;  L4: main  L5: (never jumped) t2 = call L1; return t2
+    TACInstruction code[] = {
+        I(TAC_LABEL, L(1), NONE, NONE),
+        I(TAC_LT, T(1), V(1), K(2)),
+        I(TAC_IF_FALSE, NONE, T(1), L(2)),
+        I(TAC_RETURN, NONE, K(0), NONE),
+        I(TAC_LABEL, L(2), NONE, NONE),
+        I(TAC_LABEL, L(3), NONE, NONE),
+        I(TAC_RETURN, NONE, V(1), NONE),
+        I(TAC_LABEL, L(4), NONE, NONE),
+        I(TAC_LABEL, L(5), NONE, NONE),
+        I(TAC_PARAM, NONE, K(7), NONE),
+        I(TAC_CALL, T(2), L(1), K(1)),
+        I(TAC_RETURN, NONE, T(2), NONE),
+    };
+    TACStats stats;
+    TEST_ASSERT_EQUAL(0, tac_stats_compute(code, sizeof(code) / sizeof(code[0]), &stats));
+
+    TEST_ASSERT_EQUAL(2, stats.function_count);
+    TEST_ASSERT_EQUAL(1, stats.functions[0].label);
+    TEST_ASSERT_EQUAL(0, stats.functions[0].start);
+    TEST_ASSERT_EQUAL(7, stats.functions[0].size);
+    TEST_ASSERT_EQUAL(1, stats.functions[0].calls);
+    TEST_ASSERT_EQUAL(4, stats.functions[1].label);
+    TEST_ASSERT_EQUAL(7, stats.functions[1].start);
+    TEST_ASSERT_EQUAL(5, stats.functions[1].size);
+    TEST_ASSERT_EQUAL(0, stats.functions[1].calls);
+    tac_stats_free(&stats);
+}
+
+void test_tac_stats_functions_of_compiled_program(void) {
+    compile_branchy_program();
+
+    TACStats stats;
+    TEST_ASSERT_EQUAL(0, tac_stats_compute_file(TEMP_PATH "test_stats_tac.out", &stats));
+    TEST_ASSERT_EQUAL_MESSAGE(2, stats.function_count,
+                                     "if/while labels must not open functions");
+    TEST_ASSERT_EQUAL(0, stats.functions[0].start);
+    TEST_ASSERT_EQUAL(1, stats.functions[0].calls);
+    TEST_ASSERT_EQUAL(stats.instruction_count,
+                             stats.functions[0].size + stats.functions[1].size);
+    tac_stats_free(&stats);
+}
+
+//============================================================================//
+// CC2T JSON TESTS
+//============================================================================//
+
+void test_tac_stats_cc2t_json(void) {
+    compile_branchy_program();
+
+    TEST_ASSERT_EQUAL(0, system("timeout 10s ./bin/cc2t --json " TEMP_PATH "test_stats_tac.out > "
+                                TEMP_PATH "test_stats.json"));
+    char* json = read_file_content(TEMP_PATH "test_stats.json");
+    TEST_ASSERT_NOT_NULL(json);
+
+    TACStats stats;
+    TEST_ASSERT_EQUAL(0, tac_stats_compute_file(TEMP_PATH "test_stats_tac.out", &stats));
+    char expected[64];
+    snprintf(expected, sizeof(expected), "\"instructions\": %u,", stats.instruction_count);
+    TEST_ASSERT_STRING_CONTAINS(json, expected);
+    tac_stats_free(&stats);
+
+    TEST_ASSERT_EQUAL('{', json[0]);
+    TEST_ASSERT_STRING_CONTAINS(json, "\"opcodes\": {");
+    TEST_ASSERT_STRING_CONTAINS(json, "\"def_use\": {");
+
+    // One object per function in the functions array
+    const char* functions = strstr(json, "\"functions\": [");
+    TEST_ASSERT_NOT_NULL(functions);
+    int entries = 0;
+    for (const char* p = functions; (p = strstr(p, "{\"label\": ")) != NULL; p++) {
+        entries++;
+    }
+    TEST_ASSERT_EQUAL(2, entries);
+    TEST_ASSERT_STRING_CONTAINS(functions, "{\"label\": 1, \"start\": 0, ");
+    free(json);
+}
+
+//============================================================================//
+// TEST RUNNER
+//============================================================================//
+
+void run_tac_stats_tests(void) {
+    RUN_TEST(test_tac_stats_functions_with_branches);
+    RUN_TEST(test_tac_stats_functions_of_compiled_program);
+    RUN_TEST(test_tac_stats_cc2t_json);
+}